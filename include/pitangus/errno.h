@@ -34,5 +34,6 @@
 #define ESEFAZ		9;
 #define EIDNFOUND	10;
 #define EINVFIELD	11;
+#define EARCHIVED	12;
 
 #endif
@@ -49,6 +49,12 @@ extern char *gen_lote_xml(LOTE *, EVP_PKEY *key, X509 *cert);
  */
 extern char *gen_lote_evento_xml(LOTE_EVENTO *, EVP_PKEY *key, X509 *cert);
 
+/**
+ * This function generates the signed XML asking to void a range of NF
+ * numbers, filling its id
+ */
+extern char *gen_inut_xml(INUTILIZACAO *, EVP_PKEY *key, X509 *cert);
+
 /**
  * XML for consulting service status
  */
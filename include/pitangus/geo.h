@@ -0,0 +1,106 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef	GEO_H
+#define	GEO_H
+
+#include <pitangus/libsped.h>
+#include <stddef.h>
+
+/*
+ * Tabela geográfica do IBGE compilada na biblioteca. As entradas são
+ * compartilhadas e somente leitura: ENDERECO e IDNFE apontam para elas
+ * e nunca as liberam.
+ */
+
+/**
+ * geo_municipio_nenhum:
+ *
+ * Município vazio (código 0, país Brasil) usado antes de escolher um
+ * município
+ */
+extern const MUNICIPIO geo_municipio_nenhum;
+
+/**
+ * geo_pais:
+ *
+ * Retorna o país (Brasil)
+ */
+extern const PAIS *geo_pais(void);
+
+/**
+ * geo_uf:
+ * @cUF: Código IBGE da UF
+ *
+ * Retorna a UF de código @cUF ou NULL
+ */
+extern const UF *geo_uf(unsigned int cUF);
+
+/**
+ * geo_uf_sigla:
+ * @sigla: Sigla da UF
+ *
+ * Retorna a UF de sigla @sigla ou NULL
+ */
+extern const UF *geo_uf_sigla(const char *sigla);
+
+/**
+ * geo_municipio:
+ * @cMun: Código IBGE do município
+ *
+ * Busca o município pelo código em tempo constante
+ *
+ * Returns: o município ou NULL se o código não existir
+ */
+extern const MUNICIPIO *geo_municipio(unsigned int cMun);
+
+/**
+ * geo_municipio_ou_nenhum:
+ * @cMun: Código IBGE do município
+ *
+ * Como geo_municipio(), mas retorna &geo_municipio_nenhum quando o
+ * código não existir
+ */
+extern const MUNICIPIO *geo_municipio_ou_nenhum(unsigned int cMun);
+
+/**
+ * geo_municipio_n:
+ * @n: Posição na tabela
+ *
+ * Percorre a tabela inteira, em ordem de código IBGE
+ *
+ * Returns: o @n-ésimo município ou NULL depois do último
+ */
+extern const MUNICIPIO *geo_municipio_n(size_t n);
+
+/**
+ * geo_buscar_municipios:
+ * @prefixo: Início do nome, sem diferenciar maiúsculas nem acentos
+ * @cUF: Limita a busca à UF ou 0 para todas
+ * @res: Vetor com @max posições para os resultados
+ * @max: Quantidade máxima de resultados
+ *
+ * Busca municípios pelo início do nome, em ordem alfabética
+ *
+ * Returns: quantidade de municípios escritos em @res
+ */
+extern size_t geo_buscar_municipios(const char *prefixo, unsigned int cUF,
+		const MUNICIPIO **res, size_t max);
+
+#endif
@@ -177,6 +177,14 @@ extern const char *SEFAZ_WSDL[7];
 
 typedef int evento_t;
 
+/**
+ * ARENA:
+ *
+ * Região de memória de onde os objetos de uma NF podem ser alocados e
+ * liberados de uma só vez (ver new_arena())
+ */
+typedef struct ARENA ARENA;
+
 /**
  * PAIS:
  * @cPais: Código do país
@@ -195,12 +203,12 @@ typedef struct pais_t{
  * @xUF: Nome da UF
  * @pais: Pais
  *
- * País
+ * UF. As UFs vêm da tabela compartilhada de geo.h.
  */
 typedef struct uf_t{
 	const char *xUF;
 	unsigned int cUF;
-	PAIS *pais;
+	const PAIS *pais;
 } UF;
 
 /**
@@ -209,12 +217,13 @@ typedef struct uf_t{
  * @cMun: Código IBGE do municício 
  * @uf: UF
  *
- * Informação do Município
+ * Informação do Município. Os municípios vêm da tabela compartilhada
+ * de geo.h e não pertencem a quem aponta para eles.
  */
 typedef struct municipio_t{
 	const char *xMun;
 	unsigned int cMun;
-	UF *uf;
+	const UF *uf;
 } MUNICIPIO;
 
 /**
@@ -234,7 +243,7 @@ typedef struct endereco_t{
 	const char *Cpl;
 	const char *xBairro;
 	unsigned int CEP;
-	MUNICIPIO *municipio;
+	const MUNICIPIO *municipio;
 } ENDERECO;
 
 /**
@@ -264,7 +273,7 @@ typedef struct endereco_t{
  * Identificação da Nota Fiscal Eletrônica
  */
 typedef struct {
-	MUNICIPIO *municipio;
+	const MUNICIPIO *municipio;
 	unsigned int id_nfe;
 	const char *nat_op;
 	indPag  ind_pag;
@@ -434,7 +443,7 @@ typedef struct ITEM ITEM;
  * @ordem: Ordem do item
  * @quantidade: Quantidade de produtos do item
  * @valor: Valor do item
- * @pointer: Pointer to next item
+ * @arena: Arena de onde o item foi alocado ou NULL
  *
  * Item da NF
  */
@@ -444,7 +453,7 @@ struct ITEM {
 	unsigned int ordem;
 	unsigned int quantidade;
 	double valor;
-	ITEM *pointer; //next item
+	ARENA *arena;
 };
 
 /**
@@ -480,8 +489,11 @@ typedef struct {
  * @idnfe: Identificação da NF
  * @emitente: Emitente da NF
  * @destinatario: Destinatário da NF
- * @itens: Itens da NF
+ * @itens: Itens da NF, na ordem (itens[i]->ordem == i + 1)
  * @q_itens: Quantidade de itens da NF
+ * @cap_itens: Capacidade alocada em @itens e nos vetores paralelos
+ * @itens_quantidade: Quantidade de cada item, paralelo a @itens
+ * @itens_valor: Valor unitário de cada item, paralelo a @itens
  * @total: Valor total da NF
  * @transp: Transportadora NF
  * @protocolo: Protocolo de emissão da NF
@@ -489,6 +501,7 @@ typedef struct {
  * @canceled: Flag de NF cancelada
  * @inf_ad_fisco: Informação adicional para o fisco
  * @inf_ad_contrib: Informação adicional para o contribuinte 
+ * @arena: Arena de onde a NF foi alocada ou NULL
  *
  * Nota fiscal eletrónica
  */
@@ -496,8 +509,11 @@ typedef struct {
 	IDNFE *idnfe;
 	EMITENTE *emitente;
 	DESTINATARIO *destinatario;
-	ITEM *itens;
+	ITEM **itens;
 	unsigned int q_itens;
+	unsigned int cap_itens;
+	double *itens_quantidade;
+	double *itens_valor;
 	double total;
 	TRANSP *transp;
 	PROTOCOLO *protocolo;
@@ -505,6 +521,7 @@ typedef struct {
 	int canceled;
 	const char *inf_ad_fisco;
 	const char *inf_ad_contrib;
+	ARENA *arena;
 } NFE;
 
 typedef struct LOTE_ITEM LOTE_ITEM;
@@ -527,6 +544,7 @@ struct LOTE_ITEM{
  * @recibo: Recibo do lote
  * @qtd: Quantidade de itens do lote
  * @nfes: Itens do lote
+ * @ultimo: Último item do lote
  * @xml_response: XML de resposta do lote
  *
  * Lote de envio de NFs para o SEFAZ
@@ -536,6 +554,7 @@ typedef struct {
 	const char *recibo;
 	unsigned int qtd;
 	LOTE_ITEM *nfes;
+	LOTE_ITEM *ultimo;
 	const char *xml_response;
 } LOTE;
 
@@ -600,6 +619,7 @@ struct LOTE_EVENTO_ITEM {
  * @recibo: Recibo do lote de eventos
  * @qtd: Quantidade de eventos do lote
  * @eventos: Itens de lote de eventos
+ * @ultimo: Último item do lote de eventos
  * @xml_response: Resposta XML do lote de eventos
  *
  * Item de lote de eventos
@@ -609,8 +629,45 @@ typedef struct {
 	const char *recibo;
 	unsigned int qtd;
 	LOTE_EVENTO_ITEM *eventos;
+	LOTE_EVENTO_ITEM *ultimo;
 	const char *xml_response;
 } LOTE_EVENTO;
 
+/**
+ * INUTILIZACAO:
+ * @id: Id do pedido (ID, cUF, ano, CNPJ, modelo, série e faixa)
+ * @emitente: Emitente dos números
+ * @tipo_ambiente: Ambiente do pedido
+ * @ano: Ano do pedido, dois dígitos
+ * @mod: Modelo das NFs
+ * @serie: Série das NFs
+ * @num_ini: Primeiro número da faixa
+ * @num_fim: Último número da faixa
+ * @justificativa: Justificativa, de 15 a 255 caracteres
+ * @cStat: Código de status da resposta
+ * @xmot: xMotivo da resposta
+ * @protocolo: Protocolo da inutilização
+ * @xml: XML assinado do pedido
+ * @xml_response: XML de resposta
+ *
+ * Pedido de inutilização de uma faixa de números de NF
+ */
+typedef struct {
+	const char *id;
+	EMITENTE *emitente;
+	int tipo_ambiente;
+	int ano;
+	Mod mod;
+	int serie;
+	unsigned int num_ini;
+	unsigned int num_fim;
+	const char *justificativa;
+	int cStat;
+	const char *xmot;
+	const char *protocolo;
+	const char *xml;
+	const char *xml_response;
+} INUTILIZACAO;
+
 
 #endif
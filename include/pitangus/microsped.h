@@ -44,6 +44,19 @@ extern "C" {
 #include <microxml.h>
 #include <microutils.h>
 
+/*
+ * Modelo de concorrência:
+ *
+ * - msped_inicializar() e msped_finalizar() são contadas por referência e podem ser chamadas de qualquer thread,
+ *   desde que cada msped_inicializar() tenha seu msped_finalizar() correspondente;
+ * - um objeto `msped_cfg` é imutável depois de criado e pode ser compartilhado entre threads, desde que não seja
+ *   liberado enquanto houver chamadas em andamento;
+ * - o estado temporário (contextos XPath, handles cURL, buffers) é criado por chamada, nunca no objeto compartilhado;
+ * - objetos `msped_lote` e documentos _XML_ passados às funções pertencem a uma única thread por vez;
+ * - os callbacks de erro são chamados na thread que originou o erro, com uma mensagem em buffer local, portanto só
+ *   precisam ser sincronizados se compartilharem estado próprio.
+ */
+
 // web service
 
 /**
@@ -296,11 +309,13 @@ typedef bool (*msped_atribuir_prot_msg_callback)(void *cls, void *doc_retornado)
 
 /**
  * \brief Inicializa bilioteca e suas dependências.
+ * \note Somente a primeira chamada inicializa as dependências; as demais apenas incrementam o contador de uso.
  */
 MSPED_EXTERN void msped_inicializar();
 
 /**
  * \brief Finaliza bilioteca e suas dependências.
+ * \note As dependências são finalizadas somente quando o contador de uso chega a zero.
  */
 MSPED_EXTERN void msped_finalizar();
 
@@ -444,7 +459,7 @@ MSPED_EXTERN void msped_lote_liberar(struct msped_lote *lote);
 MSPED_EXTERN bool msped_lote_ok(struct msped_lote *lote);
 
 /**
- * \brief Adiciona arquivo como item de lote.
+ * \brief Adiciona arquivo como item de lote. O arquivo é mapeado em memória no momento da adição.
  * \param lote Objeto de tipo lote.
  * \param arquivo_xml Arquivo a ser adicionado.
  * \param erro_cb Callback para tratar erros.
@@ -454,6 +469,37 @@ MSPED_EXTERN bool msped_lote_ok(struct msped_lote *lote);
 MSPED_EXTERN bool msped_lote_arquivo_adicionar(struct msped_lote *lote, const char *arquivo_xml,
                                                msped_erro_callback erro_cb, void *erro_cls);
 
+/**
+ * \brief Adiciona _XML_ assinado em memória como item de lote.
+ * \param lote Objeto de tipo lote.
+ * \param xml Conteúdo _XML_ assinado da nota.
+ * \param tamanho Tamanho do conteúdo _XML_ ou 0 para calculá-lo com _strlen_.
+ * \param copiar **true** para copiar o conteúdo ou **false** para apenas referenciá-lo.
+ * \param erro_cb Callback para tratar erros.
+ * \param erro_cls Classe para ser passada ao callback de erros.
+ * \return **true** se _XML_ adicionado com sucesso e **false** caso atingido limite máximo de itens ou de tamanho
+ * do lote.
+ * \warning Quando \p copiar for **false**, o chamador da função **deve** manter \p xml válido até liberar o lote.
+ */
+MSPED_EXTERN bool msped_lote_xml_adicionar(struct msped_lote *lote, const char *xml, size_t tamanho, bool copiar,
+                                           msped_erro_callback erro_cb, void *erro_cls);
+
+/**
+ * \brief Obtém conteúdo _XML_ por indice de item de lote.
+ * \param lote Objeto de tipo lote.
+ * \param indice Indice do item.
+ * \param tamanho Ponteiro para receber o tamanho do conteúdo ou **NULL** se não usado.
+ * \return Conteúdo _XML_ do item (não terminado em _0-null_) ou **NULL** caso não exista para indice informado.
+ */
+MSPED_EXTERN const char *msped_lote_xml_obter_por_indice(struct msped_lote *lote, uint8_t indice, size_t *tamanho);
+
+/**
+ * \brief Obtém a soma dos tamanhos dos _XMLs_ adicionados em um lote.
+ * \param lote Instância de objeto lote.
+ * \return Tamanho em bytes.
+ */
+MSPED_EXTERN size_t msped_lote_tamanho(struct msped_lote *lote);
+
 /**
  * \brief Obtém arquivo por indice de item de lote.
  * \param lote Objeto de tipo lote.
@@ -492,12 +538,32 @@ MSPED_EXTERN char *msped_doc_obter_chave(void *doc, const char *tag);
 MSPED_EXTERN bool msped_qrcode_acrescentar(struct msped_cfg *cfg, void *xml_doc,
                                            msped_erro_callback erro_cb, void *erro_cls);
 
+/**
+ * \brief Acrescenta QR Code em várias instâncias de objeto _XML_ de NFC-e assinadas, distribuindo os documentos
+ * entre threads.
+ * \param cfg Objeto de configuração.
+ * \param xml_docs Instâncias de objeto _XML_ com o conteúdo dos documentos fiscais.
+ * \param quantidade Quantidade de documentos em \p xml_docs.
+ * \param threads Quantidade de threads ou 0 para usar a quantidade de processadores.
+ * \param resultados Vetor com \p quantidade posições para receber o resultado de cada documento ou **NULL** se não
+ * usado.
+ * \param erro_cb Callback para tratar erros.
+ * \param erro_cls Classe para ser passada ao callback de erros.
+ * \return **true** se atribuído em todos os documentos e **false** em caso contrário.
+ * \note Cada documento é percorrido uma única vez e cada thread reutiliza seu contexto de _SHA-1_. O callback de erros
+ * pode ser chamado a partir de qualquer uma das threads. Os documentos não podem ser usados por outras threads durante
+ * a chamada.
+ */
+MSPED_EXTERN bool msped_qrcode_lote_acrescentar(struct msped_cfg *cfg, void **xml_docs, size_t quantidade,
+                                                unsigned int threads, bool *resultados,
+                                                msped_erro_callback erro_cb, void *erro_cls);
+
 /**
  * \brief Envia lote de notas fiscais.
  * \param cfg Objeto de configuração.
  * \param lote Objeto lote.
  * \param processo Tipo de processo (síncrono/assíncrono).
- * \param lote_gera_id_cb Callback para gerar ID do lote.
+ * \param lote_gera_id_cb Callback para gerar ID do lote ou **NULL** para usar ::msped_lote_id_gerar.
  * \param lote_gera_id_cls Classe para ser passado ao callback de geração de ID do lote.
  * \param http_escrita_cb Callback para escrita de dados HTTP retornados pelo servidor de web service.
  * \param http_escrita_cls Classe a ser passada para o callback de escrita HTTP.
@@ -558,7 +624,7 @@ MSPED_EXTERN char *msped_atribuir_prot_msg(const char *tagproc, const char *tagm
  * \param n_seq_evento Sequencial do evento para o mesmo tipo de evento.
  * \param assin_msg_cb Callback para assinatura de mensagem.
  * \param assin_msg_cls Classe para ser passada ao callback de assinatura de mensagem.
- * \param lote_gera_id_cb Callback para geração de ID de lote.
+ * \param lote_gera_id_cb Callback para geração de ID de lote ou **NULL** para usar ::msped_lote_id_gerar.
  * \param lote_gera_id_cls Classe a ser passada para o callback de geração de ID de lote.
  * \param http_escrita_cb Callback para escrita de dados HTTP retornados pelo servidor de web service.
  * \param http_escrita_cls Classe a ser passada para o callback de escrita HTTP.
@@ -586,7 +652,7 @@ MSPED_EXTERN bool msped_enviar_evento_cce(struct msped_cfg *cfg, enum MSPED_DOC_
  * \param n_prot Número do Protocolo de Autorização do Documento a ser Cancelado.
  * \param assin_msg_cb Callback para assinatura de mensagem.
  * \param assin_msg_cls Classe para ser passada ao callback de assinatura de mensagem.
- * \param lote_gera_id_cb Callback para geração de ID de lote.
+ * \param lote_gera_id_cb Callback para geração de ID de lote ou **NULL** para usar ::msped_lote_id_gerar.
  * \param lote_gera_id_cls Classe a ser passada para o callback de geração de ID de lote.
  * \param http_escrita_cb Callback para escrita de dados HTTP retornados pelo servidor de web service.
  * \param http_escrita_cls Classe a ser passada para o callback de escrita HTTP.
@@ -768,9 +834,35 @@ MSPED_EXTERN enum MSPED_NF_MODELO msped_str_para_modelo(const char *str);
  * \brief Validação de chave usando regra _[0-9]{44}_ estraída do arquivo _XSD_ da _SEFAZ_.
  * \param chave Chave em questão.
  * \return **true** se válida e **false** se inválida.
+ * \note Não verifica o dígito verificador, veja ::msped_validar_chave_dv.
  */
 MSPED_EXTERN bool msped_validar_chave(const char *chave);
 
+/**
+ * \brief Calcula o dígito verificador (módulo 11) dos 43 primeiros dígitos de uma chave.
+ * \param chave Chave com pelo menos 43 dígitos.
+ * \return Dígito verificador como caractere ('0' a '9') ou **'\0'** se houver caractere não numérico.
+ * \note Não aloca memória.
+ */
+MSPED_EXTERN char msped_calcular_dv_chave(const char *chave);
+
+/**
+ * \brief Validação de chave incluindo o dígito verificador, em uma única passada.
+ * \param chave Chave em questão.
+ * \return **true** se tiver 44 dígitos e dígito verificador correto e **false** em caso contrário.
+ * \note Não aloca memória.
+ */
+MSPED_EXTERN bool msped_validar_chave_dv(const char *chave);
+
+/**
+ * \brief Valida um lote de chaves com ::msped_validar_chave_dv.
+ * \param chaves Vetor de chaves.
+ * \param qtd Quantidade de chaves.
+ * \param resultados Vetor opcional com \p qtd posições para o resultado de cada chave.
+ * \return Quantidade de chaves válidas.
+ */
+MSPED_EXTERN size_t msped_validar_chaves(const char *const *chaves, size_t qtd, bool *resultados);
+
 /**
  * \brief Gera ID de lote com suporte a atraso informado em microsegundos.
  * \param id ID sequencial com 15 caracteres.
@@ -780,12 +872,43 @@ MSPED_EXTERN bool msped_validar_chave(const char *chave);
 MSPED_EXTERN void msped_gerar_id_lote_sleep(char *id, useconds_t usegs);
 
 /**
- * \brief Gera ID de lote com atraso de 100000 microsegundos.
+ * \brief Gera ID de lote sem atraso, usando ::msped_lote_id_gerar.
  * \param id ID sequencial com 15 caracteres.
  * \note Esta função é thread-safe.
  */
 MSPED_EXTERN void msped_gerar_id_lote(char *id);
 
+/**
+ * \brief Define o discriminador de nó (0 a 99) usado por ::msped_lote_id_gerar. Por padrão é usado o PID do
+ * processo módulo 100.
+ * \param no Discriminador do nó, por exemplo, o número da instância ou do servidor.
+ * \note Processos que emitem para o mesmo CNPJ devem usar discriminadores diferentes.
+ */
+MSPED_EXTERN void msped_lote_id_no_definir(uint8_t no);
+
+/**
+ * \brief Define o arquivo de estado usado por ::msped_lote_id_gerar. Por padrão é usada a variável de ambiente
+ * _MSPED_LOTE_ID_ARQUIVO_ ou, na falta dela, _msped_lote_id_UID_ no diretório temporário (UID do usuário).
+ * \param caminho Caminho do arquivo ou **NULL** para voltar ao padrão.
+ * \note Deve ser chamada antes do primeiro lote. Processos que compartilham o arquivo nunca repetem IDs entre si,
+ * mesmo com o mesmo discriminador de nó.
+ */
+MSPED_EXTERN void msped_lote_id_arquivo_definir(const char *caminho);
+
+/**
+ * \brief Gera ID numérico de lote com até 15 dígitos, sem atraso. Callback padrão de geração de ID de lote.
+ * \param cls Não utilizado.
+ * \return ID do lote no formato _SSSSSSSSSSNNCCC_: segundos desde 2017-01-01 (10 dígitos), discriminador de nó
+ * (2 dígitos) e contador (3 dígitos).
+ * \note Esta função é thread-safe e lock-free. Os IDs são estritamente crescentes no processo: acima de 1000 lotes
+ * no mesmo segundo o contador avança sobre os segundos seguintes em vez de esperar, e a unicidade entre reinícios é
+ * garantida enquanto a média não exceder 1000 lotes por segundo.
+ * \note O limite dos IDs já entregues é reservado em blocos de um minuto no arquivo definido por
+ * ::msped_lote_id_arquivo_definir, antes de qualquer ID do bloco ser devolvido; só essa reserva, uma vez por bloco,
+ * passa por trava. Um reinício continua depois do último bloco reservado.
+ */
+MSPED_EXTERN uint64_t msped_lote_id_gerar(void *cls);
+
 /**
  * \brief Gera data e hora no formato AAAA-MM-DDThh:mm:ssTZD (UTC).
  * \return data e hora no formato UTC.
@@ -84,6 +84,16 @@ extern "C" {
  */
 #define MU_ZBUF_CHUNK (16384)
 
+/**
+ * \brief Block size for the parallel deflate.
+ */
+#define MU_ZPBLOCK_SIZE (131072)
+
+/**
+ * \brief Dictionary size primed from the previous block in the parallel deflate.
+ */
+#define MU_ZPDICT_SIZE (32768)
+
 /**
  * \brief Returns the library version.
  * \return Library version.
@@ -548,6 +558,55 @@ MU_EXTERN int mu_zdeflate(mu_zstream_data_cb read_cb, void *read_cls, mu_zstream
  */
 MU_EXTERN int mu_zfdeflate(const char *filename_in, const char *filename_out, int level) __nonnull((1, 2));
 
+/**
+ * \brief Compresses a memory buffer to a new allocated buffer in a single call.
+ * \param src Data to be compressed.
+ * \param len Length of the data to be compressed.
+ * \param dest Pointer to the allocated buffer of compressed data.
+ * \param dest_len Pointer to the length of the compressed data.
+ * \param level Compression level: 0 (uncompressed) to 9 (max compression).
+ * \return _Z_OK_ on success, _Z_MEM_ERROR_ if memory could not be allocated for processing, _Z_STREAM_ERROR_ if an
+ * invalid compression level is supplied or _Z_ERRNO_ if an invalid argument is supplied.
+ * \warning Caller **must** free the buffer returned in \p dest.
+ * \note The output is a zlib stream, readable by ::mu_zinflate.
+ */
+MU_EXTERN int mu_zdeflate_mem(const void *src, size_t len, void **dest, size_t *dest_len,
+                              int level) __nonnull((1, 3, 4));
+
+/**
+ * \brief Compresses from stream source to stream dest as gzip, splitting the source in blocks of
+ * ::MU_ZPBLOCK_SIZE bytes which are compressed independently by a pool of threads.
+ * \param read_cb Stream source read callback.
+ * \param read_cls Stream source read closure.
+ * \param write_cb Stream dest write callback.
+ * \param write_cls Stream dest write closure.
+ * \param eof_cb EOF stream source callback.
+ * \param eof_cls EOF stream source closure.
+ * \param level Compression level: 0 (uncompressed) to 9 (max compression).
+ * \param threads Number of threads, or 0 to use the number of online processors.
+ * \return _Z_OK_ on success, _Z_MEM_ERROR_ if memory could not be allocated for processing, _Z_STREAM_ERROR_ if an
+ * invalid compression level is supplied, _Z_VERSION_ERROR_ if the version of _zlib.h_ and the version of the library
+ * linked do not match, or _Z_ERRNO_ if there is an error reading or writing the streams or creating the threads.
+ * \note Each block is primed with the last ::MU_ZPDICT_SIZE bytes of the previous one, so the ratio stays close to
+ * ::mu_zdeflate. The output is a single standard gzip member, readable by _gunzip_ or _zcat_.
+ */
+MU_EXTERN int mu_zpdeflate(mu_zstream_data_cb read_cb, void *read_cls, mu_zstream_data_cb write_cb, void *write_cls,
+                           mu_zstream_eof_cb eof_cb, void *eof_cls, int level,
+                           unsigned int threads) __nonnull((1, 2, 3, 4, 5, 6));
+
+/**
+ * \brief Compresses from file source to gzip file dest using a pool of threads.
+ * \param filename_in Filename source.
+ * \param filename_out Filename dest.
+ * \param level Compression level: 0 (uncompressed) to 9 (max compression).
+ * \param threads Number of threads, or 0 to use the number of online processors.
+ * \return _Z_OK_ on success, _Z_MEM_ERROR_ if memory could not be allocated for processing, _Z_STREAM_ERROR_ if an
+ * invalid compression level is supplied, _Z_VERSION_ERROR_ if the version of _zlib.h_ and the version of the library
+ * linked do not match, or _Z_ERRNO_ if there is an error reading or writing the files or creating the threads.
+ */
+MU_EXTERN int mu_zfpdeflate(const char *filename_in, const char *filename_out, int level,
+                            unsigned int threads) __nonnull((1, 2));
+
 /**
  * \brief Decompresses from stream source to stream dest until stream ends or EOF.
  * \param read_cb Stream source read callback.
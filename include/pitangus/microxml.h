@@ -68,6 +68,15 @@ typedef bool (*mxml_sec_cb)(void *cls, void *doc, enum MXML_SEC_CB_TYPE cb_type)
  */
 typedef void (*mxml_err_cb)(void *cls, const char *msg);
 
+/**
+ * \brief Callback for writing serialized XML to a sink.
+ * \param cls Callback class.
+ * \param buf Data to be written.
+ * \param len Data length.
+ * \return **true** if written **false** to abort.
+ */
+typedef bool (*mxml_write_cb)(void *cls, const char *buf, size_t len);
+
 /* XML */
 
 /**
@@ -75,6 +84,11 @@ typedef void (*mxml_err_cb)(void *cls, const char *msg);
  */
 struct mxml_xml_cfg;
 
+/**
+ * \brief Element index of a document, mapping local names to nodes.
+ */
+struct mxml_xml_index;
+
 /**
  * \brief Initializes the XML2 library.
  */
@@ -92,6 +106,8 @@ MXML_EXTERN void mxml_xml_finit();
  * \param warn_cb Warning callback.
  * \param error_warn_cls Error/warning callback class.
  * \return Instance of _mxml_xml_cfg_.
+ * \note The instance can be shared between threads. The callbacks are called from the thread that raised the
+ * error, so they must be thread-safe if the instance is shared.
  */
 MXML_EXTERN struct mxml_xml_cfg *mxml_xml_cfg_new(const char *xsd_uri, mxml_err_cb error_cb,
                                                   mxml_err_cb warn_cb, void *error_warn_cls);
@@ -116,10 +132,74 @@ MXML_EXTERN bool mxml_xml_cfg_ok(struct mxml_xml_cfg *cfg);
  * \param error_cb Error callback.
  * \param error_cls Error callback class.
  * \return **true** if valid **false** otherwise.
+ * \note Each call uses its own validation context over the shared schema, so concurrent validations on the same
+ * _mxml_xml_cfg_ instance run in parallel.
  */
 MXML_EXTERN bool mxml_xml_validate_file(struct mxml_xml_cfg *cfg, const char *filename,
                                         mxml_err_cb error_cb, void *error_cls);
 
+/**
+ * \brief Validates a XML file in streaming mode, without building its DOM.
+ *
+ * Suitable for very large files: memory usage stays bounded regardless of the file size. Errors are reported
+ * through \p error_cb prefixed by `filename:line:column:`.
+ * \param cfg _mxml_xml_cfg_ instance
+ * \param filename XML file to be validated.
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return **true** if valid **false** otherwise.
+ */
+MXML_EXTERN bool mxml_xml_validate_file_stream(struct mxml_xml_cfg *cfg, const char *filename,
+                                               mxml_err_cb error_cb, void *error_cls);
+
+/**
+ * \brief Validates a XML document already parsed in memory.
+ * \param cfg _mxml_xml_cfg_ instance
+ * \param doc Document instance (DOM).
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return **true** if valid **false** otherwise.
+ */
+MXML_EXTERN bool mxml_xml_validate_doc(struct mxml_xml_cfg *cfg, void *doc, mxml_err_cb error_cb, void *error_cls);
+
+/**
+ * \brief Validates a XML held in a memory buffer, without writing it to disk.
+ * \param cfg _mxml_xml_cfg_ instance
+ * \param buffer XML content.
+ * \param size XML content size.
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return **true** if valid **false** otherwise.
+ */
+MXML_EXTERN bool mxml_xml_validate_buffer(struct mxml_xml_cfg *cfg, const char *buffer, size_t size,
+                                          mxml_err_cb error_cb, void *error_cls);
+
+/**
+ * \brief Validates a list of XML files spreading them over \p threads threads.
+ * \param cfg _mxml_xml_cfg_ instance
+ * \param filenames XML files to be validated.
+ * \param count Number of files.
+ * \param threads Number of threads (**0** uses one per online CPU).
+ * \param results Optional array of \p count items receiving the result of each file.
+ * \param error_cb Error callback (called from the worker threads).
+ * \param error_cls Error callback class.
+ * \return **true** if all files are valid **false** otherwise.
+ */
+MXML_EXTERN bool mxml_xml_validate_files(struct mxml_xml_cfg *cfg, const char *const *filenames, size_t count,
+                                         unsigned int threads, bool *results, mxml_err_cb error_cb, void *error_cls);
+
+/**
+ * \brief Validates all the `.xml` files of a directory spreading them over \p threads threads.
+ * \param cfg _mxml_xml_cfg_ instance
+ * \param dirname Directory containing the XML files.
+ * \param threads Number of threads (**0** uses one per online CPU).
+ * \param error_cb Error callback (called from the worker threads).
+ * \param error_cls Error callback class.
+ * \return **true** if all files are valid **false** otherwise.
+ */
+MXML_EXTERN bool mxml_xml_validate_dir(struct mxml_xml_cfg *cfg, const char *dirname, unsigned int threads,
+                                       mxml_err_cb error_cb, void *error_cls);
+
 /* XML utils */
 
 /**
@@ -254,6 +334,66 @@ MXML_EXTERN char *mxml_xml_node_get_attr_str(void *root_node, const char *node_n
  */
 MXML_EXTERN char *mxml_xml_doc_get_attr_str(void *doc, const char *node_name, const char *attr_name);
 
+/* XML index */
+
+/**
+ * \brief Indexes all the elements below a node (inclusive) by their local names, in a single traversal.
+ * \param root_node Base node.
+ * \return Instance of _mxml_xml_index_ or **NULL** on failure.
+ * \note The index points to the document nodes, so it must be freed before the document and rebuilt if the
+ * document is changed.
+ */
+MXML_EXTERN struct mxml_xml_index *mxml_xml_index_new(void *root_node);
+
+/**
+ * \brief Indexes all the elements of a document by their local names, in a single traversal.
+ * \param doc Document instance (DOM).
+ * \return Instance of _mxml_xml_index_ or **NULL** on failure.
+ */
+MXML_EXTERN struct mxml_xml_index *mxml_xml_doc_index_new(void *doc);
+
+/**
+ * \brief Frees _mxml_xml_index_ instance.
+ * \param index Instance to be freed.
+ */
+MXML_EXTERN void mxml_xml_index_free(struct mxml_xml_index *index);
+
+/**
+ * \brief Gets all the indexed nodes with a given name, in document order.
+ * \param index _mxml_xml_index_ instance.
+ * \param node_name Node name.
+ * \param nodes Nodes found, owned by the index.
+ * \return Number of nodes found.
+ */
+MXML_EXTERN size_t mxml_xml_index_find_nodes(struct mxml_xml_index *index, const char *node_name,
+                                             void *const **nodes);
+
+/**
+ * \brief Gets the first indexed node with a given name.
+ * \param index _mxml_xml_index_ instance.
+ * \param node_name Node name.
+ * \return Node pointer if found **NULL** otherwise.
+ */
+MXML_EXTERN void *mxml_xml_index_find_node(struct mxml_xml_index *index, const char *node_name);
+
+/**
+ * \brief Gets the value of the first indexed node with a given name.
+ * \param index _mxml_xml_index_ instance.
+ * \param node_name Node name.
+ * \return Node value if found or empty string otherwise.
+ */
+MXML_EXTERN char *mxml_xml_index_get_value_str(struct mxml_xml_index *index, const char *node_name);
+
+/**
+ * \brief Gets an attribute of the first indexed node with a given name.
+ * \param index _mxml_xml_index_ instance.
+ * \param node_name Node name.
+ * \param attr_name Attribute name.
+ * \return Attribute value if found or empty string otherwise.
+ */
+MXML_EXTERN char *mxml_xml_index_get_attr_str(struct mxml_xml_index *index, const char *node_name,
+                                              const char *attr_name);
+
 /**
  * \brief Inserts a node as a child right before an existing one.
  * \param ref_node Reference node.
@@ -297,6 +437,32 @@ MXML_EXTERN void *mxml_xml_doc_import_node(void *doc, void *imported_node, bool
  */
 MXML_EXTERN char *mxml_xml_node_dom_element_get_attribute(void *node, const char *name);
 
+/* XML scanner */
+
+/**
+ * \brief Locates the first element by its local name in a serialized XML, without parsing it into a DOM.
+ * \param xml Serialized XML.
+ * \param len Length of \p xml or 0 to compute it with _strlen_.
+ * \param name Local name of the element (the namespace prefix is ignored).
+ * \param elem_len Pointer to receive the element length, from its start tag up to the end of its end tag.
+ * \param prefixed Pointer to receive **true** if the element name has a namespace prefix or **NULL** if not used.
+ * \return Pointer to the element inside \p xml or **NULL** if not found or malformed.
+ * \note Comments, CDATA sections, processing instructions and quoted attribute values are skipped. Nested elements
+ * with the same name are balanced.
+ */
+MXML_EXTERN const char *mxml_xml_scan_element(const char *xml, size_t len, const char *name, size_t *elem_len,
+                                              bool *prefixed);
+
+/**
+ * \brief Retrieves an attribute from the start tag of an element located by ::mxml_xml_scan_element.
+ * \param elem Element start.
+ * \param len Element length.
+ * \param name Attribute qualified name, e.g. _xmlns_ or _versao_.
+ * \param value_len Pointer to receive the value length.
+ * \return Pointer to the raw (not unescaped) value inside \p elem or **NULL** if not found.
+ */
+MXML_EXTERN const char *mxml_xml_scan_attribute(const char *elem, size_t len, const char *name, size_t *value_len);
+
 /* XML sec */
 
 /**
@@ -318,6 +484,9 @@ MXML_EXTERN void mxml_xmlsec_finit();
 
 /**
  * \brief Creates a new _mxml_xmlsec_cfg_ passing the PFX file name.
+ *
+ * The PFX is loaded and decrypted once here; each signature or verification only duplicates the cached key, so
+ * mxml_xmlsec_init() must be called before this function.
  * \param pfx_filename PFX file name.
  * \param pfx_pwd PFX password.
  * \param error_cb Error callback.
@@ -327,6 +496,19 @@ MXML_EXTERN void mxml_xmlsec_finit();
 MXML_EXTERN struct mxml_xmlsec_cfg *mxml_xmlsec_cfg_pfx_file_new(const char *pfx_filename, const char *pfx_pwd,
                                                                  mxml_err_cb error_cb, void *error_cls);
 
+/**
+ * \brief Creates a new _mxml_xmlsec_cfg_ from a PFX already loaded in memory.
+ * \param pfx_data PFX content.
+ * \param pfx_size PFX content size.
+ * \param pfx_pwd PFX password.
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return Instance of _mxml_xmlsec_cfg_.
+ */
+MXML_EXTERN struct mxml_xmlsec_cfg *mxml_xmlsec_cfg_pfx_memory_new(const void *pfx_data, size_t pfx_size,
+                                                                   const char *pfx_pwd, mxml_err_cb error_cb,
+                                                                   void *error_cls);
+
 /**
  * \brief Frees _mxml_xmlsec_cfg_ instance.
  * \param cfg Instance to be freed.
@@ -367,6 +549,140 @@ MXML_EXTERN bool mxml_xmlsec_sign_string(struct mxml_xmlsec_cfg *cfg, const char
                                          bool skip_xml_declaration, int compression, bool auto_uri, bool single_cert,
                                          mxml_sec_cb sec_cb, void *sec_cls, mxml_err_cb error_cb, void *error_cls);
 
+/**
+ * \brief Signs a XML document already parsed in memory, in place.
+ * \param cfg Configuration object.
+ * \param doc Document instance (DOM) to be signed.
+ * \param id_attr Attribute ID.
+ * \param id_name ID name.
+ * \param declares_attlist Declares _ATTLIST_.
+ * \param removes_blanks Removes all blank elements.
+ * \param auto_uri **true** auto declares URI.
+ * \param single_cert **true** removes the other certificates.
+ * \param sec_cb Signature callback.
+ * \param sec_cls Signature callback class.
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return **true** if signed **false** otherwise.
+ */
+MXML_EXTERN bool mxml_xmlsec_sign_doc(struct mxml_xmlsec_cfg *cfg, void *doc, const char *id_attr, const char *id_name,
+                                      bool declares_attlist, bool removes_blanks, bool auto_uri, bool single_cert,
+                                      mxml_sec_cb sec_cb, void *sec_cls, mxml_err_cb error_cb, void *error_cls);
+
+/**
+ * \brief Signs a XML document already parsed in memory and serializes it into a caller-owned buffer.
+ * \param cfg Configuration object.
+ * \param doc Document instance (DOM) to be signed. It is changed in place.
+ * \param buffer Output buffer, grown with **realloc()** when needed and always null-terminated.
+ * \param buffer_size Allocated size of \p buffer, updated when it grows.
+ * \param encoding String encoding.
+ * \param id_attr Attribute ID.
+ * \param id_name ID name.
+ * \param declares_attlist Declares _ATTLIST_.
+ * \param formatted Formatted result.
+ * \param removes_blanks Removes all blank elements.
+ * \param skip_xml_declaration Skip the XML declaration.
+ * \param auto_uri **true** auto declares URI.
+ * \param single_cert **true** removes the other certificates.
+ * \param sec_cb Signature callback.
+ * \param sec_cls Signature callback class.
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return Length of the signed XML, or **0** on failure.
+ */
+MXML_EXTERN size_t mxml_xmlsec_sign_doc_to_buffer(struct mxml_xmlsec_cfg *cfg, void *doc, char **buffer,
+                                                  size_t *buffer_size, const char *encoding, const char *id_attr,
+                                                  const char *id_name, bool declares_attlist, bool formatted,
+                                                  bool removes_blanks, bool skip_xml_declaration, bool auto_uri,
+                                                  bool single_cert, mxml_sec_cb sec_cb, void *sec_cls,
+                                                  mxml_err_cb error_cb, void *error_cls);
+
+/**
+ * \brief Signs a XML document already parsed in memory and streams it to a write callback.
+ * \param cfg Configuration object.
+ * \param doc Document instance (DOM) to be signed. It is changed in place.
+ * \param write_cb Write callback.
+ * \param write_cls Write callback class.
+ * \param encoding String encoding.
+ * \param id_attr Attribute ID.
+ * \param id_name ID name.
+ * \param declares_attlist Declares _ATTLIST_.
+ * \param formatted Formatted result.
+ * \param removes_blanks Removes all blank elements.
+ * \param skip_xml_declaration Skip the XML declaration.
+ * \param auto_uri **true** auto declares URI.
+ * \param single_cert **true** removes the other certificates.
+ * \param sec_cb Signature callback.
+ * \param sec_cls Signature callback class.
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return Number of bytes written, or **0** on failure.
+ */
+MXML_EXTERN size_t mxml_xmlsec_sign_doc_to_cb(struct mxml_xmlsec_cfg *cfg, void *doc, mxml_write_cb write_cb,
+                                              void *write_cls, const char *encoding, const char *id_attr,
+                                              const char *id_name, bool declares_attlist, bool formatted,
+                                              bool removes_blanks, bool skip_xml_declaration, bool auto_uri,
+                                              bool single_cert, mxml_sec_cb sec_cb, void *sec_cls,
+                                              mxml_err_cb error_cb, void *error_cls);
+
+/**
+ * \brief Signs a XML string into a caller-owned buffer.
+ * \param cfg Configuration object.
+ * \param string String to be signed.
+ * \param length String length.
+ * \param buffer Output buffer, grown with **realloc()** when needed and always null-terminated.
+ * \param buffer_size Allocated size of \p buffer, updated when it grows.
+ * \param encoding String encoding.
+ * \param id_attr Attribute ID.
+ * \param id_name ID name.
+ * \param declares_attlist Declares _ATTLIST_.
+ * \param formatted Formatted result.
+ * \param removes_blanks Removes all blank elements.
+ * \param skip_xml_declaration Skip the XML declaration.
+ * \param auto_uri **true** auto declares URI.
+ * \param single_cert **true** removes the other certificates.
+ * \param sec_cb Signature callback.
+ * \param sec_cls Signature callback class.
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return Length of the signed XML, or **0** on failure.
+ */
+MXML_EXTERN size_t mxml_xmlsec_sign_string_to_buffer(struct mxml_xmlsec_cfg *cfg, const char *string, size_t length,
+                                                     char **buffer, size_t *buffer_size, const char *encoding,
+                                                     const char *id_attr, const char *id_name, bool declares_attlist,
+                                                     bool formatted, bool removes_blanks, bool skip_xml_declaration,
+                                                     bool auto_uri, bool single_cert, mxml_sec_cb sec_cb,
+                                                     void *sec_cls, mxml_err_cb error_cb, void *error_cls);
+
+/**
+ * \brief Signs a XML string streaming the result to a write callback.
+ * \param cfg Configuration object.
+ * \param string String to be signed.
+ * \param length String length.
+ * \param write_cb Write callback.
+ * \param write_cls Write callback class.
+ * \param encoding String encoding.
+ * \param id_attr Attribute ID.
+ * \param id_name ID name.
+ * \param declares_attlist Declares _ATTLIST_.
+ * \param formatted Formatted result.
+ * \param removes_blanks Removes all blank elements.
+ * \param skip_xml_declaration Skip the XML declaration.
+ * \param auto_uri **true** auto declares URI.
+ * \param single_cert **true** removes the other certificates.
+ * \param sec_cb Signature callback.
+ * \param sec_cls Signature callback class.
+ * \param error_cb Error callback.
+ * \param error_cls Error callback class.
+ * \return Number of bytes written, or **0** on failure.
+ */
+MXML_EXTERN size_t mxml_xmlsec_sign_string_to_cb(struct mxml_xmlsec_cfg *cfg, const char *string, size_t length,
+                                                 mxml_write_cb write_cb, void *write_cls, const char *encoding,
+                                                 const char *id_attr, const char *id_name, bool declares_attlist,
+                                                 bool formatted, bool removes_blanks, bool skip_xml_declaration,
+                                                 bool auto_uri, bool single_cert, mxml_sec_cb sec_cb, void *sec_cls,
+                                                 mxml_err_cb error_cb, void *error_cls);
+
 /**
  * \brief Signs a XML string passing less parameters.
  * \param cfg Configuration object.
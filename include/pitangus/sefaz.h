@@ -25,6 +25,10 @@
 #include <openssl/evp.h>
 
 #define	SEFAZ_STATUS_OK	107
+/* inutilização de números homologada */
+#define	SEFAZ_INUT_OK	102
+/* tamanho de msg, alocada por quem chama */
+#define	SEFAZ_MSG_TAM	255
 
 extern int get_status_servico(int ambiente, char *URL, int cuf, EVP_PKEY *, 
 	X509 *, char *msg);
@@ -38,4 +42,13 @@ extern int send_lote_evento(LOTE_EVENTO *lote, char *URL, int ambiente, int cuf,
 extern int cons_lote(LOTE *, char *URL, int ambiente, int cuf, EVP_PKEY *, 
 	X509 *, char *msg);
 
+/**
+ * Sign and send requests voiding ranges of NF numbers, all at once over
+ * parallel connections. Fills cStat, xmot, protocolo, xml and
+ * xml_response of each one and returns how many were voided. Nothing is
+ * sent if a justificativa is not 15 to 255 characters long
+ */
+extern int send_inutilizacoes(INUTILIZACAO **, int n, char *URL, int ambiente,
+	int cuf, EVP_PKEY *, X509 *, char *msg);
+
 #endif
@@ -18,6 +18,51 @@
 
 #include <pitangus/libsped.h>
 #include <time.h>
+#include <stddef.h>
+
+/**
+ * new_arena:
+ * @tamanho_bloco: Tamanho dos blocos da arena (0 usa o padrão)
+ *
+ * Cria uma arena de memória. As alocações são feitas em blocos contíguos e
+ * liberadas de uma só vez com free_arena().
+ */
+extern ARENA *new_arena(size_t tamanho_bloco);
+
+/**
+ * arena_alloc:
+ * @a: Arena
+ * @tamanho: Tamanho em bytes
+ *
+ * Aloca memória alinhada na arena. Retorna NULL sem memória.
+ */
+extern void *arena_alloc(ARENA *a, size_t tamanho);
+
+/**
+ * arena_strdup:
+ * @a: Arena
+ * @s: String a ser copiada
+ *
+ * Copia a string @s para a arena
+ */
+extern char *arena_strdup(ARENA *a, const char *s);
+
+/**
+ * arena_owns:
+ * @a: Arena
+ * @p: Ponteiro
+ *
+ * Retorna 1 se @p foi alocado na arena @a, 0 caso contrário
+ */
+extern int arena_owns(ARENA *a, const void *p);
+
+/**
+ * free_arena:
+ * @a: Arena
+ *
+ * Libera a arena e tudo que foi alocado nela
+ */
+extern void free_arena(ARENA *a);
 
 /**
  * new_nfe:
@@ -26,6 +71,62 @@
  */
 extern NFE *new_nfe();
 
+/**
+ * new_nfe_arena:
+ * @a: Arena (ver new_arena())
+ *
+ * Cria um objeto NFE cujo grafo (endereços, itens, strings) é alocado na
+ * arena @a. free_nfe() libera tudo de uma vez junto com a arena, sem
+ * percorrer o grafo: o que for pendurado na NF depois também deve vir da
+ * arena. Só itens de outra arena ou do heap são liberados um a um.
+ */
+extern NFE *new_nfe_arena(ARENA *a);
+
+/**
+ * free_nfe:
+ * @nfe: Nota fiscal (Objeto NFE)
+ *
+ * Libera o objeto NFE com seus itens, emitente, destinatário e protocolo.
+ * Se a NF foi criada com new_nfe_arena(), a arena também é liberada.
+ * Uma NF do heap é dona de todas as suas strings, que são liberadas com
+ * ela; use nfe_set_str() para trocá-las.
+ */
+extern void free_nfe(NFE *nfe);
+
+/**
+ * nfe_strdup:
+ * @nfe: Nota fiscal (Objeto NFE)
+ * @s: String a copiar ou NULL
+ *
+ * Copia @s para onde @nfe aloca: a sua arena ou o heap
+ *
+ * Returns: a cópia, liberada com a NF
+ */
+extern char *nfe_strdup(NFE *nfe, const char *s);
+
+/**
+ * nfe_set_str:
+ * @nfe: Nota fiscal (Objeto NFE)
+ * @campo: Endereço de um campo string de @nfe ou de um objeto dela
+ * @s: Novo valor ou NULL
+ *
+ * Troca *@campo por uma cópia de @s feita com nfe_strdup(), liberando o
+ * valor anterior se ele estava no heap
+ */
+extern void nfe_set_str(NFE *nfe, const char **campo, const char *s);
+
+/**
+ * nfe_set_destinatario:
+ * @nfe: Nota fiscal (Objeto NFE)
+ * @d: Destinatário a copiar
+ *
+ * Troca o destinatário de @nfe por uma cópia de @d, com endereço e
+ * strings, alocada como @nfe. @d continua do chamador.
+ *
+ * Returns: 0, ou -1 sem memória
+ */
+extern int nfe_set_destinatario(NFE *nfe, const DESTINATARIO *d);
+
 /**
  * new_lote:
  *
@@ -40,6 +141,23 @@ extern LOTE *new_lote(int id);
  */
 extern ITEM *new_item();
 
+/**
+ * new_item_arena:
+ * @a: Arena (ver new_arena())
+ *
+ * Cria um objeto ITEM alocado na arena @a
+ */
+extern ITEM *new_item_arena(ARENA *a);
+
+/**
+ * free_item:
+ * @i: Item (objeto ITEM)
+ *
+ * Libera um ITEM. Se ele foi alocado numa arena, a memória da arena só é
+ * devolvida junto com ela.
+ */
+extern void free_item(ITEM *i);
+
 /**
  * new_evento_cancelamento:
  *
@@ -55,18 +173,26 @@ extern EVENTO_CANCELAMENTO *new_evento_cancelamento();
 extern LOTE_EVENTO *new_lote_evento(int id);
 
 /**
- * new_uf:
+ * new_inutilizacao:
+ * @e: Emitente dos números
+ * @mod: Modelo das NFs
+ * @serie: Série das NFs
+ * @num_ini: Primeiro número da faixa
+ * @num_fim: Último número da faixa
  *
- * Cria um objeto UF 
+ * Cria um objeto INUTILIZACAO para o ano corrente
  */
-extern UF *new_uf();
+extern INUTILIZACAO *new_inutilizacao(EMITENTE *e, Mod mod, int serie,
+	unsigned int num_ini, unsigned int num_fim);
 
 /**
- * new_municipio:
+ * free_inutilizacao:
+ * @i: Pedido de inutilização (objeto INUTILIZACAO)
  *
- * Cria um objeto MUNICIPIO 
+ * Libera uma INUTILIZACAO e o que a geração do XML e o envio preencheram.
+ * O emitente e a justificativa continuam com quem os passou.
  */
-extern MUNICIPIO *new_municipio();
+extern void free_inutilizacao(INUTILIZACAO *i);
 
 /**
  * new_endereco:
@@ -107,13 +233,116 @@ extern int add_item(NFE *nfe, ITEM *i);
  */
 extern int rm_item(NFE *nfe, ITEM *i);
 
+/**
+ * update_item:
+ * @nfe: Nota fiscal (Objeto NFE)
+ * @i: Item já adicionado e alterado (objeto ITEM)
+ *
+ * Atualiza os vetores paralelos e o total da NFE depois de alterar
+ * quantidade, valor ou alíquota de um item já adicionado
+ */
+extern int update_item(NFE *nfe, ITEM *i);
+
+/**
+ * get_item:
+ * @nfe: Nota fiscal (Objeto NFE)
+ * @n: Índice do item, a partir de 0
+ *
+ * Retorna o item de índice @n ou NULL
+ */
+extern ITEM *get_item(NFE *nfe, unsigned int n);
+
+/**
+ * nfe_total_itens:
+ * @nfe: Nota fiscal (Objeto NFE)
+ *
+ * Soma quantidade * valor de todos os itens
+ */
+extern double nfe_total_itens(const NFE *nfe);
+
 /**
  * set_chave:
  * @nfe: Nota fiscal (Objeto NFE)
  *
- * Calcula a chave da NFE
+ * Calcula a chave da NFE. Se algum campo que a compõe é inválido (por
+ * exemplo, CNPJ sem 14 dígitos), a chave fica NULL
+ *
+ * Returns: 0, ou -1 se a chave não pôde ser gerada
+ */
+extern int set_chave(NFE *nfe);
+
+/**
+ * CHAVE_LEN:
+ *
+ * Quantidade de dígitos da chave de acesso, incluindo o DV
+ */
+#define CHAVE_LEN 44
+
+/**
+ * chave_dv:
+ * @base: Pelo menos 43 dígitos da chave
+ *
+ * Calcula o dígito verificador (módulo 11) sem alocar memória
+ *
+ * Returns: o DV como caractere ou '\0' se @base não for numérica
  */
-extern void set_chave(NFE *nfe);
+extern char chave_dv(const char *base);
+
+/**
+ * gen_chave:
+ * @chave: Buffer do chamador com pelo menos CHAVE_LEN + 1 posições
+ * @cuf: Código da UF do emitente
+ * @dh_emis: Data de emissão
+ * @cnpj: CNPJ do emitente, 14 dígitos
+ * @mod: Modelo da NF
+ * @serie: Série da NF
+ * @num_nf: Número da NF
+ * @tipo_emissao: Tipo de emissão
+ * @cod_nfe: Código numérico da NF
+ *
+ * Monta a chave de acesso com DV em @chave sem alocar memória
+ *
+ * Returns: 0 em caso de sucesso ou -1 se algum campo não couber
+ */
+extern int gen_chave(char *chave, unsigned int cuf, time_t dh_emis,
+		const char *cnpj, int mod, int serie, int num_nf,
+		int tipo_emissao, int cod_nfe);
+
+/**
+ * gen_chaves:
+ * @nfes: Vetor de NFs
+ * @qtd: Quantidade de NFs
+ * @chaves: Buffer com @qtd * (CHAVE_LEN + 1) posições
+ *
+ * Gera em lote as chaves de @nfes, uma a cada CHAVE_LEN + 1 posições
+ * de @chaves. Chaves que não puderem ser geradas ficam vazias.
+ *
+ * Returns: quantidade de chaves geradas
+ */
+extern size_t gen_chaves(NFE *const *nfes, size_t qtd, char *chaves);
+
+/**
+ * validar_chave:
+ * @chave: Chave de acesso
+ *
+ * Verifica se @chave tem CHAVE_LEN dígitos e DV correto
+ *
+ * Returns: 1 se válida, 0 caso contrário
+ */
+extern int validar_chave(const char *chave);
+
+/**
+ * validar_chaves:
+ * @chaves: Vetor de chaves
+ * @qtd: Quantidade de chaves
+ * @resultados: Vetor opcional com o resultado de cada chave
+ *
+ * Valida um lote de chaves com validar_chave()
+ *
+ * Returns: quantidade de chaves válidas
+ */
+extern size_t validar_chaves(const char *const *chaves, size_t qtd,
+		int *resultados);
 
 extern int inst_produto(int id, const char *codigo, const char *desc, 
 		unsigned int ncm, unsigned int cfop, 
@@ -157,7 +386,7 @@ extern int inst_nfe(unsigned int id_nfe,
 		PROTOCOLO *protocolo,
 		EMITENTE *emitente,
 		DESTINATARIO *destinatario,
-		MUNICIPIO *municipio, 
+		const MUNICIPIO *municipio, 
 		NFE *nfe);
 
 extern int inst_emitente(int id, 
@@ -182,22 +411,9 @@ extern int inst_endereco(const char *rua,
 		const char *complemento, 
 		const char *bairro, 
 		unsigned int cep, 
-		const char *xMun,
 		unsigned int cMun,
-		const char *xUF,
-		unsigned int cUF,
-		const char *xPais,
-		unsigned int cPais,
 		ENDERECO *e);
 
-extern int inst_municipio(const char *xMun, 
-		unsigned int cMun, 
-		const char *xUF, 
-		unsigned int cUF, 
-		const char *xPais, 
-		unsigned int cPais, 
-		MUNICIPIO *m);
-
 extern void free_emitente(EMITENTE *e);
 
 extern void free_destinatario(DESTINATARIO *d);
@@ -18,10 +18,12 @@
  */
 
 #include <pitangus/genxml.h>
+#include <pitangus/sped.h>
 #include <pitangus/errno.h>
 #include "sign.h"
 #include <stdio.h>
 #include <string.h>
+#include <ctype.h>
 #include <libxml/xmlwriter.h>
 #include <openssl/x509.h>
 #include <openssl/evp.h>
@@ -169,8 +171,11 @@ char *generate_xml(NFE *nfe, EVP_PKEY *key, X509 *cert) {
 	int rc;
 	xmlTextWriterPtr writer;
 	xmlDocPtr doc;
-	xmlBufferPtr buf = xmlBufferCreate();
+	xmlBufferPtr buf;
 
+	if(set_chave(nfe))
+		return NULL;
+	buf = xmlBufferCreate();
 	writer = xmlNewTextWriterDoc(&doc, 0);
 	if (writer == NULL)
 		return NULL;
@@ -188,7 +193,7 @@ char *generate_xml(NFE *nfe, EVP_PKEY *key, X509 *cert) {
 	if(rc)
 		return NULL;
 	xmlNodeDump(buf, NULL, xmlDocGetRootElement(doc), 0, 0);
-	nfe->xml = strdup((char*)buf->content);
+	nfe_set_str(nfe, &nfe->xml, (char*)buf->content);
 	return (char*)buf->content;
 }
 
@@ -205,6 +210,8 @@ int gen_inf_nfe(xmlTextWriterPtr writer, NFE *nfe){
 	rc = xmlTextWriterStartElement(writer, BAD_CAST "infNFe");
 	if (rc < 0)
 		return -EXML;
+	if(nfe->idnfe->chave == NULL)
+		return -EINVFIELD;
 	char *id = malloc(strlen(nfe->idnfe->chave) + strlen(ID_PREFIX) + 2);
 	strcpy(id, ID_PREFIX);
 	strcat(id, nfe->idnfe->chave);
@@ -229,18 +236,14 @@ int gen_inf_nfe(xmlTextWriterPtr writer, NFE *nfe){
 	if (rc < 0)
 		return -EXML;
 
-	ITEM *item = nfe->itens;
-	double valor = 0;
-	int i ;
-	while(item){
-		rc = _gen_det(writer, item);
+	unsigned int i;
+	for(i = 0; i < nfe->q_itens; i++){
+		rc = _gen_det(writer, nfe->itens[i]);
 		if (rc < 0)
 			return -EXML;
-		valor += item->produto->valor * item->quantidade;
-		item = item->pointer;
 	}
 
-	rc = _gen_total(writer, valor);
+	rc = _gen_total(writer, nfe_total_itens(nfe));
 	if (rc < 0)
 		return -EXML;
 
@@ -945,6 +948,8 @@ char *generate_evento_xml(EVENTO *e, EVP_PKEY *key, X509 *cert) {
 
 	NFE *nfe = e->nfe;
 
+	if(nfe->idnfe->chave == NULL)
+		return NULL;
 	writer = xmlNewTextWriterDoc(&doc, 0);
 	if (writer == NULL)
 		return NULL;
@@ -1062,39 +1067,167 @@ char *generate_evento_xml(EVENTO *e, EVP_PKEY *key, X509 *cert) {
 	return (char*)buf->content;
 }
 
-char *gen_export_nfe_xml(NFE *nfe){
-	int rc, buffersize;
+char *gen_inut_xml(INUTILIZACAO *inut, EVP_PKEY *key, X509 *cert){
+	int rc;
 	xmlTextWriterPtr writer;
-	xmlDocPtr doc;
-	xmlChar *xmlbuf;
+	xmlDocPtr doc = NULL;
+	xmlBufferPtr buf = xmlBufferCreate();
+	char *xml = NULL;
+	EMITENTE *e = inut->emitente;
+	int cuf = e->endereco->municipio->uf->cUF;
+
+	/* ID + cUF + ano + CNPJ + modelo + série + número inicial e final */
+	char *id = malloc(sizeof(char) * 50);
+	sprintf(id, "ID%02d%02d%s%02d%03d%09u%09u", cuf, inut->ano, e->cnpj,
+		inut->mod, inut->serie, inut->num_ini, inut->num_fim);
+	free((char*)inut->id);
+	inut->id = id;
 
 	writer = xmlNewTextWriterDoc(&doc, 0);
 	if (writer == NULL)
-		return NULL;
+		goto erro;
 	xmlTextWriterStartDocument(writer, NULL, "UTF-8", NULL);
-	rc = xmlTextWriterStartElement(writer, BAD_CAST "nfeProc");
+	rc = xmlTextWriterStartElement(writer, BAD_CAST "inutNFe");
 	if (rc < 0)
-		return NULL;
+		goto erro;
+	rc = xmlTextWriterWriteAttribute(writer, BAD_CAST "xmlns",
+			BAD_CAST "http://www.portalfiscal.inf.br/nfe");
+	if (rc < 0)
+		goto erro;
 	rc = xmlTextWriterWriteAttribute(writer, BAD_CAST "versao",
 			BAD_CAST NFE_VERSAO);
 	if (rc < 0)
-		return NULL;
-	rc = xmlTextWriterWriteRaw(writer, BAD_CAST nfe->xml);
+		goto erro;
+	rc = xmlTextWriterStartElement(writer, BAD_CAST "infInut");
 	if (rc < 0)
-		return NULL;
-	rc = xmlTextWriterWriteRaw(writer, BAD_CAST nfe->protocolo->xml);
+		goto erro;
+	rc = xmlTextWriterWriteAttribute(writer, BAD_CAST "Id",
+			BAD_CAST id);
 	if (rc < 0)
-		return NULL;
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "tpAmb",
+			"%d", inut->tipo_ambiente);
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "xServ",
+			"%s", "INUTILIZAR");
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "cUF",
+			"%d", cuf);
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "ano",
+			"%02d", inut->ano);
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "CNPJ",
+			"%s", e->cnpj);
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "mod",
+			"%d", inut->mod);
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "serie",
+			"%d", inut->serie);
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "nNFIni",
+			"%u", inut->num_ini);
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "nNFFin",
+			"%u", inut->num_fim);
+	if (rc < 0)
+		goto erro;
+	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "xJust",
+			"%s", inut->justificativa);
+	if (rc < 0)
+		goto erro;
 	rc = xmlTextWriterEndElement(writer);
 	if (rc < 0)
-		return NULL;
+		goto erro;
+	rc = xmlTextWriterEndElement(writer);
+	if (rc < 0)
+		goto erro;
 	xmlTextWriterEndDocument(writer);
-	xmlDocDumpMemory(doc, &xmlbuf, &buffersize);
-	return (char*)xmlbuf;
+	char URI[52];
+	sprintf(URI, "#%s", id);
+	if(sign_xml(doc, key, cert, URI))
+		goto erro;
+	xmlNodeDump(buf, NULL, xmlDocGetRootElement(doc), 0, 0);
+	xml = (char*)xmlBufferDetach(buf);
+erro:
+	xmlFreeTextWriter(writer);
+	xmlFreeDoc(doc);
+	xmlBufferFree(buf);
+	return xml;
+}
+
+/*
+ * Skips the XML declaration, processing instructions, comments and
+ * surrounding blanks of a serialized document, so its root element can
+ * be spliced into another document as is.
+ */
+static const char *xml_fragment(const char *xml, size_t *len){
+	const char *end;
+	size_t l = strlen(xml);
+	for(;;){
+		while(l > 0 && isspace((unsigned char) *xml)){
+			xml++;
+			l--;
+		}
+		if(l > 1 && xml[0] == '<' && xml[1] == '?')
+			end = strstr(xml, "?>");
+		else if(l > 3 && strncmp(xml, "<!--", 4) == 0)
+			end = strstr(xml, "-->");
+		else
+			break;
+		if(end == NULL)
+			break;
+		end = strchr(end, '>') + 1;
+		l -= end - xml;
+		xml = end;
+	}
+	while(l > 0 && isspace((unsigned char) xml[l - 1]))
+		l--;
+	*len = l;
+	return xml;
+}
+
+char *gen_export_nfe_xml(NFE *nfe){
+	const char *header = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<nfeProc versao=\"" NFE_VERSAO "\">";
+	const char *footer = "</nfeProc>\n";
+	const char *nfe_xml, *prot_xml;
+	size_t nfe_len, prot_len, header_len, footer_len;
+	char *xml, *p;
+
+	if(nfe->xml == NULL || nfe->protocolo == NULL ||
+			nfe->protocolo->xml == NULL)
+		return NULL;
+	nfe_xml = xml_fragment(nfe->xml, &nfe_len);
+	prot_xml = xml_fragment(nfe->protocolo->xml, &prot_len);
+	header_len = strlen(header);
+	footer_len = strlen(footer);
+
+	xml = malloc(header_len + nfe_len + prot_len + footer_len + 1);
+	if(xml == NULL)
+		return NULL;
+	p = xml;
+	memcpy(p, header, header_len);
+	p += header_len;
+	memcpy(p, nfe_xml, nfe_len);
+	p += nfe_len;
+	memcpy(p, prot_xml, prot_len);
+	p += prot_len;
+	memcpy(p, footer, footer_len + 1);
+	return xml;
 }
 
 char *get_versao(sefaz_servico_t service){
-	char *versao = malloc(sizeof(char) * 5);
+	char *versao;
 	switch(service){
 		case SEFAZ_RECEPCAO_EVENTO:
 			versao = "1.00";
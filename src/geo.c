@@ -0,0 +1,141 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <pitangus/geo.h>
+#include <stdint.h>
+#include <string.h>
+#include "geo_municipios.h"
+
+const MUNICIPIO geo_municipio_nenhum = {
+	.cMun = 0,
+	.uf = &(const UF){
+		.cUF = 0,
+		.pais = &geo_brasil
+	}
+};
+
+const PAIS *geo_pais(void){
+	return &geo_brasil;
+}
+
+const UF *geo_uf(unsigned int cUF){
+	int i;
+	for(i = 0; i < GEO_QTD_UF; i++){
+		if(geo_ufs[i].cUF == cUF)
+			return &geo_ufs[i];
+	}
+	return NULL;
+}
+
+const UF *geo_uf_sigla(const char *sigla){
+	int i;
+	if(sigla == NULL)
+		return NULL;
+	for(i = 0; i < GEO_QTD_UF; i++){
+		if(strcmp(geo_ufs[i].xUF, sigla) == 0)
+			return &geo_ufs[i];
+	}
+	return NULL;
+}
+
+/*
+ * Mesmo hash usado para gerar geo_hash
+ * */
+static unsigned int geo_hash_cod(unsigned int cMun){
+	return ((uint32_t)(cMun * 2654435761u)) >> (32 - GEO_HASH_BITS);
+}
+
+const MUNICIPIO *geo_municipio(unsigned int cMun){
+	unsigned int h = geo_hash_cod(cMun);
+	uint16_t i;
+	while((i = geo_hash[h]) != 0){
+		if(geo_municipios[i - 1].cMun == cMun)
+			return &geo_municipios[i - 1];
+		h = (h + 1) & (GEO_HASH_TAM - 1);
+	}
+	return NULL;
+}
+
+const MUNICIPIO *geo_municipio_ou_nenhum(unsigned int cMun){
+	const MUNICIPIO *m = geo_municipio(cMun);
+	return m? m : &geo_municipio_nenhum;
+}
+
+const MUNICIPIO *geo_municipio_n(size_t n){
+	return n < GEO_QTD_MUNICIPIOS? &geo_municipios[n] : NULL;
+}
+
+/*
+ * Minúsculas sem acento. Só conhece ASCII e o bloco Latin-1 em UTF-8
+ * (0xC3 xx), suficiente para os nomes da tabela.
+ * */
+static unsigned char geo_dobrar(const unsigned char **s){
+	static const char latin1[] =
+		"aaaaaaaceeeeiiiidnooooo*ouuuuyps"
+		"aaaaaaaceeeeiiiidnooooo/ouuuuypy";
+	unsigned char c = **s;
+	if(c == 0xC3 && (*s)[1] >= 0x80 && (*s)[1] <= 0xBF){
+		c = latin1[(*s)[1] - 0x80];
+		*s += 2;
+		return c;
+	}
+	(*s)++;
+	return (c >= 'A' && c <= 'Z')? c - 'A' + 'a' : c;
+}
+
+/*
+ * Compara o nome dobrado com o prefixo dobrado: 0 se o nome começa
+ * com o prefixo
+ * */
+static int geo_cmp_prefixo(const char *nome, const char *prefixo){
+	const unsigned char *n = (const unsigned char*)nome;
+	const unsigned char *p = (const unsigned char*)prefixo;
+	while(*p){
+		unsigned char cp = geo_dobrar(&p);
+		unsigned char cn = *n? geo_dobrar(&n) : 0;
+		if(cn != cp)
+			return cn < cp? -1 : 1;
+	}
+	return 0;
+}
+
+size_t geo_buscar_municipios(const char *prefixo, unsigned int cUF,
+		const MUNICIPIO **res, size_t max){
+	size_t ini = 0, fim = GEO_QTD_MUNICIPIOS, qtd = 0;
+	if(prefixo == NULL || res == NULL)
+		return 0;
+	/* primeiro nome >= prefixo */
+	while(ini < fim){
+		size_t meio = ini + (fim - ini) / 2;
+		if(geo_cmp_prefixo(geo_municipios[geo_por_nome[meio]].xMun,
+				prefixo) < 0){
+			ini = meio + 1;
+		} else {
+			fim = meio;
+		}
+	}
+	for(; ini < GEO_QTD_MUNICIPIOS && qtd < max; ini++){
+		const MUNICIPIO *m = &geo_municipios[geo_por_nome[ini]];
+		if(geo_cmp_prefixo(m->xMun, prefixo) != 0)
+			break;
+		if(cUF == 0 || m->uf->cUF == cUF)
+			res[qtd++] = m;
+	}
+	return qtd;
+}
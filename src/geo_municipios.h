@@ -0,0 +1,7127 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Tabela de municípios do IBGE, gerada a partir dos INSERTs de
+ * tool_db_create.c. Incluída somente por geo.c.
+ *
+ * geo_municipios: ordenado por código IBGE
+ * geo_por_nome: índices de geo_municipios ordenados pelo nome dobrado
+ *	(minúsculas, sem acento), usado na busca por prefixo
+ * geo_hash: endereçamento aberto por código, guarda índice + 1
+ */
+
+#define GEO_QTD_UF 27
+#define GEO_QTD_MUNICIPIOS 5565
+#define GEO_HASH_BITS 14
+#define GEO_HASH_TAM (1u << GEO_HASH_BITS)
+
+static const PAIS geo_brasil = {"BRASIL", 1058};
+
+static const UF geo_ufs[GEO_QTD_UF] = {
+	{"RO", 11, &geo_brasil},
+	{"AC", 12, &geo_brasil},
+	{"AM", 13, &geo_brasil},
+	{"RR", 14, &geo_brasil},
+	{"PA", 15, &geo_brasil},
+	{"AP", 16, &geo_brasil},
+	{"TO", 17, &geo_brasil},
+	{"MA", 21, &geo_brasil},
+	{"PI", 22, &geo_brasil},
+	{"CE", 23, &geo_brasil},
+	{"RN", 24, &geo_brasil},
+	{"PB", 25, &geo_brasil},
+	{"PE", 26, &geo_brasil},
+	{"AL", 27, &geo_brasil},
+	{"SE", 28, &geo_brasil},
+	{"BA", 29, &geo_brasil},
+	{"MG", 31, &geo_brasil},
+	{"ES", 32, &geo_brasil},
+	{"RJ", 33, &geo_brasil},
+	{"SP", 35, &geo_brasil},
+	{"PR", 41, &geo_brasil},
+	{"SC", 42, &geo_brasil},
+	{"RS", 43, &geo_brasil},
+	{"MS", 50, &geo_brasil},
+	{"MT", 51, &geo_brasil},
+	{"GO", 52, &geo_brasil},
+	{"DF", 53, &geo_brasil},
+};
+
+static const MUNICIPIO geo_municipios[GEO_QTD_MUNICIPIOS] = {
+	{"Alta Floresta D'Oeste", 1100015, &geo_ufs[0]},
+	{"Ariquemes", 1100023, &geo_ufs[0]},
+	{"Cabixi", 1100031, &geo_ufs[0]},
+	{"Cacoal", 1100049, &geo_ufs[0]},
+	{"Cerejeiras", 1100056, &geo_ufs[0]},
+	{"Colorado do Oeste", 1100064, &geo_ufs[0]},
+	{"Corumbiara", 1100072, &geo_ufs[0]},
+	{"Costa Marques", 1100080, &geo_ufs[0]},
+	{"Espigão D'Oeste", 1100098, &geo_ufs[0]},
+	{"Guajará-Mirim", 1100106, &geo_ufs[0]},
+	{"Jaru", 1100114, &geo_ufs[0]},
+	{"Ji-Paraná", 1100122, &geo_ufs[0]},
+	{"Machadinho D'Oeste", 1100130, &geo_ufs[0]},
+	{"Nova Brasilândia D'Oeste", 1100148, &geo_ufs[0]},
+	{"Ouro Preto do Oeste", 1100155, &geo_ufs[0]},
+	{"Pimenta Bueno", 1100189, &geo_ufs[0]},
+	{"Porto Velho", 1100205, &geo_ufs[0]},
+	{"Presidente Médici", 1100254, &geo_ufs[0]},
+	{"Rio Crespo", 1100262, &geo_ufs[0]},
+	{"Rolim de Moura", 1100288, &geo_ufs[0]},
+	{"Santa Luzia D'Oeste", 1100296, &geo_ufs[0]},
+	{"Vilhena", 1100304, &geo_ufs[0]},
+	{"São Miguel do Guaporé", 1100320, &geo_ufs[0]},
+	{"Nova Mamoré", 1100338, &geo_ufs[0]},
+	{"Alvorada D'Oeste", 1100346, &geo_ufs[0]},
+	{"Alto Alegre dos Parecis", 1100379, &geo_ufs[0]},
+	{"Alto Paraíso", 1100403, &geo_ufs[0]},
+	{"Buritis", 1100452, &geo_ufs[0]},
+	{"Novo Horizonte do Oeste", 1100502, &geo_ufs[0]},
+	{"Cacaulândia", 1100601, &geo_ufs[0]},
+	{"Campo Novo de Rondônia", 1100700, &geo_ufs[0]},
+	{"Candeias do Jamari", 1100809, &geo_ufs[0]},
+	{"Castanheiras", 1100908, &geo_ufs[0]},
+	{"Chupinguaia", 1100924, &geo_ufs[0]},
+	{"Cujubim", 1100940, &geo_ufs[0]},
+	{"Governador Jorge Teixeira", 1101005, &geo_ufs[0]},
+	{"Itapuã do Oeste", 1101104, &geo_ufs[0]},
+	{"Ministro Andreazza", 1101203, &geo_ufs[0]},
+	{"Mirante da Serra", 1101302, &geo_ufs[0]},
+	{"Monte Negro", 1101401, &geo_ufs[0]},
+	{"Nova União", 1101435, &geo_ufs[0]},
+	{"Parecis", 1101450, &geo_ufs[0]},
+	{"Pimenteiras do Oeste", 1101468, &geo_ufs[0]},
+	{"Primavera de Rondônia", 1101476, &geo_ufs[0]},
+	{"São Felipe D'Oeste", 1101484, &geo_ufs[0]},
+	{"São Francisco do Guaporé", 1101492, &geo_ufs[0]},
+	{"Seringueiras", 1101500, &geo_ufs[0]},
+	{"Teixeirópolis", 1101559, &geo_ufs[0]},
+	{"Theobroma", 1101609, &geo_ufs[0]},
+	{"Urupá", 1101708, &geo_ufs[0]},
+	{"Vale do Anari", 1101757, &geo_ufs[0]},
+	{"Vale do Paraíso", 1101807, &geo_ufs[0]},
+	{"Acrelândia", 1200013, &geo_ufs[1]},
+	{"Assis Brasil", 1200054, &geo_ufs[1]},
+	{"Brasiléia", 1200104, &geo_ufs[1]},
+	{"Bujari", 1200138, &geo_ufs[1]},
+	{"Capixaba", 1200179, &geo_ufs[1]},
+	{"Cruzeiro do Sul", 1200203, &geo_ufs[1]},
+	{"Epitaciolândia", 1200252, &geo_ufs[1]},
+	{"Feijó", 1200302, &geo_ufs[1]},
+	{"Jordão", 1200328, &geo_ufs[1]},
+	{"Mâncio Lima", 1200336, &geo_ufs[1]},
+	{"Manoel Urbano", 1200344, &geo_ufs[1]},
+	{"Marechal Thaumaturgo", 1200351, &geo_ufs[1]},
+	{"Plácido de Castro", 1200385, &geo_ufs[1]},
+	{"Porto Walter", 1200393, &geo_ufs[1]},
+	{"Rio Branco", 1200401, &geo_ufs[1]},
+	{"Rodrigues Alves", 1200427, &geo_ufs[1]},
+	{"Santa Rosa do Purus", 1200435, &geo_ufs[1]},
+	{"Senador Guiomard", 1200450, &geo_ufs[1]},
+	{"Sena Madureira", 1200500, &geo_ufs[1]},
+	{"Tarauacá", 1200609, &geo_ufs[1]},
+	{"Xapuri", 1200708, &geo_ufs[1]},
+	{"Porto Acre", 1200807, &geo_ufs[1]},
+	{"Alvarães", 1300029, &geo_ufs[2]},
+	{"Amaturá", 1300060, &geo_ufs[2]},
+	{"Anamã", 1300086, &geo_ufs[2]},
+	{"Anori", 1300102, &geo_ufs[2]},
+	{"Apuí", 1300144, &geo_ufs[2]},
+	{"Atalaia do Norte", 1300201, &geo_ufs[2]},
+	{"Autazes", 1300300, &geo_ufs[2]},
+	{"Barcelos", 1300409, &geo_ufs[2]},
+	{"Barreirinha", 1300508, &geo_ufs[2]},
+	{"Benjamin Constant", 1300607, &geo_ufs[2]},
+	{"Beruri", 1300631, &geo_ufs[2]},
+	{"Boa Vista do Ramos", 1300680, &geo_ufs[2]},
+	{"Boca do Acre", 1300706, &geo_ufs[2]},
+	{"Borba", 1300805, &geo_ufs[2]},
+	{"Caapiranga", 1300839, &geo_ufs[2]},
+	{"Canutama", 1300904, &geo_ufs[2]},
+	{"Carauari", 1301001, &geo_ufs[2]},
+	{"Careiro", 1301100, &geo_ufs[2]},
+	{"Careiro da Várzea", 1301159, &geo_ufs[2]},
+	{"Coari", 1301209, &geo_ufs[2]},
+	{"Codajás", 1301308, &geo_ufs[2]},
+	{"Eirunepé", 1301407, &geo_ufs[2]},
+	{"Envira", 1301506, &geo_ufs[2]},
+	{"Fonte Boa", 1301605, &geo_ufs[2]},
+	{"Guajará", 1301654, &geo_ufs[2]},
+	{"Humaitá", 1301704, &geo_ufs[2]},
+	{"Ipixuna", 1301803, &geo_ufs[2]},
+	{"Iranduba", 1301852, &geo_ufs[2]},
+	{"Itacoatiara", 1301902, &geo_ufs[2]},
+	{"Itamarati", 1301951, &geo_ufs[2]},
+	{"Itapiranga", 1302009, &geo_ufs[2]},
+	{"Japurá", 1302108, &geo_ufs[2]},
+	{"Juruá", 1302207, &geo_ufs[2]},
+	{"Jutaí", 1302306, &geo_ufs[2]},
+	{"Lábrea", 1302405, &geo_ufs[2]},
+	{"Manacapuru", 1302504, &geo_ufs[2]},
+	{"Manaquiri", 1302553, &geo_ufs[2]},
+	{"Manaus", 1302603, &geo_ufs[2]},
+	{"Manicoré", 1302702, &geo_ufs[2]},
+	{"Maraã", 1302801, &geo_ufs[2]},
+	{"Maués", 1302900, &geo_ufs[2]},
+	{"Nhamundá", 1303007, &geo_ufs[2]},
+	{"Nova Olinda do Norte", 1303106, &geo_ufs[2]},
+	{"Novo Airão", 1303205, &geo_ufs[2]},
+	{"Novo Aripuanã", 1303304, &geo_ufs[2]},
+	{"Parintins", 1303403, &geo_ufs[2]},
+	{"Pauini", 1303502, &geo_ufs[2]},
+	{"Presidente Figueiredo", 1303536, &geo_ufs[2]},
+	{"Rio Preto da Eva", 1303569, &geo_ufs[2]},
+	{"Santa Isabel do Rio Negro", 1303601, &geo_ufs[2]},
+	{"Santo Antônio do Içá", 1303700, &geo_ufs[2]},
+	{"São Gabriel da Cachoeira", 1303809, &geo_ufs[2]},
+	{"São Paulo de Olivença", 1303908, &geo_ufs[2]},
+	{"São Sebastião do Uatumã", 1303957, &geo_ufs[2]},
+	{"Silves", 1304005, &geo_ufs[2]},
+	{"Tabatinga", 1304062, &geo_ufs[2]},
+	{"Tapauá", 1304104, &geo_ufs[2]},
+	{"Tefé", 1304203, &geo_ufs[2]},
+	{"Tonantins", 1304237, &geo_ufs[2]},
+	{"Uarini", 1304260, &geo_ufs[2]},
+	{"Urucará", 1304302, &geo_ufs[2]},
+	{"Urucurituba", 1304401, &geo_ufs[2]},
+	{"Amajari", 1400027, &geo_ufs[3]},
+	{"Alto Alegre", 1400050, &geo_ufs[3]},
+	{"Boa Vista", 1400100, &geo_ufs[3]},
+	{"Bonfim", 1400159, &geo_ufs[3]},
+	{"Cantá", 1400175, &geo_ufs[3]},
+	{"Caracaraí", 1400209, &geo_ufs[3]},
+	{"Caroebe", 1400233, &geo_ufs[3]},
+	{"Iracema", 1400282, &geo_ufs[3]},
+	{"Mucajaí", 1400308, &geo_ufs[3]},
+	{"Normandia", 1400407, &geo_ufs[3]},
+	{"Pacaraima", 1400456, &geo_ufs[3]},
+	{"Rorainópolis", 1400472, &geo_ufs[3]},
+	{"São João da Baliza", 1400506, &geo_ufs[3]},
+	{"São Luiz", 1400605, &geo_ufs[3]},
+	{"Uiramutã", 1400704, &geo_ufs[3]},
+	{"Abaetetuba", 1500107, &geo_ufs[4]},
+	{"Abel Figueiredo", 1500131, &geo_ufs[4]},
+	{"Acará", 1500206, &geo_ufs[4]},
+	{"Afuá", 1500305, &geo_ufs[4]},
+	{"Água Azul do Norte", 1500347, &geo_ufs[4]},
+	{"Alenquer", 1500404, &geo_ufs[4]},
+	{"Almeirim", 1500503, &geo_ufs[4]},
+	{"Altamira", 1500602, &geo_ufs[4]},
+	{"Anajás", 1500701, &geo_ufs[4]},
+	{"Ananindeua", 1500800, &geo_ufs[4]},
+	{"Anapu", 1500859, &geo_ufs[4]},
+	{"Augusto Corrêa", 1500909, &geo_ufs[4]},
+	{"Aurora do Pará", 1500958, &geo_ufs[4]},
+	{"Aveiro", 1501006, &geo_ufs[4]},
+	{"Bagre", 1501105, &geo_ufs[4]},
+	{"Baião", 1501204, &geo_ufs[4]},
+	{"Bannach", 1501253, &geo_ufs[4]},
+	{"Barcarena", 1501303, &geo_ufs[4]},
+	{"Belém", 1501402, &geo_ufs[4]},
+	{"Belterra", 1501451, &geo_ufs[4]},
+	{"Benevides", 1501501, &geo_ufs[4]},
+	{"Bom Jesus do Tocantins", 1501576, &geo_ufs[4]},
+	{"Bonito", 1501600, &geo_ufs[4]},
+	{"Bragança", 1501709, &geo_ufs[4]},
+	{"Brasil Novo", 1501725, &geo_ufs[4]},
+	{"Brejo Grande do Araguaia", 1501758, &geo_ufs[4]},
+	{"Breu Branco", 1501782, &geo_ufs[4]},
+	{"Breves", 1501808, &geo_ufs[4]},
+	{"Bujaru", 1501907, &geo_ufs[4]},
+	{"Cachoeira do Piriá", 1501956, &geo_ufs[4]},
+	{"Cachoeira do Arari", 1502004, &geo_ufs[4]},
+	{"Cametá", 1502103, &geo_ufs[4]},
+	{"Canaã dos Carajás", 1502152, &geo_ufs[4]},
+	{"Capanema", 1502202, &geo_ufs[4]},
+	{"Capitão Poço", 1502301, &geo_ufs[4]},
+	{"Castanhal", 1502400, &geo_ufs[4]},
+	{"Chaves", 1502509, &geo_ufs[4]},
+	{"Colares", 1502608, &geo_ufs[4]},
+	{"Conceição do Araguaia", 1502707, &geo_ufs[4]},
+	{"Concórdia do Pará", 1502756, &geo_ufs[4]},
+	{"Cumaru do Norte", 1502764, &geo_ufs[4]},
+	{"Curionópolis", 1502772, &geo_ufs[4]},
+	{"Curralinho", 1502806, &geo_ufs[4]},
+	{"Curuá", 1502855, &geo_ufs[4]},
+	{"Curuçá", 1502905, &geo_ufs[4]},
+	{"Dom Eliseu", 1502939, &geo_ufs[4]},
+	{"Eldorado dos Carajás", 1502954, &geo_ufs[4]},
+	{"Faro", 1503002, &geo_ufs[4]},
+	{"Floresta do Araguaia", 1503044, &geo_ufs[4]},
+	{"Garrafão do Norte", 1503077, &geo_ufs[4]},
+	{"Goianésia do Pará", 1503093, &geo_ufs[4]},
+	{"Gurupá", 1503101, &geo_ufs[4]},
+	{"Igarapé-Açu", 1503200, &geo_ufs[4]},
+	{"Igarapé-Miri", 1503309, &geo_ufs[4]},
+	{"Inhangapi", 1503408, &geo_ufs[4]},
+	{"Ipixuna do Pará", 1503457, &geo_ufs[4]},
+	{"Irituia", 1503507, &geo_ufs[4]},
+	{"Itaituba", 1503606, &geo_ufs[4]},
+	{"Itupiranga", 1503705, &geo_ufs[4]},
+	{"Jacareacanga", 1503754, &geo_ufs[4]},
+	{"Jacundá", 1503804, &geo_ufs[4]},
+	{"Juruti", 1503903, &geo_ufs[4]},
+	{"Limoeiro do Ajuru", 1504000, &geo_ufs[4]},
+	{"Mãe do Rio", 1504059, &geo_ufs[4]},
+	{"Magalhães Barata", 1504109, &geo_ufs[4]},
+	{"Marabá", 1504208, &geo_ufs[4]},
+	{"Maracanã", 1504307, &geo_ufs[4]},
+	{"Marapanim", 1504406, &geo_ufs[4]},
+	{"Marituba", 1504422, &geo_ufs[4]},
+	{"Medicilândia", 1504455, &geo_ufs[4]},
+	{"Melgaço", 1504505, &geo_ufs[4]},
+	{"Mocajuba", 1504604, &geo_ufs[4]},
+	{"Moju", 1504703, &geo_ufs[4]},
+	{"Monte Alegre", 1504802, &geo_ufs[4]},
+	{"Muaná", 1504901, &geo_ufs[4]},
+	{"Nova Esperança do Piriá", 1504950, &geo_ufs[4]},
+	{"Nova Ipixuna", 1504976, &geo_ufs[4]},
+	{"Nova Timboteua", 1505007, &geo_ufs[4]},
+	{"Novo Progresso", 1505031, &geo_ufs[4]},
+	{"Novo Repartimento", 1505064, &geo_ufs[4]},
+	{"Óbidos", 1505106, &geo_ufs[4]},
+	{"Oeiras do Pará", 1505205, &geo_ufs[4]},
+	{"Oriximiná", 1505304, &geo_ufs[4]},
+	{"Ourém", 1505403, &geo_ufs[4]},
+	{"Ourilândia do Norte", 1505437, &geo_ufs[4]},
+	{"Pacajá", 1505486, &geo_ufs[4]},
+	{"Palestina do Pará", 1505494, &geo_ufs[4]},
+	{"Paragominas", 1505502, &geo_ufs[4]},
+	{"Parauapebas", 1505536, &geo_ufs[4]},
+	{"Pau D'Arco", 1505551, &geo_ufs[4]},
+	{"Peixe-Boi", 1505601, &geo_ufs[4]},
+	{"Piçarra", 1505635, &geo_ufs[4]},
+	{"Placas", 1505650, &geo_ufs[4]},
+	{"Ponta de Pedras", 1505700, &geo_ufs[4]},
+	{"Portel", 1505809, &geo_ufs[4]},
+	{"Porto de Moz", 1505908, &geo_ufs[4]},
+	{"Prainha", 1506005, &geo_ufs[4]},
+	{"Primavera", 1506104, &geo_ufs[4]},
+	{"Quatipuru", 1506112, &geo_ufs[4]},
+	{"Redenção", 1506138, &geo_ufs[4]},
+	{"Rio Maria", 1506161, &geo_ufs[4]},
+	{"Rondon do Pará", 1506187, &geo_ufs[4]},
+	{"Rurópolis", 1506195, &geo_ufs[4]},
+	{"Salinópolis", 1506203, &geo_ufs[4]},
+	{"Salvaterra", 1506302, &geo_ufs[4]},
+	{"Santa Bárbara do Pará", 1506351, &geo_ufs[4]},
+	{"Santa Cruz do Arari", 1506401, &geo_ufs[4]},
+	{"Santa Isabel do Pará", 1506500, &geo_ufs[4]},
+	{"Santa Luzia do Pará", 1506559, &geo_ufs[4]},
+	{"Santa Maria das Barreiras", 1506583, &geo_ufs[4]},
+	{"Santa Maria do Pará", 1506609, &geo_ufs[4]},
+	{"Santana do Araguaia", 1506708, &geo_ufs[4]},
+	{"Santarém", 1506807, &geo_ufs[4]},
+	{"Santarém Novo", 1506906, &geo_ufs[4]},
+	{"Santo Antônio do Tauá", 1507003, &geo_ufs[4]},
+	{"São Caetano de Odivelas", 1507102, &geo_ufs[4]},
+	{"São Domingos do Araguaia", 1507151, &geo_ufs[4]},
+	{"São Domingos do Capim", 1507201, &geo_ufs[4]},
+	{"São Félix do Xingu", 1507300, &geo_ufs[4]},
+	{"São Francisco do Pará", 1507409, &geo_ufs[4]},
+	{"São Geraldo do Araguaia", 1507458, &geo_ufs[4]},
+	{"São João da Ponta", 1507466, &geo_ufs[4]},
+	{"São João de Pirabas", 1507474, &geo_ufs[4]},
+	{"São João do Araguaia", 1507508, &geo_ufs[4]},
+	{"São Miguel do Guamá", 1507607, &geo_ufs[4]},
+	{"São Sebastião da Boa Vista", 1507706, &geo_ufs[4]},
+	{"Sapucaia", 1507755, &geo_ufs[4]},
+	{"Senador José Porfírio", 1507805, &geo_ufs[4]},
+	{"Soure", 1507904, &geo_ufs[4]},
+	{"Tailândia", 1507953, &geo_ufs[4]},
+	{"Terra Alta", 1507961, &geo_ufs[4]},
+	{"Terra Santa", 1507979, &geo_ufs[4]},
+	{"Tomé-Açu", 1508001, &geo_ufs[4]},
+	{"Tracuateua", 1508035, &geo_ufs[4]},
+	{"Trairão", 1508050, &geo_ufs[4]},
+	{"Tucumã", 1508084, &geo_ufs[4]},
+	{"Tucuruí", 1508100, &geo_ufs[4]},
+	{"Ulianópolis", 1508126, &geo_ufs[4]},
+	{"Uruará", 1508159, &geo_ufs[4]},
+	{"Vigia", 1508209, &geo_ufs[4]},
+	{"Viseu", 1508308, &geo_ufs[4]},
+	{"Vitória do Xingu", 1508357, &geo_ufs[4]},
+	{"Xinguara", 1508407, &geo_ufs[4]},
+	{"Serra do Navio", 1600055, &geo_ufs[5]},
+	{"Amapá", 1600105, &geo_ufs[5]},
+	{"Pedra Branca do Amapari", 1600154, &geo_ufs[5]},
+	{"Calçoene", 1600204, &geo_ufs[5]},
+	{"Cutias", 1600212, &geo_ufs[5]},
+	{"Ferreira Gomes", 1600238, &geo_ufs[5]},
+	{"Itaubal", 1600253, &geo_ufs[5]},
+	{"Laranjal do Jari", 1600279, &geo_ufs[5]},
+	{"Macapá", 1600303, &geo_ufs[5]},
+	{"Mazagão", 1600402, &geo_ufs[5]},
+	{"Oiapoque", 1600501, &geo_ufs[5]},
+	{"Porto Grande", 1600535, &geo_ufs[5]},
+	{"Pracuúba", 1600550, &geo_ufs[5]},
+	{"Santana", 1600600, &geo_ufs[5]},
+	{"Tartarugalzinho", 1600709, &geo_ufs[5]},
+	{"Vitória do Jari", 1600808, &geo_ufs[5]},
+	{"Abreulândia", 1700251, &geo_ufs[6]},
+	{"Aguiarnópolis", 1700301, &geo_ufs[6]},
+	{"Aliança do Tocantins", 1700350, &geo_ufs[6]},
+	{"Almas", 1700400, &geo_ufs[6]},
+	{"Alvorada", 1700707, &geo_ufs[6]},
+	{"Ananás", 1701002, &geo_ufs[6]},
+	{"Angico", 1701051, &geo_ufs[6]},
+	{"Aparecida do Rio Negro", 1701101, &geo_ufs[6]},
+	{"Aragominas", 1701309, &geo_ufs[6]},
+	{"Araguacema", 1701903, &geo_ufs[6]},
+	{"Araguaçu", 1702000, &geo_ufs[6]},
+	{"Araguaína", 1702109, &geo_ufs[6]},
+	{"Araguanã", 1702158, &geo_ufs[6]},
+	{"Araguatins", 1702208, &geo_ufs[6]},
+	{"Arapoema", 1702307, &geo_ufs[6]},
+	{"Arraias", 1702406, &geo_ufs[6]},
+	{"Augustinópolis", 1702554, &geo_ufs[6]},
+	{"Aurora do Tocantins", 1702703, &geo_ufs[6]},
+	{"Axixá do Tocantins", 1702901, &geo_ufs[6]},
+	{"Babaçulândia", 1703008, &geo_ufs[6]},
+	{"Bandeirantes do Tocantins", 1703057, &geo_ufs[6]},
+	{"Barra do Ouro", 1703073, &geo_ufs[6]},
+	{"Barrolândia", 1703107, &geo_ufs[6]},
+	{"Bernardo Sayão", 1703206, &geo_ufs[6]},
+	{"Bom Jesus do Tocantins", 1703305, &geo_ufs[6]},
+	{"Brasilândia do Tocantins", 1703602, &geo_ufs[6]},
+	{"Brejinho de Nazaré", 1703701, &geo_ufs[6]},
+	{"Buriti do Tocantins", 1703800, &geo_ufs[6]},
+	{"Cachoeirinha", 1703826, &geo_ufs[6]},
+	{"Campos Lindos", 1703842, &geo_ufs[6]},
+	{"Cariri do Tocantins", 1703867, &geo_ufs[6]},
+	{"Carmolândia", 1703883, &geo_ufs[6]},
+	{"Carrasco Bonito", 1703891, &geo_ufs[6]},
+	{"Caseara", 1703909, &geo_ufs[6]},
+	{"Centenário", 1704105, &geo_ufs[6]},
+	{"Chapada de Areia", 1704600, &geo_ufs[6]},
+	{"Chapada da Natividade", 1705102, &geo_ufs[6]},
+	{"Colinas do Tocantins", 1705508, &geo_ufs[6]},
+	{"Combinado", 1705557, &geo_ufs[6]},
+	{"Conceição do Tocantins", 1705607, &geo_ufs[6]},
+	{"Couto Magalhães", 1706001, &geo_ufs[6]},
+	{"Cristalândia", 1706100, &geo_ufs[6]},
+	{"Crixás do Tocantins", 1706258, &geo_ufs[6]},
+	{"Darcinópolis", 1706506, &geo_ufs[6]},
+	{"Dianópolis", 1707009, &geo_ufs[6]},
+	{"Divinópolis do Tocantins", 1707108, &geo_ufs[6]},
+	{"Dois Irmãos do Tocantins", 1707207, &geo_ufs[6]},
+	{"Dueré", 1707306, &geo_ufs[6]},
+	{"Esperantina", 1707405, &geo_ufs[6]},
+	{"Fátima", 1707553, &geo_ufs[6]},
+	{"Figueirópolis", 1707652, &geo_ufs[6]},
+	{"Filadélfia", 1707702, &geo_ufs[6]},
+	{"Formoso do Araguaia", 1708205, &geo_ufs[6]},
+	{"Fortaleza do Tabocão", 1708254, &geo_ufs[6]},
+	{"Goianorte", 1708304, &geo_ufs[6]},
+	{"Goiatins", 1709005, &geo_ufs[6]},
+	{"Guaraí", 1709302, &geo_ufs[6]},
+	{"Gurupi", 1709500, &geo_ufs[6]},
+	{"Ipueiras", 1709807, &geo_ufs[6]},
+	{"Itacajá", 1710508, &geo_ufs[6]},
+	{"Itaguatins", 1710706, &geo_ufs[6]},
+	{"Itapiratins", 1710904, &geo_ufs[6]},
+	{"Itaporã do Tocantins", 1711100, &geo_ufs[6]},
+	{"Jaú do Tocantins", 1711506, &geo_ufs[6]},
+	{"Juarina", 1711803, &geo_ufs[6]},
+	{"Lagoa da Confusão", 1711902, &geo_ufs[6]},
+	{"Lagoa do Tocantins", 1711951, &geo_ufs[6]},
+	{"Lajeado", 1712009, &geo_ufs[6]},
+	{"Lavandeira", 1712157, &geo_ufs[6]},
+	{"Lizarda", 1712405, &geo_ufs[6]},
+	{"Luzinópolis", 1712454, &geo_ufs[6]},
+	{"Marianópolis do Tocantins", 1712504, &geo_ufs[6]},
+	{"Mateiros", 1712702, &geo_ufs[6]},
+	{"Maurilândia do Tocantins", 1712801, &geo_ufs[6]},
+	{"Miracema do Tocantins", 1713205, &geo_ufs[6]},
+	{"Miranorte", 1713304, &geo_ufs[6]},
+	{"Monte do Carmo", 1713601, &geo_ufs[6]},
+	{"Monte Santo do Tocantins", 1713700, &geo_ufs[6]},
+	{"Palmeiras do Tocantins", 1713809, &geo_ufs[6]},
+	{"Muricilândia", 1713957, &geo_ufs[6]},
+	{"Natividade", 1714203, &geo_ufs[6]},
+	{"Nazaré", 1714302, &geo_ufs[6]},
+	{"Nova Olinda", 1714880, &geo_ufs[6]},
+	{"Nova Rosalândia", 1715002, &geo_ufs[6]},
+	{"Novo Acordo", 1715101, &geo_ufs[6]},
+	{"Novo Alegre", 1715150, &geo_ufs[6]},
+	{"Novo Jardim", 1715259, &geo_ufs[6]},
+	{"Oliveira de Fátima", 1715507, &geo_ufs[6]},
+	{"Palmeirante", 1715705, &geo_ufs[6]},
+	{"Palmeirópolis", 1715754, &geo_ufs[6]},
+	{"Paraíso do Tocantins", 1716109, &geo_ufs[6]},
+	{"Paranã", 1716208, &geo_ufs[6]},
+	{"Pau D'Arco", 1716307, &geo_ufs[6]},
+	{"Pedro Afonso", 1716505, &geo_ufs[6]},
+	{"Peixe", 1716604, &geo_ufs[6]},
+	{"Pequizeiro", 1716653, &geo_ufs[6]},
+	{"Colméia", 1716703, &geo_ufs[6]},
+	{"Pindorama do Tocantins", 1717008, &geo_ufs[6]},
+	{"Piraquê", 1717206, &geo_ufs[6]},
+	{"Pium", 1717503, &geo_ufs[6]},
+	{"Ponte Alta do Bom Jesus", 1717800, &geo_ufs[6]},
+	{"Ponte Alta do Tocantins", 1717909, &geo_ufs[6]},
+	{"Porto Alegre do Tocantins", 1718006, &geo_ufs[6]},
+	{"Porto Nacional", 1718204, &geo_ufs[6]},
+	{"Praia Norte", 1718303, &geo_ufs[6]},
+	{"Presidente Kennedy", 1718402, &geo_ufs[6]},
+	{"Pugmil", 1718451, &geo_ufs[6]},
+	{"Recursolândia", 1718501, &geo_ufs[6]},
+	{"Riachinho", 1718550, &geo_ufs[6]},
+	{"Rio da Conceição", 1718659, &geo_ufs[6]},
+	{"Rio dos Bois", 1718709, &geo_ufs[6]},
+	{"Rio Sono", 1718758, &geo_ufs[6]},
+	{"Sampaio", 1718808, &geo_ufs[6]},
+	{"Sandolândia", 1718840, &geo_ufs[6]},
+	{"Santa Fé do Araguaia", 1718865, &geo_ufs[6]},
+	{"Santa Maria do Tocantins", 1718881, &geo_ufs[6]},
+	{"Santa Rita do Tocantins", 1718899, &geo_ufs[6]},
+	{"Santa Rosa do Tocantins", 1718907, &geo_ufs[6]},
+	{"Santa Tereza do Tocantins", 1719004, &geo_ufs[6]},
+	{"Santa Terezinha do Tocantins", 1720002, &geo_ufs[6]},
+	{"São Bento do Tocantins", 1720101, &geo_ufs[6]},
+	{"São Félix do Tocantins", 1720150, &geo_ufs[6]},
+	{"São Miguel do Tocantins", 1720200, &geo_ufs[6]},
+	{"São Salvador do Tocantins", 1720259, &geo_ufs[6]},
+	{"São Sebastião do Tocantins", 1720309, &geo_ufs[6]},
+	{"São Valério", 1720499, &geo_ufs[6]},
+	{"Silvanópolis", 1720655, &geo_ufs[6]},
+	{"Sítio Novo do Tocantins", 1720804, &geo_ufs[6]},
+	{"Sucupira", 1720853, &geo_ufs[6]},
+	{"Taguatinga", 1720903, &geo_ufs[6]},
+	{"Taipas do Tocantins", 1720937, &geo_ufs[6]},
+	{"Talismã", 1720978, &geo_ufs[6]},
+	{"Palmas", 1721000, &geo_ufs[6]},
+	{"Tocantínia", 1721109, &geo_ufs[6]},
+	{"Tocantinópolis", 1721208, &geo_ufs[6]},
+	{"Tupirama", 1721257, &geo_ufs[6]},
+	{"Tupiratins", 1721307, &geo_ufs[6]},
+	{"Wanderlândia", 1722081, &geo_ufs[6]},
+	{"Xambioá", 1722107, &geo_ufs[6]},
+	{"Açailândia", 2100055, &geo_ufs[7]},
+	{"Afonso Cunha", 2100105, &geo_ufs[7]},
+	{"Água Doce do Maranhão", 2100154, &geo_ufs[7]},
+	{"Alcântara", 2100204, &geo_ufs[7]},
+	{"Aldeias Altas", 2100303, &geo_ufs[7]},
+	{"Altamira do Maranhão", 2100402, &geo_ufs[7]},
+	{"Alto Alegre do Maranhão", 2100436, &geo_ufs[7]},
+	{"Alto Alegre do Pindaré", 2100477, &geo_ufs[7]},
+	{"Alto Parnaíba", 2100501, &geo_ufs[7]},
+	{"Amapá do Maranhão", 2100550, &geo_ufs[7]},
+	{"Amarante do Maranhão", 2100600, &geo_ufs[7]},
+	{"Anajatuba", 2100709, &geo_ufs[7]},
+	{"Anapurus", 2100808, &geo_ufs[7]},
+	{"Apicum-Açu", 2100832, &geo_ufs[7]},
+	{"Araguanã", 2100873, &geo_ufs[7]},
+	{"Araioses", 2100907, &geo_ufs[7]},
+	{"Arame", 2100956, &geo_ufs[7]},
+	{"Arari", 2101004, &geo_ufs[7]},
+	{"Axixá", 2101103, &geo_ufs[7]},
+	{"Bacabal", 2101202, &geo_ufs[7]},
+	{"Bacabeira", 2101251, &geo_ufs[7]},
+	{"Bacuri", 2101301, &geo_ufs[7]},
+	{"Bacurituba", 2101350, &geo_ufs[7]},
+	{"Balsas", 2101400, &geo_ufs[7]},
+	{"Barão de Grajaú", 2101509, &geo_ufs[7]},
+	{"Barra do Corda", 2101608, &geo_ufs[7]},
+	{"Barreirinhas", 2101707, &geo_ufs[7]},
+	{"Belágua", 2101731, &geo_ufs[7]},
+	{"Bela Vista do Maranhão", 2101772, &geo_ufs[7]},
+	{"Benedito Leite", 2101806, &geo_ufs[7]},
+	{"Bequimão", 2101905, &geo_ufs[7]},
+	{"Bernardo do Mearim", 2101939, &geo_ufs[7]},
+	{"Boa Vista do Gurupi", 2101970, &geo_ufs[7]},
+	{"Bom Jardim", 2102002, &geo_ufs[7]},
+	{"Bom Jesus das Selvas", 2102036, &geo_ufs[7]},
+	{"Bom Lugar", 2102077, &geo_ufs[7]},
+	{"Brejo", 2102101, &geo_ufs[7]},
+	{"Brejo de Areia", 2102150, &geo_ufs[7]},
+	{"Buriti", 2102200, &geo_ufs[7]},
+	{"Buriti Bravo", 2102309, &geo_ufs[7]},
+	{"Buriticupu", 2102325, &geo_ufs[7]},
+	{"Buritirana", 2102358, &geo_ufs[7]},
+	{"Cachoeira Grande", 2102374, &geo_ufs[7]},
+	{"Cajapió", 2102408, &geo_ufs[7]},
+	{"Cajari", 2102507, &geo_ufs[7]},
+	{"Campestre do Maranhão", 2102556, &geo_ufs[7]},
+	{"Cândido Mendes", 2102606, &geo_ufs[7]},
+	{"Cantanhede", 2102705, &geo_ufs[7]},
+	{"Capinzal do Norte", 2102754, &geo_ufs[7]},
+	{"Carolina", 2102804, &geo_ufs[7]},
+	{"Carutapera", 2102903, &geo_ufs[7]},
+	{"Caxias", 2103000, &geo_ufs[7]},
+	{"Cedral", 2103109, &geo_ufs[7]},
+	{"Central do Maranhão", 2103125, &geo_ufs[7]},
+	{"Centro do Guilherme", 2103158, &geo_ufs[7]},
+	{"Centro Novo do Maranhão", 2103174, &geo_ufs[7]},
+	{"Chapadinha", 2103208, &geo_ufs[7]},
+	{"Cidelândia", 2103257, &geo_ufs[7]},
+	{"Codó", 2103307, &geo_ufs[7]},
+	{"Coelho Neto", 2103406, &geo_ufs[7]},
+	{"Colinas", 2103505, &geo_ufs[7]},
+	{"Conceição do Lago-Açu", 2103554, &geo_ufs[7]},
+	{"Coroatá", 2103604, &geo_ufs[7]},
+	{"Cururupu", 2103703, &geo_ufs[7]},
+	{"Davinópolis", 2103752, &geo_ufs[7]},
+	{"Dom Pedro", 2103802, &geo_ufs[7]},
+	{"Duque Bacelar", 2103901, &geo_ufs[7]},
+	{"Esperantinópolis", 2104008, &geo_ufs[7]},
+	{"Estreito", 2104057, &geo_ufs[7]},
+	{"Feira Nova do Maranhão", 2104073, &geo_ufs[7]},
+	{"Fernando Falcão", 2104081, &geo_ufs[7]},
+	{"Formosa da Serra Negra", 2104099, &geo_ufs[7]},
+	{"Fortaleza dos Nogueiras", 2104107, &geo_ufs[7]},
+	{"Fortuna", 2104206, &geo_ufs[7]},
+	{"Godofredo Viana", 2104305, &geo_ufs[7]},
+	{"Gonçalves Dias", 2104404, &geo_ufs[7]},
+	{"Governador Archer", 2104503, &geo_ufs[7]},
+	{"Governador Edison Lobão", 2104552, &geo_ufs[7]},
+	{"Governador Eugênio Barros", 2104602, &geo_ufs[7]},
+	{"Governador Luiz Rocha", 2104628, &geo_ufs[7]},
+	{"Governador Newton Bello", 2104651, &geo_ufs[7]},
+	{"Governador Nunes Freire", 2104677, &geo_ufs[7]},
+	{"Graça Aranha", 2104701, &geo_ufs[7]},
+	{"Grajaú", 2104800, &geo_ufs[7]},
+	{"Guimarães", 2104909, &geo_ufs[7]},
+	{"Humberto de Campos", 2105005, &geo_ufs[7]},
+	{"Icatu", 2105104, &geo_ufs[7]},
+	{"Igarapé do Meio", 2105153, &geo_ufs[7]},
+	{"Igarapé Grande", 2105203, &geo_ufs[7]},
+	{"Imperatriz", 2105302, &geo_ufs[7]},
+	{"Itaipava do Grajaú", 2105351, &geo_ufs[7]},
+	{"Itapecuru Mirim", 2105401, &geo_ufs[7]},
+	{"Itinga do Maranhão", 2105427, &geo_ufs[7]},
+	{"Jatobá", 2105450, &geo_ufs[7]},
+	{"Jenipapo dos Vieiras", 2105476, &geo_ufs[7]},
+	{"João Lisboa", 2105500, &geo_ufs[7]},
+	{"Joselândia", 2105609, &geo_ufs[7]},
+	{"Junco do Maranhão", 2105658, &geo_ufs[7]},
+	{"Lago da Pedra", 2105708, &geo_ufs[7]},
+	{"Lago do Junco", 2105807, &geo_ufs[7]},
+	{"Lago Verde", 2105906, &geo_ufs[7]},
+	{"Lagoa do Mato", 2105922, &geo_ufs[7]},
+	{"Lago dos Rodrigues", 2105948, &geo_ufs[7]},
+	{"Lagoa Grande do Maranhão", 2105963, &geo_ufs[7]},
+	{"Lajeado Novo", 2105989, &geo_ufs[7]},
+	{"Lima Campos", 2106003, &geo_ufs[7]},
+	{"Loreto", 2106102, &geo_ufs[7]},
+	{"Luís Domingues", 2106201, &geo_ufs[7]},
+	{"Magalhães de Almeida", 2106300, &geo_ufs[7]},
+	{"Maracaçumé", 2106326, &geo_ufs[7]},
+	{"Marajá do Sena", 2106359, &geo_ufs[7]},
+	{"Maranhãozinho", 2106375, &geo_ufs[7]},
+	{"Mata Roma", 2106409, &geo_ufs[7]},
+	{"Matinha", 2106508, &geo_ufs[7]},
+	{"Matões", 2106607, &geo_ufs[7]},
+	{"Matões do Norte", 2106631, &geo_ufs[7]},
+	{"Milagres do Maranhão", 2106672, &geo_ufs[7]},
+	{"Mirador", 2106706, &geo_ufs[7]},
+	{"Miranda do Norte", 2106755, &geo_ufs[7]},
+	{"Mirinzal", 2106805, &geo_ufs[7]},
+	{"Monção", 2106904, &geo_ufs[7]},
+	{"Montes Altos", 2107001, &geo_ufs[7]},
+	{"Morros", 2107100, &geo_ufs[7]},
+	{"Nina Rodrigues", 2107209, &geo_ufs[7]},
+	{"Nova Colinas", 2107258, &geo_ufs[7]},
+	{"Nova Iorque", 2107308, &geo_ufs[7]},
+	{"Nova Olinda do Maranhão", 2107357, &geo_ufs[7]},
+	{"Olho d'Água das Cunhãs", 2107407, &geo_ufs[7]},
+	{"Olinda Nova do Maranhão", 2107456, &geo_ufs[7]},
+	{"Paço do Lumiar", 2107506, &geo_ufs[7]},
+	{"Palmeirândia", 2107605, &geo_ufs[7]},
+	{"Paraibano", 2107704, &geo_ufs[7]},
+	{"Parnarama", 2107803, &geo_ufs[7]},
+	{"Passagem Franca", 2107902, &geo_ufs[7]},
+	{"Pastos Bons", 2108009, &geo_ufs[7]},
+	{"Paulino Neves", 2108058, &geo_ufs[7]},
+	{"Paulo Ramos", 2108108, &geo_ufs[7]},
+	{"Pedreiras", 2108207, &geo_ufs[7]},
+	{"Pedro do Rosário", 2108256, &geo_ufs[7]},
+	{"Penalva", 2108306, &geo_ufs[7]},
+	{"Peri Mirim", 2108405, &geo_ufs[7]},
+	{"Peritoró", 2108454, &geo_ufs[7]},
+	{"Pindaré-Mirim", 2108504, &geo_ufs[7]},
+	{"Pinheiro", 2108603, &geo_ufs[7]},
+	{"Pio XII", 2108702, &geo_ufs[7]},
+	{"Pirapemas", 2108801, &geo_ufs[7]},
+	{"Poção de Pedras", 2108900, &geo_ufs[7]},
+	{"Porto Franco", 2109007, &geo_ufs[7]},
+	{"Porto Rico do Maranhão", 2109056, &geo_ufs[7]},
+	{"Presidente Dutra", 2109106, &geo_ufs[7]},
+	{"Presidente Juscelino", 2109205, &geo_ufs[7]},
+	{"Presidente Médici", 2109239, &geo_ufs[7]},
+	{"Presidente Sarney", 2109270, &geo_ufs[7]},
+	{"Presidente Vargas", 2109304, &geo_ufs[7]},
+	{"Primeira Cruz", 2109403, &geo_ufs[7]},
+	{"Raposa", 2109452, &geo_ufs[7]},
+	{"Riachão", 2109502, &geo_ufs[7]},
+	{"Ribamar Fiquene", 2109551, &geo_ufs[7]},
+	{"Rosário", 2109601, &geo_ufs[7]},
+	{"Sambaíba", 2109700, &geo_ufs[7]},
+	{"Santa Filomena do Maranhão", 2109759, &geo_ufs[7]},
+	{"Santa Helena", 2109809, &geo_ufs[7]},
+	{"Santa Inês", 2109908, &geo_ufs[7]},
+	{"Santa Luzia", 2110005, &geo_ufs[7]},
+	{"Santa Luzia do Paruá", 2110039, &geo_ufs[7]},
+	{"Santa Quitéria do Maranhão", 2110104, &geo_ufs[7]},
+	{"Santa Rita", 2110203, &geo_ufs[7]},
+	{"Santana do Maranhão", 2110237, &geo_ufs[7]},
+	{"Santo Amaro do Maranhão", 2110278, &geo_ufs[7]},
+	{"Santo Antônio dos Lopes", 2110302, &geo_ufs[7]},
+	{"São Benedito do Rio Preto", 2110401, &geo_ufs[7]},
+	{"São Bento", 2110500, &geo_ufs[7]},
+	{"São Bernardo", 2110609, &geo_ufs[7]},
+	{"São Domingos do Azeitão", 2110658, &geo_ufs[7]},
+	{"São Domingos do Maranhão", 2110708, &geo_ufs[7]},
+	{"São Félix de Balsas", 2110807, &geo_ufs[7]},
+	{"São Francisco do Brejão", 2110856, &geo_ufs[7]},
+	{"São Francisco do Maranhão", 2110906, &geo_ufs[7]},
+	{"São João Batista", 2111003, &geo_ufs[7]},
+	{"São João do Carú", 2111029, &geo_ufs[7]},
+	{"São João do Paraíso", 2111052, &geo_ufs[7]},
+	{"São João do Soter", 2111078, &geo_ufs[7]},
+	{"São João dos Patos", 2111102, &geo_ufs[7]},
+	{"São José de Ribamar", 2111201, &geo_ufs[7]},
+	{"São José dos Basílios", 2111250, &geo_ufs[7]},
+	{"São Luís", 2111300, &geo_ufs[7]},
+	{"São Luís Gonzaga do Maranhão", 2111409, &geo_ufs[7]},
+	{"São Mateus do Maranhão", 2111508, &geo_ufs[7]},
+	{"São Pedro da Água Branca", 2111532, &geo_ufs[7]},
+	{"São Pedro dos Crentes", 2111573, &geo_ufs[7]},
+	{"São Raimundo das Mangabeiras", 2111607, &geo_ufs[7]},
+	{"São Raimundo do Doca Bezerra", 2111631, &geo_ufs[7]},
+	{"São Roberto", 2111672, &geo_ufs[7]},
+	{"São Vicente Ferrer", 2111706, &geo_ufs[7]},
+	{"Satubinha", 2111722, &geo_ufs[7]},
+	{"Senador Alexandre Costa", 2111748, &geo_ufs[7]},
+	{"Senador La Rocque", 2111763, &geo_ufs[7]},
+	{"Serrano do Maranhão", 2111789, &geo_ufs[7]},
+	{"Sítio Novo", 2111805, &geo_ufs[7]},
+	{"Sucupira do Norte", 2111904, &geo_ufs[7]},
+	{"Sucupira do Riachão", 2111953, &geo_ufs[7]},
+	{"Tasso Fragoso", 2112001, &geo_ufs[7]},
+	{"Timbiras", 2112100, &geo_ufs[7]},
+	{"Timon", 2112209, &geo_ufs[7]},
+	{"Trizidela do Vale", 2112233, &geo_ufs[7]},
+	{"Tufilândia", 2112274, &geo_ufs[7]},
+	{"Tuntum", 2112308, &geo_ufs[7]},
+	{"Turiaçu", 2112407, &geo_ufs[7]},
+	{"Turilândia", 2112456, &geo_ufs[7]},
+	{"Tutóia", 2112506, &geo_ufs[7]},
+	{"Urbano Santos", 2112605, &geo_ufs[7]},
+	{"Vargem Grande", 2112704, &geo_ufs[7]},
+	{"Viana", 2112803, &geo_ufs[7]},
+	{"Vila Nova dos Martírios", 2112852, &geo_ufs[7]},
+	{"Vitória do Mearim", 2112902, &geo_ufs[7]},
+	{"Vitorino Freire", 2113009, &geo_ufs[7]},
+	{"Zé Doca", 2114007, &geo_ufs[7]},
+	{"Acauã", 2200053, &geo_ufs[8]},
+	{"Agricolândia", 2200103, &geo_ufs[8]},
+	{"Água Branca", 2200202, &geo_ufs[8]},
+	{"Alagoinha do Piauí", 2200251, &geo_ufs[8]},
+	{"Alegrete do Piauí", 2200277, &geo_ufs[8]},
+	{"Alto Longá", 2200301, &geo_ufs[8]},
+	{"Altos", 2200400, &geo_ufs[8]},
+	{"Alvorada do Gurguéia", 2200459, &geo_ufs[8]},
+	{"Amarante", 2200509, &geo_ufs[8]},
+	{"Angical do Piauí", 2200608, &geo_ufs[8]},
+	{"Anísio de Abreu", 2200707, &geo_ufs[8]},
+	{"Antônio Almeida", 2200806, &geo_ufs[8]},
+	{"Aroazes", 2200905, &geo_ufs[8]},
+	{"Aroeiras do Itaim", 2200954, &geo_ufs[8]},
+	{"Arraial", 2201002, &geo_ufs[8]},
+	{"Assunção do Piauí", 2201051, &geo_ufs[8]},
+	{"Avelino Lopes", 2201101, &geo_ufs[8]},
+	{"Baixa Grande do Ribeiro", 2201150, &geo_ufs[8]},
+	{"Barra D'Alcântara", 2201176, &geo_ufs[8]},
+	{"Barras", 2201200, &geo_ufs[8]},
+	{"Barreiras do Piauí", 2201309, &geo_ufs[8]},
+	{"Barro Duro", 2201408, &geo_ufs[8]},
+	{"Batalha", 2201507, &geo_ufs[8]},
+	{"Bela Vista do Piauí", 2201556, &geo_ufs[8]},
+	{"Belém do Piauí", 2201572, &geo_ufs[8]},
+	{"Beneditinos", 2201606, &geo_ufs[8]},
+	{"Bertolínia", 2201705, &geo_ufs[8]},
+	{"Betânia do Piauí", 2201739, &geo_ufs[8]},
+	{"Boa Hora", 2201770, &geo_ufs[8]},
+	{"Bocaina", 2201804, &geo_ufs[8]},
+	{"Bom Jesus", 2201903, &geo_ufs[8]},
+	{"Bom Princípio do Piauí", 2201919, &geo_ufs[8]},
+	{"Bonfim do Piauí", 2201929, &geo_ufs[8]},
+	{"Boqueirão do Piauí", 2201945, &geo_ufs[8]},
+	{"Brasileira", 2201960, &geo_ufs[8]},
+	{"Brejo do Piauí", 2201988, &geo_ufs[8]},
+	{"Buriti dos Lopes", 2202000, &geo_ufs[8]},
+	{"Buriti dos Montes", 2202026, &geo_ufs[8]},
+	{"Cabeceiras do Piauí", 2202059, &geo_ufs[8]},
+	{"Cajazeiras do Piauí", 2202075, &geo_ufs[8]},
+	{"Cajueiro da Praia", 2202083, &geo_ufs[8]},
+	{"Caldeirão Grande do Piauí", 2202091, &geo_ufs[8]},
+	{"Campinas do Piauí", 2202109, &geo_ufs[8]},
+	{"Campo Alegre do Fidalgo", 2202117, &geo_ufs[8]},
+	{"Campo Grande do Piauí", 2202133, &geo_ufs[8]},
+	{"Campo Largo do Piauí", 2202174, &geo_ufs[8]},
+	{"Campo Maior", 2202208, &geo_ufs[8]},
+	{"Canavieira", 2202251, &geo_ufs[8]},
+	{"Canto do Buriti", 2202307, &geo_ufs[8]},
+	{"Capitão de Campos", 2202406, &geo_ufs[8]},
+	{"Capitão Gervásio Oliveira", 2202455, &geo_ufs[8]},
+	{"Caracol", 2202505, &geo_ufs[8]},
+	{"Caraúbas do Piauí", 2202539, &geo_ufs[8]},
+	{"Caridade do Piauí", 2202554, &geo_ufs[8]},
+	{"Castelo do Piauí", 2202604, &geo_ufs[8]},
+	{"Caxingó", 2202653, &geo_ufs[8]},
+	{"Cocal", 2202703, &geo_ufs[8]},
+	{"Cocal de Telha", 2202711, &geo_ufs[8]},
+	{"Cocal dos Alves", 2202729, &geo_ufs[8]},
+	{"Coivaras", 2202737, &geo_ufs[8]},
+	{"Colônia do Gurguéia", 2202752, &geo_ufs[8]},
+	{"Colônia do Piauí", 2202778, &geo_ufs[8]},
+	{"Conceição do Canindé", 2202802, &geo_ufs[8]},
+	{"Coronel José Dias", 2202851, &geo_ufs[8]},
+	{"Corrente", 2202901, &geo_ufs[8]},
+	{"Cristalândia do Piauí", 2203008, &geo_ufs[8]},
+	{"Cristino Castro", 2203107, &geo_ufs[8]},
+	{"Curimatá", 2203206, &geo_ufs[8]},
+	{"Currais", 2203230, &geo_ufs[8]},
+	{"Curralinhos", 2203255, &geo_ufs[8]},
+	{"Curral Novo do Piauí", 2203271, &geo_ufs[8]},
+	{"Demerval Lobão", 2203305, &geo_ufs[8]},
+	{"Dirceu Arcoverde", 2203354, &geo_ufs[8]},
+	{"Dom Expedito Lopes", 2203404, &geo_ufs[8]},
+	{"Domingos Mourão", 2203420, &geo_ufs[8]},
+	{"Dom Inocêncio", 2203453, &geo_ufs[8]},
+	{"Elesbão Veloso", 2203503, &geo_ufs[8]},
+	{"Eliseu Martins", 2203602, &geo_ufs[8]},
+	{"Esperantina", 2203701, &geo_ufs[8]},
+	{"Fartura do Piauí", 2203750, &geo_ufs[8]},
+	{"Flores do Piauí", 2203800, &geo_ufs[8]},
+	{"Floresta do Piauí", 2203859, &geo_ufs[8]},
+	{"Floriano", 2203909, &geo_ufs[8]},
+	{"Francinópolis", 2204006, &geo_ufs[8]},
+	{"Francisco Ayres", 2204105, &geo_ufs[8]},
+	{"Francisco Macedo", 2204154, &geo_ufs[8]},
+	{"Francisco Santos", 2204204, &geo_ufs[8]},
+	{"Fronteiras", 2204303, &geo_ufs[8]},
+	{"Geminiano", 2204352, &geo_ufs[8]},
+	{"Gilbués", 2204402, &geo_ufs[8]},
+	{"Guadalupe", 2204501, &geo_ufs[8]},
+	{"Guaribas", 2204550, &geo_ufs[8]},
+	{"Hugo Napoleão", 2204600, &geo_ufs[8]},
+	{"Ilha Grande", 2204659, &geo_ufs[8]},
+	{"Inhuma", 2204709, &geo_ufs[8]},
+	{"Ipiranga do Piauí", 2204808, &geo_ufs[8]},
+	{"Isaías Coelho", 2204907, &geo_ufs[8]},
+	{"Itainópolis", 2205003, &geo_ufs[8]},
+	{"Itaueira", 2205102, &geo_ufs[8]},
+	{"Jacobina do Piauí", 2205151, &geo_ufs[8]},
+	{"Jaicós", 2205201, &geo_ufs[8]},
+	{"Jardim do Mulato", 2205250, &geo_ufs[8]},
+	{"Jatobá do Piauí", 2205276, &geo_ufs[8]},
+	{"Jerumenha", 2205300, &geo_ufs[8]},
+	{"João Costa", 2205359, &geo_ufs[8]},
+	{"Joaquim Pires", 2205409, &geo_ufs[8]},
+	{"Joca Marques", 2205458, &geo_ufs[8]},
+	{"José de Freitas", 2205508, &geo_ufs[8]},
+	{"Juazeiro do Piauí", 2205516, &geo_ufs[8]},
+	{"Júlio Borges", 2205524, &geo_ufs[8]},
+	{"Jurema", 2205532, &geo_ufs[8]},
+	{"Lagoinha do Piauí", 2205540, &geo_ufs[8]},
+	{"Lagoa Alegre", 2205557, &geo_ufs[8]},
+	{"Lagoa do Barro do Piauí", 2205565, &geo_ufs[8]},
+	{"Lagoa de São Francisco", 2205573, &geo_ufs[8]},
+	{"Lagoa do Piauí", 2205581, &geo_ufs[8]},
+	{"Lagoa do Sítio", 2205599, &geo_ufs[8]},
+	{"Landri Sales", 2205607, &geo_ufs[8]},
+	{"Luís Correia", 2205706, &geo_ufs[8]},
+	{"Luzilândia", 2205805, &geo_ufs[8]},
+	{"Madeiro", 2205854, &geo_ufs[8]},
+	{"Manoel Emídio", 2205904, &geo_ufs[8]},
+	{"Marcolândia", 2205953, &geo_ufs[8]},
+	{"Marcos Parente", 2206001, &geo_ufs[8]},
+	{"Massapê do Piauí", 2206050, &geo_ufs[8]},
+	{"Matias Olímpio", 2206100, &geo_ufs[8]},
+	{"Miguel Alves", 2206209, &geo_ufs[8]},
+	{"Miguel Leão", 2206308, &geo_ufs[8]},
+	{"Milton Brandão", 2206357, &geo_ufs[8]},
+	{"Monsenhor Gil", 2206407, &geo_ufs[8]},
+	{"Monsenhor Hipólito", 2206506, &geo_ufs[8]},
+	{"Monte Alegre do Piauí", 2206605, &geo_ufs[8]},
+	{"Morro Cabeça no Tempo", 2206654, &geo_ufs[8]},
+	{"Morro do Chapéu do Piauí", 2206670, &geo_ufs[8]},
+	{"Murici dos Portelas", 2206696, &geo_ufs[8]},
+	{"Nazaré do Piauí", 2206704, &geo_ufs[8]},
+	{"Nazária ", 2206720, &geo_ufs[8]},
+	{"Nossa Senhora de Nazaré", 2206753, &geo_ufs[8]},
+	{"Nossa Senhora dos Remédios", 2206803, &geo_ufs[8]},
+	{"Novo Oriente do Piauí", 2206902, &geo_ufs[8]},
+	{"Novo Santo Antônio", 2206951, &geo_ufs[8]},
+	{"Oeiras", 2207009, &geo_ufs[8]},
+	{"Olho D'Água do Piauí", 2207108, &geo_ufs[8]},
+	{"Padre Marcos", 2207207, &geo_ufs[8]},
+	{"Paes Landim", 2207306, &geo_ufs[8]},
+	{"Pajeú do Piauí", 2207355, &geo_ufs[8]},
+	{"Palmeira do Piauí", 2207405, &geo_ufs[8]},
+	{"Palmeirais", 2207504, &geo_ufs[8]},
+	{"Paquetá", 2207553, &geo_ufs[8]},
+	{"Parnaguá", 2207603, &geo_ufs[8]},
+	{"Parnaíba", 2207702, &geo_ufs[8]},
+	{"Passagem Franca do Piauí", 2207751, &geo_ufs[8]},
+	{"Patos do Piauí", 2207777, &geo_ufs[8]},
+	{"Pau D'Arco do Piauí", 2207793, &geo_ufs[8]},
+	{"Paulistana", 2207801, &geo_ufs[8]},
+	{"Pavussu", 2207850, &geo_ufs[8]},
+	{"Pedro II", 2207900, &geo_ufs[8]},
+	{"Pedro Laurentino", 2207934, &geo_ufs[8]},
+	{"Nova Santa Rita", 2207959, &geo_ufs[8]},
+	{"Picos", 2208007, &geo_ufs[8]},
+	{"Pimenteiras", 2208106, &geo_ufs[8]},
+	{"Pio IX", 2208205, &geo_ufs[8]},
+	{"Piracuruca", 2208304, &geo_ufs[8]},
+	{"Piripiri", 2208403, &geo_ufs[8]},
+	{"Porto", 2208502, &geo_ufs[8]},
+	{"Porto Alegre do Piauí", 2208551, &geo_ufs[8]},
+	{"Prata do Piauí", 2208601, &geo_ufs[8]},
+	{"Queimada Nova", 2208650, &geo_ufs[8]},
+	{"Redenção do Gurguéia", 2208700, &geo_ufs[8]},
+	{"Regeneração", 2208809, &geo_ufs[8]},
+	{"Riacho Frio", 2208858, &geo_ufs[8]},
+	{"Ribeira do Piauí", 2208874, &geo_ufs[8]},
+	{"Ribeiro Gonçalves", 2208908, &geo_ufs[8]},
+	{"Rio Grande do Piauí", 2209005, &geo_ufs[8]},
+	{"Santa Cruz do Piauí", 2209104, &geo_ufs[8]},
+	{"Santa Cruz dos Milagres", 2209153, &geo_ufs[8]},
+	{"Santa Filomena", 2209203, &geo_ufs[8]},
+	{"Santa Luz", 2209302, &geo_ufs[8]},
+	{"Santana do Piauí", 2209351, &geo_ufs[8]},
+	{"Santa Rosa do Piauí", 2209377, &geo_ufs[8]},
+	{"Santo Antônio de Lisboa", 2209401, &geo_ufs[8]},
+	{"Santo Antônio dos Milagres", 2209450, &geo_ufs[8]},
+	{"Santo Inácio do Piauí", 2209500, &geo_ufs[8]},
+	{"São Braz do Piauí", 2209559, &geo_ufs[8]},
+	{"São Félix do Piauí", 2209609, &geo_ufs[8]},
+	{"São Francisco de Assis do Piauí", 2209658, &geo_ufs[8]},
+	{"São Francisco do Piauí", 2209708, &geo_ufs[8]},
+	{"São Gonçalo do Gurguéia", 2209757, &geo_ufs[8]},
+	{"São Gonçalo do Piauí", 2209807, &geo_ufs[8]},
+	{"São João da Canabrava", 2209856, &geo_ufs[8]},
+	{"São João da Fronteira", 2209872, &geo_ufs[8]},
+	{"São João da Serra", 2209906, &geo_ufs[8]},
+	{"São João da Varjota", 2209955, &geo_ufs[8]},
+	{"São João do Arraial", 2209971, &geo_ufs[8]},
+	{"São João do Piauí", 2210003, &geo_ufs[8]},
+	{"São José do Divino", 2210052, &geo_ufs[8]},
+	{"São José do Peixe", 2210102, &geo_ufs[8]},
+	{"São José do Piauí", 2210201, &geo_ufs[8]},
+	{"São Julião", 2210300, &geo_ufs[8]},
+	{"São Lourenço do Piauí", 2210359, &geo_ufs[8]},
+	{"São Luis do Piauí", 2210375, &geo_ufs[8]},
+	{"São Miguel da Baixa Grande", 2210383, &geo_ufs[8]},
+	{"São Miguel do Fidalgo", 2210391, &geo_ufs[8]},
+	{"São Miguel do Tapuio", 2210409, &geo_ufs[8]},
+	{"São Pedro do Piauí", 2210508, &geo_ufs[8]},
+	{"São Raimundo Nonato", 2210607, &geo_ufs[8]},
+	{"Sebastião Barros", 2210623, &geo_ufs[8]},
+	{"Sebastião Leal", 2210631, &geo_ufs[8]},
+	{"Sigefredo Pacheco", 2210656, &geo_ufs[8]},
+	{"Simões", 2210706, &geo_ufs[8]},
+	{"Simplício Mendes", 2210805, &geo_ufs[8]},
+	{"Socorro do Piauí", 2210904, &geo_ufs[8]},
+	{"Sussuapara", 2210938, &geo_ufs[8]},
+	{"Tamboril do Piauí", 2210953, &geo_ufs[8]},
+	{"Tanque do Piauí", 2210979, &geo_ufs[8]},
+	{"Teresina", 2211001, &geo_ufs[8]},
+	{"União", 2211100, &geo_ufs[8]},
+	{"Uruçuí", 2211209, &geo_ufs[8]},
+	{"Valença do Piauí", 2211308, &geo_ufs[8]},
+	{"Várzea Branca", 2211357, &geo_ufs[8]},
+	{"Várzea Grande", 2211407, &geo_ufs[8]},
+	{"Vera Mendes", 2211506, &geo_ufs[8]},
+	{"Vila Nova do Piauí", 2211605, &geo_ufs[8]},
+	{"Wall Ferraz", 2211704, &geo_ufs[8]},
+	{"Abaiara", 2300101, &geo_ufs[9]},
+	{"Acarape", 2300150, &geo_ufs[9]},
+	{"Acaraú", 2300200, &geo_ufs[9]},
+	{"Acopiara", 2300309, &geo_ufs[9]},
+	{"Aiuaba", 2300408, &geo_ufs[9]},
+	{"Alcântaras", 2300507, &geo_ufs[9]},
+	{"Altaneira", 2300606, &geo_ufs[9]},
+	{"Alto Santo", 2300705, &geo_ufs[9]},
+	{"Amontada", 2300754, &geo_ufs[9]},
+	{"Antonina do Norte", 2300804, &geo_ufs[9]},
+	{"Apuiarés", 2300903, &geo_ufs[9]},
+	{"Aquiraz", 2301000, &geo_ufs[9]},
+	{"Aracati", 2301109, &geo_ufs[9]},
+	{"Aracoiaba", 2301208, &geo_ufs[9]},
+	{"Ararendá", 2301257, &geo_ufs[9]},
+	{"Araripe", 2301307, &geo_ufs[9]},
+	{"Aratuba", 2301406, &geo_ufs[9]},
+	{"Arneiroz", 2301505, &geo_ufs[9]},
+	{"Assaré", 2301604, &geo_ufs[9]},
+	{"Aurora", 2301703, &geo_ufs[9]},
+	{"Baixio", 2301802, &geo_ufs[9]},
+	{"Banabuiú", 2301851, &geo_ufs[9]},
+	{"Barbalha", 2301901, &geo_ufs[9]},
+	{"Barreira", 2301950, &geo_ufs[9]},
+	{"Barro", 2302008, &geo_ufs[9]},
+	{"Barroquinha", 2302057, &geo_ufs[9]},
+	{"Baturité", 2302107, &geo_ufs[9]},
+	{"Beberibe", 2302206, &geo_ufs[9]},
+	{"Bela Cruz", 2302305, &geo_ufs[9]},
+	{"Boa Viagem", 2302404, &geo_ufs[9]},
+	{"Brejo Santo", 2302503, &geo_ufs[9]},
+	{"Camocim", 2302602, &geo_ufs[9]},
+	{"Campos Sales", 2302701, &geo_ufs[9]},
+	{"Canindé", 2302800, &geo_ufs[9]},
+	{"Capistrano", 2302909, &geo_ufs[9]},
+	{"Caridade", 2303006, &geo_ufs[9]},
+	{"Cariré", 2303105, &geo_ufs[9]},
+	{"Caririaçu", 2303204, &geo_ufs[9]},
+	{"Cariús", 2303303, &geo_ufs[9]},
+	{"Carnaubal", 2303402, &geo_ufs[9]},
+	{"Cascavel", 2303501, &geo_ufs[9]},
+	{"Catarina", 2303600, &geo_ufs[9]},
+	{"Catunda", 2303659, &geo_ufs[9]},
+	{"Caucaia", 2303709, &geo_ufs[9]},
+	{"Cedro", 2303808, &geo_ufs[9]},
+	{"Chaval", 2303907, &geo_ufs[9]},
+	{"Choró", 2303931, &geo_ufs[9]},
+	{"Chorozinho", 2303956, &geo_ufs[9]},
+	{"Coreaú", 2304004, &geo_ufs[9]},
+	{"Crateús", 2304103, &geo_ufs[9]},
+	{"Crato", 2304202, &geo_ufs[9]},
+	{"Croatá", 2304236, &geo_ufs[9]},
+	{"Cruz", 2304251, &geo_ufs[9]},
+	{"Deputado Irapuan Pinheiro", 2304269, &geo_ufs[9]},
+	{"Ererê", 2304277, &geo_ufs[9]},
+	{"Eusébio", 2304285, &geo_ufs[9]},
+	{"Farias Brito", 2304301, &geo_ufs[9]},
+	{"Forquilha", 2304350, &geo_ufs[9]},
+	{"Fortaleza", 2304400, &geo_ufs[9]},
+	{"Fortim", 2304459, &geo_ufs[9]},
+	{"Frecheirinha", 2304509, &geo_ufs[9]},
+	{"General Sampaio", 2304608, &geo_ufs[9]},
+	{"Graça", 2304657, &geo_ufs[9]},
+	{"Granja", 2304707, &geo_ufs[9]},
+	{"Granjeiro", 2304806, &geo_ufs[9]},
+	{"Groaíras", 2304905, &geo_ufs[9]},
+	{"Guaiúba", 2304954, &geo_ufs[9]},
+	{"Guaraciaba do Norte", 2305001, &geo_ufs[9]},
+	{"Guaramiranga", 2305100, &geo_ufs[9]},
+	{"Hidrolândia", 2305209, &geo_ufs[9]},
+	{"Horizonte", 2305233, &geo_ufs[9]},
+	{"Ibaretama", 2305266, &geo_ufs[9]},
+	{"Ibiapina", 2305308, &geo_ufs[9]},
+	{"Ibicuitinga", 2305332, &geo_ufs[9]},
+	{"Icapuí", 2305357, &geo_ufs[9]},
+	{"Icó", 2305407, &geo_ufs[9]},
+	{"Iguatu", 2305506, &geo_ufs[9]},
+	{"Independência", 2305605, &geo_ufs[9]},
+	{"Ipaporanga", 2305654, &geo_ufs[9]},
+	{"Ipaumirim", 2305704, &geo_ufs[9]},
+	{"Ipu", 2305803, &geo_ufs[9]},
+	{"Ipueiras", 2305902, &geo_ufs[9]},
+	{"Iracema", 2306009, &geo_ufs[9]},
+	{"Irauçuba", 2306108, &geo_ufs[9]},
+	{"Itaiçaba", 2306207, &geo_ufs[9]},
+	{"Itaitinga", 2306256, &geo_ufs[9]},
+	{"Itapagé", 2306306, &geo_ufs[9]},
+	{"Itapipoca", 2306405, &geo_ufs[9]},
+	{"Itapiúna", 2306504, &geo_ufs[9]},
+	{"Itarema", 2306553, &geo_ufs[9]},
+	{"Itatira", 2306603, &geo_ufs[9]},
+	{"Jaguaretama", 2306702, &geo_ufs[9]},
+	{"Jaguaribara", 2306801, &geo_ufs[9]},
+	{"Jaguaribe", 2306900, &geo_ufs[9]},
+	{"Jaguaruana", 2307007, &geo_ufs[9]},
+	{"Jardim", 2307106, &geo_ufs[9]},
+	{"Jati", 2307205, &geo_ufs[9]},
+	{"Jijoca de Jericoacoara", 2307254, &geo_ufs[9]},
+	{"Juazeiro do Norte", 2307304, &geo_ufs[9]},
+	{"Jucás", 2307403, &geo_ufs[9]},
+	{"Lavras da Mangabeira", 2307502, &geo_ufs[9]},
+	{"Limoeiro do Norte", 2307601, &geo_ufs[9]},
+	{"Madalena", 2307635, &geo_ufs[9]},
+	{"Maracanaú", 2307650, &geo_ufs[9]},
+	{"Maranguape", 2307700, &geo_ufs[9]},
+	{"Marco", 2307809, &geo_ufs[9]},
+	{"Martinópole", 2307908, &geo_ufs[9]},
+	{"Massapê", 2308005, &geo_ufs[9]},
+	{"Mauriti", 2308104, &geo_ufs[9]},
+	{"Meruoca", 2308203, &geo_ufs[9]},
+	{"Milagres", 2308302, &geo_ufs[9]},
+	{"Milhã", 2308351, &geo_ufs[9]},
+	{"Miraíma", 2308377, &geo_ufs[9]},
+	{"Missão Velha", 2308401, &geo_ufs[9]},
+	{"Mombaça", 2308500, &geo_ufs[9]},
+	{"Monsenhor Tabosa", 2308609, &geo_ufs[9]},
+	{"Morada Nova", 2308708, &geo_ufs[9]},
+	{"Moraújo", 2308807, &geo_ufs[9]},
+	{"Morrinhos", 2308906, &geo_ufs[9]},
+	{"Mucambo", 2309003, &geo_ufs[9]},
+	{"Mulungu", 2309102, &geo_ufs[9]},
+	{"Nova Olinda", 2309201, &geo_ufs[9]},
+	{"Nova Russas", 2309300, &geo_ufs[9]},
+	{"Novo Oriente", 2309409, &geo_ufs[9]},
+	{"Ocara", 2309458, &geo_ufs[9]},
+	{"Orós", 2309508, &geo_ufs[9]},
+	{"Pacajus", 2309607, &geo_ufs[9]},
+	{"Pacatuba", 2309706, &geo_ufs[9]},
+	{"Pacoti", 2309805, &geo_ufs[9]},
+	{"Pacujá", 2309904, &geo_ufs[9]},
+	{"Palhano", 2310001, &geo_ufs[9]},
+	{"Palmácia", 2310100, &geo_ufs[9]},
+	{"Paracuru", 2310209, &geo_ufs[9]},
+	{"Paraipaba", 2310258, &geo_ufs[9]},
+	{"Parambu", 2310308, &geo_ufs[9]},
+	{"Paramoti", 2310407, &geo_ufs[9]},
+	{"Pedra Branca", 2310506, &geo_ufs[9]},
+	{"Penaforte", 2310605, &geo_ufs[9]},
+	{"Pentecoste", 2310704, &geo_ufs[9]},
+	{"Pereiro", 2310803, &geo_ufs[9]},
+	{"Pindoretama", 2310852, &geo_ufs[9]},
+	{"Piquet Carneiro", 2310902, &geo_ufs[9]},
+	{"Pires Ferreira", 2310951, &geo_ufs[9]},
+	{"Poranga", 2311009, &geo_ufs[9]},
+	{"Porteiras", 2311108, &geo_ufs[9]},
+	{"Potengi", 2311207, &geo_ufs[9]},
+	{"Potiretama", 2311231, &geo_ufs[9]},
+	{"Quiterianópolis", 2311264, &geo_ufs[9]},
+	{"Quixadá", 2311306, &geo_ufs[9]},
+	{"Quixelô", 2311355, &geo_ufs[9]},
+	{"Quixeramobim", 2311405, &geo_ufs[9]},
+	{"Quixeré", 2311504, &geo_ufs[9]},
+	{"Redenção", 2311603, &geo_ufs[9]},
+	{"Reriutaba", 2311702, &geo_ufs[9]},
+	{"Russas", 2311801, &geo_ufs[9]},
+	{"Saboeiro", 2311900, &geo_ufs[9]},
+	{"Salitre", 2311959, &geo_ufs[9]},
+	{"Santana do Acaraú", 2312007, &geo_ufs[9]},
+	{"Santana do Cariri", 2312106, &geo_ufs[9]},
+	{"Santa Quitéria", 2312205, &geo_ufs[9]},
+	{"São Benedito", 2312304, &geo_ufs[9]},
+	{"São Gonçalo do Amarante", 2312403, &geo_ufs[9]},
+	{"São João do Jaguaribe", 2312502, &geo_ufs[9]},
+	{"São Luís do Curu", 2312601, &geo_ufs[9]},
+	{"Senador Pompeu", 2312700, &geo_ufs[9]},
+	{"Senador Sá", 2312809, &geo_ufs[9]},
+	{"Sobral", 2312908, &geo_ufs[9]},
+	{"Solonópole", 2313005, &geo_ufs[9]},
+	{"Tabuleiro do Norte", 2313104, &geo_ufs[9]},
+	{"Tamboril", 2313203, &geo_ufs[9]},
+	{"Tarrafas", 2313252, &geo_ufs[9]},
+	{"Tauá", 2313302, &geo_ufs[9]},
+	{"Tejuçuoca", 2313351, &geo_ufs[9]},
+	{"Tianguá", 2313401, &geo_ufs[9]},
+	{"Trairi", 2313500, &geo_ufs[9]},
+	{"Tururu", 2313559, &geo_ufs[9]},
+	{"Ubajara", 2313609, &geo_ufs[9]},
+	{"Umari", 2313708, &geo_ufs[9]},
+	{"Umirim", 2313757, &geo_ufs[9]},
+	{"Uruburetama", 2313807, &geo_ufs[9]},
+	{"Uruoca", 2313906, &geo_ufs[9]},
+	{"Varjota", 2313955, &geo_ufs[9]},
+	{"Várzea Alegre", 2314003, &geo_ufs[9]},
+	{"Viçosa do Ceará", 2314102, &geo_ufs[9]},
+	{"Acari", 2400109, &geo_ufs[10]},
+	{"Açu", 2400208, &geo_ufs[10]},
+	{"Afonso Bezerra", 2400307, &geo_ufs[10]},
+	{"Água Nova", 2400406, &geo_ufs[10]},
+	{"Alexandria", 2400505, &geo_ufs[10]},
+	{"Almino Afonso", 2400604, &geo_ufs[10]},
+	{"Alto do Rodrigues", 2400703, &geo_ufs[10]},
+	{"Angicos", 2400802, &geo_ufs[10]},
+	{"Antônio Martins", 2400901, &geo_ufs[10]},
+	{"Apodi", 2401008, &geo_ufs[10]},
+	{"Areia Branca", 2401107, &geo_ufs[10]},
+	{"Arês", 2401206, &geo_ufs[10]},
+	{"Augusto Severo", 2401305, &geo_ufs[10]},
+	{"Baía Formosa", 2401404, &geo_ufs[10]},
+	{"Baraúna", 2401453, &geo_ufs[10]},
+	{"Barcelona", 2401503, &geo_ufs[10]},
+	{"Bento Fernandes", 2401602, &geo_ufs[10]},
+	{"Bodó", 2401651, &geo_ufs[10]},
+	{"Bom Jesus", 2401701, &geo_ufs[10]},
+	{"Brejinho", 2401800, &geo_ufs[10]},
+	{"Caiçara do Norte", 2401859, &geo_ufs[10]},
+	{"Caiçara do Rio do Vento", 2401909, &geo_ufs[10]},
+	{"Caicó", 2402006, &geo_ufs[10]},
+	{"Campo Redondo", 2402105, &geo_ufs[10]},
+	{"Canguaretama", 2402204, &geo_ufs[10]},
+	{"Caraúbas", 2402303, &geo_ufs[10]},
+	{"Carnaúba dos Dantas", 2402402, &geo_ufs[10]},
+	{"Carnaubais", 2402501, &geo_ufs[10]},
+	{"Ceará-Mirim", 2402600, &geo_ufs[10]},
+	{"Cerro Corá", 2402709, &geo_ufs[10]},
+	{"Coronel Ezequiel", 2402808, &geo_ufs[10]},
+	{"Coronel João Pessoa", 2402907, &geo_ufs[10]},
+	{"Cruzeta", 2403004, &geo_ufs[10]},
+	{"Currais Novos", 2403103, &geo_ufs[10]},
+	{"Doutor Severiano", 2403202, &geo_ufs[10]},
+	{"Parnamirim", 2403251, &geo_ufs[10]},
+	{"Encanto", 2403301, &geo_ufs[10]},
+	{"Equador", 2403400, &geo_ufs[10]},
+	{"Espírito Santo", 2403509, &geo_ufs[10]},
+	{"Extremoz", 2403608, &geo_ufs[10]},
+	{"Felipe Guerra", 2403707, &geo_ufs[10]},
+	{"Fernando Pedroza", 2403756, &geo_ufs[10]},
+	{"Florânia", 2403806, &geo_ufs[10]},
+	{"Francisco Dantas", 2403905, &geo_ufs[10]},
+	{"Frutuoso Gomes", 2404002, &geo_ufs[10]},
+	{"Galinhos", 2404101, &geo_ufs[10]},
+	{"Goianinha", 2404200, &geo_ufs[10]},
+	{"Governador Dix-Sept Rosado", 2404309, &geo_ufs[10]},
+	{"Grossos", 2404408, &geo_ufs[10]},
+	{"Guamaré", 2404507, &geo_ufs[10]},
+	{"Ielmo Marinho", 2404606, &geo_ufs[10]},
+	{"Ipanguaçu", 2404705, &geo_ufs[10]},
+	{"Ipueira", 2404804, &geo_ufs[10]},
+	{"Itajá", 2404853, &geo_ufs[10]},
+	{"Itaú", 2404903, &geo_ufs[10]},
+	{"Jaçanã", 2405009, &geo_ufs[10]},
+	{"Jandaíra", 2405108, &geo_ufs[10]},
+	{"Janduís", 2405207, &geo_ufs[10]},
+	{"Januário Cicco", 2405306, &geo_ufs[10]},
+	{"Japi", 2405405, &geo_ufs[10]},
+	{"Jardim de Angicos", 2405504, &geo_ufs[10]},
+	{"Jardim de Piranhas", 2405603, &geo_ufs[10]},
+	{"Jardim do Seridó", 2405702, &geo_ufs[10]},
+	{"João Câmara", 2405801, &geo_ufs[10]},
+	{"João Dias", 2405900, &geo_ufs[10]},
+	{"José da Penha", 2406007, &geo_ufs[10]},
+	{"Jucurutu", 2406106, &geo_ufs[10]},
+	{"Jundiá", 2406155, &geo_ufs[10]},
+	{"Lagoa d'Anta", 2406205, &geo_ufs[10]},
+	{"Lagoa de Pedras", 2406304, &geo_ufs[10]},
+	{"Lagoa de Velhos", 2406403, &geo_ufs[10]},
+	{"Lagoa Nova", 2406502, &geo_ufs[10]},
+	{"Lagoa Salgada", 2406601, &geo_ufs[10]},
+	{"Lajes", 2406700, &geo_ufs[10]},
+	{"Lajes Pintadas", 2406809, &geo_ufs[10]},
+	{"Lucrécia", 2406908, &geo_ufs[10]},
+	{"Luís Gomes", 2407005, &geo_ufs[10]},
+	{"Macaíba", 2407104, &geo_ufs[10]},
+	{"Macau", 2407203, &geo_ufs[10]},
+	{"Major Sales", 2407252, &geo_ufs[10]},
+	{"Marcelino Vieira", 2407302, &geo_ufs[10]},
+	{"Martins", 2407401, &geo_ufs[10]},
+	{"Maxaranguape", 2407500, &geo_ufs[10]},
+	{"Messias Targino", 2407609, &geo_ufs[10]},
+	{"Montanhas", 2407708, &geo_ufs[10]},
+	{"Monte Alegre", 2407807, &geo_ufs[10]},
+	{"Monte das Gameleiras", 2407906, &geo_ufs[10]},
+	{"Mossoró", 2408003, &geo_ufs[10]},
+	{"Natal", 2408102, &geo_ufs[10]},
+	{"Nísia Floresta", 2408201, &geo_ufs[10]},
+	{"Nova Cruz", 2408300, &geo_ufs[10]},
+	{"Olho-d'Água do Borges", 2408409, &geo_ufs[10]},
+	{"Ouro Branco", 2408508, &geo_ufs[10]},
+	{"Paraná", 2408607, &geo_ufs[10]},
+	{"Paraú", 2408706, &geo_ufs[10]},
+	{"Parazinho", 2408805, &geo_ufs[10]},
+	{"Parelhas", 2408904, &geo_ufs[10]},
+	{"Rio do Fogo", 2408953, &geo_ufs[10]},
+	{"Passa e Fica", 2409100, &geo_ufs[10]},
+	{"Passagem", 2409209, &geo_ufs[10]},
+	{"Patu", 2409308, &geo_ufs[10]},
+	{"Santa Maria", 2409332, &geo_ufs[10]},
+	{"Pau dos Ferros", 2409407, &geo_ufs[10]},
+	{"Pedra Grande", 2409506, &geo_ufs[10]},
+	{"Pedra Preta", 2409605, &geo_ufs[10]},
+	{"Pedro Avelino", 2409704, &geo_ufs[10]},
+	{"Pedro Velho", 2409803, &geo_ufs[10]},
+	{"Pendências", 2409902, &geo_ufs[10]},
+	{"Pilões", 2410009, &geo_ufs[10]},
+	{"Poço Branco", 2410108, &geo_ufs[10]},
+	{"Portalegre", 2410207, &geo_ufs[10]},
+	{"Porto do Mangue", 2410256, &geo_ufs[10]},
+	{"Presidente Juscelino", 2410306, &geo_ufs[10]},
+	{"Pureza", 2410405, &geo_ufs[10]},
+	{"Rafael Fernandes", 2410504, &geo_ufs[10]},
+	{"Rafael Godeiro", 2410603, &geo_ufs[10]},
+	{"Riacho da Cruz", 2410702, &geo_ufs[10]},
+	{"Riacho de Santana", 2410801, &geo_ufs[10]},
+	{"Riachuelo", 2410900, &geo_ufs[10]},
+	{"Rodolfo Fernandes", 2411007, &geo_ufs[10]},
+	{"Tibau", 2411056, &geo_ufs[10]},
+	{"Ruy Barbosa", 2411106, &geo_ufs[10]},
+	{"Santa Cruz", 2411205, &geo_ufs[10]},
+	{"Santana do Matos", 2411403, &geo_ufs[10]},
+	{"Santana do Seridó", 2411429, &geo_ufs[10]},
+	{"Santo Antônio", 2411502, &geo_ufs[10]},
+	{"São Bento do Norte", 2411601, &geo_ufs[10]},
+	{"São Bento do Trairí", 2411700, &geo_ufs[10]},
+	{"São Fernando", 2411809, &geo_ufs[10]},
+	{"São Francisco do Oeste", 2411908, &geo_ufs[10]},
+	{"São Gonçalo do Amarante", 2412005, &geo_ufs[10]},
+	{"São João do Sabugi", 2412104, &geo_ufs[10]},
+	{"São José de Mipibu", 2412203, &geo_ufs[10]},
+	{"São José do Campestre", 2412302, &geo_ufs[10]},
+	{"São José do Seridó", 2412401, &geo_ufs[10]},
+	{"São Miguel", 2412500, &geo_ufs[10]},
+	{"São Miguel do Gostoso", 2412559, &geo_ufs[10]},
+	{"São Paulo do Potengi", 2412609, &geo_ufs[10]},
+	{"São Pedro", 2412708, &geo_ufs[10]},
+	{"São Rafael", 2412807, &geo_ufs[10]},
+	{"São Tomé", 2412906, &geo_ufs[10]},
+	{"São Vicente", 2413003, &geo_ufs[10]},
+	{"Senador Elói de Souza", 2413102, &geo_ufs[10]},
+	{"Senador Georgino Avelino", 2413201, &geo_ufs[10]},
+	{"Serra de São Bento", 2413300, &geo_ufs[10]},
+	{"Serra do Mel", 2413359, &geo_ufs[10]},
+	{"Serra Negra do Norte", 2413409, &geo_ufs[10]},
+	{"Serrinha", 2413508, &geo_ufs[10]},
+	{"Serrinha dos Pintos", 2413557, &geo_ufs[10]},
+	{"Severiano Melo", 2413607, &geo_ufs[10]},
+	{"Sítio Novo", 2413706, &geo_ufs[10]},
+	{"Taboleiro Grande", 2413805, &geo_ufs[10]},
+	{"Taipu", 2413904, &geo_ufs[10]},
+	{"Tangará", 2414001, &geo_ufs[10]},
+	{"Tenente Ananias", 2414100, &geo_ufs[10]},
+	{"Tenente Laurentino Cruz", 2414159, &geo_ufs[10]},
+	{"Tibau do Sul", 2414209, &geo_ufs[10]},
+	{"Timbaúba dos Batistas", 2414308, &geo_ufs[10]},
+	{"Touros", 2414407, &geo_ufs[10]},
+	{"Triunfo Potiguar", 2414456, &geo_ufs[10]},
+	{"Umarizal", 2414506, &geo_ufs[10]},
+	{"Upanema", 2414605, &geo_ufs[10]},
+	{"Várzea", 2414704, &geo_ufs[10]},
+	{"Venha-Ver", 2414753, &geo_ufs[10]},
+	{"Vera Cruz", 2414803, &geo_ufs[10]},
+	{"Viçosa", 2414902, &geo_ufs[10]},
+	{"Vila Flor", 2415008, &geo_ufs[10]},
+	{"Água Branca", 2500106, &geo_ufs[11]},
+	{"Aguiar", 2500205, &geo_ufs[11]},
+	{"Alagoa Grande", 2500304, &geo_ufs[11]},
+	{"Alagoa Nova", 2500403, &geo_ufs[11]},
+	{"Alagoinha", 2500502, &geo_ufs[11]},
+	{"Alcantil", 2500536, &geo_ufs[11]},
+	{"Algodão de Jandaíra", 2500577, &geo_ufs[11]},
+	{"Alhandra", 2500601, &geo_ufs[11]},
+	{"São João do Rio do Peixe", 2500700, &geo_ufs[11]},
+	{"Amparo", 2500734, &geo_ufs[11]},
+	{"Aparecida", 2500775, &geo_ufs[11]},
+	{"Araçagi", 2500809, &geo_ufs[11]},
+	{"Arara", 2500908, &geo_ufs[11]},
+	{"Araruna", 2501005, &geo_ufs[11]},
+	{"Areia", 2501104, &geo_ufs[11]},
+	{"Areia de Baraúnas", 2501153, &geo_ufs[11]},
+	{"Areial", 2501203, &geo_ufs[11]},
+	{"Aroeiras", 2501302, &geo_ufs[11]},
+	{"Assunção", 2501351, &geo_ufs[11]},
+	{"Baía da Traição", 2501401, &geo_ufs[11]},
+	{"Bananeiras", 2501500, &geo_ufs[11]},
+	{"Baraúna", 2501534, &geo_ufs[11]},
+	{"Barra de Santana", 2501575, &geo_ufs[11]},
+	{"Barra de Santa Rosa", 2501609, &geo_ufs[11]},
+	{"Barra de São Miguel", 2501708, &geo_ufs[11]},
+	{"Bayeux", 2501807, &geo_ufs[11]},
+	{"Belém", 2501906, &geo_ufs[11]},
+	{"Belém do Brejo do Cruz", 2502003, &geo_ufs[11]},
+	{"Bernardino Batista", 2502052, &geo_ufs[11]},
+	{"Boa Ventura", 2502102, &geo_ufs[11]},
+	{"Boa Vista", 2502151, &geo_ufs[11]},
+	{"Bom Jesus", 2502201, &geo_ufs[11]},
+	{"Bom Sucesso", 2502300, &geo_ufs[11]},
+	{"Bonito de Santa Fé", 2502409, &geo_ufs[11]},
+	{"Boqueirão", 2502508, &geo_ufs[11]},
+	{"Igaracy", 2502607, &geo_ufs[11]},
+	{"Borborema", 2502706, &geo_ufs[11]},
+	{"Brejo do Cruz", 2502805, &geo_ufs[11]},
+	{"Brejo dos Santos", 2502904, &geo_ufs[11]},
+	{"Caaporã", 2503001, &geo_ufs[11]},
+	{"Cabaceiras", 2503100, &geo_ufs[11]},
+	{"Cabedelo", 2503209, &geo_ufs[11]},
+	{"Cachoeira dos Índios", 2503308, &geo_ufs[11]},
+	{"Cacimba de Areia", 2503407, &geo_ufs[11]},
+	{"Cacimba de Dentro", 2503506, &geo_ufs[11]},
+	{"Cacimbas", 2503555, &geo_ufs[11]},
+	{"Caiçara", 2503605, &geo_ufs[11]},
+	{"Cajazeiras", 2503704, &geo_ufs[11]},
+	{"Cajazeirinhas", 2503753, &geo_ufs[11]},
+	{"Caldas Brandão", 2503803, &geo_ufs[11]},
+	{"Camalaú", 2503902, &geo_ufs[11]},
+	{"Campina Grande", 2504009, &geo_ufs[11]},
+	{"Capim", 2504033, &geo_ufs[11]},
+	{"Caraúbas", 2504074, &geo_ufs[11]},
+	{"Carrapateira", 2504108, &geo_ufs[11]},
+	{"Casserengue", 2504157, &geo_ufs[11]},
+	{"Catingueira", 2504207, &geo_ufs[11]},
+	{"Catolé do Rocha", 2504306, &geo_ufs[11]},
+	{"Caturité", 2504355, &geo_ufs[11]},
+	{"Conceição", 2504405, &geo_ufs[11]},
+	{"Condado", 2504504, &geo_ufs[11]},
+	{"Conde", 2504603, &geo_ufs[11]},
+	{"Congo", 2504702, &geo_ufs[11]},
+	{"Coremas", 2504801, &geo_ufs[11]},
+	{"Coxixola", 2504850, &geo_ufs[11]},
+	{"Cruz do Espírito Santo", 2504900, &geo_ufs[11]},
+	{"Cubati", 2505006, &geo_ufs[11]},
+	{"Cuité", 2505105, &geo_ufs[11]},
+	{"Cuitegi", 2505204, &geo_ufs[11]},
+	{"Cuité de Mamanguape", 2505238, &geo_ufs[11]},
+	{"Curral de Cima", 2505279, &geo_ufs[11]},
+	{"Curral Velho", 2505303, &geo_ufs[11]},
+	{"Damião", 2505352, &geo_ufs[11]},
+	{"Desterro", 2505402, &geo_ufs[11]},
+	{"Vista Serrana", 2505501, &geo_ufs[11]},
+	{"Diamante", 2505600, &geo_ufs[11]},
+	{"Dona Inês", 2505709, &geo_ufs[11]},
+	{"Duas Estradas", 2505808, &geo_ufs[11]},
+	{"Emas", 2505907, &geo_ufs[11]},
+	{"Esperança", 2506004, &geo_ufs[11]},
+	{"Fagundes", 2506103, &geo_ufs[11]},
+	{"Frei Martinho", 2506202, &geo_ufs[11]},
+	{"Gado Bravo", 2506251, &geo_ufs[11]},
+	{"Guarabira", 2506301, &geo_ufs[11]},
+	{"Gurinhém", 2506400, &geo_ufs[11]},
+	{"Gurjão", 2506509, &geo_ufs[11]},
+	{"Ibiara", 2506608, &geo_ufs[11]},
+	{"Imaculada", 2506707, &geo_ufs[11]},
+	{"Ingá", 2506806, &geo_ufs[11]},
+	{"Itabaiana", 2506905, &geo_ufs[11]},
+	{"Itaporanga", 2507002, &geo_ufs[11]},
+	{"Itapororoca", 2507101, &geo_ufs[11]},
+	{"Itatuba", 2507200, &geo_ufs[11]},
+	{"Jacaraú", 2507309, &geo_ufs[11]},
+	{"Jericó", 2507408, &geo_ufs[11]},
+	{"João Pessoa", 2507507, &geo_ufs[11]},
+	{"Juarez Távora", 2507606, &geo_ufs[11]},
+	{"Juazeirinho", 2507705, &geo_ufs[11]},
+	{"Junco do Seridó", 2507804, &geo_ufs[11]},
+	{"Juripiranga", 2507903, &geo_ufs[11]},
+	{"Juru", 2508000, &geo_ufs[11]},
+	{"Lagoa", 2508109, &geo_ufs[11]},
+	{"Lagoa de Dentro", 2508208, &geo_ufs[11]},
+	{"Lagoa Seca", 2508307, &geo_ufs[11]},
+	{"Lastro", 2508406, &geo_ufs[11]},
+	{"Livramento", 2508505, &geo_ufs[11]},
+	{"Logradouro", 2508554, &geo_ufs[11]},
+	{"Lucena", 2508604, &geo_ufs[11]},
+	{"Mãe d'Água", 2508703, &geo_ufs[11]},
+	{"Malta", 2508802, &geo_ufs[11]},
+	{"Mamanguape", 2508901, &geo_ufs[11]},
+	{"Manaíra", 2509008, &geo_ufs[11]},
+	{"Marcação", 2509057, &geo_ufs[11]},
+	{"Mari", 2509107, &geo_ufs[11]},
+	{"Marizópolis", 2509156, &geo_ufs[11]},
+	{"Massaranduba", 2509206, &geo_ufs[11]},
+	{"Mataraca", 2509305, &geo_ufs[11]},
+	{"Matinhas", 2509339, &geo_ufs[11]},
+	{"Mato Grosso", 2509370, &geo_ufs[11]},
+	{"Maturéia", 2509396, &geo_ufs[11]},
+	{"Mogeiro", 2509404, &geo_ufs[11]},
+	{"Montadas", 2509503, &geo_ufs[11]},
+	{"Monte Horebe", 2509602, &geo_ufs[11]},
+	{"Monteiro", 2509701, &geo_ufs[11]},
+	{"Mulungu", 2509800, &geo_ufs[11]},
+	{"Natuba", 2509909, &geo_ufs[11]},
+	{"Nazarezinho", 2510006, &geo_ufs[11]},
+	{"Nova Floresta", 2510105, &geo_ufs[11]},
+	{"Nova Olinda", 2510204, &geo_ufs[11]},
+	{"Nova Palmeira", 2510303, &geo_ufs[11]},
+	{"Olho d'Água", 2510402, &geo_ufs[11]},
+	{"Olivedos", 2510501, &geo_ufs[11]},
+	{"Ouro Velho", 2510600, &geo_ufs[11]},
+	{"Parari", 2510659, &geo_ufs[11]},
+	{"Passagem", 2510709, &geo_ufs[11]},
+	{"Patos", 2510808, &geo_ufs[11]},
+	{"Paulista", 2510907, &geo_ufs[11]},
+	{"Pedra Branca", 2511004, &geo_ufs[11]},
+	{"Pedra Lavrada", 2511103, &geo_ufs[11]},
+	{"Pedras de Fogo", 2511202, &geo_ufs[11]},
+	{"Piancó", 2511301, &geo_ufs[11]},
+	{"Picuí", 2511400, &geo_ufs[11]},
+	{"Pilar", 2511509, &geo_ufs[11]},
+	{"Pilões", 2511608, &geo_ufs[11]},
+	{"Pilõezinhos", 2511707, &geo_ufs[11]},
+	{"Pirpirituba", 2511806, &geo_ufs[11]},
+	{"Pitimbu", 2511905, &geo_ufs[11]},
+	{"Pocinhos", 2512002, &geo_ufs[11]},
+	{"Poço Dantas", 2512036, &geo_ufs[11]},
+	{"Poço de José de Moura", 2512077, &geo_ufs[11]},
+	{"Pombal", 2512101, &geo_ufs[11]},
+	{"Prata", 2512200, &geo_ufs[11]},
+	{"Princesa Isabel", 2512309, &geo_ufs[11]},
+	{"Puxinanã", 2512408, &geo_ufs[11]},
+	{"Queimadas", 2512507, &geo_ufs[11]},
+	{"Quixabá", 2512606, &geo_ufs[11]},
+	{"Remígio", 2512705, &geo_ufs[11]},
+	{"Pedro Régis", 2512721, &geo_ufs[11]},
+	{"Riachão", 2512747, &geo_ufs[11]},
+	{"Riachão do Bacamarte", 2512754, &geo_ufs[11]},
+	{"Riachão do Poço", 2512762, &geo_ufs[11]},
+	{"Riacho de Santo Antônio", 2512788, &geo_ufs[11]},
+	{"Riacho dos Cavalos", 2512804, &geo_ufs[11]},
+	{"Rio Tinto", 2512903, &geo_ufs[11]},
+	{"Salgadinho", 2513000, &geo_ufs[11]},
+	{"Salgado de São Félix", 2513109, &geo_ufs[11]},
+	{"Santa Cecília", 2513158, &geo_ufs[11]},
+	{"Santa Cruz", 2513208, &geo_ufs[11]},
+	{"Santa Helena", 2513307, &geo_ufs[11]},
+	{"Santa Inês", 2513356, &geo_ufs[11]},
+	{"Santa Luzia", 2513406, &geo_ufs[11]},
+	{"Santana de Mangueira", 2513505, &geo_ufs[11]},
+	{"Santana dos Garrotes", 2513604, &geo_ufs[11]},
+	{"Joca Claudino", 2513653, &geo_ufs[11]},
+	{"Santa Rita", 2513703, &geo_ufs[11]},
+	{"Santa Teresinha", 2513802, &geo_ufs[11]},
+	{"Santo André", 2513851, &geo_ufs[11]},
+	{"São Bento", 2513901, &geo_ufs[11]},
+	{"São Bentinho", 2513927, &geo_ufs[11]},
+	{"São Domingos do Cariri", 2513943, &geo_ufs[11]},
+	{"São Domingos", 2513968, &geo_ufs[11]},
+	{"São Francisco", 2513984, &geo_ufs[11]},
+	{"São João do Cariri", 2514008, &geo_ufs[11]},
+	{"São João do Tigre", 2514107, &geo_ufs[11]},
+	{"São José da Lagoa Tapada", 2514206, &geo_ufs[11]},
+	{"São José de Caiana", 2514305, &geo_ufs[11]},
+	{"São José de Espinharas", 2514404, &geo_ufs[11]},
+	{"São José dos Ramos", 2514453, &geo_ufs[11]},
+	{"São José de Piranhas", 2514503, &geo_ufs[11]},
+	{"São José de Princesa", 2514552, &geo_ufs[11]},
+	{"São José do Bonfim", 2514602, &geo_ufs[11]},
+	{"São José do Brejo do Cruz", 2514651, &geo_ufs[11]},
+	{"São José do Sabugi", 2514701, &geo_ufs[11]},
+	{"São José dos Cordeiros", 2514800, &geo_ufs[11]},
+	{"São Mamede", 2514909, &geo_ufs[11]},
+	{"São Miguel de Taipu", 2515005, &geo_ufs[11]},
+	{"São Sebastião de Lagoa de Roça", 2515104, &geo_ufs[11]},
+	{"São Sebastião do Umbuzeiro", 2515203, &geo_ufs[11]},
+	{"Sapé", 2515302, &geo_ufs[11]},
+	{"Seridó", 2515401, &geo_ufs[11]},
+	{"Serra Branca", 2515500, &geo_ufs[11]},
+	{"Serra da Raiz", 2515609, &geo_ufs[11]},
+	{"Serra Grande", 2515708, &geo_ufs[11]},
+	{"Serra Redonda", 2515807, &geo_ufs[11]},
+	{"Serraria", 2515906, &geo_ufs[11]},
+	{"Sertãozinho", 2515930, &geo_ufs[11]},
+	{"Sobrado", 2515971, &geo_ufs[11]},
+	{"Solânea", 2516003, &geo_ufs[11]},
+	{"Soledade", 2516102, &geo_ufs[11]},
+	{"Sossêgo", 2516151, &geo_ufs[11]},
+	{"Sousa", 2516201, &geo_ufs[11]},
+	{"Sumé", 2516300, &geo_ufs[11]},
+	{"Tacima", 2516409, &geo_ufs[11]},
+	{"Taperoá", 2516508, &geo_ufs[11]},
+	{"Tavares", 2516607, &geo_ufs[11]},
+	{"Teixeira", 2516706, &geo_ufs[11]},
+	{"Tenório", 2516755, &geo_ufs[11]},
+	{"Triunfo", 2516805, &geo_ufs[11]},
+	{"Uiraúna", 2516904, &geo_ufs[11]},
+	{"Umbuzeiro", 2517001, &geo_ufs[11]},
+	{"Várzea", 2517100, &geo_ufs[11]},
+	{"Vieirópolis", 2517209, &geo_ufs[11]},
+	{"Zabelê", 2517407, &geo_ufs[11]},
+	{"Abreu e Lima", 2600054, &geo_ufs[12]},
+	{"Afogados da Ingazeira", 2600104, &geo_ufs[12]},
+	{"Afrânio", 2600203, &geo_ufs[12]},
+	{"Agrestina", 2600302, &geo_ufs[12]},
+	{"Água Preta", 2600401, &geo_ufs[12]},
+	{"Águas Belas", 2600500, &geo_ufs[12]},
+	{"Alagoinha", 2600609, &geo_ufs[12]},
+	{"Aliança", 2600708, &geo_ufs[12]},
+	{"Altinho", 2600807, &geo_ufs[12]},
+	{"Amaraji", 2600906, &geo_ufs[12]},
+	{"Angelim", 2601003, &geo_ufs[12]},
+	{"Araçoiaba", 2601052, &geo_ufs[12]},
+	{"Araripina", 2601102, &geo_ufs[12]},
+	{"Arcoverde", 2601201, &geo_ufs[12]},
+	{"Barra de Guabiraba", 2601300, &geo_ufs[12]},
+	{"Barreiros", 2601409, &geo_ufs[12]},
+	{"Belém de Maria", 2601508, &geo_ufs[12]},
+	{"Belém do São Francisco", 2601607, &geo_ufs[12]},
+	{"Belo Jardim", 2601706, &geo_ufs[12]},
+	{"Betânia", 2601805, &geo_ufs[12]},
+	{"Bezerros", 2601904, &geo_ufs[12]},
+	{"Bodocó", 2602001, &geo_ufs[12]},
+	{"Bom Conselho", 2602100, &geo_ufs[12]},
+	{"Bom Jardim", 2602209, &geo_ufs[12]},
+	{"Bonito", 2602308, &geo_ufs[12]},
+	{"Brejão", 2602407, &geo_ufs[12]},
+	{"Brejinho", 2602506, &geo_ufs[12]},
+	{"Brejo da Madre de Deus", 2602605, &geo_ufs[12]},
+	{"Buenos Aires", 2602704, &geo_ufs[12]},
+	{"Buíque", 2602803, &geo_ufs[12]},
+	{"Cabo de Santo Agostinho", 2602902, &geo_ufs[12]},
+	{"Cabrobó", 2603009, &geo_ufs[12]},
+	{"Cachoeirinha", 2603108, &geo_ufs[12]},
+	{"Caetés", 2603207, &geo_ufs[12]},
+	{"Calçado", 2603306, &geo_ufs[12]},
+	{"Calumbi", 2603405, &geo_ufs[12]},
+	{"Camaragibe", 2603454, &geo_ufs[12]},
+	{"Camocim de São Félix", 2603504, &geo_ufs[12]},
+	{"Camutanga", 2603603, &geo_ufs[12]},
+	{"Canhotinho", 2603702, &geo_ufs[12]},
+	{"Capoeiras", 2603801, &geo_ufs[12]},
+	{"Carnaíba", 2603900, &geo_ufs[12]},
+	{"Carnaubeira da Penha", 2603926, &geo_ufs[12]},
+	{"Carpina", 2604007, &geo_ufs[12]},
+	{"Caruaru", 2604106, &geo_ufs[12]},
+	{"Casinhas", 2604155, &geo_ufs[12]},
+	{"Catende", 2604205, &geo_ufs[12]},
+	{"Cedro", 2604304, &geo_ufs[12]},
+	{"Chã de Alegria", 2604403, &geo_ufs[12]},
+	{"Chã Grande", 2604502, &geo_ufs[12]},
+	{"Condado", 2604601, &geo_ufs[12]},
+	{"Correntes", 2604700, &geo_ufs[12]},
+	{"Cortês", 2604809, &geo_ufs[12]},
+	{"Cumaru", 2604908, &geo_ufs[12]},
+	{"Cupira", 2605004, &geo_ufs[12]},
+	{"Custódia", 2605103, &geo_ufs[12]},
+	{"Dormentes", 2605152, &geo_ufs[12]},
+	{"Escada", 2605202, &geo_ufs[12]},
+	{"Exu", 2605301, &geo_ufs[12]},
+	{"Feira Nova", 2605400, &geo_ufs[12]},
+	{"Fernando de Noronha", 2605459, &geo_ufs[12]},
+	{"Ferreiros", 2605509, &geo_ufs[12]},
+	{"Flores", 2605608, &geo_ufs[12]},
+	{"Floresta", 2605707, &geo_ufs[12]},
+	{"Frei Miguelinho", 2605806, &geo_ufs[12]},
+	{"Gameleira", 2605905, &geo_ufs[12]},
+	{"Garanhuns", 2606002, &geo_ufs[12]},
+	{"Glória do Goitá", 2606101, &geo_ufs[12]},
+	{"Goiana", 2606200, &geo_ufs[12]},
+	{"Granito", 2606309, &geo_ufs[12]},
+	{"Gravatá", 2606408, &geo_ufs[12]},
+	{"Iati", 2606507, &geo_ufs[12]},
+	{"Ibimirim", 2606606, &geo_ufs[12]},
+	{"Ibirajuba", 2606705, &geo_ufs[12]},
+	{"Igarassu", 2606804, &geo_ufs[12]},
+	{"Iguaraci", 2606903, &geo_ufs[12]},
+	{"Inajá", 2607000, &geo_ufs[12]},
+	{"Ingazeira", 2607109, &geo_ufs[12]},
+	{"Ipojuca", 2607208, &geo_ufs[12]},
+	{"Ipubi", 2607307, &geo_ufs[12]},
+	{"Itacuruba", 2607406, &geo_ufs[12]},
+	{"Itaíba", 2607505, &geo_ufs[12]},
+	{"Ilha de Itamaracá", 2607604, &geo_ufs[12]},
+	{"Itambé", 2607653, &geo_ufs[12]},
+	{"Itapetim", 2607703, &geo_ufs[12]},
+	{"Itapissuma", 2607752, &geo_ufs[12]},
+	{"Itaquitinga", 2607802, &geo_ufs[12]},
+	{"Jaboatão dos Guararapes", 2607901, &geo_ufs[12]},
+	{"Jaqueira", 2607950, &geo_ufs[12]},
+	{"Jataúba", 2608008, &geo_ufs[12]},
+	{"Jatobá", 2608057, &geo_ufs[12]},
+	{"João Alfredo", 2608107, &geo_ufs[12]},
+	{"Joaquim Nabuco", 2608206, &geo_ufs[12]},
+	{"Jucati", 2608255, &geo_ufs[12]},
+	{"Jupi", 2608305, &geo_ufs[12]},
+	{"Jurema", 2608404, &geo_ufs[12]},
+	{"Lagoa do Carro", 2608453, &geo_ufs[12]},
+	{"Lagoa de Itaenga", 2608503, &geo_ufs[12]},
+	{"Lagoa do Ouro", 2608602, &geo_ufs[12]},
+	{"Lagoa dos Gatos", 2608701, &geo_ufs[12]},
+	{"Lagoa Grande", 2608750, &geo_ufs[12]},
+	{"Lajedo", 2608800, &geo_ufs[12]},
+	{"Limoeiro", 2608909, &geo_ufs[12]},
+	{"Macaparana", 2609006, &geo_ufs[12]},
+	{"Machados", 2609105, &geo_ufs[12]},
+	{"Manari", 2609154, &geo_ufs[12]},
+	{"Maraial", 2609204, &geo_ufs[12]},
+	{"Mirandiba", 2609303, &geo_ufs[12]},
+	{"Moreno", 2609402, &geo_ufs[12]},
+	{"Nazaré da Mata", 2609501, &geo_ufs[12]},
+	{"Olinda", 2609600, &geo_ufs[12]},
+	{"Orobó", 2609709, &geo_ufs[12]},
+	{"Orocó", 2609808, &geo_ufs[12]},
+	{"Ouricuri", 2609907, &geo_ufs[12]},
+	{"Palmares", 2610004, &geo_ufs[12]},
+	{"Palmeirina", 2610103, &geo_ufs[12]},
+	{"Panelas", 2610202, &geo_ufs[12]},
+	{"Paranatama", 2610301, &geo_ufs[12]},
+	{"Parnamirim", 2610400, &geo_ufs[12]},
+	{"Passira", 2610509, &geo_ufs[12]},
+	{"Paudalho", 2610608, &geo_ufs[12]},
+	{"Paulista", 2610707, &geo_ufs[12]},
+	{"Pedra", 2610806, &geo_ufs[12]},
+	{"Pesqueira", 2610905, &geo_ufs[12]},
+	{"Petrolândia", 2611002, &geo_ufs[12]},
+	{"Petrolina", 2611101, &geo_ufs[12]},
+	{"Poção", 2611200, &geo_ufs[12]},
+	{"Pombos", 2611309, &geo_ufs[12]},
+	{"Primavera", 2611408, &geo_ufs[12]},
+	{"Quipapá", 2611507, &geo_ufs[12]},
+	{"Quixaba", 2611533, &geo_ufs[12]},
+	{"Recife", 2611606, &geo_ufs[12]},
+	{"Riacho das Almas", 2611705, &geo_ufs[12]},
+	{"Ribeirão", 2611804, &geo_ufs[12]},
+	{"Rio Formoso", 2611903, &geo_ufs[12]},
+	{"Sairé", 2612000, &geo_ufs[12]},
+	{"Salgadinho", 2612109, &geo_ufs[12]},
+	{"Salgueiro", 2612208, &geo_ufs[12]},
+	{"Saloá", 2612307, &geo_ufs[12]},
+	{"Sanharó", 2612406, &geo_ufs[12]},
+	{"Santa Cruz", 2612455, &geo_ufs[12]},
+	{"Santa Cruz da Baixa Verde", 2612471, &geo_ufs[12]},
+	{"Santa Cruz do Capibaribe", 2612505, &geo_ufs[12]},
+	{"Santa Filomena", 2612554, &geo_ufs[12]},
+	{"Santa Maria da Boa Vista", 2612604, &geo_ufs[12]},
+	{"Santa Maria do Cambucá", 2612703, &geo_ufs[12]},
+	{"Santa Terezinha", 2612802, &geo_ufs[12]},
+	{"São Benedito do Sul", 2612901, &geo_ufs[12]},
+	{"São Bento do Una", 2613008, &geo_ufs[12]},
+	{"São Caitano", 2613107, &geo_ufs[12]},
+	{"São João", 2613206, &geo_ufs[12]},
+	{"São Joaquim do Monte", 2613305, &geo_ufs[12]},
+	{"São José da Coroa Grande", 2613404, &geo_ufs[12]},
+	{"São José do Belmonte", 2613503, &geo_ufs[12]},
+	{"São José do Egito", 2613602, &geo_ufs[12]},
+	{"São Lourenço da Mata", 2613701, &geo_ufs[12]},
+	{"São Vicente Ferrer", 2613800, &geo_ufs[12]},
+	{"Serra Talhada", 2613909, &geo_ufs[12]},
+	{"Serrita", 2614006, &geo_ufs[12]},
+	{"Sertânia", 2614105, &geo_ufs[12]},
+	{"Sirinhaém", 2614204, &geo_ufs[12]},
+	{"Moreilândia", 2614303, &geo_ufs[12]},
+	{"Solidão", 2614402, &geo_ufs[12]},
+	{"Surubim", 2614501, &geo_ufs[12]},
+	{"Tabira", 2614600, &geo_ufs[12]},
+	{"Tacaimbó", 2614709, &geo_ufs[12]},
+	{"Tacaratu", 2614808, &geo_ufs[12]},
+	{"Tamandaré", 2614857, &geo_ufs[12]},
+	{"Taquaritinga do Norte", 2615003, &geo_ufs[12]},
+	{"Terezinha", 2615102, &geo_ufs[12]},
+	{"Terra Nova", 2615201, &geo_ufs[12]},
+	{"Timbaúba", 2615300, &geo_ufs[12]},
+	{"Toritama", 2615409, &geo_ufs[12]},
+	{"Tracunhaém", 2615508, &geo_ufs[12]},
+	{"Trindade", 2615607, &geo_ufs[12]},
+	{"Triunfo", 2615706, &geo_ufs[12]},
+	{"Tupanatinga", 2615805, &geo_ufs[12]},
+	{"Tuparetama", 2615904, &geo_ufs[12]},
+	{"Venturosa", 2616001, &geo_ufs[12]},
+	{"Verdejante", 2616100, &geo_ufs[12]},
+	{"Vertente do Lério", 2616183, &geo_ufs[12]},
+	{"Vertentes", 2616209, &geo_ufs[12]},
+	{"Vicência", 2616308, &geo_ufs[12]},
+	{"Vitória de Santo Antão", 2616407, &geo_ufs[12]},
+	{"Xexéu", 2616506, &geo_ufs[12]},
+	{"Água Branca", 2700102, &geo_ufs[13]},
+	{"Anadia", 2700201, &geo_ufs[13]},
+	{"Arapiraca", 2700300, &geo_ufs[13]},
+	{"Atalaia", 2700409, &geo_ufs[13]},
+	{"Barra de Santo Antônio", 2700508, &geo_ufs[13]},
+	{"Barra de São Miguel", 2700607, &geo_ufs[13]},
+	{"Batalha", 2700706, &geo_ufs[13]},
+	{"Belém", 2700805, &geo_ufs[13]},
+	{"Belo Monte", 2700904, &geo_ufs[13]},
+	{"Boca da Mata", 2701001, &geo_ufs[13]},
+	{"Branquinha", 2701100, &geo_ufs[13]},
+	{"Cacimbinhas", 2701209, &geo_ufs[13]},
+	{"Cajueiro", 2701308, &geo_ufs[13]},
+	{"Campestre", 2701357, &geo_ufs[13]},
+	{"Campo Alegre", 2701407, &geo_ufs[13]},
+	{"Campo Grande", 2701506, &geo_ufs[13]},
+	{"Canapi", 2701605, &geo_ufs[13]},
+	{"Capela", 2701704, &geo_ufs[13]},
+	{"Carneiros", 2701803, &geo_ufs[13]},
+	{"Chã Preta", 2701902, &geo_ufs[13]},
+	{"Coité do Nóia", 2702009, &geo_ufs[13]},
+	{"Colônia Leopoldina", 2702108, &geo_ufs[13]},
+	{"Coqueiro Seco", 2702207, &geo_ufs[13]},
+	{"Coruripe", 2702306, &geo_ufs[13]},
+	{"Craíbas", 2702355, &geo_ufs[13]},
+	{"Delmiro Gouveia", 2702405, &geo_ufs[13]},
+	{"Dois Riachos", 2702504, &geo_ufs[13]},
+	{"Estrela de Alagoas", 2702553, &geo_ufs[13]},
+	{"Feira Grande", 2702603, &geo_ufs[13]},
+	{"Feliz Deserto", 2702702, &geo_ufs[13]},
+	{"Flexeiras", 2702801, &geo_ufs[13]},
+	{"Girau do Ponciano", 2702900, &geo_ufs[13]},
+	{"Ibateguara", 2703007, &geo_ufs[13]},
+	{"Igaci", 2703106, &geo_ufs[13]},
+	{"Igreja Nova", 2703205, &geo_ufs[13]},
+	{"Inhapi", 2703304, &geo_ufs[13]},
+	{"Jacaré dos Homens", 2703403, &geo_ufs[13]},
+	{"Jacuípe", 2703502, &geo_ufs[13]},
+	{"Japaratinga", 2703601, &geo_ufs[13]},
+	{"Jaramataia", 2703700, &geo_ufs[13]},
+	{"Jequiá da Praia", 2703759, &geo_ufs[13]},
+	{"Joaquim Gomes", 2703809, &geo_ufs[13]},
+	{"Jundiá", 2703908, &geo_ufs[13]},
+	{"Junqueiro", 2704005, &geo_ufs[13]},
+	{"Lagoa da Canoa", 2704104, &geo_ufs[13]},
+	{"Limoeiro de Anadia", 2704203, &geo_ufs[13]},
+	{"Maceió", 2704302, &geo_ufs[13]},
+	{"Major Isidoro", 2704401, &geo_ufs[13]},
+	{"Maragogi", 2704500, &geo_ufs[13]},
+	{"Maravilha", 2704609, &geo_ufs[13]},
+	{"Marechal Deodoro", 2704708, &geo_ufs[13]},
+	{"Maribondo", 2704807, &geo_ufs[13]},
+	{"Mar Vermelho", 2704906, &geo_ufs[13]},
+	{"Mata Grande", 2705002, &geo_ufs[13]},
+	{"Matriz de Camaragibe", 2705101, &geo_ufs[13]},
+	{"Messias", 2705200, &geo_ufs[13]},
+	{"Minador do Negrão", 2705309, &geo_ufs[13]},
+	{"Monteirópolis", 2705408, &geo_ufs[13]},
+	{"Murici", 2705507, &geo_ufs[13]},
+	{"Novo Lino", 2705606, &geo_ufs[13]},
+	{"Olho d'Água das Flores", 2705705, &geo_ufs[13]},
+	{"Olho d'Água do Casado", 2705804, &geo_ufs[13]},
+	{"Olho d'Água Grande", 2705903, &geo_ufs[13]},
+	{"Olivença", 2706000, &geo_ufs[13]},
+	{"Ouro Branco", 2706109, &geo_ufs[13]},
+	{"Palestina", 2706208, &geo_ufs[13]},
+	{"Palmeira dos Índios", 2706307, &geo_ufs[13]},
+	{"Pão de Açúcar", 2706406, &geo_ufs[13]},
+	{"Pariconha", 2706422, &geo_ufs[13]},
+	{"Paripueira", 2706448, &geo_ufs[13]},
+	{"Passo de Camaragibe", 2706505, &geo_ufs[13]},
+	{"Paulo Jacinto", 2706604, &geo_ufs[13]},
+	{"Penedo", 2706703, &geo_ufs[13]},
+	{"Piaçabuçu", 2706802, &geo_ufs[13]},
+	{"Pilar", 2706901, &geo_ufs[13]},
+	{"Pindoba", 2707008, &geo_ufs[13]},
+	{"Piranhas", 2707107, &geo_ufs[13]},
+	{"Poço das Trincheiras", 2707206, &geo_ufs[13]},
+	{"Porto Calvo", 2707305, &geo_ufs[13]},
+	{"Porto de Pedras", 2707404, &geo_ufs[13]},
+	{"Porto Real do Colégio", 2707503, &geo_ufs[13]},
+	{"Quebrangulo", 2707602, &geo_ufs[13]},
+	{"Rio Largo", 2707701, &geo_ufs[13]},
+	{"Roteiro", 2707800, &geo_ufs[13]},
+	{"Santa Luzia do Norte", 2707909, &geo_ufs[13]},
+	{"Santana do Ipanema", 2708006, &geo_ufs[13]},
+	{"Santana do Mundaú", 2708105, &geo_ufs[13]},
+	{"São Brás", 2708204, &geo_ufs[13]},
+	{"São José da Laje", 2708303, &geo_ufs[13]},
+	{"São José da Tapera", 2708402, &geo_ufs[13]},
+	{"São Luís do Quitunde", 2708501, &geo_ufs[13]},
+	{"São Miguel dos Campos", 2708600, &geo_ufs[13]},
+	{"São Miguel dos Milagres", 2708709, &geo_ufs[13]},
+	{"São Sebastião", 2708808, &geo_ufs[13]},
+	{"Satuba", 2708907, &geo_ufs[13]},
+	{"Senador Rui Palmeira", 2708956, &geo_ufs[13]},
+	{"Tanque d'Arca", 2709004, &geo_ufs[13]},
+	{"Taquarana", 2709103, &geo_ufs[13]},
+	{"Teotônio Vilela", 2709152, &geo_ufs[13]},
+	{"Traipu", 2709202, &geo_ufs[13]},
+	{"União dos Palmares", 2709301, &geo_ufs[13]},
+	{"Viçosa", 2709400, &geo_ufs[13]},
+	{"Amparo de São Francisco", 2800100, &geo_ufs[14]},
+	{"Aquidabã", 2800209, &geo_ufs[14]},
+	{"Aracaju", 2800308, &geo_ufs[14]},
+	{"Arauá", 2800407, &geo_ufs[14]},
+	{"Areia Branca", 2800506, &geo_ufs[14]},
+	{"Barra dos Coqueiros", 2800605, &geo_ufs[14]},
+	{"Boquim", 2800670, &geo_ufs[14]},
+	{"Brejo Grande", 2800704, &geo_ufs[14]},
+	{"Campo do Brito", 2801009, &geo_ufs[14]},
+	{"Canhoba", 2801108, &geo_ufs[14]},
+	{"Canindé de São Francisco", 2801207, &geo_ufs[14]},
+	{"Capela", 2801306, &geo_ufs[14]},
+	{"Carira", 2801405, &geo_ufs[14]},
+	{"Carmópolis", 2801504, &geo_ufs[14]},
+	{"Cedro de São João", 2801603, &geo_ufs[14]},
+	{"Cristinápolis", 2801702, &geo_ufs[14]},
+	{"Cumbe", 2801900, &geo_ufs[14]},
+	{"Divina Pastora", 2802007, &geo_ufs[14]},
+	{"Estância", 2802106, &geo_ufs[14]},
+	{"Feira Nova", 2802205, &geo_ufs[14]},
+	{"Frei Paulo", 2802304, &geo_ufs[14]},
+	{"Gararu", 2802403, &geo_ufs[14]},
+	{"General Maynard", 2802502, &geo_ufs[14]},
+	{"Gracho Cardoso", 2802601, &geo_ufs[14]},
+	{"Ilha das Flores", 2802700, &geo_ufs[14]},
+	{"Indiaroba", 2802809, &geo_ufs[14]},
+	{"Itabaiana", 2802908, &geo_ufs[14]},
+	{"Itabaianinha", 2803005, &geo_ufs[14]},
+	{"Itabi", 2803104, &geo_ufs[14]},
+	{"Itaporanga d'Ajuda", 2803203, &geo_ufs[14]},
+	{"Japaratuba", 2803302, &geo_ufs[14]},
+	{"Japoatã", 2803401, &geo_ufs[14]},
+	{"Lagarto", 2803500, &geo_ufs[14]},
+	{"Laranjeiras", 2803609, &geo_ufs[14]},
+	{"Macambira", 2803708, &geo_ufs[14]},
+	{"Malhada dos Bois", 2803807, &geo_ufs[14]},
+	{"Malhador", 2803906, &geo_ufs[14]},
+	{"Maruim", 2804003, &geo_ufs[14]},
+	{"Moita Bonita", 2804102, &geo_ufs[14]},
+	{"Monte Alegre de Sergipe", 2804201, &geo_ufs[14]},
+	{"Muribeca", 2804300, &geo_ufs[14]},
+	{"Neópolis", 2804409, &geo_ufs[14]},
+	{"Nossa Senhora Aparecida", 2804458, &geo_ufs[14]},
+	{"Nossa Senhora da Glória", 2804508, &geo_ufs[14]},
+	{"Nossa Senhora das Dores", 2804607, &geo_ufs[14]},
+	{"Nossa Senhora de Lourdes", 2804706, &geo_ufs[14]},
+	{"Nossa Senhora do Socorro", 2804805, &geo_ufs[14]},
+	{"Pacatuba", 2804904, &geo_ufs[14]},
+	{"Pedra Mole", 2805000, &geo_ufs[14]},
+	{"Pedrinhas", 2805109, &geo_ufs[14]},
+	{"Pinhão", 2805208, &geo_ufs[14]},
+	{"Pirambu", 2805307, &geo_ufs[14]},
+	{"Poço Redondo", 2805406, &geo_ufs[14]},
+	{"Poço Verde", 2805505, &geo_ufs[14]},
+	{"Porto da Folha", 2805604, &geo_ufs[14]},
+	{"Propriá", 2805703, &geo_ufs[14]},
+	{"Riachão do Dantas", 2805802, &geo_ufs[14]},
+	{"Riachuelo", 2805901, &geo_ufs[14]},
+	{"Ribeirópolis", 2806008, &geo_ufs[14]},
+	{"Rosário do Catete", 2806107, &geo_ufs[14]},
+	{"Salgado", 2806206, &geo_ufs[14]},
+	{"Santa Luzia do Itanhy", 2806305, &geo_ufs[14]},
+	{"Santana do São Francisco", 2806404, &geo_ufs[14]},
+	{"Santa Rosa de Lima", 2806503, &geo_ufs[14]},
+	{"Santo Amaro das Brotas", 2806602, &geo_ufs[14]},
+	{"São Cristóvão", 2806701, &geo_ufs[14]},
+	{"São Domingos", 2806800, &geo_ufs[14]},
+	{"São Francisco", 2806909, &geo_ufs[14]},
+	{"São Miguel do Aleixo", 2807006, &geo_ufs[14]},
+	{"Simão Dias", 2807105, &geo_ufs[14]},
+	{"Siriri", 2807204, &geo_ufs[14]},
+	{"Telha", 2807303, &geo_ufs[14]},
+	{"Tobias Barreto", 2807402, &geo_ufs[14]},
+	{"Tomar do Geru", 2807501, &geo_ufs[14]},
+	{"Umbaúba", 2807600, &geo_ufs[14]},
+	{"Abaíra", 2900108, &geo_ufs[15]},
+	{"Abaré", 2900207, &geo_ufs[15]},
+	{"Acajutiba", 2900306, &geo_ufs[15]},
+	{"Adustina", 2900355, &geo_ufs[15]},
+	{"Água Fria", 2900405, &geo_ufs[15]},
+	{"Érico Cardoso", 2900504, &geo_ufs[15]},
+	{"Aiquara", 2900603, &geo_ufs[15]},
+	{"Alagoinhas", 2900702, &geo_ufs[15]},
+	{"Alcobaça", 2900801, &geo_ufs[15]},
+	{"Almadina", 2900900, &geo_ufs[15]},
+	{"Amargosa", 2901007, &geo_ufs[15]},
+	{"Amélia Rodrigues", 2901106, &geo_ufs[15]},
+	{"América Dourada", 2901155, &geo_ufs[15]},
+	{"Anagé", 2901205, &geo_ufs[15]},
+	{"Andaraí", 2901304, &geo_ufs[15]},
+	{"Andorinha", 2901353, &geo_ufs[15]},
+	{"Angical", 2901403, &geo_ufs[15]},
+	{"Anguera", 2901502, &geo_ufs[15]},
+	{"Antas", 2901601, &geo_ufs[15]},
+	{"Antônio Cardoso", 2901700, &geo_ufs[15]},
+	{"Antônio Gonçalves", 2901809, &geo_ufs[15]},
+	{"Aporá", 2901908, &geo_ufs[15]},
+	{"Apuarema", 2901957, &geo_ufs[15]},
+	{"Aracatu", 2902005, &geo_ufs[15]},
+	{"Araças", 2902054, &geo_ufs[15]},
+	{"Araci", 2902104, &geo_ufs[15]},
+	{"Aramari", 2902203, &geo_ufs[15]},
+	{"Arataca", 2902252, &geo_ufs[15]},
+	{"Aratuípe", 2902302, &geo_ufs[15]},
+	{"Aurelino Leal", 2902401, &geo_ufs[15]},
+	{"Baianópolis", 2902500, &geo_ufs[15]},
+	{"Baixa Grande", 2902609, &geo_ufs[15]},
+	{"Banzaê", 2902658, &geo_ufs[15]},
+	{"Barra", 2902708, &geo_ufs[15]},
+	{"Barra da Estiva", 2902807, &geo_ufs[15]},
+	{"Barra do Choça", 2902906, &geo_ufs[15]},
+	{"Barra do Mendes", 2903003, &geo_ufs[15]},
+	{"Barra do Rocha", 2903102, &geo_ufs[15]},
+	{"Barreiras", 2903201, &geo_ufs[15]},
+	{"Barro Alto", 2903235, &geo_ufs[15]},
+	{"Barrocas", 2903276, &geo_ufs[15]},
+	{"Barro Preto", 2903300, &geo_ufs[15]},
+	{"Belmonte", 2903409, &geo_ufs[15]},
+	{"Belo Campo", 2903508, &geo_ufs[15]},
+	{"Biritinga", 2903607, &geo_ufs[15]},
+	{"Boa Nova", 2903706, &geo_ufs[15]},
+	{"Boa Vista do Tupim", 2903805, &geo_ufs[15]},
+	{"Bom Jesus da Lapa", 2903904, &geo_ufs[15]},
+	{"Bom Jesus da Serra", 2903953, &geo_ufs[15]},
+	{"Boninal", 2904001, &geo_ufs[15]},
+	{"Bonito", 2904050, &geo_ufs[15]},
+	{"Boquira", 2904100, &geo_ufs[15]},
+	{"Botuporã", 2904209, &geo_ufs[15]},
+	{"Brejões", 2904308, &geo_ufs[15]},
+	{"Brejolândia", 2904407, &geo_ufs[15]},
+	{"Brotas de Macaúbas", 2904506, &geo_ufs[15]},
+	{"Brumado", 2904605, &geo_ufs[15]},
+	{"Buerarema", 2904704, &geo_ufs[15]},
+	{"Buritirama", 2904753, &geo_ufs[15]},
+	{"Caatiba", 2904803, &geo_ufs[15]},
+	{"Cabaceiras do Paraguaçu", 2904852, &geo_ufs[15]},
+	{"Cachoeira", 2904902, &geo_ufs[15]},
+	{"Caculé", 2905008, &geo_ufs[15]},
+	{"Caém", 2905107, &geo_ufs[15]},
+	{"Caetanos", 2905156, &geo_ufs[15]},
+	{"Caetité", 2905206, &geo_ufs[15]},
+	{"Cafarnaum", 2905305, &geo_ufs[15]},
+	{"Cairu", 2905404, &geo_ufs[15]},
+	{"Caldeirão Grande", 2905503, &geo_ufs[15]},
+	{"Camacan", 2905602, &geo_ufs[15]},
+	{"Camaçari", 2905701, &geo_ufs[15]},
+	{"Camamu", 2905800, &geo_ufs[15]},
+	{"Campo Alegre de Lourdes", 2905909, &geo_ufs[15]},
+	{"Campo Formoso", 2906006, &geo_ufs[15]},
+	{"Canápolis", 2906105, &geo_ufs[15]},
+	{"Canarana", 2906204, &geo_ufs[15]},
+	{"Canavieiras", 2906303, &geo_ufs[15]},
+	{"Candeal", 2906402, &geo_ufs[15]},
+	{"Candeias", 2906501, &geo_ufs[15]},
+	{"Candiba", 2906600, &geo_ufs[15]},
+	{"Cândido Sales", 2906709, &geo_ufs[15]},
+	{"Cansanção", 2906808, &geo_ufs[15]},
+	{"Canudos", 2906824, &geo_ufs[15]},
+	{"Capela do Alto Alegre", 2906857, &geo_ufs[15]},
+	{"Capim Grosso", 2906873, &geo_ufs[15]},
+	{"Caraíbas", 2906899, &geo_ufs[15]},
+	{"Caravelas", 2906907, &geo_ufs[15]},
+	{"Cardeal da Silva", 2907004, &geo_ufs[15]},
+	{"Carinhanha", 2907103, &geo_ufs[15]},
+	{"Casa Nova", 2907202, &geo_ufs[15]},
+	{"Castro Alves", 2907301, &geo_ufs[15]},
+	{"Catolândia", 2907400, &geo_ufs[15]},
+	{"Catu", 2907509, &geo_ufs[15]},
+	{"Caturama", 2907558, &geo_ufs[15]},
+	{"Central", 2907608, &geo_ufs[15]},
+	{"Chorrochó", 2907707, &geo_ufs[15]},
+	{"Cícero Dantas", 2907806, &geo_ufs[15]},
+	{"Cipó", 2907905, &geo_ufs[15]},
+	{"Coaraci", 2908002, &geo_ufs[15]},
+	{"Cocos", 2908101, &geo_ufs[15]},
+	{"Conceição da Feira", 2908200, &geo_ufs[15]},
+	{"Conceição do Almeida", 2908309, &geo_ufs[15]},
+	{"Conceição do Coité", 2908408, &geo_ufs[15]},
+	{"Conceição do Jacuípe", 2908507, &geo_ufs[15]},
+	{"Conde", 2908606, &geo_ufs[15]},
+	{"Condeúba", 2908705, &geo_ufs[15]},
+	{"Contendas do Sincorá", 2908804, &geo_ufs[15]},
+	{"Coração de Maria", 2908903, &geo_ufs[15]},
+	{"Cordeiros", 2909000, &geo_ufs[15]},
+	{"Coribe", 2909109, &geo_ufs[15]},
+	{"Coronel João Sá", 2909208, &geo_ufs[15]},
+	{"Correntina", 2909307, &geo_ufs[15]},
+	{"Cotegipe", 2909406, &geo_ufs[15]},
+	{"Cravolândia", 2909505, &geo_ufs[15]},
+	{"Crisópolis", 2909604, &geo_ufs[15]},
+	{"Cristópolis", 2909703, &geo_ufs[15]},
+	{"Cruz das Almas", 2909802, &geo_ufs[15]},
+	{"Curaçá", 2909901, &geo_ufs[15]},
+	{"Dário Meira", 2910008, &geo_ufs[15]},
+	{"Dias d'Ávila", 2910057, &geo_ufs[15]},
+	{"Dom Basílio", 2910107, &geo_ufs[15]},
+	{"Dom Macedo Costa", 2910206, &geo_ufs[15]},
+	{"Elísio Medrado", 2910305, &geo_ufs[15]},
+	{"Encruzilhada", 2910404, &geo_ufs[15]},
+	{"Entre Rios", 2910503, &geo_ufs[15]},
+	{"Esplanada", 2910602, &geo_ufs[15]},
+	{"Euclides da Cunha", 2910701, &geo_ufs[15]},
+	{"Eunápolis", 2910727, &geo_ufs[15]},
+	{"Fátima", 2910750, &geo_ufs[15]},
+	{"Feira da Mata", 2910776, &geo_ufs[15]},
+	{"Feira de Santana", 2910800, &geo_ufs[15]},
+	{"Filadélfia", 2910859, &geo_ufs[15]},
+	{"Firmino Alves", 2910909, &geo_ufs[15]},
+	{"Floresta Azul", 2911006, &geo_ufs[15]},
+	{"Formosa do Rio Preto", 2911105, &geo_ufs[15]},
+	{"Gandu", 2911204, &geo_ufs[15]},
+	{"Gavião", 2911253, &geo_ufs[15]},
+	{"Gentio do Ouro", 2911303, &geo_ufs[15]},
+	{"Glória", 2911402, &geo_ufs[15]},
+	{"Gongogi", 2911501, &geo_ufs[15]},
+	{"Governador Mangabeira", 2911600, &geo_ufs[15]},
+	{"Guajeru", 2911659, &geo_ufs[15]},
+	{"Guanambi", 2911709, &geo_ufs[15]},
+	{"Guaratinga", 2911808, &geo_ufs[15]},
+	{"Heliópolis", 2911857, &geo_ufs[15]},
+	{"Iaçu", 2911907, &geo_ufs[15]},
+	{"Ibiassucê", 2912004, &geo_ufs[15]},
+	{"Ibicaraí", 2912103, &geo_ufs[15]},
+	{"Ibicoara", 2912202, &geo_ufs[15]},
+	{"Ibicuí", 2912301, &geo_ufs[15]},
+	{"Ibipeba", 2912400, &geo_ufs[15]},
+	{"Ibipitanga", 2912509, &geo_ufs[15]},
+	{"Ibiquera", 2912608, &geo_ufs[15]},
+	{"Ibirapitanga", 2912707, &geo_ufs[15]},
+	{"Ibirapuã", 2912806, &geo_ufs[15]},
+	{"Ibirataia", 2912905, &geo_ufs[15]},
+	{"Ibitiara", 2913002, &geo_ufs[15]},
+	{"Ibititá", 2913101, &geo_ufs[15]},
+	{"Ibotirama", 2913200, &geo_ufs[15]},
+	{"Ichu", 2913309, &geo_ufs[15]},
+	{"Igaporã", 2913408, &geo_ufs[15]},
+	{"Igrapiúna", 2913457, &geo_ufs[15]},
+	{"Iguaí", 2913507, &geo_ufs[15]},
+	{"Ilhéus", 2913606, &geo_ufs[15]},
+	{"Inhambupe", 2913705, &geo_ufs[15]},
+	{"Ipecaetá", 2913804, &geo_ufs[15]},
+	{"Ipiaú", 2913903, &geo_ufs[15]},
+	{"Ipirá", 2914000, &geo_ufs[15]},
+	{"Ipupiara", 2914109, &geo_ufs[15]},
+	{"Irajuba", 2914208, &geo_ufs[15]},
+	{"Iramaia", 2914307, &geo_ufs[15]},
+	{"Iraquara", 2914406, &geo_ufs[15]},
+	{"Irará", 2914505, &geo_ufs[15]},
+	{"Irecê", 2914604, &geo_ufs[15]},
+	{"Itabela", 2914653, &geo_ufs[15]},
+	{"Itaberaba", 2914703, &geo_ufs[15]},
+	{"Itabuna", 2914802, &geo_ufs[15]},
+	{"Itacaré", 2914901, &geo_ufs[15]},
+	{"Itaeté", 2915007, &geo_ufs[15]},
+	{"Itagi", 2915106, &geo_ufs[15]},
+	{"Itagibá", 2915205, &geo_ufs[15]},
+	{"Itagimirim", 2915304, &geo_ufs[15]},
+	{"Itaguaçu da Bahia", 2915353, &geo_ufs[15]},
+	{"Itaju do Colônia", 2915403, &geo_ufs[15]},
+	{"Itajuípe", 2915502, &geo_ufs[15]},
+	{"Itamaraju", 2915601, &geo_ufs[15]},
+	{"Itamari", 2915700, &geo_ufs[15]},
+	{"Itambé", 2915809, &geo_ufs[15]},
+	{"Itanagra", 2915908, &geo_ufs[15]},
+	{"Itanhém", 2916005, &geo_ufs[15]},
+	{"Itaparica", 2916104, &geo_ufs[15]},
+	{"Itapé", 2916203, &geo_ufs[15]},
+	{"Itapebi", 2916302, &geo_ufs[15]},
+	{"Itapetinga", 2916401, &geo_ufs[15]},
+	{"Itapicuru", 2916500, &geo_ufs[15]},
+	{"Itapitanga", 2916609, &geo_ufs[15]},
+	{"Itaquara", 2916708, &geo_ufs[15]},
+	{"Itarantim", 2916807, &geo_ufs[15]},
+	{"Itatim", 2916856, &geo_ufs[15]},
+	{"Itiruçu", 2916906, &geo_ufs[15]},
+	{"Itiúba", 2917003, &geo_ufs[15]},
+	{"Itororó", 2917102, &geo_ufs[15]},
+	{"Ituaçu", 2917201, &geo_ufs[15]},
+	{"Ituberá", 2917300, &geo_ufs[15]},
+	{"Iuiú", 2917334, &geo_ufs[15]},
+	{"Jaborandi", 2917359, &geo_ufs[15]},
+	{"Jacaraci", 2917409, &geo_ufs[15]},
+	{"Jacobina", 2917508, &geo_ufs[15]},
+	{"Jaguaquara", 2917607, &geo_ufs[15]},
+	{"Jaguarari", 2917706, &geo_ufs[15]},
+	{"Jaguaripe", 2917805, &geo_ufs[15]},
+	{"Jandaíra", 2917904, &geo_ufs[15]},
+	{"Jequié", 2918001, &geo_ufs[15]},
+	{"Jeremoabo", 2918100, &geo_ufs[15]},
+	{"Jiquiriçá", 2918209, &geo_ufs[15]},
+	{"Jitaúna", 2918308, &geo_ufs[15]},
+	{"João Dourado", 2918357, &geo_ufs[15]},
+	{"Juazeiro", 2918407, &geo_ufs[15]},
+	{"Jucuruçu", 2918456, &geo_ufs[15]},
+	{"Jussara", 2918506, &geo_ufs[15]},
+	{"Jussari", 2918555, &geo_ufs[15]},
+	{"Jussiape", 2918605, &geo_ufs[15]},
+	{"Lafaiete Coutinho", 2918704, &geo_ufs[15]},
+	{"Lagoa Real", 2918753, &geo_ufs[15]},
+	{"Laje", 2918803, &geo_ufs[15]},
+	{"Lajedão", 2918902, &geo_ufs[15]},
+	{"Lajedinho", 2919009, &geo_ufs[15]},
+	{"Lajedo do Tabocal", 2919058, &geo_ufs[15]},
+	{"Lamarão", 2919108, &geo_ufs[15]},
+	{"Lapão", 2919157, &geo_ufs[15]},
+	{"Lauro de Freitas", 2919207, &geo_ufs[15]},
+	{"Lençóis", 2919306, &geo_ufs[15]},
+	{"Licínio de Almeida", 2919405, &geo_ufs[15]},
+	{"Livramento de Nossa Senhora", 2919504, &geo_ufs[15]},
+	{"Luís Eduardo Magalhães", 2919553, &geo_ufs[15]},
+	{"Macajuba", 2919603, &geo_ufs[15]},
+	{"Macarani", 2919702, &geo_ufs[15]},
+	{"Macaúbas", 2919801, &geo_ufs[15]},
+	{"Macururé", 2919900, &geo_ufs[15]},
+	{"Madre de Deus", 2919926, &geo_ufs[15]},
+	{"Maetinga", 2919959, &geo_ufs[15]},
+	{"Maiquinique", 2920007, &geo_ufs[15]},
+	{"Mairi", 2920106, &geo_ufs[15]},
+	{"Malhada", 2920205, &geo_ufs[15]},
+	{"Malhada de Pedras", 2920304, &geo_ufs[15]},
+	{"Manoel Vitorino", 2920403, &geo_ufs[15]},
+	{"Mansidão", 2920452, &geo_ufs[15]},
+	{"Maracás", 2920502, &geo_ufs[15]},
+	{"Maragogipe", 2920601, &geo_ufs[15]},
+	{"Maraú", 2920700, &geo_ufs[15]},
+	{"Marcionílio Souza", 2920809, &geo_ufs[15]},
+	{"Mascote", 2920908, &geo_ufs[15]},
+	{"Mata de São João", 2921005, &geo_ufs[15]},
+	{"Matina", 2921054, &geo_ufs[15]},
+	{"Medeiros Neto", 2921104, &geo_ufs[15]},
+	{"Miguel Calmon", 2921203, &geo_ufs[15]},
+	{"Milagres", 2921302, &geo_ufs[15]},
+	{"Mirangaba", 2921401, &geo_ufs[15]},
+	{"Mirante", 2921450, &geo_ufs[15]},
+	{"Monte Santo", 2921500, &geo_ufs[15]},
+	{"Morpará", 2921609, &geo_ufs[15]},
+	{"Morro do Chapéu", 2921708, &geo_ufs[15]},
+	{"Mortugaba", 2921807, &geo_ufs[15]},
+	{"Mucugê", 2921906, &geo_ufs[15]},
+	{"Mucuri", 2922003, &geo_ufs[15]},
+	{"Mulungu do Morro", 2922052, &geo_ufs[15]},
+	{"Mundo Novo", 2922102, &geo_ufs[15]},
+	{"Muniz Ferreira", 2922201, &geo_ufs[15]},
+	{"Muquém de São Francisco", 2922250, &geo_ufs[15]},
+	{"Muritiba", 2922300, &geo_ufs[15]},
+	{"Mutuípe", 2922409, &geo_ufs[15]},
+	{"Nazaré", 2922508, &geo_ufs[15]},
+	{"Nilo Peçanha", 2922607, &geo_ufs[15]},
+	{"Nordestina", 2922656, &geo_ufs[15]},
+	{"Nova Canaã", 2922706, &geo_ufs[15]},
+	{"Nova Fátima", 2922730, &geo_ufs[15]},
+	{"Nova Ibiá", 2922755, &geo_ufs[15]},
+	{"Nova Itarana", 2922805, &geo_ufs[15]},
+	{"Nova Redenção", 2922854, &geo_ufs[15]},
+	{"Nova Soure", 2922904, &geo_ufs[15]},
+	{"Nova Viçosa", 2923001, &geo_ufs[15]},
+	{"Novo Horizonte", 2923035, &geo_ufs[15]},
+	{"Novo Triunfo", 2923050, &geo_ufs[15]},
+	{"Olindina", 2923100, &geo_ufs[15]},
+	{"Oliveira dos Brejinhos", 2923209, &geo_ufs[15]},
+	{"Ouriçangas", 2923308, &geo_ufs[15]},
+	{"Ourolândia", 2923357, &geo_ufs[15]},
+	{"Palmas de Monte Alto", 2923407, &geo_ufs[15]},
+	{"Palmeiras", 2923506, &geo_ufs[15]},
+	{"Paramirim", 2923605, &geo_ufs[15]},
+	{"Paratinga", 2923704, &geo_ufs[15]},
+	{"Paripiranga", 2923803, &geo_ufs[15]},
+	{"Pau Brasil", 2923902, &geo_ufs[15]},
+	{"Paulo Afonso", 2924009, &geo_ufs[15]},
+	{"Pé de Serra", 2924058, &geo_ufs[15]},
+	{"Pedrão", 2924108, &geo_ufs[15]},
+	{"Pedro Alexandre", 2924207, &geo_ufs[15]},
+	{"Piatã", 2924306, &geo_ufs[15]},
+	{"Pilão Arcado", 2924405, &geo_ufs[15]},
+	{"Pindaí", 2924504, &geo_ufs[15]},
+	{"Pindobaçu", 2924603, &geo_ufs[15]},
+	{"Pintadas", 2924652, &geo_ufs[15]},
+	{"Piraí do Norte", 2924678, &geo_ufs[15]},
+	{"Piripá", 2924702, &geo_ufs[15]},
+	{"Piritiba", 2924801, &geo_ufs[15]},
+	{"Planaltino", 2924900, &geo_ufs[15]},
+	{"Planalto", 2925006, &geo_ufs[15]},
+	{"Poções", 2925105, &geo_ufs[15]},
+	{"Pojuca", 2925204, &geo_ufs[15]},
+	{"Ponto Novo", 2925253, &geo_ufs[15]},
+	{"Porto Seguro", 2925303, &geo_ufs[15]},
+	{"Potiraguá", 2925402, &geo_ufs[15]},
+	{"Prado", 2925501, &geo_ufs[15]},
+	{"Presidente Dutra", 2925600, &geo_ufs[15]},
+	{"Presidente Jânio Quadros", 2925709, &geo_ufs[15]},
+	{"Presidente Tancredo Neves", 2925758, &geo_ufs[15]},
+	{"Queimadas", 2925808, &geo_ufs[15]},
+	{"Quijingue", 2925907, &geo_ufs[15]},
+	{"Quixabeira", 2925931, &geo_ufs[15]},
+	{"Rafael Jambeiro", 2925956, &geo_ufs[15]},
+	{"Remanso", 2926004, &geo_ufs[15]},
+	{"Retirolândia", 2926103, &geo_ufs[15]},
+	{"Riachão das Neves", 2926202, &geo_ufs[15]},
+	{"Riachão do Jacuípe", 2926301, &geo_ufs[15]},
+	{"Riacho de Santana", 2926400, &geo_ufs[15]},
+	{"Ribeira do Amparo", 2926509, &geo_ufs[15]},
+	{"Ribeira do Pombal", 2926608, &geo_ufs[15]},
+	{"Ribeirão do Largo", 2926657, &geo_ufs[15]},
+	{"Rio de Contas", 2926707, &geo_ufs[15]},
+	{"Rio do Antônio", 2926806, &geo_ufs[15]},
+	{"Rio do Pires", 2926905, &geo_ufs[15]},
+	{"Rio Real", 2927002, &geo_ufs[15]},
+	{"Rodelas", 2927101, &geo_ufs[15]},
+	{"Ruy Barbosa", 2927200, &geo_ufs[15]},
+	{"Salinas da Margarida", 2927309, &geo_ufs[15]},
+	{"Salvador", 2927408, &geo_ufs[15]},
+	{"Santa Bárbara", 2927507, &geo_ufs[15]},
+	{"Santa Brígida", 2927606, &geo_ufs[15]},
+	{"Santa Cruz Cabrália", 2927705, &geo_ufs[15]},
+	{"Santa Cruz da Vitória", 2927804, &geo_ufs[15]},
+	{"Santa Inês", 2927903, &geo_ufs[15]},
+	{"Santaluz", 2928000, &geo_ufs[15]},
+	{"Santa Luzia", 2928059, &geo_ufs[15]},
+	{"Santa Maria da Vitória", 2928109, &geo_ufs[15]},
+	{"Santana", 2928208, &geo_ufs[15]},
+	{"Santanópolis", 2928307, &geo_ufs[15]},
+	{"Santa Rita de Cássia", 2928406, &geo_ufs[15]},
+	{"Santa Teresinha", 2928505, &geo_ufs[15]},
+	{"Santo Amaro", 2928604, &geo_ufs[15]},
+	{"Santo Antônio de Jesus", 2928703, &geo_ufs[15]},
+	{"Santo Estêvão", 2928802, &geo_ufs[15]},
+	{"São Desidério", 2928901, &geo_ufs[15]},
+	{"São Domingos", 2928950, &geo_ufs[15]},
+	{"São Félix", 2929008, &geo_ufs[15]},
+	{"São Félix do Coribe", 2929057, &geo_ufs[15]},
+	{"São Felipe", 2929107, &geo_ufs[15]},
+	{"São Francisco do Conde", 2929206, &geo_ufs[15]},
+	{"São Gabriel", 2929255, &geo_ufs[15]},
+	{"São Gonçalo dos Campos", 2929305, &geo_ufs[15]},
+	{"São José da Vitória", 2929354, &geo_ufs[15]},
+	{"São José do Jacuípe", 2929370, &geo_ufs[15]},
+	{"São Miguel das Matas", 2929404, &geo_ufs[15]},
+	{"São Sebastião do Passé", 2929503, &geo_ufs[15]},
+	{"Sapeaçu", 2929602, &geo_ufs[15]},
+	{"Sátiro Dias", 2929701, &geo_ufs[15]},
+	{"Saubara", 2929750, &geo_ufs[15]},
+	{"Saúde", 2929800, &geo_ufs[15]},
+	{"Seabra", 2929909, &geo_ufs[15]},
+	{"Sebastião Laranjeiras", 2930006, &geo_ufs[15]},
+	{"Senhor do Bonfim", 2930105, &geo_ufs[15]},
+	{"Serra do Ramalho", 2930154, &geo_ufs[15]},
+	{"Sento Sé", 2930204, &geo_ufs[15]},
+	{"Serra Dourada", 2930303, &geo_ufs[15]},
+	{"Serra Preta", 2930402, &geo_ufs[15]},
+	{"Serrinha", 2930501, &geo_ufs[15]},
+	{"Serrolândia", 2930600, &geo_ufs[15]},
+	{"Simões Filho", 2930709, &geo_ufs[15]},
+	{"Sítio do Mato", 2930758, &geo_ufs[15]},
+	{"Sítio do Quinto", 2930766, &geo_ufs[15]},
+	{"Sobradinho", 2930774, &geo_ufs[15]},
+	{"Souto Soares", 2930808, &geo_ufs[15]},
+	{"Tabocas do Brejo Velho", 2930907, &geo_ufs[15]},
+	{"Tanhaçu", 2931004, &geo_ufs[15]},
+	{"Tanque Novo", 2931053, &geo_ufs[15]},
+	{"Tanquinho", 2931103, &geo_ufs[15]},
+	{"Taperoá", 2931202, &geo_ufs[15]},
+	{"Tapiramutá", 2931301, &geo_ufs[15]},
+	{"Teixeira de Freitas", 2931350, &geo_ufs[15]},
+	{"Teodoro Sampaio", 2931400, &geo_ufs[15]},
+	{"Teofilândia", 2931509, &geo_ufs[15]},
+	{"Teolândia", 2931608, &geo_ufs[15]},
+	{"Terra Nova", 2931707, &geo_ufs[15]},
+	{"Tremedal", 2931806, &geo_ufs[15]},
+	{"Tucano", 2931905, &geo_ufs[15]},
+	{"Uauá", 2932002, &geo_ufs[15]},
+	{"Ubaíra", 2932101, &geo_ufs[15]},
+	{"Ubaitaba", 2932200, &geo_ufs[15]},
+	{"Ubatã", 2932309, &geo_ufs[15]},
+	{"Uibaí", 2932408, &geo_ufs[15]},
+	{"Umburanas", 2932457, &geo_ufs[15]},
+	{"Una", 2932507, &geo_ufs[15]},
+	{"Urandi", 2932606, &geo_ufs[15]},
+	{"Uruçuca", 2932705, &geo_ufs[15]},
+	{"Utinga", 2932804, &geo_ufs[15]},
+	{"Valença", 2932903, &geo_ufs[15]},
+	{"Valente", 2933000, &geo_ufs[15]},
+	{"Várzea da Roça", 2933059, &geo_ufs[15]},
+	{"Várzea do Poço", 2933109, &geo_ufs[15]},
+	{"Várzea Nova", 2933158, &geo_ufs[15]},
+	{"Varzedo", 2933174, &geo_ufs[15]},
+	{"Vera Cruz", 2933208, &geo_ufs[15]},
+	{"Vereda", 2933257, &geo_ufs[15]},
+	{"Vitória da Conquista", 2933307, &geo_ufs[15]},
+	{"Wagner", 2933406, &geo_ufs[15]},
+	{"Wanderley", 2933455, &geo_ufs[15]},
+	{"Wenceslau Guimarães", 2933505, &geo_ufs[15]},
+	{"Xique-Xique", 2933604, &geo_ufs[15]},
+	{"Abadia dos Dourados", 3100104, &geo_ufs[16]},
+	{"Abaeté", 3100203, &geo_ufs[16]},
+	{"Abre Campo", 3100302, &geo_ufs[16]},
+	{"Acaiaca", 3100401, &geo_ufs[16]},
+	{"Açucena", 3100500, &geo_ufs[16]},
+	{"Água Boa", 3100609, &geo_ufs[16]},
+	{"Água Comprida", 3100708, &geo_ufs[16]},
+	{"Aguanil", 3100807, &geo_ufs[16]},
+	{"Águas Formosas", 3100906, &geo_ufs[16]},
+	{"Águas Vermelhas", 3101003, &geo_ufs[16]},
+	{"Aimorés", 3101102, &geo_ufs[16]},
+	{"Aiuruoca", 3101201, &geo_ufs[16]},
+	{"Alagoa", 3101300, &geo_ufs[16]},
+	{"Albertina", 3101409, &geo_ufs[16]},
+	{"Além Paraíba", 3101508, &geo_ufs[16]},
+	{"Alfenas", 3101607, &geo_ufs[16]},
+	{"Alfredo Vasconcelos", 3101631, &geo_ufs[16]},
+	{"Almenara", 3101706, &geo_ufs[16]},
+	{"Alpercata", 3101805, &geo_ufs[16]},
+	{"Alpinópolis", 3101904, &geo_ufs[16]},
+	{"Alterosa", 3102001, &geo_ufs[16]},
+	{"Alto Caparaó", 3102050, &geo_ufs[16]},
+	{"Alto Rio Doce", 3102100, &geo_ufs[16]},
+	{"Alvarenga", 3102209, &geo_ufs[16]},
+	{"Alvinópolis", 3102308, &geo_ufs[16]},
+	{"Alvorada de Minas", 3102407, &geo_ufs[16]},
+	{"Amparo do Serra", 3102506, &geo_ufs[16]},
+	{"Andradas", 3102605, &geo_ufs[16]},
+	{"Cachoeira de Pajeú", 3102704, &geo_ufs[16]},
+	{"Andrelândia", 3102803, &geo_ufs[16]},
+	{"Angelândia", 3102852, &geo_ufs[16]},
+	{"Antônio Carlos", 3102902, &geo_ufs[16]},
+	{"Antônio Dias", 3103009, &geo_ufs[16]},
+	{"Antônio Prado de Minas", 3103108, &geo_ufs[16]},
+	{"Araçaí", 3103207, &geo_ufs[16]},
+	{"Aracitaba", 3103306, &geo_ufs[16]},
+	{"Araçuaí", 3103405, &geo_ufs[16]},
+	{"Araguari", 3103504, &geo_ufs[16]},
+	{"Arantina", 3103603, &geo_ufs[16]},
+	{"Araponga", 3103702, &geo_ufs[16]},
+	{"Araporã", 3103751, &geo_ufs[16]},
+	{"Arapuá", 3103801, &geo_ufs[16]},
+	{"Araújos", 3103900, &geo_ufs[16]},
+	{"Araxá", 3104007, &geo_ufs[16]},
+	{"Arceburgo", 3104106, &geo_ufs[16]},
+	{"Arcos", 3104205, &geo_ufs[16]},
+	{"Areado", 3104304, &geo_ufs[16]},
+	{"Argirita", 3104403, &geo_ufs[16]},
+	{"Aricanduva", 3104452, &geo_ufs[16]},
+	{"Arinos", 3104502, &geo_ufs[16]},
+	{"Astolfo Dutra", 3104601, &geo_ufs[16]},
+	{"Ataléia", 3104700, &geo_ufs[16]},
+	{"Augusto de Lima", 3104809, &geo_ufs[16]},
+	{"Baependi", 3104908, &geo_ufs[16]},
+	{"Baldim", 3105004, &geo_ufs[16]},
+	{"Bambuí", 3105103, &geo_ufs[16]},
+	{"Bandeira", 3105202, &geo_ufs[16]},
+	{"Bandeira do Sul", 3105301, &geo_ufs[16]},
+	{"Barão de Cocais", 3105400, &geo_ufs[16]},
+	{"Barão de Monte Alto", 3105509, &geo_ufs[16]},
+	{"Barbacena", 3105608, &geo_ufs[16]},
+	{"Barra Longa", 3105707, &geo_ufs[16]},
+	{"Barroso", 3105905, &geo_ufs[16]},
+	{"Bela Vista de Minas", 3106002, &geo_ufs[16]},
+	{"Belmiro Braga", 3106101, &geo_ufs[16]},
+	{"Belo Horizonte", 3106200, &geo_ufs[16]},
+	{"Belo Oriente", 3106309, &geo_ufs[16]},
+	{"Belo Vale", 3106408, &geo_ufs[16]},
+	{"Berilo", 3106507, &geo_ufs[16]},
+	{"Bertópolis", 3106606, &geo_ufs[16]},
+	{"Berizal", 3106655, &geo_ufs[16]},
+	{"Betim", 3106705, &geo_ufs[16]},
+	{"Bias Fortes", 3106804, &geo_ufs[16]},
+	{"Bicas", 3106903, &geo_ufs[16]},
+	{"Biquinhas", 3107000, &geo_ufs[16]},
+	{"Boa Esperança", 3107109, &geo_ufs[16]},
+	{"Bocaina de Minas", 3107208, &geo_ufs[16]},
+	{"Bocaiúva", 3107307, &geo_ufs[16]},
+	{"Bom Despacho", 3107406, &geo_ufs[16]},
+	{"Bom Jardim de Minas", 3107505, &geo_ufs[16]},
+	{"Bom Jesus da Penha", 3107604, &geo_ufs[16]},
+	{"Bom Jesus do Amparo", 3107703, &geo_ufs[16]},
+	{"Bom Jesus do Galho", 3107802, &geo_ufs[16]},
+	{"Bom Repouso", 3107901, &geo_ufs[16]},
+	{"Bom Sucesso", 3108008, &geo_ufs[16]},
+	{"Bonfim", 3108107, &geo_ufs[16]},
+	{"Bonfinópolis de Minas", 3108206, &geo_ufs[16]},
+	{"Bonito de Minas", 3108255, &geo_ufs[16]},
+	{"Borda da Mata", 3108305, &geo_ufs[16]},
+	{"Botelhos", 3108404, &geo_ufs[16]},
+	{"Botumirim", 3108503, &geo_ufs[16]},
+	{"Brasilândia de Minas", 3108552, &geo_ufs[16]},
+	{"Brasília de Minas", 3108602, &geo_ufs[16]},
+	{"Brás Pires", 3108701, &geo_ufs[16]},
+	{"Braúnas", 3108800, &geo_ufs[16]},
+	{"Brasópolis", 3108909, &geo_ufs[16]},
+	{"Brumadinho", 3109006, &geo_ufs[16]},
+	{"Bueno Brandão", 3109105, &geo_ufs[16]},
+	{"Buenópolis", 3109204, &geo_ufs[16]},
+	{"Bugre", 3109253, &geo_ufs[16]},
+	{"Buritis", 3109303, &geo_ufs[16]},
+	{"Buritizeiro", 3109402, &geo_ufs[16]},
+	{"Cabeceira Grande", 3109451, &geo_ufs[16]},
+	{"Cabo Verde", 3109501, &geo_ufs[16]},
+	{"Cachoeira da Prata", 3109600, &geo_ufs[16]},
+	{"Cachoeira de Minas", 3109709, &geo_ufs[16]},
+	{"Cachoeira Dourada", 3109808, &geo_ufs[16]},
+	{"Caetanópolis", 3109907, &geo_ufs[16]},
+	{"Caeté", 3110004, &geo_ufs[16]},
+	{"Caiana", 3110103, &geo_ufs[16]},
+	{"Cajuri", 3110202, &geo_ufs[16]},
+	{"Caldas", 3110301, &geo_ufs[16]},
+	{"Camacho", 3110400, &geo_ufs[16]},
+	{"Camanducaia", 3110509, &geo_ufs[16]},
+	{"Cambuí", 3110608, &geo_ufs[16]},
+	{"Cambuquira", 3110707, &geo_ufs[16]},
+	{"Campanário", 3110806, &geo_ufs[16]},
+	{"Campanha", 3110905, &geo_ufs[16]},
+	{"Campestre", 3111002, &geo_ufs[16]},
+	{"Campina Verde", 3111101, &geo_ufs[16]},
+	{"Campo Azul", 3111150, &geo_ufs[16]},
+	{"Campo Belo", 3111200, &geo_ufs[16]},
+	{"Campo do Meio", 3111309, &geo_ufs[16]},
+	{"Campo Florido", 3111408, &geo_ufs[16]},
+	{"Campos Altos", 3111507, &geo_ufs[16]},
+	{"Campos Gerais", 3111606, &geo_ufs[16]},
+	{"Canaã", 3111705, &geo_ufs[16]},
+	{"Canápolis", 3111804, &geo_ufs[16]},
+	{"Cana Verde", 3111903, &geo_ufs[16]},
+	{"Candeias", 3112000, &geo_ufs[16]},
+	{"Cantagalo", 3112059, &geo_ufs[16]},
+	{"Caparaó", 3112109, &geo_ufs[16]},
+	{"Capela Nova", 3112208, &geo_ufs[16]},
+	{"Capelinha", 3112307, &geo_ufs[16]},
+	{"Capetinga", 3112406, &geo_ufs[16]},
+	{"Capim Branco", 3112505, &geo_ufs[16]},
+	{"Capinópolis", 3112604, &geo_ufs[16]},
+	{"Capitão Andrade", 3112653, &geo_ufs[16]},
+	{"Capitão Enéas", 3112703, &geo_ufs[16]},
+	{"Capitólio", 3112802, &geo_ufs[16]},
+	{"Caputira", 3112901, &geo_ufs[16]},
+	{"Caraí", 3113008, &geo_ufs[16]},
+	{"Caranaíba", 3113107, &geo_ufs[16]},
+	{"Carandaí", 3113206, &geo_ufs[16]},
+	{"Carangola", 3113305, &geo_ufs[16]},
+	{"Caratinga", 3113404, &geo_ufs[16]},
+	{"Carbonita", 3113503, &geo_ufs[16]},
+	{"Careaçu", 3113602, &geo_ufs[16]},
+	{"Carlos Chagas", 3113701, &geo_ufs[16]},
+	{"Carmésia", 3113800, &geo_ufs[16]},
+	{"Carmo da Cachoeira", 3113909, &geo_ufs[16]},
+	{"Carmo da Mata", 3114006, &geo_ufs[16]},
+	{"Carmo de Minas", 3114105, &geo_ufs[16]},
+	{"Carmo do Cajuru", 3114204, &geo_ufs[16]},
+	{"Carmo do Paranaíba", 3114303, &geo_ufs[16]},
+	{"Carmo do Rio Claro", 3114402, &geo_ufs[16]},
+	{"Carmópolis de Minas", 3114501, &geo_ufs[16]},
+	{"Carneirinho", 3114550, &geo_ufs[16]},
+	{"Carrancas", 3114600, &geo_ufs[16]},
+	{"Carvalhópolis", 3114709, &geo_ufs[16]},
+	{"Carvalhos", 3114808, &geo_ufs[16]},
+	{"Casa Grande", 3114907, &geo_ufs[16]},
+	{"Cascalho Rico", 3115003, &geo_ufs[16]},
+	{"Cássia", 3115102, &geo_ufs[16]},
+	{"Conceição da Barra de Minas", 3115201, &geo_ufs[16]},
+	{"Cataguases", 3115300, &geo_ufs[16]},
+	{"Catas Altas", 3115359, &geo_ufs[16]},
+	{"Catas Altas da Noruega", 3115409, &geo_ufs[16]},
+	{"Catuji", 3115458, &geo_ufs[16]},
+	{"Catuti", 3115474, &geo_ufs[16]},
+	{"Caxambu", 3115508, &geo_ufs[16]},
+	{"Cedro do Abaeté", 3115607, &geo_ufs[16]},
+	{"Central de Minas", 3115706, &geo_ufs[16]},
+	{"Centralina", 3115805, &geo_ufs[16]},
+	{"Chácara", 3115904, &geo_ufs[16]},
+	{"Chalé", 3116001, &geo_ufs[16]},
+	{"Chapada do Norte", 3116100, &geo_ufs[16]},
+	{"Chapada Gaúcha", 3116159, &geo_ufs[16]},
+	{"Chiador", 3116209, &geo_ufs[16]},
+	{"Cipotânea", 3116308, &geo_ufs[16]},
+	{"Claraval", 3116407, &geo_ufs[16]},
+	{"Claro dos Poções", 3116506, &geo_ufs[16]},
+	{"Cláudio", 3116605, &geo_ufs[16]},
+	{"Coimbra", 3116704, &geo_ufs[16]},
+	{"Coluna", 3116803, &geo_ufs[16]},
+	{"Comendador Gomes", 3116902, &geo_ufs[16]},
+	{"Comercinho", 3117009, &geo_ufs[16]},
+	{"Conceição da Aparecida", 3117108, &geo_ufs[16]},
+	{"Conceição das Pedras", 3117207, &geo_ufs[16]},
+	{"Conceição das Alagoas", 3117306, &geo_ufs[16]},
+	{"Conceição de Ipanema", 3117405, &geo_ufs[16]},
+	{"Conceição do Mato Dentro", 3117504, &geo_ufs[16]},
+	{"Conceição do Pará", 3117603, &geo_ufs[16]},
+	{"Conceição do Rio Verde", 3117702, &geo_ufs[16]},
+	{"Conceição dos Ouros", 3117801, &geo_ufs[16]},
+	{"Cônego Marinho", 3117836, &geo_ufs[16]},
+	{"Confins", 3117876, &geo_ufs[16]},
+	{"Congonhal", 3117900, &geo_ufs[16]},
+	{"Congonhas", 3118007, &geo_ufs[16]},
+	{"Congonhas do Norte", 3118106, &geo_ufs[16]},
+	{"Conquista", 3118205, &geo_ufs[16]},
+	{"Conselheiro Lafaiete", 3118304, &geo_ufs[16]},
+	{"Conselheiro Pena", 3118403, &geo_ufs[16]},
+	{"Consolação", 3118502, &geo_ufs[16]},
+	{"Contagem", 3118601, &geo_ufs[16]},
+	{"Coqueiral", 3118700, &geo_ufs[16]},
+	{"Coração de Jesus", 3118809, &geo_ufs[16]},
+	{"Cordisburgo", 3118908, &geo_ufs[16]},
+	{"Cordislândia", 3119005, &geo_ufs[16]},
+	{"Corinto", 3119104, &geo_ufs[16]},
+	{"Coroaci", 3119203, &geo_ufs[16]},
+	{"Coromandel", 3119302, &geo_ufs[16]},
+	{"Coronel Fabriciano", 3119401, &geo_ufs[16]},
+	{"Coronel Murta", 3119500, &geo_ufs[16]},
+	{"Coronel Pacheco", 3119609, &geo_ufs[16]},
+	{"Coronel Xavier Chaves", 3119708, &geo_ufs[16]},
+	{"Córrego Danta", 3119807, &geo_ufs[16]},
+	{"Córrego do Bom Jesus", 3119906, &geo_ufs[16]},
+	{"Córrego Fundo", 3119955, &geo_ufs[16]},
+	{"Córrego Novo", 3120003, &geo_ufs[16]},
+	{"Couto de Magalhães de Minas", 3120102, &geo_ufs[16]},
+	{"Crisólita", 3120151, &geo_ufs[16]},
+	{"Cristais", 3120201, &geo_ufs[16]},
+	{"Cristália", 3120300, &geo_ufs[16]},
+	{"Cristiano Otoni", 3120409, &geo_ufs[16]},
+	{"Cristina", 3120508, &geo_ufs[16]},
+	{"Crucilândia", 3120607, &geo_ufs[16]},
+	{"Cruzeiro da Fortaleza", 3120706, &geo_ufs[16]},
+	{"Cruzília", 3120805, &geo_ufs[16]},
+	{"Cuparaque", 3120839, &geo_ufs[16]},
+	{"Curral de Dentro", 3120870, &geo_ufs[16]},
+	{"Curvelo", 3120904, &geo_ufs[16]},
+	{"Datas", 3121001, &geo_ufs[16]},
+	{"Delfim Moreira", 3121100, &geo_ufs[16]},
+	{"Delfinópolis", 3121209, &geo_ufs[16]},
+	{"Delta", 3121258, &geo_ufs[16]},
+	{"Descoberto", 3121308, &geo_ufs[16]},
+	{"Desterro de Entre Rios", 3121407, &geo_ufs[16]},
+	{"Desterro do Melo", 3121506, &geo_ufs[16]},
+	{"Diamantina", 3121605, &geo_ufs[16]},
+	{"Diogo de Vasconcelos", 3121704, &geo_ufs[16]},
+	{"Dionísio", 3121803, &geo_ufs[16]},
+	{"Divinésia", 3121902, &geo_ufs[16]},
+	{"Divino", 3122009, &geo_ufs[16]},
+	{"Divino das Laranjeiras", 3122108, &geo_ufs[16]},
+	{"Divinolândia de Minas", 3122207, &geo_ufs[16]},
+	{"Divinópolis", 3122306, &geo_ufs[16]},
+	{"Divisa Alegre", 3122355, &geo_ufs[16]},
+	{"Divisa Nova", 3122405, &geo_ufs[16]},
+	{"Divisópolis", 3122454, &geo_ufs[16]},
+	{"Dom Bosco", 3122470, &geo_ufs[16]},
+	{"Dom Cavati", 3122504, &geo_ufs[16]},
+	{"Dom Joaquim", 3122603, &geo_ufs[16]},
+	{"Dom Silvério", 3122702, &geo_ufs[16]},
+	{"Dom Viçoso", 3122801, &geo_ufs[16]},
+	{"Dona Eusébia", 3122900, &geo_ufs[16]},
+	{"Dores de Campos", 3123007, &geo_ufs[16]},
+	{"Dores de Guanhães", 3123106, &geo_ufs[16]},
+	{"Dores do Indaiá", 3123205, &geo_ufs[16]},
+	{"Dores do Turvo", 3123304, &geo_ufs[16]},
+	{"Doresópolis", 3123403, &geo_ufs[16]},
+	{"Douradoquara", 3123502, &geo_ufs[16]},
+	{"Durandé", 3123528, &geo_ufs[16]},
+	{"Elói Mendes", 3123601, &geo_ufs[16]},
+	{"Engenheiro Caldas", 3123700, &geo_ufs[16]},
+	{"Engenheiro Navarro", 3123809, &geo_ufs[16]},
+	{"Entre Folhas", 3123858, &geo_ufs[16]},
+	{"Entre Rios de Minas", 3123908, &geo_ufs[16]},
+	{"Ervália", 3124005, &geo_ufs[16]},
+	{"Esmeraldas", 3124104, &geo_ufs[16]},
+	{"Espera Feliz", 3124203, &geo_ufs[16]},
+	{"Espinosa", 3124302, &geo_ufs[16]},
+	{"Espírito Santo do Dourado", 3124401, &geo_ufs[16]},
+	{"Estiva", 3124500, &geo_ufs[16]},
+	{"Estrela Dalva", 3124609, &geo_ufs[16]},
+	{"Estrela do Indaiá", 3124708, &geo_ufs[16]},
+	{"Estrela do Sul", 3124807, &geo_ufs[16]},
+	{"Eugenópolis", 3124906, &geo_ufs[16]},
+	{"Ewbank da Câmara", 3125002, &geo_ufs[16]},
+	{"Extrema", 3125101, &geo_ufs[16]},
+	{"Fama", 3125200, &geo_ufs[16]},
+	{"Faria Lemos", 3125309, &geo_ufs[16]},
+	{"Felício dos Santos", 3125408, &geo_ufs[16]},
+	{"São Gonçalo do Rio Preto", 3125507, &geo_ufs[16]},
+	{"Felisburgo", 3125606, &geo_ufs[16]},
+	{"Felixlândia", 3125705, &geo_ufs[16]},
+	{"Fernandes Tourinho", 3125804, &geo_ufs[16]},
+	{"Ferros", 3125903, &geo_ufs[16]},
+	{"Fervedouro", 3125952, &geo_ufs[16]},
+	{"Florestal", 3126000, &geo_ufs[16]},
+	{"Formiga", 3126109, &geo_ufs[16]},
+	{"Formoso", 3126208, &geo_ufs[16]},
+	{"Fortaleza de Minas", 3126307, &geo_ufs[16]},
+	{"Fortuna de Minas", 3126406, &geo_ufs[16]},
+	{"Francisco Badaró", 3126505, &geo_ufs[16]},
+	{"Francisco Dumont", 3126604, &geo_ufs[16]},
+	{"Francisco Sá", 3126703, &geo_ufs[16]},
+	{"Franciscópolis", 3126752, &geo_ufs[16]},
+	{"Frei Gaspar", 3126802, &geo_ufs[16]},
+	{"Frei Inocêncio", 3126901, &geo_ufs[16]},
+	{"Frei Lagonegro", 3126950, &geo_ufs[16]},
+	{"Fronteira", 3127008, &geo_ufs[16]},
+	{"Fronteira dos Vales", 3127057, &geo_ufs[16]},
+	{"Fruta de Leite", 3127073, &geo_ufs[16]},
+	{"Frutal", 3127107, &geo_ufs[16]},
+	{"Funilândia", 3127206, &geo_ufs[16]},
+	{"Galiléia", 3127305, &geo_ufs[16]},
+	{"Gameleiras", 3127339, &geo_ufs[16]},
+	{"Glaucilândia", 3127354, &geo_ufs[16]},
+	{"Goiabeira", 3127370, &geo_ufs[16]},
+	{"Goianá", 3127388, &geo_ufs[16]},
+	{"Gonçalves", 3127404, &geo_ufs[16]},
+	{"Gonzaga", 3127503, &geo_ufs[16]},
+	{"Gouveia", 3127602, &geo_ufs[16]},
+	{"Governador Valadares", 3127701, &geo_ufs[16]},
+	{"Grão Mogol", 3127800, &geo_ufs[16]},
+	{"Grupiara", 3127909, &geo_ufs[16]},
+	{"Guanhães", 3128006, &geo_ufs[16]},
+	{"Guapé", 3128105, &geo_ufs[16]},
+	{"Guaraciaba", 3128204, &geo_ufs[16]},
+	{"Guaraciama", 3128253, &geo_ufs[16]},
+	{"Guaranésia", 3128303, &geo_ufs[16]},
+	{"Guarani", 3128402, &geo_ufs[16]},
+	{"Guarará", 3128501, &geo_ufs[16]},
+	{"Guarda-Mor", 3128600, &geo_ufs[16]},
+	{"Guaxupé", 3128709, &geo_ufs[16]},
+	{"Guidoval", 3128808, &geo_ufs[16]},
+	{"Guimarânia", 3128907, &geo_ufs[16]},
+	{"Guiricema", 3129004, &geo_ufs[16]},
+	{"Gurinhatã", 3129103, &geo_ufs[16]},
+	{"Heliodora", 3129202, &geo_ufs[16]},
+	{"Iapu", 3129301, &geo_ufs[16]},
+	{"Ibertioga", 3129400, &geo_ufs[16]},
+	{"Ibiá", 3129509, &geo_ufs[16]},
+	{"Ibiaí", 3129608, &geo_ufs[16]},
+	{"Ibiracatu", 3129657, &geo_ufs[16]},
+	{"Ibiraci", 3129707, &geo_ufs[16]},
+	{"Ibirité", 3129806, &geo_ufs[16]},
+	{"Ibitiúra de Minas", 3129905, &geo_ufs[16]},
+	{"Ibituruna", 3130002, &geo_ufs[16]},
+	{"Icaraí de Minas", 3130051, &geo_ufs[16]},
+	{"Igarapé", 3130101, &geo_ufs[16]},
+	{"Igaratinga", 3130200, &geo_ufs[16]},
+	{"Iguatama", 3130309, &geo_ufs[16]},
+	{"Ijaci", 3130408, &geo_ufs[16]},
+	{"Ilicínea", 3130507, &geo_ufs[16]},
+	{"Imbé de Minas", 3130556, &geo_ufs[16]},
+	{"Inconfidentes", 3130606, &geo_ufs[16]},
+	{"Indaiabira", 3130655, &geo_ufs[16]},
+	{"Indianópolis", 3130705, &geo_ufs[16]},
+	{"Ingaí", 3130804, &geo_ufs[16]},
+	{"Inhapim", 3130903, &geo_ufs[16]},
+	{"Inhaúma", 3131000, &geo_ufs[16]},
+	{"Inimutaba", 3131109, &geo_ufs[16]},
+	{"Ipaba", 3131158, &geo_ufs[16]},
+	{"Ipanema", 3131208, &geo_ufs[16]},
+	{"Ipatinga", 3131307, &geo_ufs[16]},
+	{"Ipiaçu", 3131406, &geo_ufs[16]},
+	{"Ipuiúna", 3131505, &geo_ufs[16]},
+	{"Iraí de Minas", 3131604, &geo_ufs[16]},
+	{"Itabira", 3131703, &geo_ufs[16]},
+	{"Itabirinha", 3131802, &geo_ufs[16]},
+	{"Itabirito", 3131901, &geo_ufs[16]},
+	{"Itacambira", 3132008, &geo_ufs[16]},
+	{"Itacarambi", 3132107, &geo_ufs[16]},
+	{"Itaguara", 3132206, &geo_ufs[16]},
+	{"Itaipé", 3132305, &geo_ufs[16]},
+	{"Itajubá", 3132404, &geo_ufs[16]},
+	{"Itamarandiba", 3132503, &geo_ufs[16]},
+	{"Itamarati de Minas", 3132602, &geo_ufs[16]},
+	{"Itambacuri", 3132701, &geo_ufs[16]},
+	{"Itambé do Mato Dentro", 3132800, &geo_ufs[16]},
+	{"Itamogi", 3132909, &geo_ufs[16]},
+	{"Itamonte", 3133006, &geo_ufs[16]},
+	{"Itanhandu", 3133105, &geo_ufs[16]},
+	{"Itanhomi", 3133204, &geo_ufs[16]},
+	{"Itaobim", 3133303, &geo_ufs[16]},
+	{"Itapagipe", 3133402, &geo_ufs[16]},
+	{"Itapecerica", 3133501, &geo_ufs[16]},
+	{"Itapeva", 3133600, &geo_ufs[16]},
+	{"Itatiaiuçu", 3133709, &geo_ufs[16]},
+	{"Itaú de Minas", 3133758, &geo_ufs[16]},
+	{"Itaúna", 3133808, &geo_ufs[16]},
+	{"Itaverava", 3133907, &geo_ufs[16]},
+	{"Itinga", 3134004, &geo_ufs[16]},
+	{"Itueta", 3134103, &geo_ufs[16]},
+	{"Ituiutaba", 3134202, &geo_ufs[16]},
+	{"Itumirim", 3134301, &geo_ufs[16]},
+	{"Iturama", 3134400, &geo_ufs[16]},
+	{"Itutinga", 3134509, &geo_ufs[16]},
+	{"Jaboticatubas", 3134608, &geo_ufs[16]},
+	{"Jacinto", 3134707, &geo_ufs[16]},
+	{"Jacuí", 3134806, &geo_ufs[16]},
+	{"Jacutinga", 3134905, &geo_ufs[16]},
+	{"Jaguaraçu", 3135001, &geo_ufs[16]},
+	{"Jaíba", 3135050, &geo_ufs[16]},
+	{"Jampruca", 3135076, &geo_ufs[16]},
+	{"Janaúba", 3135100, &geo_ufs[16]},
+	{"Januária", 3135209, &geo_ufs[16]},
+	{"Japaraíba", 3135308, &geo_ufs[16]},
+	{"Japonvar", 3135357, &geo_ufs[16]},
+	{"Jeceaba", 3135407, &geo_ufs[16]},
+	{"Jenipapo de Minas", 3135456, &geo_ufs[16]},
+	{"Jequeri", 3135506, &geo_ufs[16]},
+	{"Jequitaí", 3135605, &geo_ufs[16]},
+	{"Jequitibá", 3135704, &geo_ufs[16]},
+	{"Jequitinhonha", 3135803, &geo_ufs[16]},
+	{"Jesuânia", 3135902, &geo_ufs[16]},
+	{"Joaíma", 3136009, &geo_ufs[16]},
+	{"Joanésia", 3136108, &geo_ufs[16]},
+	{"João Monlevade", 3136207, &geo_ufs[16]},
+	{"João Pinheiro", 3136306, &geo_ufs[16]},
+	{"Joaquim Felício", 3136405, &geo_ufs[16]},
+	{"Jordânia", 3136504, &geo_ufs[16]},
+	{"José Gonçalves de Minas", 3136520, &geo_ufs[16]},
+	{"José Raydan", 3136553, &geo_ufs[16]},
+	{"Josenópolis", 3136579, &geo_ufs[16]},
+	{"Nova União", 3136603, &geo_ufs[16]},
+	{"Juatuba", 3136652, &geo_ufs[16]},
+	{"Juiz de Fora", 3136702, &geo_ufs[16]},
+	{"Juramento", 3136801, &geo_ufs[16]},
+	{"Juruaia", 3136900, &geo_ufs[16]},
+	{"Juvenília", 3136959, &geo_ufs[16]},
+	{"Ladainha", 3137007, &geo_ufs[16]},
+	{"Lagamar", 3137106, &geo_ufs[16]},
+	{"Lagoa da Prata", 3137205, &geo_ufs[16]},
+	{"Lagoa dos Patos", 3137304, &geo_ufs[16]},
+	{"Lagoa Dourada", 3137403, &geo_ufs[16]},
+	{"Lagoa Formosa", 3137502, &geo_ufs[16]},
+	{"Lagoa Grande", 3137536, &geo_ufs[16]},
+	{"Lagoa Santa", 3137601, &geo_ufs[16]},
+	{"Lajinha", 3137700, &geo_ufs[16]},
+	{"Lambari", 3137809, &geo_ufs[16]},
+	{"Lamim", 3137908, &geo_ufs[16]},
+	{"Laranjal", 3138005, &geo_ufs[16]},
+	{"Lassance", 3138104, &geo_ufs[16]},
+	{"Lavras", 3138203, &geo_ufs[16]},
+	{"Leandro Ferreira", 3138302, &geo_ufs[16]},
+	{"Leme do Prado", 3138351, &geo_ufs[16]},
+	{"Leopoldina", 3138401, &geo_ufs[16]},
+	{"Liberdade", 3138500, &geo_ufs[16]},
+	{"Lima Duarte", 3138609, &geo_ufs[16]},
+	{"Limeira do Oeste", 3138625, &geo_ufs[16]},
+	{"Lontra", 3138658, &geo_ufs[16]},
+	{"Luisburgo", 3138674, &geo_ufs[16]},
+	{"Luislândia", 3138682, &geo_ufs[16]},
+	{"Luminárias", 3138708, &geo_ufs[16]},
+	{"Luz", 3138807, &geo_ufs[16]},
+	{"Machacalis", 3138906, &geo_ufs[16]},
+	{"Machado", 3139003, &geo_ufs[16]},
+	{"Madre de Deus de Minas", 3139102, &geo_ufs[16]},
+	{"Malacacheta", 3139201, &geo_ufs[16]},
+	{"Mamonas", 3139250, &geo_ufs[16]},
+	{"Manga", 3139300, &geo_ufs[16]},
+	{"Manhuaçu", 3139409, &geo_ufs[16]},
+	{"Manhumirim", 3139508, &geo_ufs[16]},
+	{"Mantena", 3139607, &geo_ufs[16]},
+	{"Maravilhas", 3139706, &geo_ufs[16]},
+	{"Mar de Espanha", 3139805, &geo_ufs[16]},
+	{"Maria da Fé", 3139904, &geo_ufs[16]},
+	{"Mariana", 3140001, &geo_ufs[16]},
+	{"Marilac", 3140100, &geo_ufs[16]},
+	{"Mário Campos", 3140159, &geo_ufs[16]},
+	{"Maripá de Minas", 3140209, &geo_ufs[16]},
+	{"Marliéria", 3140308, &geo_ufs[16]},
+	{"Marmelópolis", 3140407, &geo_ufs[16]},
+	{"Martinho Campos", 3140506, &geo_ufs[16]},
+	{"Martins Soares", 3140530, &geo_ufs[16]},
+	{"Mata Verde", 3140555, &geo_ufs[16]},
+	{"Materlândia", 3140605, &geo_ufs[16]},
+	{"Mateus Leme", 3140704, &geo_ufs[16]},
+	{"Matias Barbosa", 3140803, &geo_ufs[16]},
+	{"Matias Cardoso", 3140852, &geo_ufs[16]},
+	{"Matipó", 3140902, &geo_ufs[16]},
+	{"Mato Verde", 3141009, &geo_ufs[16]},
+	{"Matozinhos", 3141108, &geo_ufs[16]},
+	{"Matutina", 3141207, &geo_ufs[16]},
+	{"Medeiros", 3141306, &geo_ufs[16]},
+	{"Medina", 3141405, &geo_ufs[16]},
+	{"Mendes Pimentel", 3141504, &geo_ufs[16]},
+	{"Mercês", 3141603, &geo_ufs[16]},
+	{"Mesquita", 3141702, &geo_ufs[16]},
+	{"Minas Novas", 3141801, &geo_ufs[16]},
+	{"Minduri", 3141900, &geo_ufs[16]},
+	{"Mirabela", 3142007, &geo_ufs[16]},
+	{"Miradouro", 3142106, &geo_ufs[16]},
+	{"Miraí", 3142205, &geo_ufs[16]},
+	{"Miravânia", 3142254, &geo_ufs[16]},
+	{"Moeda", 3142304, &geo_ufs[16]},
+	{"Moema", 3142403, &geo_ufs[16]},
+	{"Monjolos", 3142502, &geo_ufs[16]},
+	{"Monsenhor Paulo", 3142601, &geo_ufs[16]},
+	{"Montalvânia", 3142700, &geo_ufs[16]},
+	{"Monte Alegre de Minas", 3142809, &geo_ufs[16]},
+	{"Monte Azul", 3142908, &geo_ufs[16]},
+	{"Monte Belo", 3143005, &geo_ufs[16]},
+	{"Monte Carmelo", 3143104, &geo_ufs[16]},
+	{"Monte Formoso", 3143153, &geo_ufs[16]},
+	{"Monte Santo de Minas", 3143203, &geo_ufs[16]},
+	{"Montes Claros", 3143302, &geo_ufs[16]},
+	{"Monte Sião", 3143401, &geo_ufs[16]},
+	{"Montezuma", 3143450, &geo_ufs[16]},
+	{"Morada Nova de Minas", 3143500, &geo_ufs[16]},
+	{"Morro da Garça", 3143609, &geo_ufs[16]},
+	{"Morro do Pilar", 3143708, &geo_ufs[16]},
+	{"Munhoz", 3143807, &geo_ufs[16]},
+	{"Muriaé", 3143906, &geo_ufs[16]},
+	{"Mutum", 3144003, &geo_ufs[16]},
+	{"Muzambinho", 3144102, &geo_ufs[16]},
+	{"Nacip Raydan", 3144201, &geo_ufs[16]},
+	{"Nanuque", 3144300, &geo_ufs[16]},
+	{"Naque", 3144359, &geo_ufs[16]},
+	{"Natalândia", 3144375, &geo_ufs[16]},
+	{"Natércia", 3144409, &geo_ufs[16]},
+	{"Nazareno", 3144508, &geo_ufs[16]},
+	{"Nepomuceno", 3144607, &geo_ufs[16]},
+	{"Ninheira", 3144656, &geo_ufs[16]},
+	{"Nova Belém", 3144672, &geo_ufs[16]},
+	{"Nova Era", 3144706, &geo_ufs[16]},
+	{"Nova Lima", 3144805, &geo_ufs[16]},
+	{"Nova Módica", 3144904, &geo_ufs[16]},
+	{"Nova Ponte", 3145000, &geo_ufs[16]},
+	{"Nova Porteirinha", 3145059, &geo_ufs[16]},
+	{"Nova Resende", 3145109, &geo_ufs[16]},
+	{"Nova Serrana", 3145208, &geo_ufs[16]},
+	{"Novo Cruzeiro", 3145307, &geo_ufs[16]},
+	{"Novo Oriente de Minas", 3145356, &geo_ufs[16]},
+	{"Novorizonte", 3145372, &geo_ufs[16]},
+	{"Olaria", 3145406, &geo_ufs[16]},
+	{"Olhos-d'Água", 3145455, &geo_ufs[16]},
+	{"Olímpio Noronha", 3145505, &geo_ufs[16]},
+	{"Oliveira", 3145604, &geo_ufs[16]},
+	{"Oliveira Fortes", 3145703, &geo_ufs[16]},
+	{"Onça de Pitangui", 3145802, &geo_ufs[16]},
+	{"Oratórios", 3145851, &geo_ufs[16]},
+	{"Orizânia", 3145877, &geo_ufs[16]},
+	{"Ouro Branco", 3145901, &geo_ufs[16]},
+	{"Ouro Fino", 3146008, &geo_ufs[16]},
+	{"Ouro Preto", 3146107, &geo_ufs[16]},
+	{"Ouro Verde de Minas", 3146206, &geo_ufs[16]},
+	{"Padre Carvalho", 3146255, &geo_ufs[16]},
+	{"Padre Paraíso", 3146305, &geo_ufs[16]},
+	{"Paineiras", 3146404, &geo_ufs[16]},
+	{"Pains", 3146503, &geo_ufs[16]},
+	{"Pai Pedro", 3146552, &geo_ufs[16]},
+	{"Paiva", 3146602, &geo_ufs[16]},
+	{"Palma", 3146701, &geo_ufs[16]},
+	{"Palmópolis", 3146750, &geo_ufs[16]},
+	{"Papagaios", 3146909, &geo_ufs[16]},
+	{"Paracatu", 3147006, &geo_ufs[16]},
+	{"Pará de Minas", 3147105, &geo_ufs[16]},
+	{"Paraguaçu", 3147204, &geo_ufs[16]},
+	{"Paraisópolis", 3147303, &geo_ufs[16]},
+	{"Paraopeba", 3147402, &geo_ufs[16]},
+	{"Passabém", 3147501, &geo_ufs[16]},
+	{"Passa Quatro", 3147600, &geo_ufs[16]},
+	{"Passa Tempo", 3147709, &geo_ufs[16]},
+	{"Passa-Vinte", 3147808, &geo_ufs[16]},
+	{"Passos", 3147907, &geo_ufs[16]},
+	{"Patis", 3147956, &geo_ufs[16]},
+	{"Patos de Minas", 3148004, &geo_ufs[16]},
+	{"Patrocínio", 3148103, &geo_ufs[16]},
+	{"Patrocínio do Muriaé", 3148202, &geo_ufs[16]},
+	{"Paula Cândido", 3148301, &geo_ufs[16]},
+	{"Paulistas", 3148400, &geo_ufs[16]},
+	{"Pavão", 3148509, &geo_ufs[16]},
+	{"Peçanha", 3148608, &geo_ufs[16]},
+	{"Pedra Azul", 3148707, &geo_ufs[16]},
+	{"Pedra Bonita", 3148756, &geo_ufs[16]},
+	{"Pedra do Anta", 3148806, &geo_ufs[16]},
+	{"Pedra do Indaiá", 3148905, &geo_ufs[16]},
+	{"Pedra Dourada", 3149002, &geo_ufs[16]},
+	{"Pedralva", 3149101, &geo_ufs[16]},
+	{"Pedras de Maria da Cruz", 3149150, &geo_ufs[16]},
+	{"Pedrinópolis", 3149200, &geo_ufs[16]},
+	{"Pedro Leopoldo", 3149309, &geo_ufs[16]},
+	{"Pedro Teixeira", 3149408, &geo_ufs[16]},
+	{"Pequeri", 3149507, &geo_ufs[16]},
+	{"Pequi", 3149606, &geo_ufs[16]},
+	{"Perdigão", 3149705, &geo_ufs[16]},
+	{"Perdizes", 3149804, &geo_ufs[16]},
+	{"Perdões", 3149903, &geo_ufs[16]},
+	{"Periquito", 3149952, &geo_ufs[16]},
+	{"Pescador", 3150000, &geo_ufs[16]},
+	{"Piau", 3150109, &geo_ufs[16]},
+	{"Piedade de Caratinga", 3150158, &geo_ufs[16]},
+	{"Piedade de Ponte Nova", 3150208, &geo_ufs[16]},
+	{"Piedade do Rio Grande", 3150307, &geo_ufs[16]},
+	{"Piedade dos Gerais", 3150406, &geo_ufs[16]},
+	{"Pimenta", 3150505, &geo_ufs[16]},
+	{"Pingo-d'Água", 3150539, &geo_ufs[16]},
+	{"Pintópolis", 3150570, &geo_ufs[16]},
+	{"Piracema", 3150604, &geo_ufs[16]},
+	{"Pirajuba", 3150703, &geo_ufs[16]},
+	{"Piranga", 3150802, &geo_ufs[16]},
+	{"Piranguçu", 3150901, &geo_ufs[16]},
+	{"Piranguinho", 3151008, &geo_ufs[16]},
+	{"Pirapetinga", 3151107, &geo_ufs[16]},
+	{"Pirapora", 3151206, &geo_ufs[16]},
+	{"Piraúba", 3151305, &geo_ufs[16]},
+	{"Pitangui", 3151404, &geo_ufs[16]},
+	{"Piumhi", 3151503, &geo_ufs[16]},
+	{"Planura", 3151602, &geo_ufs[16]},
+	{"Poço Fundo", 3151701, &geo_ufs[16]},
+	{"Poços de Caldas", 3151800, &geo_ufs[16]},
+	{"Pocrane", 3151909, &geo_ufs[16]},
+	{"Pompéu", 3152006, &geo_ufs[16]},
+	{"Ponte Nova", 3152105, &geo_ufs[16]},
+	{"Ponto Chique", 3152131, &geo_ufs[16]},
+	{"Ponto dos Volantes", 3152170, &geo_ufs[16]},
+	{"Porteirinha", 3152204, &geo_ufs[16]},
+	{"Porto Firme", 3152303, &geo_ufs[16]},
+	{"Poté", 3152402, &geo_ufs[16]},
+	{"Pouso Alegre", 3152501, &geo_ufs[16]},
+	{"Pouso Alto", 3152600, &geo_ufs[16]},
+	{"Prados", 3152709, &geo_ufs[16]},
+	{"Prata", 3152808, &geo_ufs[16]},
+	{"Pratápolis", 3152907, &geo_ufs[16]},
+	{"Pratinha", 3153004, &geo_ufs[16]},
+	{"Presidente Bernardes", 3153103, &geo_ufs[16]},
+	{"Presidente Juscelino", 3153202, &geo_ufs[16]},
+	{"Presidente Kubitschek", 3153301, &geo_ufs[16]},
+	{"Presidente Olegário", 3153400, &geo_ufs[16]},
+	{"Alto Jequitibá", 3153509, &geo_ufs[16]},
+	{"Prudente de Morais", 3153608, &geo_ufs[16]},
+	{"Quartel Geral", 3153707, &geo_ufs[16]},
+	{"Queluzito", 3153806, &geo_ufs[16]},
+	{"Raposos", 3153905, &geo_ufs[16]},
+	{"Raul Soares", 3154002, &geo_ufs[16]},
+	{"Recreio", 3154101, &geo_ufs[16]},
+	{"Reduto", 3154150, &geo_ufs[16]},
+	{"Resende Costa", 3154200, &geo_ufs[16]},
+	{"Resplendor", 3154309, &geo_ufs[16]},
+	{"Ressaquinha", 3154408, &geo_ufs[16]},
+	{"Riachinho", 3154457, &geo_ufs[16]},
+	{"Riacho dos Machados", 3154507, &geo_ufs[16]},
+	{"Ribeirão das Neves", 3154606, &geo_ufs[16]},
+	{"Ribeirão Vermelho", 3154705, &geo_ufs[16]},
+	{"Rio Acima", 3154804, &geo_ufs[16]},
+	{"Rio Casca", 3154903, &geo_ufs[16]},
+	{"Rio Doce", 3155009, &geo_ufs[16]},
+	{"Rio do Prado", 3155108, &geo_ufs[16]},
+	{"Rio Espera", 3155207, &geo_ufs[16]},
+	{"Rio Manso", 3155306, &geo_ufs[16]},
+	{"Rio Novo", 3155405, &geo_ufs[16]},
+	{"Rio Paranaíba", 3155504, &geo_ufs[16]},
+	{"Rio Pardo de Minas", 3155603, &geo_ufs[16]},
+	{"Rio Piracicaba", 3155702, &geo_ufs[16]},
+	{"Rio Pomba", 3155801, &geo_ufs[16]},
+	{"Rio Preto", 3155900, &geo_ufs[16]},
+	{"Rio Vermelho", 3156007, &geo_ufs[16]},
+	{"Ritápolis", 3156106, &geo_ufs[16]},
+	{"Rochedo de Minas", 3156205, &geo_ufs[16]},
+	{"Rodeiro", 3156304, &geo_ufs[16]},
+	{"Romaria", 3156403, &geo_ufs[16]},
+	{"Rosário da Limeira", 3156452, &geo_ufs[16]},
+	{"Rubelita", 3156502, &geo_ufs[16]},
+	{"Rubim", 3156601, &geo_ufs[16]},
+	{"Sabará", 3156700, &geo_ufs[16]},
+	{"Sabinópolis", 3156809, &geo_ufs[16]},
+	{"Sacramento", 3156908, &geo_ufs[16]},
+	{"Salinas", 3157005, &geo_ufs[16]},
+	{"Salto da Divisa", 3157104, &geo_ufs[16]},
+	{"Santa Bárbara", 3157203, &geo_ufs[16]},
+	{"Santa Bárbara do Leste", 3157252, &geo_ufs[16]},
+	{"Santa Bárbara do Monte Verde", 3157278, &geo_ufs[16]},
+	{"Santa Bárbara do Tugúrio", 3157302, &geo_ufs[16]},
+	{"Santa Cruz de Minas", 3157336, &geo_ufs[16]},
+	{"Santa Cruz de Salinas", 3157377, &geo_ufs[16]},
+	{"Santa Cruz do Escalvado", 3157401, &geo_ufs[16]},
+	{"Santa Efigênia de Minas", 3157500, &geo_ufs[16]},
+	{"Santa Fé de Minas", 3157609, &geo_ufs[16]},
+	{"Santa Helena de Minas", 3157658, &geo_ufs[16]},
+	{"Santa Juliana", 3157708, &geo_ufs[16]},
+	{"Santa Luzia", 3157807, &geo_ufs[16]},
+	{"Santa Margarida", 3157906, &geo_ufs[16]},
+	{"Santa Maria de Itabira", 3158003, &geo_ufs[16]},
+	{"Santa Maria do Salto", 3158102, &geo_ufs[16]},
+	{"Santa Maria do Suaçuí", 3158201, &geo_ufs[16]},
+	{"Santana da Vargem", 3158300, &geo_ufs[16]},
+	{"Santana de Cataguases", 3158409, &geo_ufs[16]},
+	{"Santana de Pirapama", 3158508, &geo_ufs[16]},
+	{"Santana do Deserto", 3158607, &geo_ufs[16]},
+	{"Santana do Garambéu", 3158706, &geo_ufs[16]},
+	{"Santana do Jacaré", 3158805, &geo_ufs[16]},
+	{"Santana do Manhuaçu", 3158904, &geo_ufs[16]},
+	{"Santana do Paraíso", 3158953, &geo_ufs[16]},
+	{"Santana do Riacho", 3159001, &geo_ufs[16]},
+	{"Santana dos Montes", 3159100, &geo_ufs[16]},
+	{"Santa Rita de Caldas", 3159209, &geo_ufs[16]},
+	{"Santa Rita de Jacutinga", 3159308, &geo_ufs[16]},
+	{"Santa Rita de Minas", 3159357, &geo_ufs[16]},
+	{"Santa Rita de Ibitipoca", 3159407, &geo_ufs[16]},
+	{"Santa Rita do Itueto", 3159506, &geo_ufs[16]},
+	{"Santa Rita do Sapucaí", 3159605, &geo_ufs[16]},
+	{"Santa Rosa da Serra", 3159704, &geo_ufs[16]},
+	{"Santa Vitória", 3159803, &geo_ufs[16]},
+	{"Santo Antônio do Amparo", 3159902, &geo_ufs[16]},
+	{"Santo Antônio do Aventureiro", 3160009, &geo_ufs[16]},
+	{"Santo Antônio do Grama", 3160108, &geo_ufs[16]},
+	{"Santo Antônio do Itambé", 3160207, &geo_ufs[16]},
+	{"Santo Antônio do Jacinto", 3160306, &geo_ufs[16]},
+	{"Santo Antônio do Monte", 3160405, &geo_ufs[16]},
+	{"Santo Antônio do Retiro", 3160454, &geo_ufs[16]},
+	{"Santo Antônio do Rio Abaixo", 3160504, &geo_ufs[16]},
+	{"Santo Hipólito", 3160603, &geo_ufs[16]},
+	{"Santos Dumont", 3160702, &geo_ufs[16]},
+	{"São Bento Abade", 3160801, &geo_ufs[16]},
+	{"São Brás do Suaçuí", 3160900, &geo_ufs[16]},
+	{"São Domingos das Dores", 3160959, &geo_ufs[16]},
+	{"São Domingos do Prata", 3161007, &geo_ufs[16]},
+	{"São Félix de Minas", 3161056, &geo_ufs[16]},
+	{"São Francisco", 3161106, &geo_ufs[16]},
+	{"São Francisco de Paula", 3161205, &geo_ufs[16]},
+	{"São Francisco de Sales", 3161304, &geo_ufs[16]},
+	{"São Francisco do Glória", 3161403, &geo_ufs[16]},
+	{"São Geraldo", 3161502, &geo_ufs[16]},
+	{"São Geraldo da Piedade", 3161601, &geo_ufs[16]},
+	{"São Geraldo do Baixio", 3161650, &geo_ufs[16]},
+	{"São Gonçalo do Abaeté", 3161700, &geo_ufs[16]},
+	{"São Gonçalo do Pará", 3161809, &geo_ufs[16]},
+	{"São Gonçalo do Rio Abaixo", 3161908, &geo_ufs[16]},
+	{"São Gonçalo do Sapucaí", 3162005, &geo_ufs[16]},
+	{"São Gotardo", 3162104, &geo_ufs[16]},
+	{"São João Batista do Glória", 3162203, &geo_ufs[16]},
+	{"São João da Lagoa", 3162252, &geo_ufs[16]},
+	{"São João da Mata", 3162302, &geo_ufs[16]},
+	{"São João da Ponte", 3162401, &geo_ufs[16]},
+	{"São João das Missões", 3162450, &geo_ufs[16]},
+	{"São João del Rei", 3162500, &geo_ufs[16]},
+	{"São João do Manhuaçu", 3162559, &geo_ufs[16]},
+	{"São João do Manteninha", 3162575, &geo_ufs[16]},
+	{"São João do Oriente", 3162609, &geo_ufs[16]},
+	{"São João do Pacuí", 3162658, &geo_ufs[16]},
+	{"São João do Paraíso", 3162708, &geo_ufs[16]},
+	{"São João Evangelista", 3162807, &geo_ufs[16]},
+	{"São João Nepomuceno", 3162906, &geo_ufs[16]},
+	{"São Joaquim de Bicas", 3162922, &geo_ufs[16]},
+	{"São José da Barra", 3162948, &geo_ufs[16]},
+	{"São José da Lapa", 3162955, &geo_ufs[16]},
+	{"São José da Safira", 3163003, &geo_ufs[16]},
+	{"São José da Varginha", 3163102, &geo_ufs[16]},
+	{"São José do Alegre", 3163201, &geo_ufs[16]},
+	{"São José do Divino", 3163300, &geo_ufs[16]},
+	{"São José do Goiabal", 3163409, &geo_ufs[16]},
+	{"São José do Jacuri", 3163508, &geo_ufs[16]},
+	{"São José do Mantimento", 3163607, &geo_ufs[16]},
+	{"São Lourenço", 3163706, &geo_ufs[16]},
+	{"São Miguel do Anta", 3163805, &geo_ufs[16]},
+	{"São Pedro da União", 3163904, &geo_ufs[16]},
+	{"São Pedro dos Ferros", 3164001, &geo_ufs[16]},
+	{"São Pedro do Suaçuí", 3164100, &geo_ufs[16]},
+	{"São Romão", 3164209, &geo_ufs[16]},
+	{"São Roque de Minas", 3164308, &geo_ufs[16]},
+	{"São Sebastião da Bela Vista", 3164407, &geo_ufs[16]},
+	{"São Sebastião da Vargem Alegre", 3164431, &geo_ufs[16]},
+	{"São Sebastião do Anta", 3164472, &geo_ufs[16]},
+	{"São Sebastião do Maranhão", 3164506, &geo_ufs[16]},
+	{"São Sebastião do Oeste", 3164605, &geo_ufs[16]},
+	{"São Sebastião do Paraíso", 3164704, &geo_ufs[16]},
+	{"São Sebastião do Rio Preto", 3164803, &geo_ufs[16]},
+	{"São Sebastião do Rio Verde", 3164902, &geo_ufs[16]},
+	{"São Tiago", 3165008, &geo_ufs[16]},
+	{"São Tomás de Aquino", 3165107, &geo_ufs[16]},
+	{"São Thomé das Letras", 3165206, &geo_ufs[16]},
+	{"São Vicente de Minas", 3165305, &geo_ufs[16]},
+	{"Sapucaí-Mirim", 3165404, &geo_ufs[16]},
+	{"Sardoá", 3165503, &geo_ufs[16]},
+	{"Sarzedo", 3165537, &geo_ufs[16]},
+	{"Setubinha", 3165552, &geo_ufs[16]},
+	{"Sem-Peixe", 3165560, &geo_ufs[16]},
+	{"Senador Amaral", 3165578, &geo_ufs[16]},
+	{"Senador Cortes", 3165602, &geo_ufs[16]},
+	{"Senador Firmino", 3165701, &geo_ufs[16]},
+	{"Senador José Bento", 3165800, &geo_ufs[16]},
+	{"Senador Modestino Gonçalves", 3165909, &geo_ufs[16]},
+	{"Senhora de Oliveira", 3166006, &geo_ufs[16]},
+	{"Senhora do Porto", 3166105, &geo_ufs[16]},
+	{"Senhora dos Remédios", 3166204, &geo_ufs[16]},
+	{"Sericita", 3166303, &geo_ufs[16]},
+	{"Seritinga", 3166402, &geo_ufs[16]},
+	{"Serra Azul de Minas", 3166501, &geo_ufs[16]},
+	{"Serra da Saudade", 3166600, &geo_ufs[16]},
+	{"Serra dos Aimorés", 3166709, &geo_ufs[16]},
+	{"Serra do Salitre", 3166808, &geo_ufs[16]},
+	{"Serrania", 3166907, &geo_ufs[16]},
+	{"Serranópolis de Minas", 3166956, &geo_ufs[16]},
+	{"Serranos", 3167004, &geo_ufs[16]},
+	{"Serro", 3167103, &geo_ufs[16]},
+	{"Sete Lagoas", 3167202, &geo_ufs[16]},
+	{"Silveirânia", 3167301, &geo_ufs[16]},
+	{"Silvianópolis", 3167400, &geo_ufs[16]},
+	{"Simão Pereira", 3167509, &geo_ufs[16]},
+	{"Simonésia", 3167608, &geo_ufs[16]},
+	{"Sobrália", 3167707, &geo_ufs[16]},
+	{"Soledade de Minas", 3167806, &geo_ufs[16]},
+	{"Tabuleiro", 3167905, &geo_ufs[16]},
+	{"Taiobeiras", 3168002, &geo_ufs[16]},
+	{"Taparuba", 3168051, &geo_ufs[16]},
+	{"Tapira", 3168101, &geo_ufs[16]},
+	{"Tapiraí", 3168200, &geo_ufs[16]},
+	{"Taquaraçu de Minas", 3168309, &geo_ufs[16]},
+	{"Tarumirim", 3168408, &geo_ufs[16]},
+	{"Teixeiras", 3168507, &geo_ufs[16]},
+	{"Teófilo Otoni", 3168606, &geo_ufs[16]},
+	{"Timóteo", 3168705, &geo_ufs[16]},
+	{"Tiradentes", 3168804, &geo_ufs[16]},
+	{"Tiros", 3168903, &geo_ufs[16]},
+	{"Tocantins", 3169000, &geo_ufs[16]},
+	{"Tocos do Moji", 3169059, &geo_ufs[16]},
+	{"Toledo", 3169109, &geo_ufs[16]},
+	{"Tombos", 3169208, &geo_ufs[16]},
+	{"Três Corações", 3169307, &geo_ufs[16]},
+	{"Três Marias", 3169356, &geo_ufs[16]},
+	{"Três Pontas", 3169406, &geo_ufs[16]},
+	{"Tumiritinga", 3169505, &geo_ufs[16]},
+	{"Tupaciguara", 3169604, &geo_ufs[16]},
+	{"Turmalina", 3169703, &geo_ufs[16]},
+	{"Turvolândia", 3169802, &geo_ufs[16]},
+	{"Ubá", 3169901, &geo_ufs[16]},
+	{"Ubaí", 3170008, &geo_ufs[16]},
+	{"Ubaporanga", 3170057, &geo_ufs[16]},
+	{"Uberaba", 3170107, &geo_ufs[16]},
+	{"Uberlândia", 3170206, &geo_ufs[16]},
+	{"Umburatiba", 3170305, &geo_ufs[16]},
+	{"Unaí", 3170404, &geo_ufs[16]},
+	{"União de Minas", 3170438, &geo_ufs[16]},
+	{"Uruana de Minas", 3170479, &geo_ufs[16]},
+	{"Urucânia", 3170503, &geo_ufs[16]},
+	{"Urucuia", 3170529, &geo_ufs[16]},
+	{"Vargem Alegre", 3170578, &geo_ufs[16]},
+	{"Vargem Bonita", 3170602, &geo_ufs[16]},
+	{"Vargem Grande do Rio Pardo", 3170651, &geo_ufs[16]},
+	{"Varginha", 3170701, &geo_ufs[16]},
+	{"Varjão de Minas", 3170750, &geo_ufs[16]},
+	{"Várzea da Palma", 3170800, &geo_ufs[16]},
+	{"Varzelândia", 3170909, &geo_ufs[16]},
+	{"Vazante", 3171006, &geo_ufs[16]},
+	{"Verdelândia", 3171030, &geo_ufs[16]},
+	{"Veredinha", 3171071, &geo_ufs[16]},
+	{"Veríssimo", 3171105, &geo_ufs[16]},
+	{"Vermelho Novo", 3171154, &geo_ufs[16]},
+	{"Vespasiano", 3171204, &geo_ufs[16]},
+	{"Viçosa", 3171303, &geo_ufs[16]},
+	{"Vieiras", 3171402, &geo_ufs[16]},
+	{"Mathias Lobato", 3171501, &geo_ufs[16]},
+	{"Virgem da Lapa", 3171600, &geo_ufs[16]},
+	{"Virgínia", 3171709, &geo_ufs[16]},
+	{"Virginópolis", 3171808, &geo_ufs[16]},
+	{"Virgolândia", 3171907, &geo_ufs[16]},
+	{"Visconde do Rio Branco", 3172004, &geo_ufs[16]},
+	{"Volta Grande", 3172103, &geo_ufs[16]},
+	{"Wenceslau Braz", 3172202, &geo_ufs[16]},
+	{"Afonso Cláudio", 3200102, &geo_ufs[17]},
+	{"Águia Branca", 3200136, &geo_ufs[17]},
+	{"Água Doce do Norte", 3200169, &geo_ufs[17]},
+	{"Alegre", 3200201, &geo_ufs[17]},
+	{"Alfredo Chaves", 3200300, &geo_ufs[17]},
+	{"Alto Rio Novo", 3200359, &geo_ufs[17]},
+	{"Anchieta", 3200409, &geo_ufs[17]},
+	{"Apiacá", 3200508, &geo_ufs[17]},
+	{"Aracruz", 3200607, &geo_ufs[17]},
+	{"Atilio Vivacqua", 3200706, &geo_ufs[17]},
+	{"Baixo Guandu", 3200805, &geo_ufs[17]},
+	{"Barra de São Francisco", 3200904, &geo_ufs[17]},
+	{"Boa Esperança", 3201001, &geo_ufs[17]},
+	{"Bom Jesus do Norte", 3201100, &geo_ufs[17]},
+	{"Brejetuba", 3201159, &geo_ufs[17]},
+	{"Cachoeiro de Itapemirim", 3201209, &geo_ufs[17]},
+	{"Cariacica", 3201308, &geo_ufs[17]},
+	{"Castelo", 3201407, &geo_ufs[17]},
+	{"Colatina", 3201506, &geo_ufs[17]},
+	{"Conceição da Barra", 3201605, &geo_ufs[17]},
+	{"Conceição do Castelo", 3201704, &geo_ufs[17]},
+	{"Divino de São Lourenço", 3201803, &geo_ufs[17]},
+	{"Domingos Martins", 3201902, &geo_ufs[17]},
+	{"Dores do Rio Preto", 3202009, &geo_ufs[17]},
+	{"Ecoporanga", 3202108, &geo_ufs[17]},
+	{"Fundão", 3202207, &geo_ufs[17]},
+	{"Governador Lindenberg", 3202256, &geo_ufs[17]},
+	{"Guaçuí", 3202306, &geo_ufs[17]},
+	{"Guarapari", 3202405, &geo_ufs[17]},
+	{"Ibatiba", 3202454, &geo_ufs[17]},
+	{"Ibiraçu", 3202504, &geo_ufs[17]},
+	{"Ibitirama", 3202553, &geo_ufs[17]},
+	{"Iconha", 3202603, &geo_ufs[17]},
+	{"Irupi", 3202652, &geo_ufs[17]},
+	{"Itaguaçu", 3202702, &geo_ufs[17]},
+	{"Itapemirim", 3202801, &geo_ufs[17]},
+	{"Itarana", 3202900, &geo_ufs[17]},
+	{"Iúna", 3203007, &geo_ufs[17]},
+	{"Jaguaré", 3203056, &geo_ufs[17]},
+	{"Jerônimo Monteiro", 3203106, &geo_ufs[17]},
+	{"João Neiva", 3203130, &geo_ufs[17]},
+	{"Laranja da Terra", 3203163, &geo_ufs[17]},
+	{"Linhares", 3203205, &geo_ufs[17]},
+	{"Mantenópolis", 3203304, &geo_ufs[17]},
+	{"Marataízes", 3203320, &geo_ufs[17]},
+	{"Marechal Floriano", 3203346, &geo_ufs[17]},
+	{"Marilândia", 3203353, &geo_ufs[17]},
+	{"Mimoso do Sul", 3203403, &geo_ufs[17]},
+	{"Montanha", 3203502, &geo_ufs[17]},
+	{"Mucurici", 3203601, &geo_ufs[17]},
+	{"Muniz Freire", 3203700, &geo_ufs[17]},
+	{"Muqui", 3203809, &geo_ufs[17]},
+	{"Nova Venécia", 3203908, &geo_ufs[17]},
+	{"Pancas", 3204005, &geo_ufs[17]},
+	{"Pedro Canário", 3204054, &geo_ufs[17]},
+	{"Pinheiros", 3204104, &geo_ufs[17]},
+	{"Piúma", 3204203, &geo_ufs[17]},
+	{"Ponto Belo", 3204252, &geo_ufs[17]},
+	{"Presidente Kennedy", 3204302, &geo_ufs[17]},
+	{"Rio Bananal", 3204351, &geo_ufs[17]},
+	{"Rio Novo do Sul", 3204401, &geo_ufs[17]},
+	{"Santa Leopoldina", 3204500, &geo_ufs[17]},
+	{"Santa Maria de Jetibá", 3204559, &geo_ufs[17]},
+	{"Santa Teresa", 3204609, &geo_ufs[17]},
+	{"São Domingos do Norte", 3204658, &geo_ufs[17]},
+	{"São Gabriel da Palha", 3204708, &geo_ufs[17]},
+	{"São José do Calçado", 3204807, &geo_ufs[17]},
+	{"São Mateus", 3204906, &geo_ufs[17]},
+	{"São Roque do Canaã", 3204955, &geo_ufs[17]},
+	{"Serra", 3205002, &geo_ufs[17]},
+	{"Sooretama", 3205010, &geo_ufs[17]},
+	{"Vargem Alta", 3205036, &geo_ufs[17]},
+	{"Venda Nova do Imigrante", 3205069, &geo_ufs[17]},
+	{"Viana", 3205101, &geo_ufs[17]},
+	{"Vila Pavão", 3205150, &geo_ufs[17]},
+	{"Vila Valério", 3205176, &geo_ufs[17]},
+	{"Vila Velha", 3205200, &geo_ufs[17]},
+	{"Vitória", 3205309, &geo_ufs[17]},
+	{"Angra dos Reis", 3300100, &geo_ufs[18]},
+	{"Aperibé", 3300159, &geo_ufs[18]},
+	{"Araruama", 3300209, &geo_ufs[18]},
+	{"Areal", 3300225, &geo_ufs[18]},
+	{"Armação dos Búzios", 3300233, &geo_ufs[18]},
+	{"Arraial do Cabo", 3300258, &geo_ufs[18]},
+	{"Barra do Piraí", 3300308, &geo_ufs[18]},
+	{"Barra Mansa", 3300407, &geo_ufs[18]},
+	{"Belford Roxo", 3300456, &geo_ufs[18]},
+	{"Bom Jardim", 3300506, &geo_ufs[18]},
+	{"Bom Jesus do Itabapoana", 3300605, &geo_ufs[18]},
+	{"Cabo Frio", 3300704, &geo_ufs[18]},
+	{"Cachoeiras de Macacu", 3300803, &geo_ufs[18]},
+	{"Cambuci", 3300902, &geo_ufs[18]},
+	{"Carapebus", 3300936, &geo_ufs[18]},
+	{"Comendador Levy Gasparian", 3300951, &geo_ufs[18]},
+	{"Campos dos Goytacazes", 3301009, &geo_ufs[18]},
+	{"Cantagalo", 3301108, &geo_ufs[18]},
+	{"Cardoso Moreira", 3301157, &geo_ufs[18]},
+	{"Carmo", 3301207, &geo_ufs[18]},
+	{"Casimiro de Abreu", 3301306, &geo_ufs[18]},
+	{"Conceição de Macabu", 3301405, &geo_ufs[18]},
+	{"Cordeiro", 3301504, &geo_ufs[18]},
+	{"Duas Barras", 3301603, &geo_ufs[18]},
+	{"Duque de Caxias", 3301702, &geo_ufs[18]},
+	{"Engenheiro Paulo de Frontin", 3301801, &geo_ufs[18]},
+	{"Guapimirim", 3301850, &geo_ufs[18]},
+	{"Iguaba Grande", 3301876, &geo_ufs[18]},
+	{"Itaboraí", 3301900, &geo_ufs[18]},
+	{"Itaguaí", 3302007, &geo_ufs[18]},
+	{"Italva", 3302056, &geo_ufs[18]},
+	{"Itaocara", 3302106, &geo_ufs[18]},
+	{"Itaperuna", 3302205, &geo_ufs[18]},
+	{"Itatiaia", 3302254, &geo_ufs[18]},
+	{"Japeri", 3302270, &geo_ufs[18]},
+	{"Laje do Muriaé", 3302304, &geo_ufs[18]},
+	{"Macaé", 3302403, &geo_ufs[18]},
+	{"Macuco", 3302452, &geo_ufs[18]},
+	{"Magé", 3302502, &geo_ufs[18]},
+	{"Mangaratiba", 3302601, &geo_ufs[18]},
+	{"Maricá", 3302700, &geo_ufs[18]},
+	{"Mendes", 3302809, &geo_ufs[18]},
+	{"Mesquita", 3302858, &geo_ufs[18]},
+	{"Miguel Pereira", 3302908, &geo_ufs[18]},
+	{"Miracema", 3303005, &geo_ufs[18]},
+	{"Natividade", 3303104, &geo_ufs[18]},
+	{"Nilópolis", 3303203, &geo_ufs[18]},
+	{"Niterói", 3303302, &geo_ufs[18]},
+	{"Nova Friburgo", 3303401, &geo_ufs[18]},
+	{"Nova Iguaçu", 3303500, &geo_ufs[18]},
+	{"Paracambi", 3303609, &geo_ufs[18]},
+	{"Paraíba do Sul", 3303708, &geo_ufs[18]},
+	{"Paraty", 3303807, &geo_ufs[18]},
+	{"Paty do Alferes", 3303856, &geo_ufs[18]},
+	{"Petrópolis", 3303906, &geo_ufs[18]},
+	{"Pinheiral", 3303955, &geo_ufs[18]},
+	{"Piraí", 3304003, &geo_ufs[18]},
+	{"Porciúncula", 3304102, &geo_ufs[18]},
+	{"Porto Real", 3304110, &geo_ufs[18]},
+	{"Quatis", 3304128, &geo_ufs[18]},
+	{"Queimados", 3304144, &geo_ufs[18]},
+	{"Quissamã", 3304151, &geo_ufs[18]},
+	{"Resende", 3304201, &geo_ufs[18]},
+	{"Rio Bonito", 3304300, &geo_ufs[18]},
+	{"Rio Claro", 3304409, &geo_ufs[18]},
+	{"Rio das Flores", 3304508, &geo_ufs[18]},
+	{"Rio das Ostras", 3304524, &geo_ufs[18]},
+	{"Rio de Janeiro", 3304557, &geo_ufs[18]},
+	{"Santa Maria Madalena", 3304607, &geo_ufs[18]},
+	{"Santo Antônio de Pádua", 3304706, &geo_ufs[18]},
+	{"São Francisco de Itabapoana", 3304755, &geo_ufs[18]},
+	{"São Fidélis", 3304805, &geo_ufs[18]},
+	{"São Gonçalo", 3304904, &geo_ufs[18]},
+	{"São João da Barra", 3305000, &geo_ufs[18]},
+	{"São João de Meriti", 3305109, &geo_ufs[18]},
+	{"São José de Ubá", 3305133, &geo_ufs[18]},
+	{"São José do Vale do Rio Preto", 3305158, &geo_ufs[18]},
+	{"São Pedro da Aldeia", 3305208, &geo_ufs[18]},
+	{"São Sebastião do Alto", 3305307, &geo_ufs[18]},
+	{"Sapucaia", 3305406, &geo_ufs[18]},
+	{"Saquarema", 3305505, &geo_ufs[18]},
+	{"Seropédica", 3305554, &geo_ufs[18]},
+	{"Silva Jardim", 3305604, &geo_ufs[18]},
+	{"Sumidouro", 3305703, &geo_ufs[18]},
+	{"Tanguá", 3305752, &geo_ufs[18]},
+	{"Teresópolis", 3305802, &geo_ufs[18]},
+	{"Trajano de Moraes", 3305901, &geo_ufs[18]},
+	{"Três Rios", 3306008, &geo_ufs[18]},
+	{"Valença", 3306107, &geo_ufs[18]},
+	{"Varre-Sai", 3306156, &geo_ufs[18]},
+	{"Vassouras", 3306206, &geo_ufs[18]},
+	{"Volta Redonda", 3306305, &geo_ufs[18]},
+	{"Adamantina", 3500105, &geo_ufs[19]},
+	{"Adolfo", 3500204, &geo_ufs[19]},
+	{"Aguaí", 3500303, &geo_ufs[19]},
+	{"Águas da Prata", 3500402, &geo_ufs[19]},
+	{"Águas de Lindóia", 3500501, &geo_ufs[19]},
+	{"Águas de Santa Bárbara", 3500550, &geo_ufs[19]},
+	{"Águas de São Pedro", 3500600, &geo_ufs[19]},
+	{"Agudos", 3500709, &geo_ufs[19]},
+	{"Alambari", 3500758, &geo_ufs[19]},
+	{"Alfredo Marcondes", 3500808, &geo_ufs[19]},
+	{"Altair", 3500907, &geo_ufs[19]},
+	{"Altinópolis", 3501004, &geo_ufs[19]},
+	{"Alto Alegre", 3501103, &geo_ufs[19]},
+	{"Alumínio", 3501152, &geo_ufs[19]},
+	{"Álvares Florence", 3501202, &geo_ufs[19]},
+	{"Álvares Machado", 3501301, &geo_ufs[19]},
+	{"Álvaro de Carvalho", 3501400, &geo_ufs[19]},
+	{"Alvinlândia", 3501509, &geo_ufs[19]},
+	{"Americana", 3501608, &geo_ufs[19]},
+	{"Américo Brasiliense", 3501707, &geo_ufs[19]},
+	{"Américo de Campos", 3501806, &geo_ufs[19]},
+	{"Amparo", 3501905, &geo_ufs[19]},
+	{"Analândia", 3502002, &geo_ufs[19]},
+	{"Andradina", 3502101, &geo_ufs[19]},
+	{"Angatuba", 3502200, &geo_ufs[19]},
+	{"Anhembi", 3502309, &geo_ufs[19]},
+	{"Anhumas", 3502408, &geo_ufs[19]},
+	{"Aparecida", 3502507, &geo_ufs[19]},
+	{"Aparecida d'Oeste", 3502606, &geo_ufs[19]},
+	{"Apiaí", 3502705, &geo_ufs[19]},
+	{"Araçariguama", 3502754, &geo_ufs[19]},
+	{"Araçatuba", 3502804, &geo_ufs[19]},
+	{"Araçoiaba da Serra", 3502903, &geo_ufs[19]},
+	{"Aramina", 3503000, &geo_ufs[19]},
+	{"Arandu", 3503109, &geo_ufs[19]},
+	{"Arapeí", 3503158, &geo_ufs[19]},
+	{"Araraquara", 3503208, &geo_ufs[19]},
+	{"Araras", 3503307, &geo_ufs[19]},
+	{"Arco-Íris", 3503356, &geo_ufs[19]},
+	{"Arealva", 3503406, &geo_ufs[19]},
+	{"Areias", 3503505, &geo_ufs[19]},
+	{"Areiópolis", 3503604, &geo_ufs[19]},
+	{"Ariranha", 3503703, &geo_ufs[19]},
+	{"Artur Nogueira", 3503802, &geo_ufs[19]},
+	{"Arujá", 3503901, &geo_ufs[19]},
+	{"Aspásia", 3503950, &geo_ufs[19]},
+	{"Assis", 3504008, &geo_ufs[19]},
+	{"Atibaia", 3504107, &geo_ufs[19]},
+	{"Auriflama", 3504206, &geo_ufs[19]},
+	{"Avaí", 3504305, &geo_ufs[19]},
+	{"Avanhandava", 3504404, &geo_ufs[19]},
+	{"Avaré", 3504503, &geo_ufs[19]},
+	{"Bady Bassitt", 3504602, &geo_ufs[19]},
+	{"Balbinos", 3504701, &geo_ufs[19]},
+	{"Bálsamo", 3504800, &geo_ufs[19]},
+	{"Bananal", 3504909, &geo_ufs[19]},
+	{"Barão de Antonina", 3505005, &geo_ufs[19]},
+	{"Barbosa", 3505104, &geo_ufs[19]},
+	{"Bariri", 3505203, &geo_ufs[19]},
+	{"Barra Bonita", 3505302, &geo_ufs[19]},
+	{"Barra do Chapéu", 3505351, &geo_ufs[19]},
+	{"Barra do Turvo", 3505401, &geo_ufs[19]},
+	{"Barretos", 3505500, &geo_ufs[19]},
+	{"Barrinha", 3505609, &geo_ufs[19]},
+	{"Barueri", 3505708, &geo_ufs[19]},
+	{"Bastos", 3505807, &geo_ufs[19]},
+	{"Batatais", 3505906, &geo_ufs[19]},
+	{"Bauru", 3506003, &geo_ufs[19]},
+	{"Bebedouro", 3506102, &geo_ufs[19]},
+	{"Bento de Abreu", 3506201, &geo_ufs[19]},
+	{"Bernardino de Campos", 3506300, &geo_ufs[19]},
+	{"Bertioga", 3506359, &geo_ufs[19]},
+	{"Bilac", 3506409, &geo_ufs[19]},
+	{"Birigui", 3506508, &geo_ufs[19]},
+	{"Biritiba-Mirim", 3506607, &geo_ufs[19]},
+	{"Boa Esperança do Sul", 3506706, &geo_ufs[19]},
+	{"Bocaina", 3506805, &geo_ufs[19]},
+	{"Bofete", 3506904, &geo_ufs[19]},
+	{"Boituva", 3507001, &geo_ufs[19]},
+	{"Bom Jesus dos Perdões", 3507100, &geo_ufs[19]},
+	{"Bom Sucesso de Itararé", 3507159, &geo_ufs[19]},
+	{"Borá", 3507209, &geo_ufs[19]},
+	{"Boracéia", 3507308, &geo_ufs[19]},
+	{"Borborema", 3507407, &geo_ufs[19]},
+	{"Borebi", 3507456, &geo_ufs[19]},
+	{"Botucatu", 3507506, &geo_ufs[19]},
+	{"Bragança Paulista", 3507605, &geo_ufs[19]},
+	{"Braúna", 3507704, &geo_ufs[19]},
+	{"Brejo Alegre", 3507753, &geo_ufs[19]},
+	{"Brodowski", 3507803, &geo_ufs[19]},
+	{"Brotas", 3507902, &geo_ufs[19]},
+	{"Buri", 3508009, &geo_ufs[19]},
+	{"Buritama", 3508108, &geo_ufs[19]},
+	{"Buritizal", 3508207, &geo_ufs[19]},
+	{"Cabrália Paulista", 3508306, &geo_ufs[19]},
+	{"Cabreúva", 3508405, &geo_ufs[19]},
+	{"Caçapava", 3508504, &geo_ufs[19]},
+	{"Cachoeira Paulista", 3508603, &geo_ufs[19]},
+	{"Caconde", 3508702, &geo_ufs[19]},
+	{"Cafelândia", 3508801, &geo_ufs[19]},
+	{"Caiabu", 3508900, &geo_ufs[19]},
+	{"Caieiras", 3509007, &geo_ufs[19]},
+	{"Caiuá", 3509106, &geo_ufs[19]},
+	{"Cajamar", 3509205, &geo_ufs[19]},
+	{"Cajati", 3509254, &geo_ufs[19]},
+	{"Cajobi", 3509304, &geo_ufs[19]},
+	{"Cajuru", 3509403, &geo_ufs[19]},
+	{"Campina do Monte Alegre", 3509452, &geo_ufs[19]},
+	{"Campinas", 3509502, &geo_ufs[19]},
+	{"Campo Limpo Paulista", 3509601, &geo_ufs[19]},
+	{"Campos do Jordão", 3509700, &geo_ufs[19]},
+	{"Campos Novos Paulista", 3509809, &geo_ufs[19]},
+	{"Cananéia", 3509908, &geo_ufs[19]},
+	{"Canas", 3509957, &geo_ufs[19]},
+	{"Cândido Mota", 3510005, &geo_ufs[19]},
+	{"Cândido Rodrigues", 3510104, &geo_ufs[19]},
+	{"Canitar", 3510153, &geo_ufs[19]},
+	{"Capão Bonito", 3510203, &geo_ufs[19]},
+	{"Capela do Alto", 3510302, &geo_ufs[19]},
+	{"Capivari", 3510401, &geo_ufs[19]},
+	{"Caraguatatuba", 3510500, &geo_ufs[19]},
+	{"Carapicuíba", 3510609, &geo_ufs[19]},
+	{"Cardoso", 3510708, &geo_ufs[19]},
+	{"Casa Branca", 3510807, &geo_ufs[19]},
+	{"Cássia dos Coqueiros", 3510906, &geo_ufs[19]},
+	{"Castilho", 3511003, &geo_ufs[19]},
+	{"Catanduva", 3511102, &geo_ufs[19]},
+	{"Catiguá", 3511201, &geo_ufs[19]},
+	{"Cedral", 3511300, &geo_ufs[19]},
+	{"Cerqueira César", 3511409, &geo_ufs[19]},
+	{"Cerquilho", 3511508, &geo_ufs[19]},
+	{"Cesário Lange", 3511607, &geo_ufs[19]},
+	{"Charqueada", 3511706, &geo_ufs[19]},
+	{"Clementina", 3511904, &geo_ufs[19]},
+	{"Colina", 3512001, &geo_ufs[19]},
+	{"Colômbia", 3512100, &geo_ufs[19]},
+	{"Conchal", 3512209, &geo_ufs[19]},
+	{"Conchas", 3512308, &geo_ufs[19]},
+	{"Cordeirópolis", 3512407, &geo_ufs[19]},
+	{"Coroados", 3512506, &geo_ufs[19]},
+	{"Coronel Macedo", 3512605, &geo_ufs[19]},
+	{"Corumbataí", 3512704, &geo_ufs[19]},
+	{"Cosmópolis", 3512803, &geo_ufs[19]},
+	{"Cosmorama", 3512902, &geo_ufs[19]},
+	{"Cotia", 3513009, &geo_ufs[19]},
+	{"Cravinhos", 3513108, &geo_ufs[19]},
+	{"Cristais Paulista", 3513207, &geo_ufs[19]},
+	{"Cruzália", 3513306, &geo_ufs[19]},
+	{"Cruzeiro", 3513405, &geo_ufs[19]},
+	{"Cubatão", 3513504, &geo_ufs[19]},
+	{"Cunha", 3513603, &geo_ufs[19]},
+	{"Descalvado", 3513702, &geo_ufs[19]},
+	{"Diadema", 3513801, &geo_ufs[19]},
+	{"Dirce Reis", 3513850, &geo_ufs[19]},
+	{"Divinolândia", 3513900, &geo_ufs[19]},
+	{"Dobrada", 3514007, &geo_ufs[19]},
+	{"Dois Córregos", 3514106, &geo_ufs[19]},
+	{"Dolcinópolis", 3514205, &geo_ufs[19]},
+	{"Dourado", 3514304, &geo_ufs[19]},
+	{"Dracena", 3514403, &geo_ufs[19]},
+	{"Duartina", 3514502, &geo_ufs[19]},
+	{"Dumont", 3514601, &geo_ufs[19]},
+	{"Echaporã", 3514700, &geo_ufs[19]},
+	{"Eldorado", 3514809, &geo_ufs[19]},
+	{"Elias Fausto", 3514908, &geo_ufs[19]},
+	{"Elisiário", 3514924, &geo_ufs[19]},
+	{"Embaúba", 3514957, &geo_ufs[19]},
+	{"Embu", 3515004, &geo_ufs[19]},
+	{"Embu-Guaçu", 3515103, &geo_ufs[19]},
+	{"Emilianópolis", 3515129, &geo_ufs[19]},
+	{"Engenheiro Coelho", 3515152, &geo_ufs[19]},
+	{"Espírito Santo do Pinhal", 3515186, &geo_ufs[19]},
+	{"Espírito Santo do Turvo", 3515194, &geo_ufs[19]},
+	{"Estrela d'Oeste", 3515202, &geo_ufs[19]},
+	{"Estrela do Norte", 3515301, &geo_ufs[19]},
+	{"Euclides da Cunha Paulista", 3515350, &geo_ufs[19]},
+	{"Fartura", 3515400, &geo_ufs[19]},
+	{"Fernandópolis", 3515509, &geo_ufs[19]},
+	{"Fernando Prestes", 3515608, &geo_ufs[19]},
+	{"Fernão", 3515657, &geo_ufs[19]},
+	{"Ferraz de Vasconcelos", 3515707, &geo_ufs[19]},
+	{"Flora Rica", 3515806, &geo_ufs[19]},
+	{"Floreal", 3515905, &geo_ufs[19]},
+	{"Flórida Paulista", 3516002, &geo_ufs[19]},
+	{"Florínia", 3516101, &geo_ufs[19]},
+	{"Franca", 3516200, &geo_ufs[19]},
+	{"Francisco Morato", 3516309, &geo_ufs[19]},
+	{"Franco da Rocha", 3516408, &geo_ufs[19]},
+	{"Gabriel Monteiro", 3516507, &geo_ufs[19]},
+	{"Gália", 3516606, &geo_ufs[19]},
+	{"Garça", 3516705, &geo_ufs[19]},
+	{"Gastão Vidigal", 3516804, &geo_ufs[19]},
+	{"Gavião Peixoto", 3516853, &geo_ufs[19]},
+	{"General Salgado", 3516903, &geo_ufs[19]},
+	{"Getulina", 3517000, &geo_ufs[19]},
+	{"Glicério", 3517109, &geo_ufs[19]},
+	{"Guaiçara", 3517208, &geo_ufs[19]},
+	{"Guaimbê", 3517307, &geo_ufs[19]},
+	{"Guaíra", 3517406, &geo_ufs[19]},
+	{"Guapiaçu", 3517505, &geo_ufs[19]},
+	{"Guapiara", 3517604, &geo_ufs[19]},
+	{"Guará", 3517703, &geo_ufs[19]},
+	{"Guaraçaí", 3517802, &geo_ufs[19]},
+	{"Guaraci", 3517901, &geo_ufs[19]},
+	{"Guarani d'Oeste", 3518008, &geo_ufs[19]},
+	{"Guarantã", 3518107, &geo_ufs[19]},
+	{"Guararapes", 3518206, &geo_ufs[19]},
+	{"Guararema", 3518305, &geo_ufs[19]},
+	{"Guaratinguetá", 3518404, &geo_ufs[19]},
+	{"Guareí", 3518503, &geo_ufs[19]},
+	{"Guariba", 3518602, &geo_ufs[19]},
+	{"Guarujá", 3518701, &geo_ufs[19]},
+	{"Guarulhos", 3518800, &geo_ufs[19]},
+	{"Guatapará", 3518859, &geo_ufs[19]},
+	{"Guzolândia", 3518909, &geo_ufs[19]},
+	{"Herculândia", 3519006, &geo_ufs[19]},
+	{"Holambra", 3519055, &geo_ufs[19]},
+	{"Hortolândia", 3519071, &geo_ufs[19]},
+	{"Iacanga", 3519105, &geo_ufs[19]},
+	{"Iacri", 3519204, &geo_ufs[19]},
+	{"Iaras", 3519253, &geo_ufs[19]},
+	{"Ibaté", 3519303, &geo_ufs[19]},
+	{"Ibirá", 3519402, &geo_ufs[19]},
+	{"Ibirarema", 3519501, &geo_ufs[19]},
+	{"Ibitinga", 3519600, &geo_ufs[19]},
+	{"Ibiúna", 3519709, &geo_ufs[19]},
+	{"Icém", 3519808, &geo_ufs[19]},
+	{"Iepê", 3519907, &geo_ufs[19]},
+	{"Igaraçu do Tietê", 3520004, &geo_ufs[19]},
+	{"Igarapava", 3520103, &geo_ufs[19]},
+	{"Igaratá", 3520202, &geo_ufs[19]},
+	{"Iguape", 3520301, &geo_ufs[19]},
+	{"Ilhabela", 3520400, &geo_ufs[19]},
+	{"Ilha Comprida", 3520426, &geo_ufs[19]},
+	{"Ilha Solteira", 3520442, &geo_ufs[19]},
+	{"Indaiatuba", 3520509, &geo_ufs[19]},
+	{"Indiana", 3520608, &geo_ufs[19]},
+	{"Indiaporã", 3520707, &geo_ufs[19]},
+	{"Inúbia Paulista", 3520806, &geo_ufs[19]},
+	{"Ipaussu", 3520905, &geo_ufs[19]},
+	{"Iperó", 3521002, &geo_ufs[19]},
+	{"Ipeúna", 3521101, &geo_ufs[19]},
+	{"Ipiguá", 3521150, &geo_ufs[19]},
+	{"Iporanga", 3521200, &geo_ufs[19]},
+	{"Ipuã", 3521309, &geo_ufs[19]},
+	{"Iracemápolis", 3521408, &geo_ufs[19]},
+	{"Irapuã", 3521507, &geo_ufs[19]},
+	{"Irapuru", 3521606, &geo_ufs[19]},
+	{"Itaberá", 3521705, &geo_ufs[19]},
+	{"Itaí", 3521804, &geo_ufs[19]},
+	{"Itajobi", 3521903, &geo_ufs[19]},
+	{"Itaju", 3522000, &geo_ufs[19]},
+	{"Itanhaém", 3522109, &geo_ufs[19]},
+	{"Itaóca", 3522158, &geo_ufs[19]},
+	{"Itapecerica da Serra", 3522208, &geo_ufs[19]},
+	{"Itapetininga", 3522307, &geo_ufs[19]},
+	{"Itapeva", 3522406, &geo_ufs[19]},
+	{"Itapevi", 3522505, &geo_ufs[19]},
+	{"Itapira", 3522604, &geo_ufs[19]},
+	{"Itapirapuã Paulista", 3522653, &geo_ufs[19]},
+	{"Itápolis", 3522703, &geo_ufs[19]},
+	{"Itaporanga", 3522802, &geo_ufs[19]},
+	{"Itapuí", 3522901, &geo_ufs[19]},
+	{"Itapura", 3523008, &geo_ufs[19]},
+	{"Itaquaquecetuba", 3523107, &geo_ufs[19]},
+	{"Itararé", 3523206, &geo_ufs[19]},
+	{"Itariri", 3523305, &geo_ufs[19]},
+	{"Itatiba", 3523404, &geo_ufs[19]},
+	{"Itatinga", 3523503, &geo_ufs[19]},
+	{"Itirapina", 3523602, &geo_ufs[19]},
+	{"Itirapuã", 3523701, &geo_ufs[19]},
+	{"Itobi", 3523800, &geo_ufs[19]},
+	{"Itu", 3523909, &geo_ufs[19]},
+	{"Itupeva", 3524006, &geo_ufs[19]},
+	{"Ituverava", 3524105, &geo_ufs[19]},
+	{"Jaborandi", 3524204, &geo_ufs[19]},
+	{"Jaboticabal", 3524303, &geo_ufs[19]},
+	{"Jacareí", 3524402, &geo_ufs[19]},
+	{"Jaci", 3524501, &geo_ufs[19]},
+	{"Jacupiranga", 3524600, &geo_ufs[19]},
+	{"Jaguariúna", 3524709, &geo_ufs[19]},
+	{"Jales", 3524808, &geo_ufs[19]},
+	{"Jambeiro", 3524907, &geo_ufs[19]},
+	{"Jandira", 3525003, &geo_ufs[19]},
+	{"Jardinópolis", 3525102, &geo_ufs[19]},
+	{"Jarinu", 3525201, &geo_ufs[19]},
+	{"Jaú", 3525300, &geo_ufs[19]},
+	{"Jeriquara", 3525409, &geo_ufs[19]},
+	{"Joanópolis", 3525508, &geo_ufs[19]},
+	{"João Ramalho", 3525607, &geo_ufs[19]},
+	{"José Bonifácio", 3525706, &geo_ufs[19]},
+	{"Júlio Mesquita", 3525805, &geo_ufs[19]},
+	{"Jumirim", 3525854, &geo_ufs[19]},
+	{"Jundiaí", 3525904, &geo_ufs[19]},
+	{"Junqueirópolis", 3526001, &geo_ufs[19]},
+	{"Juquiá", 3526100, &geo_ufs[19]},
+	{"Juquitiba", 3526209, &geo_ufs[19]},
+	{"Lagoinha", 3526308, &geo_ufs[19]},
+	{"Laranjal Paulista", 3526407, &geo_ufs[19]},
+	{"Lavínia", 3526506, &geo_ufs[19]},
+	{"Lavrinhas", 3526605, &geo_ufs[19]},
+	{"Leme", 3526704, &geo_ufs[19]},
+	{"Lençóis Paulista", 3526803, &geo_ufs[19]},
+	{"Limeira", 3526902, &geo_ufs[19]},
+	{"Lindóia", 3527009, &geo_ufs[19]},
+	{"Lins", 3527108, &geo_ufs[19]},
+	{"Lorena", 3527207, &geo_ufs[19]},
+	{"Lourdes", 3527256, &geo_ufs[19]},
+	{"Louveira", 3527306, &geo_ufs[19]},
+	{"Lucélia", 3527405, &geo_ufs[19]},
+	{"Lucianópolis", 3527504, &geo_ufs[19]},
+	{"Luís Antônio", 3527603, &geo_ufs[19]},
+	{"Luiziânia", 3527702, &geo_ufs[19]},
+	{"Lupércio", 3527801, &geo_ufs[19]},
+	{"Lutécia", 3527900, &geo_ufs[19]},
+	{"Macatuba", 3528007, &geo_ufs[19]},
+	{"Macaubal", 3528106, &geo_ufs[19]},
+	{"Macedônia", 3528205, &geo_ufs[19]},
+	{"Magda", 3528304, &geo_ufs[19]},
+	{"Mairinque", 3528403, &geo_ufs[19]},
+	{"Mairiporã", 3528502, &geo_ufs[19]},
+	{"Manduri", 3528601, &geo_ufs[19]},
+	{"Marabá Paulista", 3528700, &geo_ufs[19]},
+	{"Maracaí", 3528809, &geo_ufs[19]},
+	{"Marapoama", 3528858, &geo_ufs[19]},
+	{"Mariápolis", 3528908, &geo_ufs[19]},
+	{"Marília", 3529005, &geo_ufs[19]},
+	{"Marinópolis", 3529104, &geo_ufs[19]},
+	{"Martinópolis", 3529203, &geo_ufs[19]},
+	{"Matão", 3529302, &geo_ufs[19]},
+	{"Mauá", 3529401, &geo_ufs[19]},
+	{"Mendonça", 3529500, &geo_ufs[19]},
+	{"Meridiano", 3529609, &geo_ufs[19]},
+	{"Mesópolis", 3529658, &geo_ufs[19]},
+	{"Miguelópolis", 3529708, &geo_ufs[19]},
+	{"Mineiros do Tietê", 3529807, &geo_ufs[19]},
+	{"Miracatu", 3529906, &geo_ufs[19]},
+	{"Mira Estrela", 3530003, &geo_ufs[19]},
+	{"Mirandópolis", 3530102, &geo_ufs[19]},
+	{"Mirante do Paranapanema", 3530201, &geo_ufs[19]},
+	{"Mirassol", 3530300, &geo_ufs[19]},
+	{"Mirassolândia", 3530409, &geo_ufs[19]},
+	{"Mococa", 3530508, &geo_ufs[19]},
+	{"Mogi das Cruzes", 3530607, &geo_ufs[19]},
+	{"Mogi Guaçu", 3530706, &geo_ufs[19]},
+	{"Moji Mirim", 3530805, &geo_ufs[19]},
+	{"Mombuca", 3530904, &geo_ufs[19]},
+	{"Monções", 3531001, &geo_ufs[19]},
+	{"Mongaguá", 3531100, &geo_ufs[19]},
+	{"Monte Alegre do Sul", 3531209, &geo_ufs[19]},
+	{"Monte Alto", 3531308, &geo_ufs[19]},
+	{"Monte Aprazível", 3531407, &geo_ufs[19]},
+	{"Monte Azul Paulista", 3531506, &geo_ufs[19]},
+	{"Monte Castelo", 3531605, &geo_ufs[19]},
+	{"Monteiro Lobato", 3531704, &geo_ufs[19]},
+	{"Monte Mor", 3531803, &geo_ufs[19]},
+	{"Morro Agudo", 3531902, &geo_ufs[19]},
+	{"Morungaba", 3532009, &geo_ufs[19]},
+	{"Motuca", 3532058, &geo_ufs[19]},
+	{"Murutinga do Sul", 3532108, &geo_ufs[19]},
+	{"Nantes", 3532157, &geo_ufs[19]},
+	{"Narandiba", 3532207, &geo_ufs[19]},
+	{"Natividade da Serra", 3532306, &geo_ufs[19]},
+	{"Nazaré Paulista", 3532405, &geo_ufs[19]},
+	{"Neves Paulista", 3532504, &geo_ufs[19]},
+	{"Nhandeara", 3532603, &geo_ufs[19]},
+	{"Nipoã", 3532702, &geo_ufs[19]},
+	{"Nova Aliança", 3532801, &geo_ufs[19]},
+	{"Nova Campina", 3532827, &geo_ufs[19]},
+	{"Nova Canaã Paulista", 3532843, &geo_ufs[19]},
+	{"Nova Castilho", 3532868, &geo_ufs[19]},
+	{"Nova Europa", 3532900, &geo_ufs[19]},
+	{"Nova Granada", 3533007, &geo_ufs[19]},
+	{"Nova Guataporanga", 3533106, &geo_ufs[19]},
+	{"Nova Independência", 3533205, &geo_ufs[19]},
+	{"Novais", 3533254, &geo_ufs[19]},
+	{"Nova Luzitânia", 3533304, &geo_ufs[19]},
+	{"Nova Odessa", 3533403, &geo_ufs[19]},
+	{"Novo Horizonte", 3533502, &geo_ufs[19]},
+	{"Nuporanga", 3533601, &geo_ufs[19]},
+	{"Ocauçu", 3533700, &geo_ufs[19]},
+	{"Óleo", 3533809, &geo_ufs[19]},
+	{"Olímpia", 3533908, &geo_ufs[19]},
+	{"Onda Verde", 3534005, &geo_ufs[19]},
+	{"Oriente", 3534104, &geo_ufs[19]},
+	{"Orindiúva", 3534203, &geo_ufs[19]},
+	{"Orlândia", 3534302, &geo_ufs[19]},
+	{"Osasco", 3534401, &geo_ufs[19]},
+	{"Oscar Bressane", 3534500, &geo_ufs[19]},
+	{"Osvaldo Cruz", 3534609, &geo_ufs[19]},
+	{"Ourinhos", 3534708, &geo_ufs[19]},
+	{"Ouroeste", 3534757, &geo_ufs[19]},
+	{"Ouro Verde", 3534807, &geo_ufs[19]},
+	{"Pacaembu", 3534906, &geo_ufs[19]},
+	{"Palestina", 3535002, &geo_ufs[19]},
+	{"Palmares Paulista", 3535101, &geo_ufs[19]},
+	{"Palmeira d'Oeste", 3535200, &geo_ufs[19]},
+	{"Palmital", 3535309, &geo_ufs[19]},
+	{"Panorama", 3535408, &geo_ufs[19]},
+	{"Paraguaçu Paulista", 3535507, &geo_ufs[19]},
+	{"Paraibuna", 3535606, &geo_ufs[19]},
+	{"Paraíso", 3535705, &geo_ufs[19]},
+	{"Paranapanema", 3535804, &geo_ufs[19]},
+	{"Paranapuã", 3535903, &geo_ufs[19]},
+	{"Parapuã", 3536000, &geo_ufs[19]},
+	{"Pardinho", 3536109, &geo_ufs[19]},
+	{"Pariquera-Açu", 3536208, &geo_ufs[19]},
+	{"Parisi", 3536257, &geo_ufs[19]},
+	{"Patrocínio Paulista", 3536307, &geo_ufs[19]},
+	{"Paulicéia", 3536406, &geo_ufs[19]},
+	{"Paulínia", 3536505, &geo_ufs[19]},
+	{"Paulistânia", 3536570, &geo_ufs[19]},
+	{"Paulo de Faria", 3536604, &geo_ufs[19]},
+	{"Pederneiras", 3536703, &geo_ufs[19]},
+	{"Pedra Bela", 3536802, &geo_ufs[19]},
+	{"Pedranópolis", 3536901, &geo_ufs[19]},
+	{"Pedregulho", 3537008, &geo_ufs[19]},
+	{"Pedreira", 3537107, &geo_ufs[19]},
+	{"Pedrinhas Paulista", 3537156, &geo_ufs[19]},
+	{"Pedro de Toledo", 3537206, &geo_ufs[19]},
+	{"Penápolis", 3537305, &geo_ufs[19]},
+	{"Pereira Barreto", 3537404, &geo_ufs[19]},
+	{"Pereiras", 3537503, &geo_ufs[19]},
+	{"Peruíbe", 3537602, &geo_ufs[19]},
+	{"Piacatu", 3537701, &geo_ufs[19]},
+	{"Piedade", 3537800, &geo_ufs[19]},
+	{"Pilar do Sul", 3537909, &geo_ufs[19]},
+	{"Pindamonhangaba", 3538006, &geo_ufs[19]},
+	{"Pindorama", 3538105, &geo_ufs[19]},
+	{"Pinhalzinho", 3538204, &geo_ufs[19]},
+	{"Piquerobi", 3538303, &geo_ufs[19]},
+	{"Piquete", 3538501, &geo_ufs[19]},
+	{"Piracaia", 3538600, &geo_ufs[19]},
+	{"Piracicaba", 3538709, &geo_ufs[19]},
+	{"Piraju", 3538808, &geo_ufs[19]},
+	{"Pirajuí", 3538907, &geo_ufs[19]},
+	{"Pirangi", 3539004, &geo_ufs[19]},
+	{"Pirapora do Bom Jesus", 3539103, &geo_ufs[19]},
+	{"Pirapozinho", 3539202, &geo_ufs[19]},
+	{"Pirassununga", 3539301, &geo_ufs[19]},
+	{"Piratininga", 3539400, &geo_ufs[19]},
+	{"Pitangueiras", 3539509, &geo_ufs[19]},
+	{"Planalto", 3539608, &geo_ufs[19]},
+	{"Platina", 3539707, &geo_ufs[19]},
+	{"Poá", 3539806, &geo_ufs[19]},
+	{"Poloni", 3539905, &geo_ufs[19]},
+	{"Pompéia", 3540002, &geo_ufs[19]},
+	{"Pongaí", 3540101, &geo_ufs[19]},
+	{"Pontal", 3540200, &geo_ufs[19]},
+	{"Pontalinda", 3540259, &geo_ufs[19]},
+	{"Pontes Gestal", 3540309, &geo_ufs[19]},
+	{"Populina", 3540408, &geo_ufs[19]},
+	{"Porangaba", 3540507, &geo_ufs[19]},
+	{"Porto Feliz", 3540606, &geo_ufs[19]},
+	{"Porto Ferreira", 3540705, &geo_ufs[19]},
+	{"Potim", 3540754, &geo_ufs[19]},
+	{"Potirendaba", 3540804, &geo_ufs[19]},
+	{"Pracinha", 3540853, &geo_ufs[19]},
+	{"Pradópolis", 3540903, &geo_ufs[19]},
+	{"Praia Grande", 3541000, &geo_ufs[19]},
+	{"Pratânia", 3541059, &geo_ufs[19]},
+	{"Presidente Alves", 3541109, &geo_ufs[19]},
+	{"Presidente Bernardes", 3541208, &geo_ufs[19]},
+	{"Presidente Epitácio", 3541307, &geo_ufs[19]},
+	{"Presidente Prudente", 3541406, &geo_ufs[19]},
+	{"Presidente Venceslau", 3541505, &geo_ufs[19]},
+	{"Promissão", 3541604, &geo_ufs[19]},
+	{"Quadra", 3541653, &geo_ufs[19]},
+	{"Quatá", 3541703, &geo_ufs[19]},
+	{"Queiroz", 3541802, &geo_ufs[19]},
+	{"Queluz", 3541901, &geo_ufs[19]},
+	{"Quintana", 3542008, &geo_ufs[19]},
+	{"Rafard", 3542107, &geo_ufs[19]},
+	{"Rancharia", 3542206, &geo_ufs[19]},
+	{"Redenção da Serra", 3542305, &geo_ufs[19]},
+	{"Regente Feijó", 3542404, &geo_ufs[19]},
+	{"Reginópolis", 3542503, &geo_ufs[19]},
+	{"Registro", 3542602, &geo_ufs[19]},
+	{"Restinga", 3542701, &geo_ufs[19]},
+	{"Ribeira", 3542800, &geo_ufs[19]},
+	{"Ribeirão Bonito", 3542909, &geo_ufs[19]},
+	{"Ribeirão Branco", 3543006, &geo_ufs[19]},
+	{"Ribeirão Corrente", 3543105, &geo_ufs[19]},
+	{"Ribeirão do Sul", 3543204, &geo_ufs[19]},
+	{"Ribeirão dos Índios", 3543238, &geo_ufs[19]},
+	{"Ribeirão Grande", 3543253, &geo_ufs[19]},
+	{"Ribeirão Pires", 3543303, &geo_ufs[19]},
+	{"Ribeirão Preto", 3543402, &geo_ufs[19]},
+	{"Riversul", 3543501, &geo_ufs[19]},
+	{"Rifaina", 3543600, &geo_ufs[19]},
+	{"Rincão", 3543709, &geo_ufs[19]},
+	{"Rinópolis", 3543808, &geo_ufs[19]},
+	{"Rio Claro", 3543907, &geo_ufs[19]},
+	{"Rio das Pedras", 3544004, &geo_ufs[19]},
+	{"Rio Grande da Serra", 3544103, &geo_ufs[19]},
+	{"Riolândia", 3544202, &geo_ufs[19]},
+	{"Rosana", 3544251, &geo_ufs[19]},
+	{"Roseira", 3544301, &geo_ufs[19]},
+	{"Rubiácea", 3544400, &geo_ufs[19]},
+	{"Rubinéia", 3544509, &geo_ufs[19]},
+	{"Sabino", 3544608, &geo_ufs[19]},
+	{"Sagres", 3544707, &geo_ufs[19]},
+	{"Sales", 3544806, &geo_ufs[19]},
+	{"Sales Oliveira", 3544905, &geo_ufs[19]},
+	{"Salesópolis", 3545001, &geo_ufs[19]},
+	{"Salmourão", 3545100, &geo_ufs[19]},
+	{"Saltinho", 3545159, &geo_ufs[19]},
+	{"Salto", 3545209, &geo_ufs[19]},
+	{"Salto de Pirapora", 3545308, &geo_ufs[19]},
+	{"Salto Grande", 3545407, &geo_ufs[19]},
+	{"Sandovalina", 3545506, &geo_ufs[19]},
+	{"Santa Adélia", 3545605, &geo_ufs[19]},
+	{"Santa Albertina", 3545704, &geo_ufs[19]},
+	{"Santa Bárbara d'Oeste", 3545803, &geo_ufs[19]},
+	{"Santa Branca", 3546009, &geo_ufs[19]},
+	{"Santa Clara d'Oeste", 3546108, &geo_ufs[19]},
+	{"Santa Cruz da Conceição", 3546207, &geo_ufs[19]},
+	{"Santa Cruz da Esperança", 3546256, &geo_ufs[19]},
+	{"Santa Cruz das Palmeiras", 3546306, &geo_ufs[19]},
+	{"Santa Cruz do Rio Pardo", 3546405, &geo_ufs[19]},
+	{"Santa Ernestina", 3546504, &geo_ufs[19]},
+	{"Santa Fé do Sul", 3546603, &geo_ufs[19]},
+	{"Santa Gertrudes", 3546702, &geo_ufs[19]},
+	{"Santa Isabel", 3546801, &geo_ufs[19]},
+	{"Santa Lúcia", 3546900, &geo_ufs[19]},
+	{"Santa Maria da Serra", 3547007, &geo_ufs[19]},
+	{"Santa Mercedes", 3547106, &geo_ufs[19]},
+	{"Santana da Ponte Pensa", 3547205, &geo_ufs[19]},
+	{"Santana de Parnaíba", 3547304, &geo_ufs[19]},
+	{"Santa Rita d'Oeste", 3547403, &geo_ufs[19]},
+	{"Santa Rita do Passa Quatro", 3547502, &geo_ufs[19]},
+	{"Santa Rosa de Viterbo", 3547601, &geo_ufs[19]},
+	{"Santa Salete", 3547650, &geo_ufs[19]},
+	{"Santo Anastácio", 3547700, &geo_ufs[19]},
+	{"Santo André", 3547809, &geo_ufs[19]},
+	{"Santo Antônio da Alegria", 3547908, &geo_ufs[19]},
+	{"Santo Antônio de Posse", 3548005, &geo_ufs[19]},
+	{"Santo Antônio do Aracanguá", 3548054, &geo_ufs[19]},
+	{"Santo Antônio do Jardim", 3548104, &geo_ufs[19]},
+	{"Santo Antônio do Pinhal", 3548203, &geo_ufs[19]},
+	{"Santo Expedito", 3548302, &geo_ufs[19]},
+	{"Santópolis do Aguapeí", 3548401, &geo_ufs[19]},
+	{"Santos", 3548500, &geo_ufs[19]},
+	{"São Bento do Sapucaí", 3548609, &geo_ufs[19]},
+	{"São Bernardo do Campo", 3548708, &geo_ufs[19]},
+	{"São Caetano do Sul", 3548807, &geo_ufs[19]},
+	{"São Carlos", 3548906, &geo_ufs[19]},
+	{"São Francisco", 3549003, &geo_ufs[19]},
+	{"São João da Boa Vista", 3549102, &geo_ufs[19]},
+	{"São João das Duas Pontes", 3549201, &geo_ufs[19]},
+	{"São João de Iracema", 3549250, &geo_ufs[19]},
+	{"São João do Pau d'Alho", 3549300, &geo_ufs[19]},
+	{"São Joaquim da Barra", 3549409, &geo_ufs[19]},
+	{"São José da Bela Vista", 3549508, &geo_ufs[19]},
+	{"São José do Barreiro", 3549607, &geo_ufs[19]},
+	{"São José do Rio Pardo", 3549706, &geo_ufs[19]},
+	{"São José do Rio Preto", 3549805, &geo_ufs[19]},
+	{"São José dos Campos", 3549904, &geo_ufs[19]},
+	{"São Lourenço da Serra", 3549953, &geo_ufs[19]},
+	{"São Luís do Paraitinga", 3550001, &geo_ufs[19]},
+	{"São Manuel", 3550100, &geo_ufs[19]},
+	{"São Miguel Arcanjo", 3550209, &geo_ufs[19]},
+	{"São Paulo", 3550308, &geo_ufs[19]},
+	{"São Pedro", 3550407, &geo_ufs[19]},
+	{"São Pedro do Turvo", 3550506, &geo_ufs[19]},
+	{"São Roque", 3550605, &geo_ufs[19]},
+	{"São Sebastião", 3550704, &geo_ufs[19]},
+	{"São Sebastião da Grama", 3550803, &geo_ufs[19]},
+	{"São Simão", 3550902, &geo_ufs[19]},
+	{"São Vicente", 3551009, &geo_ufs[19]},
+	{"Sarapuí", 3551108, &geo_ufs[19]},
+	{"Sarutaiá", 3551207, &geo_ufs[19]},
+	{"Sebastianópolis do Sul", 3551306, &geo_ufs[19]},
+	{"Serra Azul", 3551405, &geo_ufs[19]},
+	{"Serrana", 3551504, &geo_ufs[19]},
+	{"Serra Negra", 3551603, &geo_ufs[19]},
+	{"Sertãozinho", 3551702, &geo_ufs[19]},
+	{"Sete Barras", 3551801, &geo_ufs[19]},
+	{"Severínia", 3551900, &geo_ufs[19]},
+	{"Silveiras", 3552007, &geo_ufs[19]},
+	{"Socorro", 3552106, &geo_ufs[19]},
+	{"Sorocaba", 3552205, &geo_ufs[19]},
+	{"Sud Mennucci", 3552304, &geo_ufs[19]},
+	{"Sumaré", 3552403, &geo_ufs[19]},
+	{"Suzano", 3552502, &geo_ufs[19]},
+	{"Suzanápolis", 3552551, &geo_ufs[19]},
+	{"Tabapuã", 3552601, &geo_ufs[19]},
+	{"Tabatinga", 3552700, &geo_ufs[19]},
+	{"Taboão da Serra", 3552809, &geo_ufs[19]},
+	{"Taciba", 3552908, &geo_ufs[19]},
+	{"Taguaí", 3553005, &geo_ufs[19]},
+	{"Taiaçu", 3553104, &geo_ufs[19]},
+	{"Taiúva", 3553203, &geo_ufs[19]},
+	{"Tambaú", 3553302, &geo_ufs[19]},
+	{"Tanabi", 3553401, &geo_ufs[19]},
+	{"Tapiraí", 3553500, &geo_ufs[19]},
+	{"Tapiratiba", 3553609, &geo_ufs[19]},
+	{"Taquaral", 3553658, &geo_ufs[19]},
+	{"Taquaritinga", 3553708, &geo_ufs[19]},
+	{"Taquarituba", 3553807, &geo_ufs[19]},
+	{"Taquarivaí", 3553856, &geo_ufs[19]},
+	{"Tarabai", 3553906, &geo_ufs[19]},
+	{"Tarumã", 3553955, &geo_ufs[19]},
+	{"Tatuí", 3554003, &geo_ufs[19]},
+	{"Taubaté", 3554102, &geo_ufs[19]},
+	{"Tejupá", 3554201, &geo_ufs[19]},
+	{"Teodoro Sampaio", 3554300, &geo_ufs[19]},
+	{"Terra Roxa", 3554409, &geo_ufs[19]},
+	{"Tietê", 3554508, &geo_ufs[19]},
+	{"Timburi", 3554607, &geo_ufs[19]},
+	{"Torre de Pedra", 3554656, &geo_ufs[19]},
+	{"Torrinha", 3554706, &geo_ufs[19]},
+	{"Trabiju", 3554755, &geo_ufs[19]},
+	{"Tremembé", 3554805, &geo_ufs[19]},
+	{"Três Fronteiras", 3554904, &geo_ufs[19]},
+	{"Tuiuti", 3554953, &geo_ufs[19]},
+	{"Tupã", 3555000, &geo_ufs[19]},
+	{"Tupi Paulista", 3555109, &geo_ufs[19]},
+	{"Turiúba", 3555208, &geo_ufs[19]},
+	{"Turmalina", 3555307, &geo_ufs[19]},
+	{"Ubarana", 3555356, &geo_ufs[19]},
+	{"Ubatuba", 3555406, &geo_ufs[19]},
+	{"Ubirajara", 3555505, &geo_ufs[19]},
+	{"Uchoa", 3555604, &geo_ufs[19]},
+	{"União Paulista", 3555703, &geo_ufs[19]},
+	{"Urânia", 3555802, &geo_ufs[19]},
+	{"Uru", 3555901, &geo_ufs[19]},
+	{"Urupês", 3556008, &geo_ufs[19]},
+	{"Valentim Gentil", 3556107, &geo_ufs[19]},
+	{"Valinhos", 3556206, &geo_ufs[19]},
+	{"Valparaíso", 3556305, &geo_ufs[19]},
+	{"Vargem", 3556354, &geo_ufs[19]},
+	{"Vargem Grande do Sul", 3556404, &geo_ufs[19]},
+	{"Vargem Grande Paulista", 3556453, &geo_ufs[19]},
+	{"Várzea Paulista", 3556503, &geo_ufs[19]},
+	{"Vera Cruz", 3556602, &geo_ufs[19]},
+	{"Vinhedo", 3556701, &geo_ufs[19]},
+	{"Viradouro", 3556800, &geo_ufs[19]},
+	{"Vista Alegre do Alto", 3556909, &geo_ufs[19]},
+	{"Vitória Brasil", 3556958, &geo_ufs[19]},
+	{"Votorantim", 3557006, &geo_ufs[19]},
+	{"Votuporanga", 3557105, &geo_ufs[19]},
+	{"Zacarias", 3557154, &geo_ufs[19]},
+	{"Chavantes", 3557204, &geo_ufs[19]},
+	{"Estiva Gerbi", 3557303, &geo_ufs[19]},
+	{"Abatiá", 4100103, &geo_ufs[20]},
+	{"Adrianópolis", 4100202, &geo_ufs[20]},
+	{"Agudos do Sul", 4100301, &geo_ufs[20]},
+	{"Almirante Tamandaré", 4100400, &geo_ufs[20]},
+	{"Altamira do Paraná", 4100459, &geo_ufs[20]},
+	{"Altônia", 4100509, &geo_ufs[20]},
+	{"Alto Paraná", 4100608, &geo_ufs[20]},
+	{"Alto Piquiri", 4100707, &geo_ufs[20]},
+	{"Alvorada do Sul", 4100806, &geo_ufs[20]},
+	{"Amaporã", 4100905, &geo_ufs[20]},
+	{"Ampére", 4101002, &geo_ufs[20]},
+	{"Anahy", 4101051, &geo_ufs[20]},
+	{"Andirá", 4101101, &geo_ufs[20]},
+	{"Ângulo", 4101150, &geo_ufs[20]},
+	{"Antonina", 4101200, &geo_ufs[20]},
+	{"Antônio Olinto", 4101309, &geo_ufs[20]},
+	{"Apucarana", 4101408, &geo_ufs[20]},
+	{"Arapongas", 4101507, &geo_ufs[20]},
+	{"Arapoti", 4101606, &geo_ufs[20]},
+	{"Arapuã", 4101655, &geo_ufs[20]},
+	{"Araruna", 4101705, &geo_ufs[20]},
+	{"Araucária", 4101804, &geo_ufs[20]},
+	{"Ariranha do Ivaí", 4101853, &geo_ufs[20]},
+	{"Assaí", 4101903, &geo_ufs[20]},
+	{"Assis Chateaubriand", 4102000, &geo_ufs[20]},
+	{"Astorga", 4102109, &geo_ufs[20]},
+	{"Atalaia", 4102208, &geo_ufs[20]},
+	{"Balsa Nova", 4102307, &geo_ufs[20]},
+	{"Bandeirantes", 4102406, &geo_ufs[20]},
+	{"Barbosa Ferraz", 4102505, &geo_ufs[20]},
+	{"Barracão", 4102604, &geo_ufs[20]},
+	{"Barra do Jacaré", 4102703, &geo_ufs[20]},
+	{"Bela Vista da Caroba", 4102752, &geo_ufs[20]},
+	{"Bela Vista do Paraíso", 4102802, &geo_ufs[20]},
+	{"Bituruna", 4102901, &geo_ufs[20]},
+	{"Boa Esperança", 4103008, &geo_ufs[20]},
+	{"Boa Esperança do Iguaçu", 4103024, &geo_ufs[20]},
+	{"Boa Ventura de São Roque", 4103040, &geo_ufs[20]},
+	{"Boa Vista da Aparecida", 4103057, &geo_ufs[20]},
+	{"Bocaiúva do Sul", 4103107, &geo_ufs[20]},
+	{"Bom Jesus do Sul", 4103156, &geo_ufs[20]},
+	{"Bom Sucesso", 4103206, &geo_ufs[20]},
+	{"Bom Sucesso do Sul", 4103222, &geo_ufs[20]},
+	{"Borrazópolis", 4103305, &geo_ufs[20]},
+	{"Braganey", 4103354, &geo_ufs[20]},
+	{"Brasilândia do Sul", 4103370, &geo_ufs[20]},
+	{"Cafeara", 4103404, &geo_ufs[20]},
+	{"Cafelândia", 4103453, &geo_ufs[20]},
+	{"Cafezal do Sul", 4103479, &geo_ufs[20]},
+	{"Califórnia", 4103503, &geo_ufs[20]},
+	{"Cambará", 4103602, &geo_ufs[20]},
+	{"Cambé", 4103701, &geo_ufs[20]},
+	{"Cambira", 4103800, &geo_ufs[20]},
+	{"Campina da Lagoa", 4103909, &geo_ufs[20]},
+	{"Campina do Simão", 4103958, &geo_ufs[20]},
+	{"Campina Grande do Sul", 4104006, &geo_ufs[20]},
+	{"Campo Bonito", 4104055, &geo_ufs[20]},
+	{"Campo do Tenente", 4104105, &geo_ufs[20]},
+	{"Campo Largo", 4104204, &geo_ufs[20]},
+	{"Campo Magro", 4104253, &geo_ufs[20]},
+	{"Campo Mourão", 4104303, &geo_ufs[20]},
+	{"Cândido de Abreu", 4104402, &geo_ufs[20]},
+	{"Candói", 4104428, &geo_ufs[20]},
+	{"Cantagalo", 4104451, &geo_ufs[20]},
+	{"Capanema", 4104501, &geo_ufs[20]},
+	{"Capitão Leônidas Marques", 4104600, &geo_ufs[20]},
+	{"Carambeí", 4104659, &geo_ufs[20]},
+	{"Carlópolis", 4104709, &geo_ufs[20]},
+	{"Cascavel", 4104808, &geo_ufs[20]},
+	{"Castro", 4104907, &geo_ufs[20]},
+	{"Catanduvas", 4105003, &geo_ufs[20]},
+	{"Centenário do Sul", 4105102, &geo_ufs[20]},
+	{"Cerro Azul", 4105201, &geo_ufs[20]},
+	{"Céu Azul", 4105300, &geo_ufs[20]},
+	{"Chopinzinho", 4105409, &geo_ufs[20]},
+	{"Cianorte", 4105508, &geo_ufs[20]},
+	{"Cidade Gaúcha", 4105607, &geo_ufs[20]},
+	{"Clevelândia", 4105706, &geo_ufs[20]},
+	{"Colombo", 4105805, &geo_ufs[20]},
+	{"Colorado", 4105904, &geo_ufs[20]},
+	{"Congonhinhas", 4106001, &geo_ufs[20]},
+	{"Conselheiro Mairinck", 4106100, &geo_ufs[20]},
+	{"Contenda", 4106209, &geo_ufs[20]},
+	{"Corbélia", 4106308, &geo_ufs[20]},
+	{"Cornélio Procópio", 4106407, &geo_ufs[20]},
+	{"Coronel Domingos Soares", 4106456, &geo_ufs[20]},
+	{"Coronel Vivida", 4106506, &geo_ufs[20]},
+	{"Corumbataí do Sul", 4106555, &geo_ufs[20]},
+	{"Cruzeiro do Iguaçu", 4106571, &geo_ufs[20]},
+	{"Cruzeiro do Oeste", 4106605, &geo_ufs[20]},
+	{"Cruzeiro do Sul", 4106704, &geo_ufs[20]},
+	{"Cruz Machado", 4106803, &geo_ufs[20]},
+	{"Cruzmaltina", 4106852, &geo_ufs[20]},
+	{"Curitiba", 4106902, &geo_ufs[20]},
+	{"Curiúva", 4107009, &geo_ufs[20]},
+	{"Diamante do Norte", 4107108, &geo_ufs[20]},
+	{"Diamante do Sul", 4107124, &geo_ufs[20]},
+	{"Diamante D'Oeste", 4107157, &geo_ufs[20]},
+	{"Dois Vizinhos", 4107207, &geo_ufs[20]},
+	{"Douradina", 4107256, &geo_ufs[20]},
+	{"Doutor Camargo", 4107306, &geo_ufs[20]},
+	{"Enéas Marques", 4107405, &geo_ufs[20]},
+	{"Engenheiro Beltrão", 4107504, &geo_ufs[20]},
+	{"Esperança Nova", 4107520, &geo_ufs[20]},
+	{"Entre Rios do Oeste", 4107538, &geo_ufs[20]},
+	{"Espigão Alto do Iguaçu", 4107546, &geo_ufs[20]},
+	{"Farol", 4107553, &geo_ufs[20]},
+	{"Faxinal", 4107603, &geo_ufs[20]},
+	{"Fazenda Rio Grande", 4107652, &geo_ufs[20]},
+	{"Fênix", 4107702, &geo_ufs[20]},
+	{"Fernandes Pinheiro", 4107736, &geo_ufs[20]},
+	{"Figueira", 4107751, &geo_ufs[20]},
+	{"Floraí", 4107801, &geo_ufs[20]},
+	{"Flor da Serra do Sul", 4107850, &geo_ufs[20]},
+	{"Floresta", 4107900, &geo_ufs[20]},
+	{"Florestópolis", 4108007, &geo_ufs[20]},
+	{"Flórida", 4108106, &geo_ufs[20]},
+	{"Formosa do Oeste", 4108205, &geo_ufs[20]},
+	{"Foz do Iguaçu", 4108304, &geo_ufs[20]},
+	{"Francisco Alves", 4108320, &geo_ufs[20]},
+	{"Francisco Beltrão", 4108403, &geo_ufs[20]},
+	{"Foz do Jordão", 4108452, &geo_ufs[20]},
+	{"General Carneiro", 4108502, &geo_ufs[20]},
+	{"Godoy Moreira", 4108551, &geo_ufs[20]},
+	{"Goioerê", 4108601, &geo_ufs[20]},
+	{"Goioxim", 4108650, &geo_ufs[20]},
+	{"Grandes Rios", 4108700, &geo_ufs[20]},
+	{"Guaíra", 4108809, &geo_ufs[20]},
+	{"Guairaçá", 4108908, &geo_ufs[20]},
+	{"Guamiranga", 4108957, &geo_ufs[20]},
+	{"Guapirama", 4109005, &geo_ufs[20]},
+	{"Guaporema", 4109104, &geo_ufs[20]},
+	{"Guaraci", 4109203, &geo_ufs[20]},
+	{"Guaraniaçu", 4109302, &geo_ufs[20]},
+	{"Guarapuava", 4109401, &geo_ufs[20]},
+	{"Guaraqueçaba", 4109500, &geo_ufs[20]},
+	{"Guaratuba", 4109609, &geo_ufs[20]},
+	{"Honório Serpa", 4109658, &geo_ufs[20]},
+	{"Ibaiti", 4109708, &geo_ufs[20]},
+	{"Ibema", 4109757, &geo_ufs[20]},
+	{"Ibiporã", 4109807, &geo_ufs[20]},
+	{"Icaraíma", 4109906, &geo_ufs[20]},
+	{"Iguaraçu", 4110003, &geo_ufs[20]},
+	{"Iguatu", 4110052, &geo_ufs[20]},
+	{"Imbaú", 4110078, &geo_ufs[20]},
+	{"Imbituva", 4110102, &geo_ufs[20]},
+	{"Inácio Martins", 4110201, &geo_ufs[20]},
+	{"Inajá", 4110300, &geo_ufs[20]},
+	{"Indianópolis", 4110409, &geo_ufs[20]},
+	{"Ipiranga", 4110508, &geo_ufs[20]},
+	{"Iporã", 4110607, &geo_ufs[20]},
+	{"Iracema do Oeste", 4110656, &geo_ufs[20]},
+	{"Irati", 4110706, &geo_ufs[20]},
+	{"Iretama", 4110805, &geo_ufs[20]},
+	{"Itaguajé", 4110904, &geo_ufs[20]},
+	{"Itaipulândia", 4110953, &geo_ufs[20]},
+	{"Itambaracá", 4111001, &geo_ufs[20]},
+	{"Itambé", 4111100, &geo_ufs[20]},
+	{"Itapejara d'Oeste", 4111209, &geo_ufs[20]},
+	{"Itaperuçu", 4111258, &geo_ufs[20]},
+	{"Itaúna do Sul", 4111308, &geo_ufs[20]},
+	{"Ivaí", 4111407, &geo_ufs[20]},
+	{"Ivaiporã", 4111506, &geo_ufs[20]},
+	{"Ivaté", 4111555, &geo_ufs[20]},
+	{"Ivatuba", 4111605, &geo_ufs[20]},
+	{"Jaboti", 4111704, &geo_ufs[20]},
+	{"Jacarezinho", 4111803, &geo_ufs[20]},
+	{"Jaguapitã", 4111902, &geo_ufs[20]},
+	{"Jaguariaíva", 4112009, &geo_ufs[20]},
+	{"Jandaia do Sul", 4112108, &geo_ufs[20]},
+	{"Janiópolis", 4112207, &geo_ufs[20]},
+	{"Japira", 4112306, &geo_ufs[20]},
+	{"Japurá", 4112405, &geo_ufs[20]},
+	{"Jardim Alegre", 4112504, &geo_ufs[20]},
+	{"Jardim Olinda", 4112603, &geo_ufs[20]},
+	{"Jataizinho", 4112702, &geo_ufs[20]},
+	{"Jesuítas", 4112751, &geo_ufs[20]},
+	{"Joaquim Távora", 4112801, &geo_ufs[20]},
+	{"Jundiaí do Sul", 4112900, &geo_ufs[20]},
+	{"Juranda", 4112959, &geo_ufs[20]},
+	{"Jussara", 4113007, &geo_ufs[20]},
+	{"Kaloré", 4113106, &geo_ufs[20]},
+	{"Lapa", 4113205, &geo_ufs[20]},
+	{"Laranjal", 4113254, &geo_ufs[20]},
+	{"Laranjeiras do Sul", 4113304, &geo_ufs[20]},
+	{"Leópolis", 4113403, &geo_ufs[20]},
+	{"Lidianópolis", 4113429, &geo_ufs[20]},
+	{"Lindoeste", 4113452, &geo_ufs[20]},
+	{"Loanda", 4113502, &geo_ufs[20]},
+	{"Lobato", 4113601, &geo_ufs[20]},
+	{"Londrina", 4113700, &geo_ufs[20]},
+	{"Luiziana", 4113734, &geo_ufs[20]},
+	{"Lunardelli", 4113759, &geo_ufs[20]},
+	{"Lupionópolis", 4113809, &geo_ufs[20]},
+	{"Mallet", 4113908, &geo_ufs[20]},
+	{"Mamborê", 4114005, &geo_ufs[20]},
+	{"Mandaguaçu", 4114104, &geo_ufs[20]},
+	{"Mandaguari", 4114203, &geo_ufs[20]},
+	{"Mandirituba", 4114302, &geo_ufs[20]},
+	{"Manfrinópolis", 4114351, &geo_ufs[20]},
+	{"Mangueirinha", 4114401, &geo_ufs[20]},
+	{"Manoel Ribas", 4114500, &geo_ufs[20]},
+	{"Marechal Cândido Rondon", 4114609, &geo_ufs[20]},
+	{"Maria Helena", 4114708, &geo_ufs[20]},
+	{"Marialva", 4114807, &geo_ufs[20]},
+	{"Marilândia do Sul", 4114906, &geo_ufs[20]},
+	{"Marilena", 4115002, &geo_ufs[20]},
+	{"Mariluz", 4115101, &geo_ufs[20]},
+	{"Maringá", 4115200, &geo_ufs[20]},
+	{"Mariópolis", 4115309, &geo_ufs[20]},
+	{"Maripá", 4115358, &geo_ufs[20]},
+	{"Marmeleiro", 4115408, &geo_ufs[20]},
+	{"Marquinho", 4115457, &geo_ufs[20]},
+	{"Marumbi", 4115507, &geo_ufs[20]},
+	{"Matelândia", 4115606, &geo_ufs[20]},
+	{"Matinhos", 4115705, &geo_ufs[20]},
+	{"Mato Rico", 4115739, &geo_ufs[20]},
+	{"Mauá da Serra", 4115754, &geo_ufs[20]},
+	{"Medianeira", 4115804, &geo_ufs[20]},
+	{"Mercedes", 4115853, &geo_ufs[20]},
+	{"Mirador", 4115903, &geo_ufs[20]},
+	{"Miraselva", 4116000, &geo_ufs[20]},
+	{"Missal", 4116059, &geo_ufs[20]},
+	{"Moreira Sales", 4116109, &geo_ufs[20]},
+	{"Morretes", 4116208, &geo_ufs[20]},
+	{"Munhoz de Melo", 4116307, &geo_ufs[20]},
+	{"Nossa Senhora das Graças", 4116406, &geo_ufs[20]},
+	{"Nova Aliança do Ivaí", 4116505, &geo_ufs[20]},
+	{"Nova América da Colina", 4116604, &geo_ufs[20]},
+	{"Nova Aurora", 4116703, &geo_ufs[20]},
+	{"Nova Cantu", 4116802, &geo_ufs[20]},
+	{"Nova Esperança", 4116901, &geo_ufs[20]},
+	{"Nova Esperança do Sudoeste", 4116950, &geo_ufs[20]},
+	{"Nova Fátima", 4117008, &geo_ufs[20]},
+	{"Nova Laranjeiras", 4117057, &geo_ufs[20]},
+	{"Nova Londrina", 4117107, &geo_ufs[20]},
+	{"Nova Olímpia", 4117206, &geo_ufs[20]},
+	{"Nova Santa Bárbara", 4117214, &geo_ufs[20]},
+	{"Nova Santa Rosa", 4117222, &geo_ufs[20]},
+	{"Nova Prata do Iguaçu", 4117255, &geo_ufs[20]},
+	{"Nova Tebas", 4117271, &geo_ufs[20]},
+	{"Novo Itacolomi", 4117297, &geo_ufs[20]},
+	{"Ortigueira", 4117305, &geo_ufs[20]},
+	{"Ourizona", 4117404, &geo_ufs[20]},
+	{"Ouro Verde do Oeste", 4117453, &geo_ufs[20]},
+	{"Paiçandu", 4117503, &geo_ufs[20]},
+	{"Palmas", 4117602, &geo_ufs[20]},
+	{"Palmeira", 4117701, &geo_ufs[20]},
+	{"Palmital", 4117800, &geo_ufs[20]},
+	{"Palotina", 4117909, &geo_ufs[20]},
+	{"Paraíso do Norte", 4118006, &geo_ufs[20]},
+	{"Paranacity", 4118105, &geo_ufs[20]},
+	{"Paranaguá", 4118204, &geo_ufs[20]},
+	{"Paranapoema", 4118303, &geo_ufs[20]},
+	{"Paranavaí", 4118402, &geo_ufs[20]},
+	{"Pato Bragado", 4118451, &geo_ufs[20]},
+	{"Pato Branco", 4118501, &geo_ufs[20]},
+	{"Paula Freitas", 4118600, &geo_ufs[20]},
+	{"Paulo Frontin", 4118709, &geo_ufs[20]},
+	{"Peabiru", 4118808, &geo_ufs[20]},
+	{"Perobal", 4118857, &geo_ufs[20]},
+	{"Pérola", 4118907, &geo_ufs[20]},
+	{"Pérola d'Oeste", 4119004, &geo_ufs[20]},
+	{"Piên", 4119103, &geo_ufs[20]},
+	{"Pinhais", 4119152, &geo_ufs[20]},
+	{"Pinhalão", 4119202, &geo_ufs[20]},
+	{"Pinhal de São Bento", 4119251, &geo_ufs[20]},
+	{"Pinhão", 4119301, &geo_ufs[20]},
+	{"Piraí do Sul", 4119400, &geo_ufs[20]},
+	{"Piraquara", 4119509, &geo_ufs[20]},
+	{"Pitanga", 4119608, &geo_ufs[20]},
+	{"Pitangueiras", 4119657, &geo_ufs[20]},
+	{"Planaltina do Paraná", 4119707, &geo_ufs[20]},
+	{"Planalto", 4119806, &geo_ufs[20]},
+	{"Ponta Grossa", 4119905, &geo_ufs[20]},
+	{"Pontal do Paraná", 4119954, &geo_ufs[20]},
+	{"Porecatu", 4120002, &geo_ufs[20]},
+	{"Porto Amazonas", 4120101, &geo_ufs[20]},
+	{"Porto Barreiro", 4120150, &geo_ufs[20]},
+	{"Porto Rico", 4120200, &geo_ufs[20]},
+	{"Porto Vitória", 4120309, &geo_ufs[20]},
+	{"Prado Ferreira", 4120333, &geo_ufs[20]},
+	{"Pranchita", 4120358, &geo_ufs[20]},
+	{"Presidente Castelo Branco", 4120408, &geo_ufs[20]},
+	{"Primeiro de Maio", 4120507, &geo_ufs[20]},
+	{"Prudentópolis", 4120606, &geo_ufs[20]},
+	{"Quarto Centenário", 4120655, &geo_ufs[20]},
+	{"Quatiguá", 4120705, &geo_ufs[20]},
+	{"Quatro Barras", 4120804, &geo_ufs[20]},
+	{"Quatro Pontes", 4120853, &geo_ufs[20]},
+	{"Quedas do Iguaçu", 4120903, &geo_ufs[20]},
+	{"Querência do Norte", 4121000, &geo_ufs[20]},
+	{"Quinta do Sol", 4121109, &geo_ufs[20]},
+	{"Quitandinha", 4121208, &geo_ufs[20]},
+	{"Ramilândia", 4121257, &geo_ufs[20]},
+	{"Rancho Alegre", 4121307, &geo_ufs[20]},
+	{"Rancho Alegre D'Oeste", 4121356, &geo_ufs[20]},
+	{"Realeza", 4121406, &geo_ufs[20]},
+	{"Rebouças", 4121505, &geo_ufs[20]},
+	{"Renascença", 4121604, &geo_ufs[20]},
+	{"Reserva", 4121703, &geo_ufs[20]},
+	{"Reserva do Iguaçu", 4121752, &geo_ufs[20]},
+	{"Ribeirão Claro", 4121802, &geo_ufs[20]},
+	{"Ribeirão do Pinhal", 4121901, &geo_ufs[20]},
+	{"Rio Azul", 4122008, &geo_ufs[20]},
+	{"Rio Bom", 4122107, &geo_ufs[20]},
+	{"Rio Bonito do Iguaçu", 4122156, &geo_ufs[20]},
+	{"Rio Branco do Ivaí", 4122172, &geo_ufs[20]},
+	{"Rio Branco do Sul", 4122206, &geo_ufs[20]},
+	{"Rio Negro", 4122305, &geo_ufs[20]},
+	{"Rolândia", 4122404, &geo_ufs[20]},
+	{"Roncador", 4122503, &geo_ufs[20]},
+	{"Rondon", 4122602, &geo_ufs[20]},
+	{"Rosário do Ivaí", 4122651, &geo_ufs[20]},
+	{"Sabáudia", 4122701, &geo_ufs[20]},
+	{"Salgado Filho", 4122800, &geo_ufs[20]},
+	{"Salto do Itararé", 4122909, &geo_ufs[20]},
+	{"Salto do Lontra", 4123006, &geo_ufs[20]},
+	{"Santa Amélia", 4123105, &geo_ufs[20]},
+	{"Santa Cecília do Pavão", 4123204, &geo_ufs[20]},
+	{"Santa Cruz de Monte Castelo", 4123303, &geo_ufs[20]},
+	{"Santa Fé", 4123402, &geo_ufs[20]},
+	{"Santa Helena", 4123501, &geo_ufs[20]},
+	{"Santa Inês", 4123600, &geo_ufs[20]},
+	{"Santa Isabel do Ivaí", 4123709, &geo_ufs[20]},
+	{"Santa Izabel do Oeste", 4123808, &geo_ufs[20]},
+	{"Santa Lúcia", 4123824, &geo_ufs[20]},
+	{"Santa Maria do Oeste", 4123857, &geo_ufs[20]},
+	{"Santa Mariana", 4123907, &geo_ufs[20]},
+	{"Santa Mônica", 4123956, &geo_ufs[20]},
+	{"Santana do Itararé", 4124004, &geo_ufs[20]},
+	{"Santa Tereza do Oeste", 4124020, &geo_ufs[20]},
+	{"Santa Terezinha de Itaipu", 4124053, &geo_ufs[20]},
+	{"Santo Antônio da Platina", 4124103, &geo_ufs[20]},
+	{"Santo Antônio do Caiuá", 4124202, &geo_ufs[20]},
+	{"Santo Antônio do Paraíso", 4124301, &geo_ufs[20]},
+	{"Santo Antônio do Sudoeste", 4124400, &geo_ufs[20]},
+	{"Santo Inácio", 4124509, &geo_ufs[20]},
+	{"São Carlos do Ivaí", 4124608, &geo_ufs[20]},
+	{"São Jerônimo da Serra", 4124707, &geo_ufs[20]},
+	{"São João", 4124806, &geo_ufs[20]},
+	{"São João do Caiuá", 4124905, &geo_ufs[20]},
+	{"São João do Ivaí", 4125001, &geo_ufs[20]},
+	{"São João do Triunfo", 4125100, &geo_ufs[20]},
+	{"São Jorge d'Oeste", 4125209, &geo_ufs[20]},
+	{"São Jorge do Ivaí", 4125308, &geo_ufs[20]},
+	{"São Jorge do Patrocínio", 4125357, &geo_ufs[20]},
+	{"São José da Boa Vista", 4125407, &geo_ufs[20]},
+	{"São José das Palmeiras", 4125456, &geo_ufs[20]},
+	{"São José dos Pinhais", 4125506, &geo_ufs[20]},
+	{"São Manoel do Paraná", 4125555, &geo_ufs[20]},
+	{"São Mateus do Sul", 4125605, &geo_ufs[20]},
+	{"São Miguel do Iguaçu", 4125704, &geo_ufs[20]},
+	{"São Pedro do Iguaçu", 4125753, &geo_ufs[20]},
+	{"São Pedro do Ivaí", 4125803, &geo_ufs[20]},
+	{"São Pedro do Paraná", 4125902, &geo_ufs[20]},
+	{"São Sebastião da Amoreira", 4126009, &geo_ufs[20]},
+	{"São Tomé", 4126108, &geo_ufs[20]},
+	{"Sapopema", 4126207, &geo_ufs[20]},
+	{"Sarandi", 4126256, &geo_ufs[20]},
+	{"Saudade do Iguaçu", 4126272, &geo_ufs[20]},
+	{"Sengés", 4126306, &geo_ufs[20]},
+	{"Serranópolis do Iguaçu", 4126355, &geo_ufs[20]},
+	{"Sertaneja", 4126405, &geo_ufs[20]},
+	{"Sertanópolis", 4126504, &geo_ufs[20]},
+	{"Siqueira Campos", 4126603, &geo_ufs[20]},
+	{"Sulina", 4126652, &geo_ufs[20]},
+	{"Tamarana", 4126678, &geo_ufs[20]},
+	{"Tamboara", 4126702, &geo_ufs[20]},
+	{"Tapejara", 4126801, &geo_ufs[20]},
+	{"Tapira", 4126900, &geo_ufs[20]},
+	{"Teixeira Soares", 4127007, &geo_ufs[20]},
+	{"Telêmaco Borba", 4127106, &geo_ufs[20]},
+	{"Terra Boa", 4127205, &geo_ufs[20]},
+	{"Terra Rica", 4127304, &geo_ufs[20]},
+	{"Terra Roxa", 4127403, &geo_ufs[20]},
+	{"Tibagi", 4127502, &geo_ufs[20]},
+	{"Tijucas do Sul", 4127601, &geo_ufs[20]},
+	{"Toledo", 4127700, &geo_ufs[20]},
+	{"Tomazina", 4127809, &geo_ufs[20]},
+	{"Três Barras do Paraná", 4127858, &geo_ufs[20]},
+	{"Tunas do Paraná", 4127882, &geo_ufs[20]},
+	{"Tuneiras do Oeste", 4127908, &geo_ufs[20]},
+	{"Tupãssi", 4127957, &geo_ufs[20]},
+	{"Turvo", 4127965, &geo_ufs[20]},
+	{"Ubiratã", 4128005, &geo_ufs[20]},
+	{"Umuarama", 4128104, &geo_ufs[20]},
+	{"União da Vitória", 4128203, &geo_ufs[20]},
+	{"Uniflor", 4128302, &geo_ufs[20]},
+	{"Uraí", 4128401, &geo_ufs[20]},
+	{"Wenceslau Braz", 4128500, &geo_ufs[20]},
+	{"Ventania", 4128534, &geo_ufs[20]},
+	{"Vera Cruz do Oeste", 4128559, &geo_ufs[20]},
+	{"Verê", 4128609, &geo_ufs[20]},
+	{"Alto Paraíso", 4128625, &geo_ufs[20]},
+	{"Doutor Ulysses", 4128633, &geo_ufs[20]},
+	{"Virmond", 4128658, &geo_ufs[20]},
+	{"Vitorino", 4128708, &geo_ufs[20]},
+	{"Xambrê", 4128807, &geo_ufs[20]},
+	{"Abdon Batista", 4200051, &geo_ufs[21]},
+	{"Abelardo Luz", 4200101, &geo_ufs[21]},
+	{"Agrolândia", 4200200, &geo_ufs[21]},
+	{"Agronômica", 4200309, &geo_ufs[21]},
+	{"Água Doce", 4200408, &geo_ufs[21]},
+	{"Águas de Chapecó", 4200507, &geo_ufs[21]},
+	{"Águas Frias", 4200556, &geo_ufs[21]},
+	{"Águas Mornas", 4200606, &geo_ufs[21]},
+	{"Alfredo Wagner", 4200705, &geo_ufs[21]},
+	{"Alto Bela Vista", 4200754, &geo_ufs[21]},
+	{"Anchieta", 4200804, &geo_ufs[21]},
+	{"Angelina", 4200903, &geo_ufs[21]},
+	{"Anita Garibaldi", 4201000, &geo_ufs[21]},
+	{"Anitápolis", 4201109, &geo_ufs[21]},
+	{"Antônio Carlos", 4201208, &geo_ufs[21]},
+	{"Apiúna", 4201257, &geo_ufs[21]},
+	{"Arabutã", 4201273, &geo_ufs[21]},
+	{"Araquari", 4201307, &geo_ufs[21]},
+	{"Araranguá", 4201406, &geo_ufs[21]},
+	{"Armazém", 4201505, &geo_ufs[21]},
+	{"Arroio Trinta", 4201604, &geo_ufs[21]},
+	{"Arvoredo", 4201653, &geo_ufs[21]},
+	{"Ascurra", 4201703, &geo_ufs[21]},
+	{"Atalanta", 4201802, &geo_ufs[21]},
+	{"Aurora", 4201901, &geo_ufs[21]},
+	{"Balneário Arroio do Silva", 4201950, &geo_ufs[21]},
+	{"Balneário Camboriú", 4202008, &geo_ufs[21]},
+	{"Balneário Barra do Sul", 4202057, &geo_ufs[21]},
+	{"Balneário Gaivota", 4202073, &geo_ufs[21]},
+	{"Bandeirante", 4202081, &geo_ufs[21]},
+	{"Barra Bonita", 4202099, &geo_ufs[21]},
+	{"Barra Velha", 4202107, &geo_ufs[21]},
+	{"Bela Vista do Toldo", 4202131, &geo_ufs[21]},
+	{"Belmonte", 4202156, &geo_ufs[21]},
+	{"Benedito Novo", 4202206, &geo_ufs[21]},
+	{"Biguaçu", 4202305, &geo_ufs[21]},
+	{"Blumenau", 4202404, &geo_ufs[21]},
+	{"Bocaina do Sul", 4202438, &geo_ufs[21]},
+	{"Bombinhas", 4202453, &geo_ufs[21]},
+	{"Bom Jardim da Serra", 4202503, &geo_ufs[21]},
+	{"Bom Jesus", 4202537, &geo_ufs[21]},
+	{"Bom Jesus do Oeste", 4202578, &geo_ufs[21]},
+	{"Bom Retiro", 4202602, &geo_ufs[21]},
+	{"Botuverá", 4202701, &geo_ufs[21]},
+	{"Braço do Norte", 4202800, &geo_ufs[21]},
+	{"Braço do Trombudo", 4202859, &geo_ufs[21]},
+	{"Brunópolis", 4202875, &geo_ufs[21]},
+	{"Brusque", 4202909, &geo_ufs[21]},
+	{"Caçador", 4203006, &geo_ufs[21]},
+	{"Caibi", 4203105, &geo_ufs[21]},
+	{"Calmon", 4203154, &geo_ufs[21]},
+	{"Camboriú", 4203204, &geo_ufs[21]},
+	{"Capão Alto", 4203253, &geo_ufs[21]},
+	{"Campo Alegre", 4203303, &geo_ufs[21]},
+	{"Campo Belo do Sul", 4203402, &geo_ufs[21]},
+	{"Campo Erê", 4203501, &geo_ufs[21]},
+	{"Campos Novos", 4203600, &geo_ufs[21]},
+	{"Canelinha", 4203709, &geo_ufs[21]},
+	{"Canoinhas", 4203808, &geo_ufs[21]},
+	{"Capinzal", 4203907, &geo_ufs[21]},
+	{"Capivari de Baixo", 4203956, &geo_ufs[21]},
+	{"Catanduvas", 4204004, &geo_ufs[21]},
+	{"Caxambu do Sul", 4204103, &geo_ufs[21]},
+	{"Celso Ramos", 4204152, &geo_ufs[21]},
+	{"Cerro Negro", 4204178, &geo_ufs[21]},
+	{"Chapadão do Lageado", 4204194, &geo_ufs[21]},
+	{"Chapecó", 4204202, &geo_ufs[21]},
+	{"Cocal do Sul", 4204251, &geo_ufs[21]},
+	{"Concórdia", 4204301, &geo_ufs[21]},
+	{"Cordilheira Alta", 4204350, &geo_ufs[21]},
+	{"Coronel Freitas", 4204400, &geo_ufs[21]},
+	{"Coronel Martins", 4204459, &geo_ufs[21]},
+	{"Corupá", 4204509, &geo_ufs[21]},
+	{"Correia Pinto", 4204558, &geo_ufs[21]},
+	{"Criciúma", 4204608, &geo_ufs[21]},
+	{"Cunha Porã", 4204707, &geo_ufs[21]},
+	{"Cunhataí", 4204756, &geo_ufs[21]},
+	{"Curitibanos", 4204806, &geo_ufs[21]},
+	{"Descanso", 4204905, &geo_ufs[21]},
+	{"Dionísio Cerqueira", 4205001, &geo_ufs[21]},
+	{"Dona Emma", 4205100, &geo_ufs[21]},
+	{"Doutor Pedrinho", 4205159, &geo_ufs[21]},
+	{"Entre Rios", 4205175, &geo_ufs[21]},
+	{"Ermo", 4205191, &geo_ufs[21]},
+	{"Erval Velho", 4205209, &geo_ufs[21]},
+	{"Faxinal dos Guedes", 4205308, &geo_ufs[21]},
+	{"Flor do Sertão", 4205357, &geo_ufs[21]},
+	{"Florianópolis", 4205407, &geo_ufs[21]},
+	{"Formosa do Sul", 4205431, &geo_ufs[21]},
+	{"Forquilhinha", 4205456, &geo_ufs[21]},
+	{"Fraiburgo", 4205506, &geo_ufs[21]},
+	{"Frei Rogério", 4205555, &geo_ufs[21]},
+	{"Galvão", 4205605, &geo_ufs[21]},
+	{"Garopaba", 4205704, &geo_ufs[21]},
+	{"Garuva", 4205803, &geo_ufs[21]},
+	{"Gaspar", 4205902, &geo_ufs[21]},
+	{"Governador Celso Ramos", 4206009, &geo_ufs[21]},
+	{"Grão Pará", 4206108, &geo_ufs[21]},
+	{"Gravatal", 4206207, &geo_ufs[21]},
+	{"Guabiruba", 4206306, &geo_ufs[21]},
+	{"Guaraciaba", 4206405, &geo_ufs[21]},
+	{"Guaramirim", 4206504, &geo_ufs[21]},
+	{"Guarujá do Sul", 4206603, &geo_ufs[21]},
+	{"Guatambú", 4206652, &geo_ufs[21]},
+	{"Herval d'Oeste", 4206702, &geo_ufs[21]},
+	{"Ibiam", 4206751, &geo_ufs[21]},
+	{"Ibicaré", 4206801, &geo_ufs[21]},
+	{"Ibirama", 4206900, &geo_ufs[21]},
+	{"Içara", 4207007, &geo_ufs[21]},
+	{"Ilhota", 4207106, &geo_ufs[21]},
+	{"Imaruí", 4207205, &geo_ufs[21]},
+	{"Imbituba", 4207304, &geo_ufs[21]},
+	{"Imbuia", 4207403, &geo_ufs[21]},
+	{"Indaial", 4207502, &geo_ufs[21]},
+	{"Iomerê", 4207577, &geo_ufs[21]},
+	{"Ipira", 4207601, &geo_ufs[21]},
+	{"Iporã do Oeste", 4207650, &geo_ufs[21]},
+	{"Ipuaçu", 4207684, &geo_ufs[21]},
+	{"Ipumirim", 4207700, &geo_ufs[21]},
+	{"Iraceminha", 4207759, &geo_ufs[21]},
+	{"Irani", 4207809, &geo_ufs[21]},
+	{"Irati", 4207858, &geo_ufs[21]},
+	{"Irineópolis", 4207908, &geo_ufs[21]},
+	{"Itá", 4208005, &geo_ufs[21]},
+	{"Itaiópolis", 4208104, &geo_ufs[21]},
+	{"Itajaí", 4208203, &geo_ufs[21]},
+	{"Itapema", 4208302, &geo_ufs[21]},
+	{"Itapiranga", 4208401, &geo_ufs[21]},
+	{"Itapoá", 4208450, &geo_ufs[21]},
+	{"Ituporanga", 4208500, &geo_ufs[21]},
+	{"Jaborá", 4208609, &geo_ufs[21]},
+	{"Jacinto Machado", 4208708, &geo_ufs[21]},
+	{"Jaguaruna", 4208807, &geo_ufs[21]},
+	{"Jaraguá do Sul", 4208906, &geo_ufs[21]},
+	{"Jardinópolis", 4208955, &geo_ufs[21]},
+	{"Joaçaba", 4209003, &geo_ufs[21]},
+	{"Joinville", 4209102, &geo_ufs[21]},
+	{"José Boiteux", 4209151, &geo_ufs[21]},
+	{"Jupiá", 4209177, &geo_ufs[21]},
+	{"Lacerdópolis", 4209201, &geo_ufs[21]},
+	{"Lages", 4209300, &geo_ufs[21]},
+	{"Laguna", 4209409, &geo_ufs[21]},
+	{"Lajeado Grande", 4209458, &geo_ufs[21]},
+	{"Laurentino", 4209508, &geo_ufs[21]},
+	{"Lauro Muller", 4209607, &geo_ufs[21]},
+	{"Lebon Régis", 4209706, &geo_ufs[21]},
+	{"Leoberto Leal", 4209805, &geo_ufs[21]},
+	{"Lindóia do Sul", 4209854, &geo_ufs[21]},
+	{"Lontras", 4209904, &geo_ufs[21]},
+	{"Luiz Alves", 4210001, &geo_ufs[21]},
+	{"Luzerna", 4210035, &geo_ufs[21]},
+	{"Macieira", 4210050, &geo_ufs[21]},
+	{"Mafra", 4210100, &geo_ufs[21]},
+	{"Major Gercino", 4210209, &geo_ufs[21]},
+	{"Major Vieira", 4210308, &geo_ufs[21]},
+	{"Maracajá", 4210407, &geo_ufs[21]},
+	{"Maravilha", 4210506, &geo_ufs[21]},
+	{"Marema", 4210555, &geo_ufs[21]},
+	{"Massaranduba", 4210605, &geo_ufs[21]},
+	{"Matos Costa", 4210704, &geo_ufs[21]},
+	{"Meleiro", 4210803, &geo_ufs[21]},
+	{"Mirim Doce", 4210852, &geo_ufs[21]},
+	{"Modelo", 4210902, &geo_ufs[21]},
+	{"Mondaí", 4211009, &geo_ufs[21]},
+	{"Monte Carlo", 4211058, &geo_ufs[21]},
+	{"Monte Castelo", 4211108, &geo_ufs[21]},
+	{"Morro da Fumaça", 4211207, &geo_ufs[21]},
+	{"Morro Grande", 4211256, &geo_ufs[21]},
+	{"Navegantes", 4211306, &geo_ufs[21]},
+	{"Nova Erechim", 4211405, &geo_ufs[21]},
+	{"Nova Itaberaba", 4211454, &geo_ufs[21]},
+	{"Nova Trento", 4211504, &geo_ufs[21]},
+	{"Nova Veneza", 4211603, &geo_ufs[21]},
+	{"Novo Horizonte", 4211652, &geo_ufs[21]},
+	{"Orleans", 4211702, &geo_ufs[21]},
+	{"Otacílio Costa", 4211751, &geo_ufs[21]},
+	{"Ouro", 4211801, &geo_ufs[21]},
+	{"Ouro Verde", 4211850, &geo_ufs[21]},
+	{"Paial", 4211876, &geo_ufs[21]},
+	{"Painel", 4211892, &geo_ufs[21]},
+	{"Palhoça", 4211900, &geo_ufs[21]},
+	{"Palma Sola", 4212007, &geo_ufs[21]},
+	{"Palmeira", 4212056, &geo_ufs[21]},
+	{"Palmitos", 4212106, &geo_ufs[21]},
+	{"Papanduva", 4212205, &geo_ufs[21]},
+	{"Paraíso", 4212239, &geo_ufs[21]},
+	{"Passo de Torres", 4212254, &geo_ufs[21]},
+	{"Passos Maia", 4212270, &geo_ufs[21]},
+	{"Paulo Lopes", 4212304, &geo_ufs[21]},
+	{"Pedras Grandes", 4212403, &geo_ufs[21]},
+	{"Penha", 4212502, &geo_ufs[21]},
+	{"Peritiba", 4212601, &geo_ufs[21]},
+	{"Petrolândia", 4212700, &geo_ufs[21]},
+	{"Balneário Piçarras", 4212809, &geo_ufs[21]},
+	{"Pinhalzinho", 4212908, &geo_ufs[21]},
+	{"Pinheiro Preto", 4213005, &geo_ufs[21]},
+	{"Piratuba", 4213104, &geo_ufs[21]},
+	{"Planalto Alegre", 4213153, &geo_ufs[21]},
+	{"Pomerode", 4213203, &geo_ufs[21]},
+	{"Ponte Alta", 4213302, &geo_ufs[21]},
+	{"Ponte Alta do Norte", 4213351, &geo_ufs[21]},
+	{"Ponte Serrada", 4213401, &geo_ufs[21]},
+	{"Porto Belo", 4213500, &geo_ufs[21]},
+	{"Porto União", 4213609, &geo_ufs[21]},
+	{"Pouso Redondo", 4213708, &geo_ufs[21]},
+	{"Praia Grande", 4213807, &geo_ufs[21]},
+	{"Presidente Castello Branco", 4213906, &geo_ufs[21]},
+	{"Presidente Getúlio", 4214003, &geo_ufs[21]},
+	{"Presidente Nereu", 4214102, &geo_ufs[21]},
+	{"Princesa", 4214151, &geo_ufs[21]},
+	{"Quilombo", 4214201, &geo_ufs[21]},
+	{"Rancho Queimado", 4214300, &geo_ufs[21]},
+	{"Rio das Antas", 4214409, &geo_ufs[21]},
+	{"Rio do Campo", 4214508, &geo_ufs[21]},
+	{"Rio do Oeste", 4214607, &geo_ufs[21]},
+	{"Rio dos Cedros", 4214706, &geo_ufs[21]},
+	{"Rio do Sul", 4214805, &geo_ufs[21]},
+	{"Rio Fortuna", 4214904, &geo_ufs[21]},
+	{"Rio Negrinho", 4215000, &geo_ufs[21]},
+	{"Rio Rufino", 4215059, &geo_ufs[21]},
+	{"Riqueza", 4215075, &geo_ufs[21]},
+	{"Rodeio", 4215109, &geo_ufs[21]},
+	{"Romelândia", 4215208, &geo_ufs[21]},
+	{"Salete", 4215307, &geo_ufs[21]},
+	{"Saltinho", 4215356, &geo_ufs[21]},
+	{"Salto Veloso", 4215406, &geo_ufs[21]},
+	{"Sangão", 4215455, &geo_ufs[21]},
+	{"Santa Cecília", 4215505, &geo_ufs[21]},
+	{"Santa Helena", 4215554, &geo_ufs[21]},
+	{"Santa Rosa de Lima", 4215604, &geo_ufs[21]},
+	{"Santa Rosa do Sul", 4215653, &geo_ufs[21]},
+	{"Santa Terezinha", 4215679, &geo_ufs[21]},
+	{"Santa Terezinha do Progresso", 4215687, &geo_ufs[21]},
+	{"Santiago do Sul", 4215695, &geo_ufs[21]},
+	{"Santo Amaro da Imperatriz", 4215703, &geo_ufs[21]},
+	{"São Bernardino", 4215752, &geo_ufs[21]},
+	{"São Bento do Sul", 4215802, &geo_ufs[21]},
+	{"São Bonifácio", 4215901, &geo_ufs[21]},
+	{"São Carlos", 4216008, &geo_ufs[21]},
+	{"São Cristovão do Sul", 4216057, &geo_ufs[21]},
+	{"São Domingos", 4216107, &geo_ufs[21]},
+	{"São Francisco do Sul", 4216206, &geo_ufs[21]},
+	{"São João do Oeste", 4216255, &geo_ufs[21]},
+	{"São João Batista", 4216305, &geo_ufs[21]},
+	{"São João do Itaperiú", 4216354, &geo_ufs[21]},
+	{"São João do Sul", 4216404, &geo_ufs[21]},
+	{"São Joaquim", 4216503, &geo_ufs[21]},
+	{"São José", 4216602, &geo_ufs[21]},
+	{"São José do Cedro", 4216701, &geo_ufs[21]},
+	{"São José do Cerrito", 4216800, &geo_ufs[21]},
+	{"São Lourenço do Oeste", 4216909, &geo_ufs[21]},
+	{"São Ludgero", 4217006, &geo_ufs[21]},
+	{"São Martinho", 4217105, &geo_ufs[21]},
+	{"São Miguel da Boa Vista", 4217154, &geo_ufs[21]},
+	{"São Miguel do Oeste", 4217204, &geo_ufs[21]},
+	{"São Pedro de Alcântara", 4217253, &geo_ufs[21]},
+	{"Saudades", 4217303, &geo_ufs[21]},
+	{"Schroeder", 4217402, &geo_ufs[21]},
+	{"Seara", 4217501, &geo_ufs[21]},
+	{"Serra Alta", 4217550, &geo_ufs[21]},
+	{"Siderópolis", 4217600, &geo_ufs[21]},
+	{"Sombrio", 4217709, &geo_ufs[21]},
+	{"Sul Brasil", 4217758, &geo_ufs[21]},
+	{"Taió", 4217808, &geo_ufs[21]},
+	{"Tangará", 4217907, &geo_ufs[21]},
+	{"Tigrinhos", 4217956, &geo_ufs[21]},
+	{"Tijucas", 4218004, &geo_ufs[21]},
+	{"Timbé do Sul", 4218103, &geo_ufs[21]},
+	{"Timbó", 4218202, &geo_ufs[21]},
+	{"Timbó Grande", 4218251, &geo_ufs[21]},
+	{"Três Barras", 4218301, &geo_ufs[21]},
+	{"Treviso", 4218350, &geo_ufs[21]},
+	{"Treze de Maio", 4218400, &geo_ufs[21]},
+	{"Treze Tílias", 4218509, &geo_ufs[21]},
+	{"Trombudo Central", 4218608, &geo_ufs[21]},
+	{"Tubarão", 4218707, &geo_ufs[21]},
+	{"Tunápolis", 4218756, &geo_ufs[21]},
+	{"Turvo", 4218806, &geo_ufs[21]},
+	{"União do Oeste", 4218855, &geo_ufs[21]},
+	{"Urubici", 4218905, &geo_ufs[21]},
+	{"Urupema", 4218954, &geo_ufs[21]},
+	{"Urussanga", 4219002, &geo_ufs[21]},
+	{"Vargeão", 4219101, &geo_ufs[21]},
+	{"Vargem", 4219150, &geo_ufs[21]},
+	{"Vargem Bonita", 4219176, &geo_ufs[21]},
+	{"Vidal Ramos", 4219200, &geo_ufs[21]},
+	{"Videira", 4219309, &geo_ufs[21]},
+	{"Vitor Meireles", 4219358, &geo_ufs[21]},
+	{"Witmarsum", 4219408, &geo_ufs[21]},
+	{"Xanxerê", 4219507, &geo_ufs[21]},
+	{"Xavantina", 4219606, &geo_ufs[21]},
+	{"Xaxim", 4219705, &geo_ufs[21]},
+	{"Zortéa", 4219853, &geo_ufs[21]},
+	{"Aceguá", 4300034, &geo_ufs[22]},
+	{"Água Santa", 4300059, &geo_ufs[22]},
+	{"Agudo", 4300109, &geo_ufs[22]},
+	{"Ajuricaba", 4300208, &geo_ufs[22]},
+	{"Alecrim", 4300307, &geo_ufs[22]},
+	{"Alegrete", 4300406, &geo_ufs[22]},
+	{"Alegria", 4300455, &geo_ufs[22]},
+	{"Almirante Tamandaré do Sul", 4300471, &geo_ufs[22]},
+	{"Alpestre", 4300505, &geo_ufs[22]},
+	{"Alto Alegre", 4300554, &geo_ufs[22]},
+	{"Alto Feliz", 4300570, &geo_ufs[22]},
+	{"Alvorada", 4300604, &geo_ufs[22]},
+	{"Amaral Ferrador", 4300638, &geo_ufs[22]},
+	{"Ametista do Sul", 4300646, &geo_ufs[22]},
+	{"André da Rocha", 4300661, &geo_ufs[22]},
+	{"Anta Gorda", 4300703, &geo_ufs[22]},
+	{"Antônio Prado", 4300802, &geo_ufs[22]},
+	{"Arambaré", 4300851, &geo_ufs[22]},
+	{"Araricá", 4300877, &geo_ufs[22]},
+	{"Aratiba", 4300901, &geo_ufs[22]},
+	{"Arroio do Meio", 4301008, &geo_ufs[22]},
+	{"Arroio do Sal", 4301057, &geo_ufs[22]},
+	{"Arroio do Padre", 4301073, &geo_ufs[22]},
+	{"Arroio dos Ratos", 4301107, &geo_ufs[22]},
+	{"Arroio do Tigre", 4301206, &geo_ufs[22]},
+	{"Arroio Grande", 4301305, &geo_ufs[22]},
+	{"Arvorezinha", 4301404, &geo_ufs[22]},
+	{"Augusto Pestana", 4301503, &geo_ufs[22]},
+	{"Áurea", 4301552, &geo_ufs[22]},
+	{"Bagé", 4301602, &geo_ufs[22]},
+	{"Balneário Pinhal", 4301636, &geo_ufs[22]},
+	{"Barão", 4301651, &geo_ufs[22]},
+	{"Barão de Cotegipe", 4301701, &geo_ufs[22]},
+	{"Barão do Triunfo", 4301750, &geo_ufs[22]},
+	{"Barracão", 4301800, &geo_ufs[22]},
+	{"Barra do Guarita", 4301859, &geo_ufs[22]},
+	{"Barra do Quaraí", 4301875, &geo_ufs[22]},
+	{"Barra do Ribeiro", 4301909, &geo_ufs[22]},
+	{"Barra do Rio Azul", 4301925, &geo_ufs[22]},
+	{"Barra Funda", 4301958, &geo_ufs[22]},
+	{"Barros Cassal", 4302006, &geo_ufs[22]},
+	{"Benjamin Constant do Sul", 4302055, &geo_ufs[22]},
+	{"Bento Gonçalves", 4302105, &geo_ufs[22]},
+	{"Boa Vista das Missões", 4302154, &geo_ufs[22]},
+	{"Boa Vista do Buricá", 4302204, &geo_ufs[22]},
+	{"Boa Vista do Cadeado", 4302220, &geo_ufs[22]},
+	{"Boa Vista do Incra", 4302238, &geo_ufs[22]},
+	{"Boa Vista do Sul", 4302253, &geo_ufs[22]},
+	{"Bom Jesus", 4302303, &geo_ufs[22]},
+	{"Bom Princípio", 4302352, &geo_ufs[22]},
+	{"Bom Progresso", 4302378, &geo_ufs[22]},
+	{"Bom Retiro do Sul", 4302402, &geo_ufs[22]},
+	{"Boqueirão do Leão", 4302451, &geo_ufs[22]},
+	{"Bossoroca", 4302501, &geo_ufs[22]},
+	{"Bozano", 4302584, &geo_ufs[22]},
+	{"Braga", 4302600, &geo_ufs[22]},
+	{"Brochier", 4302659, &geo_ufs[22]},
+	{"Butiá", 4302709, &geo_ufs[22]},
+	{"Caçapava do Sul", 4302808, &geo_ufs[22]},
+	{"Cacequi", 4302907, &geo_ufs[22]},
+	{"Cachoeira do Sul", 4303004, &geo_ufs[22]},
+	{"Cachoeirinha", 4303103, &geo_ufs[22]},
+	{"Cacique Doble", 4303202, &geo_ufs[22]},
+	{"Caibaté", 4303301, &geo_ufs[22]},
+	{"Caiçara", 4303400, &geo_ufs[22]},
+	{"Camaquã", 4303509, &geo_ufs[22]},
+	{"Camargo", 4303558, &geo_ufs[22]},
+	{"Cambará do Sul", 4303608, &geo_ufs[22]},
+	{"Campestre da Serra", 4303673, &geo_ufs[22]},
+	{"Campina das Missões", 4303707, &geo_ufs[22]},
+	{"Campinas do Sul", 4303806, &geo_ufs[22]},
+	{"Campo Bom", 4303905, &geo_ufs[22]},
+	{"Campo Novo", 4304002, &geo_ufs[22]},
+	{"Campos Borges", 4304101, &geo_ufs[22]},
+	{"Candelária", 4304200, &geo_ufs[22]},
+	{"Cândido Godói", 4304309, &geo_ufs[22]},
+	{"Candiota", 4304358, &geo_ufs[22]},
+	{"Canela", 4304408, &geo_ufs[22]},
+	{"Canguçu", 4304507, &geo_ufs[22]},
+	{"Canoas", 4304606, &geo_ufs[22]},
+	{"Canudos do Vale", 4304614, &geo_ufs[22]},
+	{"Capão Bonito do Sul", 4304622, &geo_ufs[22]},
+	{"Capão da Canoa", 4304630, &geo_ufs[22]},
+	{"Capão do Cipó", 4304655, &geo_ufs[22]},
+	{"Capão do Leão", 4304663, &geo_ufs[22]},
+	{"Capivari do Sul", 4304671, &geo_ufs[22]},
+	{"Capela de Santana", 4304689, &geo_ufs[22]},
+	{"Capitão", 4304697, &geo_ufs[22]},
+	{"Carazinho", 4304705, &geo_ufs[22]},
+	{"Caraá", 4304713, &geo_ufs[22]},
+	{"Carlos Barbosa", 4304804, &geo_ufs[22]},
+	{"Carlos Gomes", 4304853, &geo_ufs[22]},
+	{"Casca", 4304903, &geo_ufs[22]},
+	{"Caseiros", 4304952, &geo_ufs[22]},
+	{"Catuípe", 4305009, &geo_ufs[22]},
+	{"Caxias do Sul", 4305108, &geo_ufs[22]},
+	{"Centenário", 4305116, &geo_ufs[22]},
+	{"Cerrito", 4305124, &geo_ufs[22]},
+	{"Cerro Branco", 4305132, &geo_ufs[22]},
+	{"Cerro Grande", 4305157, &geo_ufs[22]},
+	{"Cerro Grande do Sul", 4305173, &geo_ufs[22]},
+	{"Cerro Largo", 4305207, &geo_ufs[22]},
+	{"Chapada", 4305306, &geo_ufs[22]},
+	{"Charqueadas", 4305355, &geo_ufs[22]},
+	{"Charrua", 4305371, &geo_ufs[22]},
+	{"Chiapetta", 4305405, &geo_ufs[22]},
+	{"Chuí", 4305439, &geo_ufs[22]},
+	{"Chuvisca", 4305447, &geo_ufs[22]},
+	{"Cidreira", 4305454, &geo_ufs[22]},
+	{"Ciríaco", 4305504, &geo_ufs[22]},
+	{"Colinas", 4305587, &geo_ufs[22]},
+	{"Colorado", 4305603, &geo_ufs[22]},
+	{"Condor", 4305702, &geo_ufs[22]},
+	{"Constantina", 4305801, &geo_ufs[22]},
+	{"Coqueiro Baixo", 4305835, &geo_ufs[22]},
+	{"Coqueiros do Sul", 4305850, &geo_ufs[22]},
+	{"Coronel Barros", 4305871, &geo_ufs[22]},
+	{"Coronel Bicaco", 4305900, &geo_ufs[22]},
+	{"Coronel Pilar", 4305934, &geo_ufs[22]},
+	{"Cotiporã", 4305959, &geo_ufs[22]},
+	{"Coxilha", 4305975, &geo_ufs[22]},
+	{"Crissiumal", 4306007, &geo_ufs[22]},
+	{"Cristal", 4306056, &geo_ufs[22]},
+	{"Cristal do Sul", 4306072, &geo_ufs[22]},
+	{"Cruz Alta", 4306106, &geo_ufs[22]},
+	{"Cruzaltense", 4306130, &geo_ufs[22]},
+	{"Cruzeiro do Sul", 4306205, &geo_ufs[22]},
+	{"David Canabarro", 4306304, &geo_ufs[22]},
+	{"Derrubadas", 4306320, &geo_ufs[22]},
+	{"Dezesseis de Novembro", 4306353, &geo_ufs[22]},
+	{"Dilermando de Aguiar", 4306379, &geo_ufs[22]},
+	{"Dois Irmãos", 4306403, &geo_ufs[22]},
+	{"Dois Irmãos das Missões", 4306429, &geo_ufs[22]},
+	{"Dois Lajeados", 4306452, &geo_ufs[22]},
+	{"Dom Feliciano", 4306502, &geo_ufs[22]},
+	{"Dom Pedro de Alcântara", 4306551, &geo_ufs[22]},
+	{"Dom Pedrito", 4306601, &geo_ufs[22]},
+	{"Dona Francisca", 4306700, &geo_ufs[22]},
+	{"Doutor Maurício Cardoso", 4306734, &geo_ufs[22]},
+	{"Doutor Ricardo", 4306759, &geo_ufs[22]},
+	{"Eldorado do Sul", 4306767, &geo_ufs[22]},
+	{"Encantado", 4306809, &geo_ufs[22]},
+	{"Encruzilhada do Sul", 4306908, &geo_ufs[22]},
+	{"Engenho Velho", 4306924, &geo_ufs[22]},
+	{"Entre-Ijuís", 4306932, &geo_ufs[22]},
+	{"Entre Rios do Sul", 4306957, &geo_ufs[22]},
+	{"Erebango", 4306973, &geo_ufs[22]},
+	{"Erechim", 4307005, &geo_ufs[22]},
+	{"Ernestina", 4307054, &geo_ufs[22]},
+	{"Herval", 4307104, &geo_ufs[22]},
+	{"Erval Grande", 4307203, &geo_ufs[22]},
+	{"Erval Seco", 4307302, &geo_ufs[22]},
+	{"Esmeralda", 4307401, &geo_ufs[22]},
+	{"Esperança do Sul", 4307450, &geo_ufs[22]},
+	{"Espumoso", 4307500, &geo_ufs[22]},
+	{"Estação", 4307559, &geo_ufs[22]},
+	{"Estância Velha", 4307609, &geo_ufs[22]},
+	{"Esteio", 4307708, &geo_ufs[22]},
+	{"Estrela", 4307807, &geo_ufs[22]},
+	{"Estrela Velha", 4307815, &geo_ufs[22]},
+	{"Eugênio de Castro", 4307831, &geo_ufs[22]},
+	{"Fagundes Varela", 4307864, &geo_ufs[22]},
+	{"Farroupilha", 4307906, &geo_ufs[22]},
+	{"Faxinal do Soturno", 4308003, &geo_ufs[22]},
+	{"Faxinalzinho", 4308052, &geo_ufs[22]},
+	{"Fazenda Vilanova", 4308078, &geo_ufs[22]},
+	{"Feliz", 4308102, &geo_ufs[22]},
+	{"Flores da Cunha", 4308201, &geo_ufs[22]},
+	{"Floriano Peixoto", 4308250, &geo_ufs[22]},
+	{"Fontoura Xavier", 4308300, &geo_ufs[22]},
+	{"Formigueiro", 4308409, &geo_ufs[22]},
+	{"Forquetinha", 4308433, &geo_ufs[22]},
+	{"Fortaleza dos Valos", 4308458, &geo_ufs[22]},
+	{"Frederico Westphalen", 4308508, &geo_ufs[22]},
+	{"Garibaldi", 4308607, &geo_ufs[22]},
+	{"Garruchos", 4308656, &geo_ufs[22]},
+	{"Gaurama", 4308706, &geo_ufs[22]},
+	{"General Câmara", 4308805, &geo_ufs[22]},
+	{"Gentil", 4308854, &geo_ufs[22]},
+	{"Getúlio Vargas", 4308904, &geo_ufs[22]},
+	{"Giruá", 4309001, &geo_ufs[22]},
+	{"Glorinha", 4309050, &geo_ufs[22]},
+	{"Gramado", 4309100, &geo_ufs[22]},
+	{"Gramado dos Loureiros", 4309126, &geo_ufs[22]},
+	{"Gramado Xavier", 4309159, &geo_ufs[22]},
+	{"Gravataí", 4309209, &geo_ufs[22]},
+	{"Guabiju", 4309258, &geo_ufs[22]},
+	{"Guaíba", 4309308, &geo_ufs[22]},
+	{"Guaporé", 4309407, &geo_ufs[22]},
+	{"Guarani das Missões", 4309506, &geo_ufs[22]},
+	{"Harmonia", 4309555, &geo_ufs[22]},
+	{"Herveiras", 4309571, &geo_ufs[22]},
+	{"Horizontina", 4309605, &geo_ufs[22]},
+	{"Hulha Negra", 4309654, &geo_ufs[22]},
+	{"Humaitá", 4309704, &geo_ufs[22]},
+	{"Ibarama", 4309753, &geo_ufs[22]},
+	{"Ibiaçá", 4309803, &geo_ufs[22]},
+	{"Ibiraiaras", 4309902, &geo_ufs[22]},
+	{"Ibirapuitã", 4309951, &geo_ufs[22]},
+	{"Ibirubá", 4310009, &geo_ufs[22]},
+	{"Igrejinha", 4310108, &geo_ufs[22]},
+	{"Ijuí", 4310207, &geo_ufs[22]},
+	{"Ilópolis", 4310306, &geo_ufs[22]},
+	{"Imbé", 4310330, &geo_ufs[22]},
+	{"Imigrante", 4310363, &geo_ufs[22]},
+	{"Independência", 4310405, &geo_ufs[22]},
+	{"Inhacorá", 4310413, &geo_ufs[22]},
+	{"Ipê", 4310439, &geo_ufs[22]},
+	{"Ipiranga do Sul", 4310462, &geo_ufs[22]},
+	{"Iraí", 4310504, &geo_ufs[22]},
+	{"Itaara", 4310538, &geo_ufs[22]},
+	{"Itacurubi", 4310553, &geo_ufs[22]},
+	{"Itapuca", 4310579, &geo_ufs[22]},
+	{"Itaqui", 4310603, &geo_ufs[22]},
+	{"Itati", 4310652, &geo_ufs[22]},
+	{"Itatiba do Sul", 4310702, &geo_ufs[22]},
+	{"Ivorá", 4310751, &geo_ufs[22]},
+	{"Ivoti", 4310801, &geo_ufs[22]},
+	{"Jaboticaba", 4310850, &geo_ufs[22]},
+	{"Jacuizinho", 4310876, &geo_ufs[22]},
+	{"Jacutinga", 4310900, &geo_ufs[22]},
+	{"Jaguarão", 4311007, &geo_ufs[22]},
+	{"Jaguari", 4311106, &geo_ufs[22]},
+	{"Jaquirana", 4311122, &geo_ufs[22]},
+	{"Jari", 4311130, &geo_ufs[22]},
+	{"Jóia", 4311155, &geo_ufs[22]},
+	{"Júlio de Castilhos", 4311205, &geo_ufs[22]},
+	{"Lagoa Bonita do Sul", 4311239, &geo_ufs[22]},
+	{"Lagoão", 4311254, &geo_ufs[22]},
+	{"Lagoa dos Três Cantos", 4311270, &geo_ufs[22]},
+	{"Lagoa Vermelha", 4311304, &geo_ufs[22]},
+	{"Lajeado", 4311403, &geo_ufs[22]},
+	{"Lajeado do Bugre", 4311429, &geo_ufs[22]},
+	{"Lavras do Sul", 4311502, &geo_ufs[22]},
+	{"Liberato Salzano", 4311601, &geo_ufs[22]},
+	{"Lindolfo Collor", 4311627, &geo_ufs[22]},
+	{"Linha Nova", 4311643, &geo_ufs[22]},
+	{"Machadinho", 4311700, &geo_ufs[22]},
+	{"Maçambará", 4311718, &geo_ufs[22]},
+	{"Mampituba", 4311734, &geo_ufs[22]},
+	{"Manoel Viana", 4311759, &geo_ufs[22]},
+	{"Maquiné", 4311775, &geo_ufs[22]},
+	{"Maratá", 4311791, &geo_ufs[22]},
+	{"Marau", 4311809, &geo_ufs[22]},
+	{"Marcelino Ramos", 4311908, &geo_ufs[22]},
+	{"Mariana Pimentel", 4311981, &geo_ufs[22]},
+	{"Mariano Moro", 4312005, &geo_ufs[22]},
+	{"Marques de Souza", 4312054, &geo_ufs[22]},
+	{"Mata", 4312104, &geo_ufs[22]},
+	{"Mato Castelhano", 4312138, &geo_ufs[22]},
+	{"Mato Leitão", 4312153, &geo_ufs[22]},
+	{"Mato Queimado", 4312179, &geo_ufs[22]},
+	{"Maximiliano de Almeida", 4312203, &geo_ufs[22]},
+	{"Minas do Leão", 4312252, &geo_ufs[22]},
+	{"Miraguaí", 4312302, &geo_ufs[22]},
+	{"Montauri", 4312351, &geo_ufs[22]},
+	{"Monte Alegre dos Campos", 4312377, &geo_ufs[22]},
+	{"Monte Belo do Sul", 4312385, &geo_ufs[22]},
+	{"Montenegro", 4312401, &geo_ufs[22]},
+	{"Mormaço", 4312427, &geo_ufs[22]},
+	{"Morrinhos do Sul", 4312443, &geo_ufs[22]},
+	{"Morro Redondo", 4312450, &geo_ufs[22]},
+	{"Morro Reuter", 4312476, &geo_ufs[22]},
+	{"Mostardas", 4312500, &geo_ufs[22]},
+	{"Muçum", 4312609, &geo_ufs[22]},
+	{"Muitos Capões", 4312617, &geo_ufs[22]},
+	{"Muliterno", 4312625, &geo_ufs[22]},
+	{"Não-Me-Toque", 4312658, &geo_ufs[22]},
+	{"Nicolau Vergueiro", 4312674, &geo_ufs[22]},
+	{"Nonoai", 4312708, &geo_ufs[22]},
+	{"Nova Alvorada", 4312757, &geo_ufs[22]},
+	{"Nova Araçá", 4312807, &geo_ufs[22]},
+	{"Nova Bassano", 4312906, &geo_ufs[22]},
+	{"Nova Boa Vista", 4312955, &geo_ufs[22]},
+	{"Nova Bréscia", 4313003, &geo_ufs[22]},
+	{"Nova Candelária", 4313011, &geo_ufs[22]},
+	{"Nova Esperança do Sul", 4313037, &geo_ufs[22]},
+	{"Nova Hartz", 4313060, &geo_ufs[22]},
+	{"Nova Pádua", 4313086, &geo_ufs[22]},
+	{"Nova Palma", 4313102, &geo_ufs[22]},
+	{"Nova Petrópolis", 4313201, &geo_ufs[22]},
+	{"Nova Prata", 4313300, &geo_ufs[22]},
+	{"Nova Ramada", 4313334, &geo_ufs[22]},
+	{"Nova Roma do Sul", 4313359, &geo_ufs[22]},
+	{"Nova Santa Rita", 4313375, &geo_ufs[22]},
+	{"Novo Cabrais", 4313391, &geo_ufs[22]},
+	{"Novo Hamburgo", 4313409, &geo_ufs[22]},
+	{"Novo Machado", 4313425, &geo_ufs[22]},
+	{"Novo Tiradentes", 4313441, &geo_ufs[22]},
+	{"Novo Xingu", 4313466, &geo_ufs[22]},
+	{"Novo Barreiro", 4313490, &geo_ufs[22]},
+	{"Osório", 4313508, &geo_ufs[22]},
+	{"Paim Filho", 4313607, &geo_ufs[22]},
+	{"Palmares do Sul", 4313656, &geo_ufs[22]},
+	{"Palmeira das Missões", 4313706, &geo_ufs[22]},
+	{"Palmitinho", 4313805, &geo_ufs[22]},
+	{"Panambi", 4313904, &geo_ufs[22]},
+	{"Pantano Grande", 4313953, &geo_ufs[22]},
+	{"Paraí", 4314001, &geo_ufs[22]},
+	{"Paraíso do Sul", 4314027, &geo_ufs[22]},
+	{"Pareci Novo", 4314035, &geo_ufs[22]},
+	{"Parobé", 4314050, &geo_ufs[22]},
+	{"Passa Sete", 4314068, &geo_ufs[22]},
+	{"Passo do Sobrado", 4314076, &geo_ufs[22]},
+	{"Passo Fundo", 4314100, &geo_ufs[22]},
+	{"Paulo Bento", 4314134, &geo_ufs[22]},
+	{"Paverama", 4314159, &geo_ufs[22]},
+	{"Pedras Altas", 4314175, &geo_ufs[22]},
+	{"Pedro Osório", 4314209, &geo_ufs[22]},
+	{"Pejuçara", 4314308, &geo_ufs[22]},
+	{"Pelotas", 4314407, &geo_ufs[22]},
+	{"Picada Café", 4314423, &geo_ufs[22]},
+	{"Pinhal", 4314456, &geo_ufs[22]},
+	{"Pinhal da Serra", 4314464, &geo_ufs[22]},
+	{"Pinhal Grande", 4314472, &geo_ufs[22]},
+	{"Pinheirinho do Vale", 4314498, &geo_ufs[22]},
+	{"Pinheiro Machado", 4314506, &geo_ufs[22]},
+	{"Pirapó", 4314555, &geo_ufs[22]},
+	{"Piratini", 4314605, &geo_ufs[22]},
+	{"Planalto", 4314704, &geo_ufs[22]},
+	{"Poço das Antas", 4314753, &geo_ufs[22]},
+	{"Pontão", 4314779, &geo_ufs[22]},
+	{"Ponte Preta", 4314787, &geo_ufs[22]},
+	{"Portão", 4314803, &geo_ufs[22]},
+	{"Porto Alegre", 4314902, &geo_ufs[22]},
+	{"Porto Lucena", 4315008, &geo_ufs[22]},
+	{"Porto Mauá", 4315057, &geo_ufs[22]},
+	{"Porto Vera Cruz", 4315073, &geo_ufs[22]},
+	{"Porto Xavier", 4315107, &geo_ufs[22]},
+	{"Pouso Novo", 4315131, &geo_ufs[22]},
+	{"Presidente Lucena", 4315149, &geo_ufs[22]},
+	{"Progresso", 4315156, &geo_ufs[22]},
+	{"Protásio Alves", 4315172, &geo_ufs[22]},
+	{"Putinga", 4315206, &geo_ufs[22]},
+	{"Quaraí", 4315305, &geo_ufs[22]},
+	{"Quatro Irmãos", 4315313, &geo_ufs[22]},
+	{"Quevedos", 4315321, &geo_ufs[22]},
+	{"Quinze de Novembro", 4315354, &geo_ufs[22]},
+	{"Redentora", 4315404, &geo_ufs[22]},
+	{"Relvado", 4315453, &geo_ufs[22]},
+	{"Restinga Seca", 4315503, &geo_ufs[22]},
+	{"Rio dos Índios", 4315552, &geo_ufs[22]},
+	{"Rio Grande", 4315602, &geo_ufs[22]},
+	{"Rio Pardo", 4315701, &geo_ufs[22]},
+	{"Riozinho", 4315750, &geo_ufs[22]},
+	{"Roca Sales", 4315800, &geo_ufs[22]},
+	{"Rodeio Bonito", 4315909, &geo_ufs[22]},
+	{"Rolador", 4315958, &geo_ufs[22]},
+	{"Rolante", 4316006, &geo_ufs[22]},
+	{"Ronda Alta", 4316105, &geo_ufs[22]},
+	{"Rondinha", 4316204, &geo_ufs[22]},
+	{"Roque Gonzales", 4316303, &geo_ufs[22]},
+	{"Rosário do Sul", 4316402, &geo_ufs[22]},
+	{"Sagrada Família", 4316428, &geo_ufs[22]},
+	{"Saldanha Marinho", 4316436, &geo_ufs[22]},
+	{"Salto do Jacuí", 4316451, &geo_ufs[22]},
+	{"Salvador das Missões", 4316477, &geo_ufs[22]},
+	{"Salvador do Sul", 4316501, &geo_ufs[22]},
+	{"Sananduva", 4316600, &geo_ufs[22]},
+	{"Santa Bárbara do Sul", 4316709, &geo_ufs[22]},
+	{"Santa Cecília do Sul", 4316733, &geo_ufs[22]},
+	{"Santa Clara do Sul", 4316758, &geo_ufs[22]},
+	{"Santa Cruz do Sul", 4316808, &geo_ufs[22]},
+	{"Santa Maria", 4316907, &geo_ufs[22]},
+	{"Santa Maria do Herval", 4316956, &geo_ufs[22]},
+	{"Santa Margarida do Sul", 4316972, &geo_ufs[22]},
+	{"Santana da Boa Vista", 4317004, &geo_ufs[22]},
+	{"Sant'Ana do Livramento", 4317103, &geo_ufs[22]},
+	{"Santa Rosa", 4317202, &geo_ufs[22]},
+	{"Santa Tereza", 4317251, &geo_ufs[22]},
+	{"Santa Vitória do Palmar", 4317301, &geo_ufs[22]},
+	{"Santiago", 4317400, &geo_ufs[22]},
+	{"Santo Ângelo", 4317509, &geo_ufs[22]},
+	{"Santo Antônio do Palma", 4317558, &geo_ufs[22]},
+	{"Santo Antônio da Patrulha", 4317608, &geo_ufs[22]},
+	{"Santo Antônio das Missões", 4317707, &geo_ufs[22]},
+	{"Santo Antônio do Planalto", 4317756, &geo_ufs[22]},
+	{"Santo Augusto", 4317806, &geo_ufs[22]},
+	{"Santo Cristo", 4317905, &geo_ufs[22]},
+	{"Santo Expedito do Sul", 4317954, &geo_ufs[22]},
+	{"São Borja", 4318002, &geo_ufs[22]},
+	{"São Domingos do Sul", 4318051, &geo_ufs[22]},
+	{"São Francisco de Assis", 4318101, &geo_ufs[22]},
+	{"São Francisco de Paula", 4318200, &geo_ufs[22]},
+	{"São Gabriel", 4318309, &geo_ufs[22]},
+	{"São Jerônimo", 4318408, &geo_ufs[22]},
+	{"São João da Urtiga", 4318424, &geo_ufs[22]},
+	{"São João do Polêsine", 4318432, &geo_ufs[22]},
+	{"São Jorge", 4318440, &geo_ufs[22]},
+	{"São José das Missões", 4318457, &geo_ufs[22]},
+	{"São José do Herval", 4318465, &geo_ufs[22]},
+	{"São José do Hortêncio", 4318481, &geo_ufs[22]},
+	{"São José do Inhacorá", 4318499, &geo_ufs[22]},
+	{"São José do Norte", 4318507, &geo_ufs[22]},
+	{"São José do Ouro", 4318606, &geo_ufs[22]},
+	{"São José do Sul", 4318614, &geo_ufs[22]},
+	{"São José dos Ausentes", 4318622, &geo_ufs[22]},
+	{"São Leopoldo", 4318705, &geo_ufs[22]},
+	{"São Lourenço do Sul", 4318804, &geo_ufs[22]},
+	{"São Luiz Gonzaga", 4318903, &geo_ufs[22]},
+	{"São Marcos", 4319000, &geo_ufs[22]},
+	{"São Martinho", 4319109, &geo_ufs[22]},
+	{"São Martinho da Serra", 4319125, &geo_ufs[22]},
+	{"São Miguel das Missões", 4319158, &geo_ufs[22]},
+	{"São Nicolau", 4319208, &geo_ufs[22]},
+	{"São Paulo das Missões", 4319307, &geo_ufs[22]},
+	{"São Pedro da Serra", 4319356, &geo_ufs[22]},
+	{"São Pedro das Missões", 4319364, &geo_ufs[22]},
+	{"São Pedro do Butiá", 4319372, &geo_ufs[22]},
+	{"São Pedro do Sul", 4319406, &geo_ufs[22]},
+	{"São Sebastião do Caí", 4319505, &geo_ufs[22]},
+	{"São Sepé", 4319604, &geo_ufs[22]},
+	{"São Valentim", 4319703, &geo_ufs[22]},
+	{"São Valentim do Sul", 4319711, &geo_ufs[22]},
+	{"São Valério do Sul", 4319737, &geo_ufs[22]},
+	{"São Vendelino", 4319752, &geo_ufs[22]},
+	{"São Vicente do Sul", 4319802, &geo_ufs[22]},
+	{"Sapiranga", 4319901, &geo_ufs[22]},
+	{"Sapucaia do Sul", 4320008, &geo_ufs[22]},
+	{"Sarandi", 4320107, &geo_ufs[22]},
+	{"Seberi", 4320206, &geo_ufs[22]},
+	{"Sede Nova", 4320230, &geo_ufs[22]},
+	{"Segredo", 4320263, &geo_ufs[22]},
+	{"Selbach", 4320305, &geo_ufs[22]},
+	{"Senador Salgado Filho", 4320321, &geo_ufs[22]},
+	{"Sentinela do Sul", 4320354, &geo_ufs[22]},
+	{"Serafina Corrêa", 4320404, &geo_ufs[22]},
+	{"Sério", 4320453, &geo_ufs[22]},
+	{"Sertão", 4320503, &geo_ufs[22]},
+	{"Sertão Santana", 4320552, &geo_ufs[22]},
+	{"Sete de Setembro", 4320578, &geo_ufs[22]},
+	{"Severiano de Almeida", 4320602, &geo_ufs[22]},
+	{"Silveira Martins", 4320651, &geo_ufs[22]},
+	{"Sinimbu", 4320677, &geo_ufs[22]},
+	{"Sobradinho", 4320701, &geo_ufs[22]},
+	{"Soledade", 4320800, &geo_ufs[22]},
+	{"Tabaí", 4320859, &geo_ufs[22]},
+	{"Tapejara", 4320909, &geo_ufs[22]},
+	{"Tapera", 4321006, &geo_ufs[22]},
+	{"Tapes", 4321105, &geo_ufs[22]},
+	{"Taquara", 4321204, &geo_ufs[22]},
+	{"Taquari", 4321303, &geo_ufs[22]},
+	{"Taquaruçu do Sul", 4321329, &geo_ufs[22]},
+	{"Tavares", 4321352, &geo_ufs[22]},
+	{"Tenente Portela", 4321402, &geo_ufs[22]},
+	{"Terra de Areia", 4321436, &geo_ufs[22]},
+	{"Teutônia", 4321451, &geo_ufs[22]},
+	{"Tio Hugo", 4321469, &geo_ufs[22]},
+	{"Tiradentes do Sul", 4321477, &geo_ufs[22]},
+	{"Toropi", 4321493, &geo_ufs[22]},
+	{"Torres", 4321501, &geo_ufs[22]},
+	{"Tramandaí", 4321600, &geo_ufs[22]},
+	{"Travesseiro", 4321626, &geo_ufs[22]},
+	{"Três Arroios", 4321634, &geo_ufs[22]},
+	{"Três Cachoeiras", 4321667, &geo_ufs[22]},
+	{"Três Coroas", 4321709, &geo_ufs[22]},
+	{"Três de Maio", 4321808, &geo_ufs[22]},
+	{"Três Forquilhas", 4321832, &geo_ufs[22]},
+	{"Três Palmeiras", 4321857, &geo_ufs[22]},
+	{"Três Passos", 4321907, &geo_ufs[22]},
+	{"Trindade do Sul", 4321956, &geo_ufs[22]},
+	{"Triunfo", 4322004, &geo_ufs[22]},
+	{"Tucunduva", 4322103, &geo_ufs[22]},
+	{"Tunas", 4322152, &geo_ufs[22]},
+	{"Tupanci do Sul", 4322186, &geo_ufs[22]},
+	{"Tupanciretã", 4322202, &geo_ufs[22]},
+	{"Tupandi", 4322251, &geo_ufs[22]},
+	{"Tuparendi", 4322301, &geo_ufs[22]},
+	{"Turuçu", 4322327, &geo_ufs[22]},
+	{"Ubiretama", 4322343, &geo_ufs[22]},
+	{"União da Serra", 4322350, &geo_ufs[22]},
+	{"Unistalda", 4322376, &geo_ufs[22]},
+	{"Uruguaiana", 4322400, &geo_ufs[22]},
+	{"Vacaria", 4322509, &geo_ufs[22]},
+	{"Vale Verde", 4322525, &geo_ufs[22]},
+	{"Vale do Sol", 4322533, &geo_ufs[22]},
+	{"Vale Real", 4322541, &geo_ufs[22]},
+	{"Vanini", 4322558, &geo_ufs[22]},
+	{"Venâncio Aires", 4322608, &geo_ufs[22]},
+	{"Vera Cruz", 4322707, &geo_ufs[22]},
+	{"Veranópolis", 4322806, &geo_ufs[22]},
+	{"Vespasiano Correa", 4322855, &geo_ufs[22]},
+	{"Viadutos", 4322905, &geo_ufs[22]},
+	{"Viamão", 4323002, &geo_ufs[22]},
+	{"Vicente Dutra", 4323101, &geo_ufs[22]},
+	{"Victor Graeff", 4323200, &geo_ufs[22]},
+	{"Vila Flores", 4323309, &geo_ufs[22]},
+	{"Vila Lângaro", 4323358, &geo_ufs[22]},
+	{"Vila Maria", 4323408, &geo_ufs[22]},
+	{"Vila Nova do Sul", 4323457, &geo_ufs[22]},
+	{"Vista Alegre", 4323507, &geo_ufs[22]},
+	{"Vista Alegre do Prata", 4323606, &geo_ufs[22]},
+	{"Vista Gaúcha", 4323705, &geo_ufs[22]},
+	{"Vitória das Missões", 4323754, &geo_ufs[22]},
+	{"Westfalia", 4323770, &geo_ufs[22]},
+	{"Xangri-lá", 4323804, &geo_ufs[22]},
+	{"Água Clara", 5000203, &geo_ufs[23]},
+	{"Alcinópolis", 5000252, &geo_ufs[23]},
+	{"Amambai", 5000609, &geo_ufs[23]},
+	{"Anastácio", 5000708, &geo_ufs[23]},
+	{"Anaurilândia", 5000807, &geo_ufs[23]},
+	{"Angélica", 5000856, &geo_ufs[23]},
+	{"Antônio João", 5000906, &geo_ufs[23]},
+	{"Aparecida do Taboado", 5001003, &geo_ufs[23]},
+	{"Aquidauana", 5001102, &geo_ufs[23]},
+	{"Aral Moreira", 5001243, &geo_ufs[23]},
+	{"Bandeirantes", 5001508, &geo_ufs[23]},
+	{"Bataguassu", 5001904, &geo_ufs[23]},
+	{"Batayporã", 5002001, &geo_ufs[23]},
+	{"Bela Vista", 5002100, &geo_ufs[23]},
+	{"Bodoquena", 5002159, &geo_ufs[23]},
+	{"Bonito", 5002209, &geo_ufs[23]},
+	{"Brasilândia", 5002308, &geo_ufs[23]},
+	{"Caarapó", 5002407, &geo_ufs[23]},
+	{"Camapuã", 5002605, &geo_ufs[23]},
+	{"Campo Grande", 5002704, &geo_ufs[23]},
+	{"Caracol", 5002803, &geo_ufs[23]},
+	{"Cassilândia", 5002902, &geo_ufs[23]},
+	{"Chapadão do Sul", 5002951, &geo_ufs[23]},
+	{"Corguinho", 5003108, &geo_ufs[23]},
+	{"Coronel Sapucaia", 5003157, &geo_ufs[23]},
+	{"Corumbá", 5003207, &geo_ufs[23]},
+	{"Costa Rica", 5003256, &geo_ufs[23]},
+	{"Coxim", 5003306, &geo_ufs[23]},
+	{"Deodápolis", 5003454, &geo_ufs[23]},
+	{"Dois Irmãos do Buriti", 5003488, &geo_ufs[23]},
+	{"Douradina", 5003504, &geo_ufs[23]},
+	{"Dourados", 5003702, &geo_ufs[23]},
+	{"Eldorado", 5003751, &geo_ufs[23]},
+	{"Fátima do Sul", 5003801, &geo_ufs[23]},
+	{"Figueirão", 5003900, &geo_ufs[23]},
+	{"Glória de Dourados", 5004007, &geo_ufs[23]},
+	{"Guia Lopes da Laguna", 5004106, &geo_ufs[23]},
+	{"Iguatemi", 5004304, &geo_ufs[23]},
+	{"Inocência", 5004403, &geo_ufs[23]},
+	{"Itaporã", 5004502, &geo_ufs[23]},
+	{"Itaquiraí", 5004601, &geo_ufs[23]},
+	{"Ivinhema", 5004700, &geo_ufs[23]},
+	{"Japorã", 5004809, &geo_ufs[23]},
+	{"Jaraguari", 5004908, &geo_ufs[23]},
+	{"Jardim", 5005004, &geo_ufs[23]},
+	{"Jateí", 5005103, &geo_ufs[23]},
+	{"Juti", 5005152, &geo_ufs[23]},
+	{"Ladário", 5005202, &geo_ufs[23]},
+	{"Laguna Carapã", 5005251, &geo_ufs[23]},
+	{"Maracaju", 5005400, &geo_ufs[23]},
+	{"Miranda", 5005608, &geo_ufs[23]},
+	{"Mundo Novo", 5005681, &geo_ufs[23]},
+	{"Naviraí", 5005707, &geo_ufs[23]},
+	{"Nioaque", 5005806, &geo_ufs[23]},
+	{"Nova Alvorada do Sul", 5006002, &geo_ufs[23]},
+	{"Nova Andradina", 5006200, &geo_ufs[23]},
+	{"Novo Horizonte do Sul", 5006259, &geo_ufs[23]},
+	{"Paranaíba", 5006309, &geo_ufs[23]},
+	{"Paranhos", 5006358, &geo_ufs[23]},
+	{"Pedro Gomes", 5006408, &geo_ufs[23]},
+	{"Ponta Porã", 5006606, &geo_ufs[23]},
+	{"Porto Murtinho", 5006903, &geo_ufs[23]},
+	{"Ribas do Rio Pardo", 5007109, &geo_ufs[23]},
+	{"Rio Brilhante", 5007208, &geo_ufs[23]},
+	{"Rio Negro", 5007307, &geo_ufs[23]},
+	{"Rio Verde de Mato Grosso", 5007406, &geo_ufs[23]},
+	{"Rochedo", 5007505, &geo_ufs[23]},
+	{"Santa Rita do Pardo", 5007554, &geo_ufs[23]},
+	{"São Gabriel do Oeste", 5007695, &geo_ufs[23]},
+	{"Sete Quedas", 5007703, &geo_ufs[23]},
+	{"Selvíria", 5007802, &geo_ufs[23]},
+	{"Sidrolândia", 5007901, &geo_ufs[23]},
+	{"Sonora", 5007935, &geo_ufs[23]},
+	{"Tacuru", 5007950, &geo_ufs[23]},
+	{"Taquarussu", 5007976, &geo_ufs[23]},
+	{"Terenos", 5008008, &geo_ufs[23]},
+	{"Três Lagoas", 5008305, &geo_ufs[23]},
+	{"Vicentina", 5008404, &geo_ufs[23]},
+	{"Acorizal", 5100102, &geo_ufs[24]},
+	{"Água Boa", 5100201, &geo_ufs[24]},
+	{"Alta Floresta", 5100250, &geo_ufs[24]},
+	{"Alto Araguaia", 5100300, &geo_ufs[24]},
+	{"Alto Boa Vista", 5100359, &geo_ufs[24]},
+	{"Alto Garças", 5100409, &geo_ufs[24]},
+	{"Alto Paraguai", 5100508, &geo_ufs[24]},
+	{"Alto Taquari", 5100607, &geo_ufs[24]},
+	{"Apiacás", 5100805, &geo_ufs[24]},
+	{"Araguaiana", 5101001, &geo_ufs[24]},
+	{"Araguainha", 5101209, &geo_ufs[24]},
+	{"Araputanga", 5101258, &geo_ufs[24]},
+	{"Arenápolis", 5101308, &geo_ufs[24]},
+	{"Aripuanã", 5101407, &geo_ufs[24]},
+	{"Barão de Melgaço", 5101605, &geo_ufs[24]},
+	{"Barra do Bugres", 5101704, &geo_ufs[24]},
+	{"Barra do Garças", 5101803, &geo_ufs[24]},
+	{"Bom Jesus do Araguaia", 5101852, &geo_ufs[24]},
+	{"Brasnorte", 5101902, &geo_ufs[24]},
+	{"Cáceres", 5102504, &geo_ufs[24]},
+	{"Campinápolis", 5102603, &geo_ufs[24]},
+	{"Campo Novo do Parecis", 5102637, &geo_ufs[24]},
+	{"Campo Verde", 5102678, &geo_ufs[24]},
+	{"Campos de Júlio", 5102686, &geo_ufs[24]},
+	{"Canabrava do Norte", 5102694, &geo_ufs[24]},
+	{"Canarana", 5102702, &geo_ufs[24]},
+	{"Carlinda", 5102793, &geo_ufs[24]},
+	{"Castanheira", 5102850, &geo_ufs[24]},
+	{"Chapada dos Guimarães", 5103007, &geo_ufs[24]},
+	{"Cláudia", 5103056, &geo_ufs[24]},
+	{"Cocalinho", 5103106, &geo_ufs[24]},
+	{"Colíder", 5103205, &geo_ufs[24]},
+	{"Colniza", 5103254, &geo_ufs[24]},
+	{"Comodoro", 5103304, &geo_ufs[24]},
+	{"Confresa", 5103353, &geo_ufs[24]},
+	{"Conquista D'Oeste", 5103361, &geo_ufs[24]},
+	{"Cotriguaçu", 5103379, &geo_ufs[24]},
+	{"Cuiabá", 5103403, &geo_ufs[24]},
+	{"Curvelândia", 5103437, &geo_ufs[24]},
+	{"Denise", 5103452, &geo_ufs[24]},
+	{"Diamantino", 5103502, &geo_ufs[24]},
+	{"Dom Aquino", 5103601, &geo_ufs[24]},
+	{"Feliz Natal", 5103700, &geo_ufs[24]},
+	{"Figueirópolis D'Oeste", 5103809, &geo_ufs[24]},
+	{"Gaúcha do Norte", 5103858, &geo_ufs[24]},
+	{"General Carneiro", 5103908, &geo_ufs[24]},
+	{"Glória D'Oeste", 5103957, &geo_ufs[24]},
+	{"Guarantã do Norte", 5104104, &geo_ufs[24]},
+	{"Guiratinga", 5104203, &geo_ufs[24]},
+	{"Indiavaí", 5104500, &geo_ufs[24]},
+	{"Ipiranga do Norte", 5104526, &geo_ufs[24]},
+	{"Itanhangá", 5104542, &geo_ufs[24]},
+	{"Itaúba", 5104559, &geo_ufs[24]},
+	{"Itiquira", 5104609, &geo_ufs[24]},
+	{"Jaciara", 5104807, &geo_ufs[24]},
+	{"Jangada", 5104906, &geo_ufs[24]},
+	{"Jauru", 5105002, &geo_ufs[24]},
+	{"Juara", 5105101, &geo_ufs[24]},
+	{"Juína", 5105150, &geo_ufs[24]},
+	{"Juruena", 5105176, &geo_ufs[24]},
+	{"Juscimeira", 5105200, &geo_ufs[24]},
+	{"Lambari D'Oeste", 5105234, &geo_ufs[24]},
+	{"Lucas do Rio Verde", 5105259, &geo_ufs[24]},
+	{"Luciara", 5105309, &geo_ufs[24]},
+	{"Vila Bela da Santíssima Trindade", 5105507, &geo_ufs[24]},
+	{"Marcelândia", 5105580, &geo_ufs[24]},
+	{"Matupá", 5105606, &geo_ufs[24]},
+	{"Mirassol d'Oeste", 5105622, &geo_ufs[24]},
+	{"Nobres", 5105903, &geo_ufs[24]},
+	{"Nortelândia", 5106000, &geo_ufs[24]},
+	{"Nossa Senhora do Livramento", 5106109, &geo_ufs[24]},
+	{"Nova Bandeirantes", 5106158, &geo_ufs[24]},
+	{"Nova Nazaré", 5106174, &geo_ufs[24]},
+	{"Nova Lacerda", 5106182, &geo_ufs[24]},
+	{"Nova Santa Helena", 5106190, &geo_ufs[24]},
+	{"Nova Brasilândia", 5106208, &geo_ufs[24]},
+	{"Nova Canaã do Norte", 5106216, &geo_ufs[24]},
+	{"Nova Mutum", 5106224, &geo_ufs[24]},
+	{"Nova Olímpia", 5106232, &geo_ufs[24]},
+	{"Nova Ubiratã", 5106240, &geo_ufs[24]},
+	{"Nova Xavantina", 5106257, &geo_ufs[24]},
+	{"Novo Mundo", 5106265, &geo_ufs[24]},
+	{"Novo Horizonte do Norte", 5106273, &geo_ufs[24]},
+	{"Novo São Joaquim", 5106281, &geo_ufs[24]},
+	{"Paranaíta", 5106299, &geo_ufs[24]},
+	{"Paranatinga", 5106307, &geo_ufs[24]},
+	{"Novo Santo Antônio", 5106315, &geo_ufs[24]},
+	{"Pedra Preta", 5106372, &geo_ufs[24]},
+	{"Peixoto de Azevedo", 5106422, &geo_ufs[24]},
+	{"Planalto da Serra", 5106455, &geo_ufs[24]},
+	{"Poconé", 5106505, &geo_ufs[24]},
+	{"Pontal do Araguaia", 5106653, &geo_ufs[24]},
+	{"Ponte Branca", 5106703, &geo_ufs[24]},
+	{"Pontes e Lacerda", 5106752, &geo_ufs[24]},
+	{"Porto Alegre do Norte", 5106778, &geo_ufs[24]},
+	{"Porto dos Gaúchos", 5106802, &geo_ufs[24]},
+	{"Porto Esperidião", 5106828, &geo_ufs[24]},
+	{"Porto Estrela", 5106851, &geo_ufs[24]},
+	{"Poxoréo", 5107008, &geo_ufs[24]},
+	{"Primavera do Leste", 5107040, &geo_ufs[24]},
+	{"Querência", 5107065, &geo_ufs[24]},
+	{"São José dos Quatro Marcos", 5107107, &geo_ufs[24]},
+	{"Reserva do Cabaçal", 5107156, &geo_ufs[24]},
+	{"Ribeirão Cascalheira", 5107180, &geo_ufs[24]},
+	{"Ribeirãozinho", 5107198, &geo_ufs[24]},
+	{"Rio Branco", 5107206, &geo_ufs[24]},
+	{"Santa Carmem", 5107248, &geo_ufs[24]},
+	{"Santo Afonso", 5107263, &geo_ufs[24]},
+	{"São José do Povo", 5107297, &geo_ufs[24]},
+	{"São José do Rio Claro", 5107305, &geo_ufs[24]},
+	{"São José do Xingu", 5107354, &geo_ufs[24]},
+	{"São Pedro da Cipa", 5107404, &geo_ufs[24]},
+	{"Rondolândia", 5107578, &geo_ufs[24]},
+	{"Rondonópolis", 5107602, &geo_ufs[24]},
+	{"Rosário Oeste", 5107701, &geo_ufs[24]},
+	{"Santa Cruz do Xingu", 5107743, &geo_ufs[24]},
+	{"Salto do Céu", 5107750, &geo_ufs[24]},
+	{"Santa Rita do Trivelato", 5107768, &geo_ufs[24]},
+	{"Santa Terezinha", 5107776, &geo_ufs[24]},
+	{"Santo Antônio do Leste", 5107792, &geo_ufs[24]},
+	{"Santo Antônio do Leverger", 5107800, &geo_ufs[24]},
+	{"São Félix do Araguaia", 5107859, &geo_ufs[24]},
+	{"Sapezal", 5107875, &geo_ufs[24]},
+	{"Serra Nova Dourada", 5107883, &geo_ufs[24]},
+	{"Sinop", 5107909, &geo_ufs[24]},
+	{"Sorriso", 5107925, &geo_ufs[24]},
+	{"Tabaporã", 5107941, &geo_ufs[24]},
+	{"Tangará da Serra", 5107958, &geo_ufs[24]},
+	{"Tapurah", 5108006, &geo_ufs[24]},
+	{"Terra Nova do Norte", 5108055, &geo_ufs[24]},
+	{"Tesouro", 5108105, &geo_ufs[24]},
+	{"Torixoréu", 5108204, &geo_ufs[24]},
+	{"União do Sul", 5108303, &geo_ufs[24]},
+	{"Vale de São Domingos", 5108352, &geo_ufs[24]},
+	{"Várzea Grande", 5108402, &geo_ufs[24]},
+	{"Vera", 5108501, &geo_ufs[24]},
+	{"Vila Rica", 5108600, &geo_ufs[24]},
+	{"Nova Guarita", 5108808, &geo_ufs[24]},
+	{"Nova Marilândia", 5108857, &geo_ufs[24]},
+	{"Nova Maringá", 5108907, &geo_ufs[24]},
+	{"Nova Monte Verde", 5108956, &geo_ufs[24]},
+	{"Abadia de Goiás", 5200050, &geo_ufs[25]},
+	{"Abadiânia", 5200100, &geo_ufs[25]},
+	{"Acreúna", 5200134, &geo_ufs[25]},
+	{"Adelândia", 5200159, &geo_ufs[25]},
+	{"Água Fria de Goiás", 5200175, &geo_ufs[25]},
+	{"Água Limpa", 5200209, &geo_ufs[25]},
+	{"Águas Lindas de Goiás", 5200258, &geo_ufs[25]},
+	{"Alexânia", 5200308, &geo_ufs[25]},
+	{"Aloândia", 5200506, &geo_ufs[25]},
+	{"Alto Horizonte", 5200555, &geo_ufs[25]},
+	{"Alto Paraíso de Goiás", 5200605, &geo_ufs[25]},
+	{"Alvorada do Norte", 5200803, &geo_ufs[25]},
+	{"Amaralina", 5200829, &geo_ufs[25]},
+	{"Americano do Brasil", 5200852, &geo_ufs[25]},
+	{"Amorinópolis", 5200902, &geo_ufs[25]},
+	{"Anápolis", 5201108, &geo_ufs[25]},
+	{"Anhanguera", 5201207, &geo_ufs[25]},
+	{"Anicuns", 5201306, &geo_ufs[25]},
+	{"Aparecida de Goiânia", 5201405, &geo_ufs[25]},
+	{"Aparecida do Rio Doce", 5201454, &geo_ufs[25]},
+	{"Aporé", 5201504, &geo_ufs[25]},
+	{"Araçu", 5201603, &geo_ufs[25]},
+	{"Aragarças", 5201702, &geo_ufs[25]},
+	{"Aragoiânia", 5201801, &geo_ufs[25]},
+	{"Araguapaz", 5202155, &geo_ufs[25]},
+	{"Arenópolis", 5202353, &geo_ufs[25]},
+	{"Aruanã", 5202502, &geo_ufs[25]},
+	{"Aurilândia", 5202601, &geo_ufs[25]},
+	{"Avelinópolis", 5202809, &geo_ufs[25]},
+	{"Baliza", 5203104, &geo_ufs[25]},
+	{"Barro Alto", 5203203, &geo_ufs[25]},
+	{"Bela Vista de Goiás", 5203302, &geo_ufs[25]},
+	{"Bom Jardim de Goiás", 5203401, &geo_ufs[25]},
+	{"Bom Jesus de Goiás", 5203500, &geo_ufs[25]},
+	{"Bonfinópolis", 5203559, &geo_ufs[25]},
+	{"Bonópolis", 5203575, &geo_ufs[25]},
+	{"Brazabrantes", 5203609, &geo_ufs[25]},
+	{"Britânia", 5203807, &geo_ufs[25]},
+	{"Buriti Alegre", 5203906, &geo_ufs[25]},
+	{"Buriti de Goiás", 5203939, &geo_ufs[25]},
+	{"Buritinópolis", 5203962, &geo_ufs[25]},
+	{"Cabeceiras", 5204003, &geo_ufs[25]},
+	{"Cachoeira Alta", 5204102, &geo_ufs[25]},
+	{"Cachoeira de Goiás", 5204201, &geo_ufs[25]},
+	{"Cachoeira Dourada", 5204250, &geo_ufs[25]},
+	{"Caçu", 5204300, &geo_ufs[25]},
+	{"Caiapônia", 5204409, &geo_ufs[25]},
+	{"Caldas Novas", 5204508, &geo_ufs[25]},
+	{"Caldazinha", 5204557, &geo_ufs[25]},
+	{"Campestre de Goiás", 5204607, &geo_ufs[25]},
+	{"Campinaçu", 5204656, &geo_ufs[25]},
+	{"Campinorte", 5204706, &geo_ufs[25]},
+	{"Campo Alegre de Goiás", 5204805, &geo_ufs[25]},
+	{"Campo Limpo de Goiás", 5204854, &geo_ufs[25]},
+	{"Campos Belos", 5204904, &geo_ufs[25]},
+	{"Campos Verdes", 5204953, &geo_ufs[25]},
+	{"Carmo do Rio Verde", 5205000, &geo_ufs[25]},
+	{"Castelândia", 5205059, &geo_ufs[25]},
+	{"Catalão", 5205109, &geo_ufs[25]},
+	{"Caturaí", 5205208, &geo_ufs[25]},
+	{"Cavalcante", 5205307, &geo_ufs[25]},
+	{"Ceres", 5205406, &geo_ufs[25]},
+	{"Cezarina", 5205455, &geo_ufs[25]},
+	{"Chapadão do Céu", 5205471, &geo_ufs[25]},
+	{"Cidade Ocidental", 5205497, &geo_ufs[25]},
+	{"Cocalzinho de Goiás", 5205513, &geo_ufs[25]},
+	{"Colinas do Sul", 5205521, &geo_ufs[25]},
+	{"Córrego do Ouro", 5205703, &geo_ufs[25]},
+	{"Corumbá de Goiás", 5205802, &geo_ufs[25]},
+	{"Corumbaíba", 5205901, &geo_ufs[25]},
+	{"Cristalina", 5206206, &geo_ufs[25]},
+	{"Cristianópolis", 5206305, &geo_ufs[25]},
+	{"Crixás", 5206404, &geo_ufs[25]},
+	{"Cromínia", 5206503, &geo_ufs[25]},
+	{"Cumari", 5206602, &geo_ufs[25]},
+	{"Damianópolis", 5206701, &geo_ufs[25]},
+	{"Damolândia", 5206800, &geo_ufs[25]},
+	{"Davinópolis", 5206909, &geo_ufs[25]},
+	{"Diorama", 5207105, &geo_ufs[25]},
+	{"Doverlândia", 5207253, &geo_ufs[25]},
+	{"Edealina", 5207352, &geo_ufs[25]},
+	{"Edéia", 5207402, &geo_ufs[25]},
+	{"Estrela do Norte", 5207501, &geo_ufs[25]},
+	{"Faina", 5207535, &geo_ufs[25]},
+	{"Fazenda Nova", 5207600, &geo_ufs[25]},
+	{"Firminópolis", 5207808, &geo_ufs[25]},
+	{"Flores de Goiás", 5207907, &geo_ufs[25]},
+	{"Formosa", 5208004, &geo_ufs[25]},
+	{"Formoso", 5208103, &geo_ufs[25]},
+	{"Gameleira de Goiás", 5208152, &geo_ufs[25]},
+	{"Divinópolis de Goiás", 5208301, &geo_ufs[25]},
+	{"Goianápolis", 5208400, &geo_ufs[25]},
+	{"Goiandira", 5208509, &geo_ufs[25]},
+	{"Goianésia", 5208608, &geo_ufs[25]},
+	{"Goiânia", 5208707, &geo_ufs[25]},
+	{"Goianira", 5208806, &geo_ufs[25]},
+	{"Goiás", 5208905, &geo_ufs[25]},
+	{"Goiatuba", 5209101, &geo_ufs[25]},
+	{"Gouvelândia", 5209150, &geo_ufs[25]},
+	{"Guapó", 5209200, &geo_ufs[25]},
+	{"Guaraíta", 5209291, &geo_ufs[25]},
+	{"Guarani de Goiás", 5209408, &geo_ufs[25]},
+	{"Guarinos", 5209457, &geo_ufs[25]},
+	{"Heitoraí", 5209606, &geo_ufs[25]},
+	{"Hidrolândia", 5209705, &geo_ufs[25]},
+	{"Hidrolina", 5209804, &geo_ufs[25]},
+	{"Iaciara", 5209903, &geo_ufs[25]},
+	{"Inaciolândia", 5209937, &geo_ufs[25]},
+	{"Indiara", 5209952, &geo_ufs[25]},
+	{"Inhumas", 5210000, &geo_ufs[25]},
+	{"Ipameri", 5210109, &geo_ufs[25]},
+	{"Ipiranga de Goiás", 5210158, &geo_ufs[25]},
+	{"Iporá", 5210208, &geo_ufs[25]},
+	{"Israelândia", 5210307, &geo_ufs[25]},
+	{"Itaberaí", 5210406, &geo_ufs[25]},
+	{"Itaguari", 5210562, &geo_ufs[25]},
+	{"Itaguaru", 5210604, &geo_ufs[25]},
+	{"Itajá", 5210802, &geo_ufs[25]},
+	{"Itapaci", 5210901, &geo_ufs[25]},
+	{"Itapirapuã", 5211008, &geo_ufs[25]},
+	{"Itapuranga", 5211206, &geo_ufs[25]},
+	{"Itarumã", 5211305, &geo_ufs[25]},
+	{"Itauçu", 5211404, &geo_ufs[25]},
+	{"Itumbiara", 5211503, &geo_ufs[25]},
+	{"Ivolândia", 5211602, &geo_ufs[25]},
+	{"Jandaia", 5211701, &geo_ufs[25]},
+	{"Jaraguá", 5211800, &geo_ufs[25]},
+	{"Jataí", 5211909, &geo_ufs[25]},
+	{"Jaupaci", 5212006, &geo_ufs[25]},
+	{"Jesúpolis", 5212055, &geo_ufs[25]},
+	{"Joviânia", 5212105, &geo_ufs[25]},
+	{"Jussara", 5212204, &geo_ufs[25]},
+	{"Lagoa Santa", 5212253, &geo_ufs[25]},
+	{"Leopoldo de Bulhões", 5212303, &geo_ufs[25]},
+	{"Luziânia", 5212501, &geo_ufs[25]},
+	{"Mairipotaba", 5212600, &geo_ufs[25]},
+	{"Mambaí", 5212709, &geo_ufs[25]},
+	{"Mara Rosa", 5212808, &geo_ufs[25]},
+	{"Marzagão", 5212907, &geo_ufs[25]},
+	{"Matrinchã", 5212956, &geo_ufs[25]},
+	{"Maurilândia", 5213004, &geo_ufs[25]},
+	{"Mimoso de Goiás", 5213053, &geo_ufs[25]},
+	{"Minaçu", 5213087, &geo_ufs[25]},
+	{"Mineiros", 5213103, &geo_ufs[25]},
+	{"Moiporá", 5213400, &geo_ufs[25]},
+	{"Monte Alegre de Goiás", 5213509, &geo_ufs[25]},
+	{"Montes Claros de Goiás", 5213707, &geo_ufs[25]},
+	{"Montividiu", 5213756, &geo_ufs[25]},
+	{"Montividiu do Norte", 5213772, &geo_ufs[25]},
+	{"Morrinhos", 5213806, &geo_ufs[25]},
+	{"Morro Agudo de Goiás", 5213855, &geo_ufs[25]},
+	{"Mossâmedes", 5213905, &geo_ufs[25]},
+	{"Mozarlândia", 5214002, &geo_ufs[25]},
+	{"Mundo Novo", 5214051, &geo_ufs[25]},
+	{"Mutunópolis", 5214101, &geo_ufs[25]},
+	{"Nazário", 5214408, &geo_ufs[25]},
+	{"Nerópolis", 5214507, &geo_ufs[25]},
+	{"Niquelândia", 5214606, &geo_ufs[25]},
+	{"Nova América", 5214705, &geo_ufs[25]},
+	{"Nova Aurora", 5214804, &geo_ufs[25]},
+	{"Nova Crixás", 5214838, &geo_ufs[25]},
+	{"Nova Glória", 5214861, &geo_ufs[25]},
+	{"Nova Iguaçu de Goiás", 5214879, &geo_ufs[25]},
+	{"Nova Roma", 5214903, &geo_ufs[25]},
+	{"Nova Veneza", 5215009, &geo_ufs[25]},
+	{"Novo Brasil", 5215207, &geo_ufs[25]},
+	{"Novo Gama", 5215231, &geo_ufs[25]},
+	{"Novo Planalto", 5215256, &geo_ufs[25]},
+	{"Orizona", 5215306, &geo_ufs[25]},
+	{"Ouro Verde de Goiás", 5215405, &geo_ufs[25]},
+	{"Ouvidor", 5215504, &geo_ufs[25]},
+	{"Padre Bernardo", 5215603, &geo_ufs[25]},
+	{"Palestina de Goiás", 5215652, &geo_ufs[25]},
+	{"Palmeiras de Goiás", 5215702, &geo_ufs[25]},
+	{"Palmelo", 5215801, &geo_ufs[25]},
+	{"Palminópolis", 5215900, &geo_ufs[25]},
+	{"Panamá", 5216007, &geo_ufs[25]},
+	{"Paranaiguara", 5216304, &geo_ufs[25]},
+	{"Paraúna", 5216403, &geo_ufs[25]},
+	{"Perolândia", 5216452, &geo_ufs[25]},
+	{"Petrolina de Goiás", 5216809, &geo_ufs[25]},
+	{"Pilar de Goiás", 5216908, &geo_ufs[25]},
+	{"Piracanjuba", 5217104, &geo_ufs[25]},
+	{"Piranhas", 5217203, &geo_ufs[25]},
+	{"Pirenópolis", 5217302, &geo_ufs[25]},
+	{"Pires do Rio", 5217401, &geo_ufs[25]},
+	{"Planaltina", 5217609, &geo_ufs[25]},
+	{"Pontalina", 5217708, &geo_ufs[25]},
+	{"Porangatu", 5218003, &geo_ufs[25]},
+	{"Porteirão", 5218052, &geo_ufs[25]},
+	{"Portelândia", 5218102, &geo_ufs[25]},
+	{"Posse", 5218300, &geo_ufs[25]},
+	{"Professor Jamil", 5218391, &geo_ufs[25]},
+	{"Quirinópolis", 5218508, &geo_ufs[25]},
+	{"Rialma", 5218607, &geo_ufs[25]},
+	{"Rianápolis", 5218706, &geo_ufs[25]},
+	{"Rio Quente", 5218789, &geo_ufs[25]},
+	{"Rio Verde", 5218805, &geo_ufs[25]},
+	{"Rubiataba", 5218904, &geo_ufs[25]},
+	{"Sanclerlândia", 5219001, &geo_ufs[25]},
+	{"Santa Bárbara de Goiás", 5219100, &geo_ufs[25]},
+	{"Santa Cruz de Goiás", 5219209, &geo_ufs[25]},
+	{"Santa Fé de Goiás", 5219258, &geo_ufs[25]},
+	{"Santa Helena de Goiás", 5219308, &geo_ufs[25]},
+	{"Santa Isabel", 5219357, &geo_ufs[25]},
+	{"Santa Rita do Araguaia", 5219407, &geo_ufs[25]},
+	{"Santa Rita do Novo Destino", 5219456, &geo_ufs[25]},
+	{"Santa Rosa de Goiás", 5219506, &geo_ufs[25]},
+	{"Santa Tereza de Goiás", 5219605, &geo_ufs[25]},
+	{"Santa Terezinha de Goiás", 5219704, &geo_ufs[25]},
+	{"Santo Antônio da Barra", 5219712, &geo_ufs[25]},
+	{"Santo Antônio de Goiás", 5219738, &geo_ufs[25]},
+	{"Santo Antônio do Descoberto", 5219753, &geo_ufs[25]},
+	{"São Domingos", 5219803, &geo_ufs[25]},
+	{"São Francisco de Goiás", 5219902, &geo_ufs[25]},
+	{"São João d'Aliança", 5220009, &geo_ufs[25]},
+	{"São João da Paraúna", 5220058, &geo_ufs[25]},
+	{"São Luís de Montes Belos", 5220108, &geo_ufs[25]},
+	{"São Luíz do Norte", 5220157, &geo_ufs[25]},
+	{"São Miguel do Araguaia", 5220207, &geo_ufs[25]},
+	{"São Miguel do Passa Quatro", 5220264, &geo_ufs[25]},
+	{"São Patrício", 5220280, &geo_ufs[25]},
+	{"São Simão", 5220405, &geo_ufs[25]},
+	{"Senador Canedo", 5220454, &geo_ufs[25]},
+	{"Serranópolis", 5220504, &geo_ufs[25]},
+	{"Silvânia", 5220603, &geo_ufs[25]},
+	{"Simolândia", 5220686, &geo_ufs[25]},
+	{"Sítio d'Abadia", 5220702, &geo_ufs[25]},
+	{"Taquaral de Goiás", 5221007, &geo_ufs[25]},
+	{"Teresina de Goiás", 5221080, &geo_ufs[25]},
+	{"Terezópolis de Goiás", 5221197, &geo_ufs[25]},
+	{"Três Ranchos", 5221304, &geo_ufs[25]},
+	{"Trindade", 5221403, &geo_ufs[25]},
+	{"Trombas", 5221452, &geo_ufs[25]},
+	{"Turvânia", 5221502, &geo_ufs[25]},
+	{"Turvelândia", 5221551, &geo_ufs[25]},
+	{"Uirapuru", 5221577, &geo_ufs[25]},
+	{"Uruaçu", 5221601, &geo_ufs[25]},
+	{"Uruana", 5221700, &geo_ufs[25]},
+	{"Urutaí", 5221809, &geo_ufs[25]},
+	{"Valparaíso de Goiás", 5221858, &geo_ufs[25]},
+	{"Varjão", 5221908, &geo_ufs[25]},
+	{"Vianópolis", 5222005, &geo_ufs[25]},
+	{"Vicentinópolis", 5222054, &geo_ufs[25]},
+	{"Vila Boa", 5222203, &geo_ufs[25]},
+	{"Vila Propício", 5222302, &geo_ufs[25]},
+	{"Brasília", 5300108, &geo_ufs[26]},
+};
+
+static const uint16_t geo_por_nome[GEO_QTD_MUNICIPIOS] = {
+	5318, 2243, 5319, 2244, 151, 890, 1826, 1827, 3911, 4310, 152, 4311,
+	2245, 1464, 310, 2246, 449, 1828, 153, 891, 892, 1074, 666, 4603,
+	893, 5177, 52, 5320, 1075, 2247, 3266, 5321, 3267, 3912, 1829, 1465,
+	1076, 3096, 450, 1466, 154, 1467, 667, 4312, 4313, 155, 2248, 5178,
+	668, 1241, 1649, 5099, 2249, 4314, 451, 3098, 1830, 5322, 5323, 1077,
+	1468, 4604, 3268, 2250, 1469, 3269, 4315, 3270, 3271, 3272, 2251, 4316,
+	5324, 4317, 2252, 4605, 3273, 3913, 3097, 1242, 311, 2253, 1832, 894,
+	2254, 4606, 2255, 1243, 1244, 1245, 1470, 669, 1833, 3274, 2256, 452,
+	895, 1246, 5100, 1834, 453, 4607, 3099, 4608, 670, 4609, 2257, 156,
+	1078, 5325, 2258, 3100, 3275, 2259, 4318, 1247, 1248, 1471, 312, 1835,
+	313, 157, 2260, 1079, 3914, 4610, 5326, 2261, 4611, 2262, 5179, 0,
+	3276, 158, 454, 3915, 896, 2263, 1472, 3277, 137, 3278, 4612, 455,
+	456, 25, 5180, 4319, 5181, 2264, 1080, 4613, 5182, 5327, 2866, 671,
+	5183, 26, 4305, 5328, 3917, 457, 3918, 2265, 3101, 897, 5184, 3916,
+	672, 3279, 74, 2266, 3280, 3281, 3282, 3283, 2267, 314, 4614, 24,
+	2268, 673, 5329, 3919, 136, 5101, 295, 458, 3920, 1473, 4615, 5330,
+	674, 459, 1836, 75, 1837, 1838, 3284, 5331, 3285, 3286, 4616, 898,
+	5332, 1250, 3287, 1751, 2269, 3921, 1650, 1839, 3922, 159, 460, 3288,
+	76, 315, 160, 5333, 161, 461, 5102, 5103, 3102, 4320, 1840, 3923,
+	1841, 2270, 3289, 4617, 2272, 3290, 2273, 5104, 1474, 4321, 1842, 675,
+	316, 1081, 3174, 1843, 3924, 5334, 3291, 3292, 5335, 676, 4322, 4323,
+	77, 4618, 1844, 3925, 899, 677, 1845, 2274, 4324, 2275, 1846, 5105,
+	1082, 3926, 4619, 2276, 1251, 3293, 3294, 5336, 5337, 317, 5106, 3175,
+	3103, 5185, 3295, 462, 4325, 1083, 1847, 5338, 1848, 3927, 78, 900,
+	1752, 5107, 901, 4326, 1252, 2277, 1753, 3296, 1850, 902, 1849, 3297,
+	1851, 2278, 903, 1475, 3298, 3104, 5339, 2279, 5340, 5341, 318, 319,
+	320, 5186, 321, 5187, 322, 463, 5342, 2280, 323, 464, 5108, 1852,
+	4620, 465, 3299, 3300, 2281, 3301, 1651, 324, 2282, 3928, 2283, 3929,
+	2284, 3930, 5188, 4327, 1253, 4328, 3302, 3303, 904, 466, 4621, 905,
+	1476, 3176, 1254, 3931, 1853, 4622, 906, 1854, 1754, 3932, 2285, 2286,
+	2287, 3304, 2288, 1477, 2289, 3177, 3305, 1255, 1084, 1755, 1256, 1257,
+	3306, 3307, 5189, 5343, 1085, 2290, 2291, 2292, 5190, 1, 3308, 3933,
+	3178, 4329, 907, 678, 1258, 679, 680, 3179, 325, 4623, 4625, 4624,
+	4627, 4626, 4628, 4330, 3309, 5344, 3310, 4331, 4629, 4332, 3311, 3934,
+	908, 3312, 53, 3935, 1259, 681, 2293, 3936, 1652, 3937, 79, 4333,
+	2294, 3313, 3105, 326, 162, 2295, 4630, 1086, 4631, 1855, 3314, 5345,
+	909, 4334, 163, 327, 80, 3315, 3316, 3317, 164, 682, 5346, 467,
+	328, 329, 468, 469, 470, 471, 3318, 2296, 4632, 165, 1260, 1087,
+	1856, 166, 1857, 683, 910, 3106, 3319, 2297, 5347, 4335, 4337, 4336,
+	4338, 4503, 4633, 3938, 3320, 472, 2298, 911, 3321, 1261, 2299, 2300,
+	4339, 3939, 5109, 330, 167, 1858, 4634, 3322, 2301, 4635, 473, 5191,
+	2302, 4636, 1088, 1262, 2303, 912, 3323, 3940, 168, 1089, 81, 3324,
+	1859, 3325, 4340, 684, 1860, 1478, 1264, 1263, 1653, 3107, 1265, 1654,
+	5192, 3326, 1861, 474, 5193, 4638, 3942, 1862, 331, 3180, 4639, 4640,
+	4641, 1863, 3327, 1756, 4642, 2304, 3181, 4341, 3941, 4637, 685, 913,
+	1864, 686, 82, 475, 1479, 3328, 3329, 914, 1865, 5348, 687, 1867,
+	1866, 332, 915, 4643, 2305, 3330, 3331, 5110, 688, 1655, 3332, 5111,
+	916, 3333, 1266, 3334, 917, 918, 5112, 3943, 5349, 2306, 477, 3944,
+	689, 4342, 476, 169, 1267, 1656, 1480, 1268, 690, 1481, 3182, 2307,
+	1868, 4343, 1869, 2308, 1482, 1657, 2309, 2310, 170, 691, 478, 4344,
+	171, 83, 4644, 3335, 1090, 4645, 479, 2311, 2313, 1269, 3336, 480,
+	333, 3337, 692, 2312, 84, 1483, 693, 2314, 1484, 2315, 2316, 4345,
+	3338, 2317, 3339, 3340, 1870, 3945, 4346, 2318, 3108, 3946, 3947, 3341,
+	694, 1871, 1270, 3948, 919, 138, 1271, 3949, 4646, 4647, 4648, 481,
+	4649, 85, 4650, 1872, 1658, 86, 695, 3342, 2319, 4347, 2320, 3950,
+	1091, 1485, 5113, 3343, 3344, 1486, 2321, 482, 1487, 3183, 4349, 5350,
+	2322, 696, 1092, 1272, 4350, 4651, 1873, 2323, 1874, 483, 5351, 2324,
+	5194, 2325, 3184, 3109, 4351, 3951, 172, 334, 3345, 484, 4652, 697,
+	4653, 2326, 4352, 4654, 1273, 2327, 3952, 3346, 3953, 4348, 139, 2328,
+	698, 5352, 2329, 1875, 173, 1488, 1876, 5114, 2330, 1274, 5353, 1275,
+	4655, 699, 1757, 1877, 3347, 3348, 87, 1277, 3349, 2331, 3350, 3954,
+	4656, 2332, 3351, 2333, 1878, 4353, 4657, 4354, 4355, 4658, 174, 3352,
+	3955, 1659, 2336, 175, 5115, 2334, 3956, 335, 54, 700, 5564, 2335,
+	5195, 2338, 3353, 2337, 5354, 1489, 3110, 1093, 1490, 336, 485, 3354,
+	1491, 486, 1278, 701, 1279, 1758, 176, 920, 1879, 1880, 177, 178,
+	5355, 4659, 3355, 3356, 1881, 2339, 1882, 4356, 4357, 2340, 2341, 1492,
+	1883, 2342, 1493, 55, 179, 3357, 3358, 487, 5356, 488, 5357, 337,
+	702, 703, 489, 5358, 1884, 490, 27, 2343, 3359, 2344, 4660, 88,
+	1280, 5116, 1885, 1281, 1886, 2345, 5359, 704, 1282, 2, 1494, 3185,
+	2346, 3360, 3361, 1495, 4358, 3362, 4661, 29, 4662, 5196, 1887, 5360,
+	2347, 5361, 2348, 2271, 181, 180, 4663, 1283, 2349, 5362, 491, 3363,
+	3186, 338, 1496, 4664, 3111, 1284, 1285, 1286, 1660, 4665, 3, 3364,
+	5363, 1888, 1889, 2350, 1890, 2351, 1497, 1891, 1892, 3957, 3365, 3958,
+	3959, 3366, 2352, 5364, 4666, 4359, 1287, 4667, 1094, 1095, 1096, 3367,
+	1893, 3368, 3369, 492, 493, 3370, 1288, 705, 1289, 3371, 1661, 706,
+	2353, 3372, 1498, 297, 2354, 1290, 5365, 5366, 1894, 707, 3960, 4360,
+	1499, 1895, 1896, 2355, 1291, 1897, 2356, 5117, 4668, 1500, 4669, 3961,
+	4670, 3962, 3963, 4361, 3187, 2357, 2358, 182, 921, 1501, 2359, 2360,
+	1662, 2361, 4671, 5367, 494, 3964, 4672, 3373, 3965, 1292, 3966, 2362,
+	5368, 5197, 3374, 708, 4673, 5369, 1663, 4363, 5370, 1898, 709, 2363,
+	2364, 4364, 4674, 3967, 1759, 2365, 3968, 4365, 2366, 1899, 1664, 5118,
+	710, 3969, 711, 5371, 3375, 3970, 712, 3971, 4675, 30, 5198, 1097,
+	5199, 2367, 5372, 4676, 5200, 3376, 3190, 2368, 339, 4366, 3377, 922,
+	5373, 1502, 2371, 2369, 183, 5201, 3378, 1665, 1900, 2370, 1901, 5202,
+	3379, 713, 1902, 1903, 1904, 2372, 31, 4677, 1905, 3972, 4678, 495,
+	3380, 3381, 1906, 4679, 3973, 4680, 4367, 1098, 4681, 1760, 1503, 923,
+	1761, 3382, 4682, 4368, 1907, 140, 2373, 3191, 3974, 496, 714, 1908,
+	4683, 89, 184, 3975, 4362, 3383, 4684, 4685, 4686, 4687, 2374, 1666,
+	1762, 4689, 3384, 1909, 2375, 2376, 2377, 1293, 2378, 1910, 2379, 4369,
+	497, 924, 4690, 2380, 715, 2381, 716, 3976, 185, 2382, 3385, 4370,
+	4688, 56, 1504, 2383, 4692, 141, 717, 5119, 3386, 2384, 1911, 3977,
+	2385, 2386, 2387, 3188, 3387, 2388, 90, 1099, 1294, 718, 1912, 4691,
+	2389, 1913, 3388, 3192, 2390, 91, 92, 3112, 925, 719, 1914, 1763,
+	926, 340, 927, 928, 5203, 3978, 4693, 2391, 4694, 2392, 3193, 2393,
+	2394, 2395, 2396, 2397, 2398, 5374, 341, 1764, 2399, 1505, 1100, 1101,
+	929, 1506, 2400, 1667, 142, 498, 1507, 2401, 1295, 342, 1508, 499,
+	2402, 2403, 3389, 2404, 1915, 4695, 2405, 930, 3979, 343, 4696, 3194,
+	1509, 1296, 2406, 3390, 5120, 186, 5204, 32, 5375, 3113, 720, 3391,
+	3980, 1916, 2408, 5376, 3392, 3981, 4371, 931, 2409, 2410, 1510, 3393,
+	1297, 1917, 1298, 1918, 4697, 2411, 932, 5377, 1919, 1299, 2412, 933,
+	5378, 2413, 4372, 500, 4698, 721, 1102, 501, 3394, 934, 1511, 1765,
+	2414, 4373, 344, 4699, 3982, 1920, 2415, 502, 2416, 503, 504, 4,
+	5379, 3395, 3396, 4700, 3983, 4701, 1103, 4702, 4703, 4704, 4374, 3397,
+	3984, 5380, 1512, 1513, 1668, 2417, 2418, 4705, 346, 345, 2419, 5205,
+	2420, 5381, 4375, 5121, 505, 4376, 3398, 4706, 4707, 935, 3909, 187,
+	2421, 4708, 3985, 936, 937, 1921, 4709, 33, 4710, 3986, 1922, 3987,
+	5382, 506, 4711, 1923, 2422, 4712, 2423, 2424, 5206, 2425, 3399, 3988,
+	1924, 93, 722, 723, 4377, 724, 5207, 5383, 1925, 94, 507, 508,
+	2426, 1669, 725, 188, 3114, 5208, 3400, 509, 4713, 5384, 347, 406,
+	5209, 3401, 3989, 726, 727, 1670, 3990, 4714, 5, 2427, 348, 2428,
+	3189, 2429, 5210, 1300, 2430, 3115, 2407, 1926, 2432, 2431, 2433, 3195,
+	1927, 189, 728, 3116, 1928, 1929, 510, 2434, 2435, 2436, 349, 2437,
+	3402, 3403, 4378, 190, 1301, 1514, 1302, 1930, 1931, 4715, 2438, 2439,
+	5211, 1303, 2440, 2441, 2442, 3991, 2443, 5212, 2444, 3992, 2445, 2446,
+	4716, 2447, 3993, 1932, 2448, 4717, 1671, 4718, 2449, 1933, 3994, 3196,
+	3404, 1934, 4379, 2450, 2451, 938, 1304, 5122, 1935, 2452, 3995, 2453,
+	3405, 511, 2454, 4719, 4720, 3996, 1104, 2455, 4380, 1105, 1936, 729,
+	3406, 4381, 2456, 2457, 4721, 5123, 3997, 2458, 2459, 2460, 5385, 2461,
+	2462, 4383, 730, 1515, 1937, 1516, 5124, 5386, 5387, 3407, 3998, 6,
+	4382, 1672, 3408, 3409, 7, 5125, 1938, 3410, 4722, 5213, 2463, 350,
+	4723, 5126, 1305, 1673, 939, 940, 3411, 1939, 4384, 2464, 1940, 4724,
+	2465, 3412, 4725, 4726, 351, 731, 2466, 5388, 2467, 5389, 2468, 1766,
+	732, 1941, 5390, 352, 941, 5391, 2469, 942, 4727, 1942, 1306, 4002,
+	3413, 4728, 3414, 2470, 3999, 4000, 57, 4001, 4729, 1106, 2471, 4003,
+	3415, 1307, 5214, 1308, 1310, 1309, 34, 5392, 1517, 191, 1767, 3416,
+	4385, 4386, 2472, 1518, 1943, 733, 192, 4004, 4387, 4005, 734, 1107,
+	1311, 2473, 736, 1312, 193, 735, 194, 195, 512, 5215, 2474, 1519,
+	298, 5393, 1313, 5394, 353, 1944, 2475, 4730, 513, 5395, 2476, 2477,
+	1674, 2478, 737, 5216, 5127, 943, 4731, 3417, 4388, 2479, 1314, 2480,
+	2481, 4732, 3418, 1316, 4008, 4006, 4007, 2482, 5217, 354, 1945, 4733,
+	2483, 2484, 4389, 5396, 3419, 738, 1768, 2485, 2486, 2487, 3117, 3420,
+	2488, 2489, 5408, 355, 2490, 2491, 2492, 3421, 3422, 4734, 4735, 5128,
+	356, 4736, 1675, 4009, 3423, 5218, 1946, 2493, 2494, 196, 739, 4737,
+	741, 2495, 1947, 4739, 514, 4738, 2496, 2497, 3118, 740, 4390, 2498,
+	4740, 1317, 2499, 2500, 2501, 3119, 2502, 2503, 1520, 4010, 5129, 3424,
+	2504, 5130, 4011, 4741, 4391, 4742, 1108, 4306, 5397, 3425, 3426, 3197,
+	1318, 357, 3427, 515, 3198, 2505, 3428, 3120, 5398, 5399, 95, 3429,
+	5131, 4743, 197, 742, 3430, 743, 3431, 1948, 2506, 1319, 3432, 3433,
+	3434, 3435, 4744, 1110, 1949, 4745, 4012, 4013, 2507, 3436, 2508, 3199,
+	4746, 2509, 1950, 4392, 2510, 4015, 4748, 4747, 96, 58, 1111, 4749,
+	4750, 944, 1831, 4393, 4751, 4753, 4754, 4394, 2511, 1521, 4755, 2512,
+	2513, 1320, 4756, 4014, 358, 744, 516, 4016, 8, 2514, 1112, 2515,
+	3437, 3438, 1951, 4757, 4758, 1769, 4759, 4760, 2516, 3910, 517, 4761,
+	3439, 2517, 1676, 2518, 3440, 5400, 2519, 4762, 1952, 3441, 4763, 2520,
+	1953, 945, 2521, 2522, 1113, 1522, 1321, 4764, 5401, 2523, 2524, 946,
+	198, 4017, 4765, 3442, 745, 359, 1954, 5132, 4018, 4766, 4395, 4767,
+	5402, 4019, 4768, 59, 1955, 1956, 1677, 1523, 1770, 518, 2525, 1114,
+	2527, 2528, 4769, 1678, 5219, 4020, 4021, 2529, 1524, 519, 1115, 3444,
+	3443, 3445, 3446, 299, 1525, 2530, 2531, 4022, 5133, 360, 5220, 361,
+	1957, 1958, 5403, 1679, 4024, 4396, 3447, 4023, 1116, 3448, 1526, 4770,
+	5404, 746, 1527, 4025, 1959, 199, 747, 2532, 4026, 748, 4771, 4397,
+	4027, 3449, 3450, 97, 4772, 2533, 4773, 5405, 520, 4028, 1960, 4398,
+	2534, 5406, 362, 4774, 947, 4399, 948, 2535, 363, 521, 4775, 949,
+	522, 2536, 4029, 4032, 4400, 3451, 749, 4030, 750, 2537, 4031, 1117,
+	2538, 751, 3452, 2539, 752, 2540, 3453, 950, 4776, 2541, 2542, 2543,
+	1322, 1528, 1771, 4401, 2544, 2545, 753, 2546, 2547, 1118, 3121, 2548,
+	3454, 1323, 3455, 2549, 1119, 4402, 1529, 5407, 2550, 1961, 1530, 1772,
+	3456, 4777, 4403, 200, 4778, 4404, 4405, 3457, 5221, 4779, 1962, 3458,
+	754, 4780, 4033, 5222, 1773, 3459, 951, 4781, 1963, 3460, 4782, 755,
+	1680, 4783, 2551, 3461, 1964, 5223, 5134, 1531, 4784, 523, 4034, 2552,
+	1532, 2553, 5409, 5410, 5411, 201, 5412, 1120, 5413, 364, 5414, 365,
+	5415, 4035, 4036, 2554, 524, 1965, 2555, 2556, 5416, 525, 4406, 1121,
+	526, 527, 35, 3122, 528, 1966, 529, 530, 2557, 952, 531, 1774,
+	532, 4785, 4786, 4787, 4037, 1533, 953, 954, 2558, 4407, 1534, 4788,
+	4408, 955, 1122, 2559, 4789, 4409, 3123, 756, 4790, 3462, 3463, 3464,
+	4038, 4039, 956, 98, 9, 1967, 1123, 4040, 1968, 2560, 2561, 3465,
+	3466, 3200, 4041, 5417, 4791, 4042, 3467, 1324, 3468, 3469, 4043, 2562,
+	4410, 957, 2563, 366, 5418, 958, 4411, 2564, 2565, 3470, 4792, 5419,
+	4044, 3471, 5224, 3124, 4045, 4046, 2566, 3472, 3473, 1969, 3474, 4047,
+	2567, 3475, 3476, 757, 5420, 3477, 4412, 3478, 4413, 3479, 2568, 5135,
+	2569, 533, 2570, 5225, 2571, 2572, 1325, 1326, 202, 367, 3480, 4793,
+	5421, 2573, 1970, 3481, 4752, 4414, 4794, 959, 5422, 5423, 3482, 4048,
+	960, 4795, 3483, 758, 4796, 99, 4797, 534, 3484, 5424, 3485, 1971,
+	2574, 3486, 1535, 4049, 4798, 961, 3487, 1681, 3125, 4050, 2575, 2576,
+	4799, 2577, 4415, 962, 1327, 1972, 1973, 4416, 1974, 1975, 963, 1536,
+	1976, 1977, 4051, 1978, 3488, 2578, 2579, 3126, 4800, 1537, 4417, 1979,
+	1980, 4801, 3489, 1981, 2580, 4802, 1982, 3490, 3127, 1983, 2581, 2582,
+	3491, 1984, 964, 4418, 2583, 4052, 535, 3492, 1985, 965, 3128, 1124,
+	3493, 1682, 1986, 3494, 1276, 3495, 2584, 536, 537, 203, 204, 1538,
+	3496, 2585, 1987, 1683, 4803, 3201, 1988, 3497, 1539, 4053, 2586, 5136,
+	966, 4054, 2587, 4804, 3499, 1775, 1546, 759, 3500, 3498, 1989, 4419,
+	2588, 4805, 1328, 4420, 4055, 4806, 2589, 4421, 4056, 4422, 4807, 538,
+	4057, 5425, 1540, 4058, 2590, 2591, 4423, 3501, 967, 4808, 3502, 2592,
+	4059, 3503, 5426, 1776, 5226, 1329, 2593, 1541, 4809, 1990, 205, 1684,
+	2594, 2595, 760, 5427, 2596, 5137, 3504, 4424, 2597, 5428, 2598, 1125,
+	968, 2599, 969, 3505, 4810, 1991, 3506, 3507, 2600, 1992, 3508, 1993,
+	4425, 4060, 5429, 5227, 761, 4811, 100, 206, 1542, 4061, 5430, 4426,
+	3509, 970, 3510, 4427, 1543, 1126, 368, 971, 2601, 4428, 1994, 143,
+	972, 4062, 3511, 4429, 4812, 2602, 1995, 1996, 101, 4430, 3512, 3513,
+	1997, 1998, 4063, 4431, 973, 1999, 4064, 4432, 207, 3129, 762, 5431,
+	4433, 4813, 1330, 1777, 1778, 2000, 3514, 2001, 5432, 1779, 2603, 2604,
+	2605, 3202, 2002, 369, 2606, 2607, 2003, 102, 1544, 4814, 2004, 2005,
+	2006, 2007, 3130, 2008, 3203, 4065, 2608, 5433, 5434, 370, 3515, 1545,
+	974, 763, 4434, 539, 2609, 4066, 975, 208, 1127, 5435, 4435, 3516,
+	3517, 2009, 2610, 2010, 3204, 2011, 2611, 103, 2612, 2012, 2613, 4067,
+	1547, 2013, 4068, 2614, 2615, 2616, 2014, 3518, 2617, 5228, 2015, 2618,
+	2619, 3519, 3205, 5436, 976, 2620, 2016, 2017, 2018, 2621, 3520, 540,
+	4069, 4436, 3131, 4070, 3206, 1548, 2019, 3521, 2622, 3522, 3523, 2020,
+	977, 3524, 104, 4437, 5437, 3525, 371, 1549, 2021, 978, 4438, 3526,
+	5138, 372, 1331, 3527, 1780, 1332, 36, 4815, 3528, 3529, 5438, 3530,
+	2022, 4816, 5139, 1550, 3132, 2023, 3531, 979, 3532, 5439, 4817, 3207,
+	2623, 3533, 4818, 2024, 3534, 980, 1333, 1128, 2624, 5229, 300, 5440,
+	764, 2625, 4071, 2626, 2627, 541, 5230, 3535, 3536, 2025, 2026, 3537,
+	2027, 3538, 2028, 2029, 2628, 2629, 5441, 2630, 3539, 209, 4439, 2631,
+	2632, 3540, 2030, 3133, 4072, 4073, 4074, 4075, 5140, 5442, 4819, 4820,
+	1551, 4440, 2031, 3541, 4076, 4821, 3542, 2633, 1129, 2032, 1334, 1685,
+	210, 3543, 4077, 3544, 5231, 2634, 4441, 2033, 765, 2635, 1686, 4822,
+	211, 3545, 2636, 4823, 4078, 2034, 2637, 4824, 2035, 3134, 981, 4825,
+	4079, 982, 983, 2036, 3546, 984, 4442, 2638, 766, 3547, 3548, 2639,
+	2640, 5443, 4080, 1130, 2037, 3549, 1131, 5232, 4081, 2641, 1132, 2642,
+	1687, 1781, 3208, 1133, 4082, 1782, 2643, 5141, 105, 4083, 1552, 4826,
+	5444, 4443, 5142, 1688, 985, 5143, 4084, 1134, 1135, 767, 1136, 4085,
+	3550, 4444, 4827, 3551, 10, 5445, 4086, 1553, 5144, 986, 542, 1554,
+	768, 3552, 373, 5446, 5233, 2644, 2645, 543, 2646, 1689, 2038, 2647,
+	2648, 2649, 2039, 1335, 3553, 3135, 769, 2650, 4087, 5447, 11, 987,
+	2040, 2041, 4445, 2651, 2652, 3554, 1555, 1137, 770, 1138, 2042, 544,
+	2653, 3136, 1336, 2654, 3555, 2655, 1690, 1556, 771, 4088, 1414, 772,
+	4828, 4446, 2656, 60, 4447, 3556, 1139, 773, 2657, 2658, 545, 2659,
+	5448, 5234, 1337, 374, 2661, 1338, 2043, 988, 774, 989, 1557, 2044,
+	1140, 5235, 2662, 775, 4829, 3557, 3558, 546, 1339, 1141, 1691, 3559,
+	4089, 1692, 3560, 1558, 4448, 3561, 3562, 2663, 4090, 776, 1559, 1340,
+	1341, 106, 2664, 5236, 212, 5237, 2045, 4091, 5449, 2046, 2047, 107,
+	5145, 2665, 4092, 108, 4449, 2666, 5146, 2048, 2667, 1783, 4450, 547,
+	548, 551, 549, 1342, 778, 4830, 1142, 1693, 375, 2668, 1343, 1561,
+	1143, 780, 1144, 779, 1560, 550, 1562, 781, 782, 376, 1563, 2669,
+	4832, 2670, 2671, 1564, 2672, 552, 1145, 2049, 1146, 2673, 5450, 1344,
+	4833, 4831, 3563, 777, 4451, 5147, 2050, 3209, 377, 4834, 4835, 4452,
+	553, 2051, 2052, 1565, 2053, 1147, 1148, 2674, 2054, 2675, 5238, 2676,
+	783, 4093, 2055, 3137, 2677, 4094, 301, 3564, 1784, 4095, 2678, 1345,
+	4453, 2056, 4454, 378, 3565, 2679, 990, 4836, 3566, 2680, 4455, 3567,
+	2681, 2057, 3568, 4456, 2682, 5451, 4096, 4837, 2683, 2058, 4097, 554,
+	2684, 3569, 2685, 1566, 1694, 213, 991, 4098, 3570, 4457, 4838, 4839,
+	3138, 3571, 1346, 2059, 379, 4099, 4100, 1347, 4101, 2686, 4458, 3572,
+	555, 3573, 3574, 5239, 3575, 1348, 3576, 5240, 1149, 3577, 784, 556,
+	2060, 1150, 2687, 2688, 4459, 4102, 3578, 2689, 4103, 3579, 4104, 3580,
+	2690, 4460, 5452, 785, 380, 3210, 1151, 2061, 4841, 1785, 302, 1567,
+	2062, 3581, 1152, 3582, 2063, 3583, 1695, 2691, 4840, 12, 2692, 1568,
+	4461, 3211, 2064, 992, 786, 2065, 2693, 1349, 214, 2066, 4462, 215,
+	557, 3584, 3212, 2067, 2068, 3585, 3586, 5453, 4463, 1696, 1153, 4464,
+	2694, 2069, 2070, 1786, 1787, 4105, 1350, 1351, 5454, 4106, 2695, 4842,
+	109, 1352, 110, 1569, 111, 61, 4107, 4108, 4109, 3587, 4110, 2696,
+	3213, 4111, 2697, 2698, 112, 787, 4112, 62, 4843, 2071, 2072, 2699,
+	3139, 4844, 2701, 1701, 5455, 113, 216, 3588, 558, 3589, 4465, 5148,
+	217, 993, 2073, 1697, 2074, 1570, 559, 994, 560, 218, 3590, 4845,
+	3140, 2075, 4846, 1698, 4466, 2700, 1353, 5242, 4847, 1154, 2076, 995,
+	788, 789, 4113, 1699, 3141, 63, 4467, 1354, 2702, 4114, 4115, 2703,
+	4848, 4849, 381, 3591, 1700, 3214, 2704, 3142, 4116, 4117, 3592, 4118,
+	4119, 3593, 2705, 4120, 4121, 2706, 219, 1355, 2707, 4122, 2708, 4850,
+	4123, 2709, 996, 3594, 1155, 2710, 1788, 4124, 5456, 2077, 997, 790,
+	1356, 4468, 4851, 2078, 1702, 561, 2711, 3595, 1357, 382, 4125, 2712,
+	2713, 3088, 2714, 2715, 791, 2079, 562, 1358, 4126, 2716, 4852, 1359,
+	4853, 4854, 4127, 2717, 563, 564, 4469, 2718, 5457, 1703, 5243, 1360,
+	2719, 3596, 4128, 114, 5458, 383, 998, 1156, 4855, 303, 2720, 2080,
+	4129, 220, 2721, 4470, 221, 3215, 2722, 3597, 4130, 2723, 3598, 999,
+	3599, 2724, 3216, 1704, 1157, 792, 2081, 793, 3217, 3600, 1000, 2082,
+	565, 1001, 794, 5459, 3143, 5460, 1705, 4856, 2725, 2726, 5461, 3601,
+	37, 3603, 2727, 3602, 3218, 384, 566, 4131, 2728, 4857, 2729, 1002,
+	5149, 567, 1571, 3604, 2083, 385, 2084, 38, 3605, 4132, 3606, 5244,
+	3607, 2730, 4471, 568, 4133, 1003, 222, 3608, 4472, 2731, 2732, 1361,
+	3609, 3610, 5462, 1789, 3611, 223, 1004, 3612, 569, 3613, 4473, 3614,
+	2733, 795, 796, 2734, 1005, 1362, 2735, 3144, 1158, 4858, 224, 1159,
+	5463, 2736, 1790, 797, 3615, 4859, 3616, 3617, 2737, 3618, 2738, 4860,
+	4474, 2739, 3619, 4475, 1160, 386, 2740, 1363, 3621, 39, 2085, 2741,
+	387, 2743, 1364, 3620, 1706, 4861, 570, 2742, 5464, 2744, 5465, 5466,
+	1006, 2745, 1007, 1625, 4134, 1572, 4862, 2086, 4135, 1008, 5467, 4863,
+	3622, 5468, 798, 4476, 2746, 2087, 799, 2747, 4477, 4864, 4865, 571,
+	2088, 3623, 5469, 1161, 4866, 3624, 5470, 225, 144, 1009, 2089, 4867,
+	2090, 3145, 4868, 4869, 1010, 1365, 2091, 2092, 5150, 5471, 2748, 4136,
+	2093, 3146, 2094, 3147, 2749, 1791, 1707, 800, 389, 2095, 3625, 2096,
+	2750, 5472, 2751, 2752, 3626, 2753, 4870, 2754, 3627, 1162, 2755, 2756,
+	390, 3219, 3628, 1366, 4478, 5151, 391, 2097, 1573, 801, 3629, 2757,
+	1367, 802, 5473, 1792, 2758, 5474, 3630, 115, 3631, 4871, 2098, 3220,
+	572, 2759, 5152, 3632, 5475, 1163, 3221, 5245, 4872, 2099, 145, 5246,
+	1793, 1794, 1795, 4137, 1796, 803, 5247, 1797, 804, 3633, 4138, 4873,
+	5153, 5476, 4139, 5154, 4874, 4140, 5477, 5248, 4875, 2760, 4876, 5252,
+	13, 4877, 3634, 2100, 5253, 3635, 4878, 4141, 3636, 573, 5478, 1164,
+	2761, 4479, 4142, 226, 4143, 4879, 3637, 2101, 4144, 1368, 3222, 5479,
+	3638, 5314, 3639, 4880, 2102, 3223, 5480, 3640, 574, 227, 4480, 2103,
+	5250, 4145, 2762, 4146, 3642, 23, 5315, 5316, 2763, 5317, 5254, 5249,
+	3643, 4147, 5255, 392, 1011, 1369, 575, 116, 4881, 4882, 1370, 4883,
+	2764, 2765, 4884, 4150, 4885, 2104, 2766, 5481, 4886, 393, 1012, 4148,
+	5251, 824, 4887, 4149, 2767, 2105, 4151, 228, 4481, 5256, 40, 2660,
+	3148, 4482, 5482, 2106, 5257, 3641, 394, 117, 395, 118, 4893, 5483,
+	4888, 2768, 5484, 4889, 2107, 3644, 4483, 5259, 28, 5155, 4152, 396,
+	1708, 4890, 5258, 1013, 2769, 805, 5485, 229, 230, 806, 5263, 5260,
+	4891, 2108, 4892, 2770, 3645, 231, 1014, 3646, 807, 232, 304, 2771,
+	3647, 1371, 576, 1709, 1710, 808, 1711, 1165, 2772, 3648, 2773, 1574,
+	577, 2109, 1372, 2774, 397, 2110, 2775, 1712, 2776, 3649, 2777, 3650,
+	3651, 233, 2778, 5486, 3652, 4484, 1575, 1576, 1015, 4153, 3653, 3654,
+	4894, 3655, 4485, 234, 2111, 1577, 235, 3656, 4154, 4486, 1166, 1713,
+	2779, 2780, 2781, 14, 1373, 3658, 4487, 5487, 2782, 4155, 3657, 2112,
+	5488, 3659, 236, 1016, 146, 1017, 1798, 578, 1018, 1019, 5489, 2783,
+	809, 2784, 810, 2787, 4488, 4156, 4895, 2785, 4489, 2786, 2788, 811,
+	1714, 3660, 5490, 237, 1020, 4490, 2789, 4491, 1021, 1578, 4896, 3661,
+	442, 4157, 2113, 4158, 4492, 3662, 4897, 812, 1715, 813, 579, 398,
+	2114, 5491, 388, 1579, 399, 5492, 5493, 3663, 4159, 4898, 4493, 2790,
+	4160, 5494, 4899, 3149, 1580, 3664, 4900, 1716, 2791, 4494, 814, 2793,
+	3224, 2792, 1022, 238, 2794, 3665, 4901, 3225, 580, 3666, 1023, 3667,
+	4495, 4161, 4902, 400, 2795, 1024, 2115, 1025, 401, 1167, 4162, 4163,
+	5156, 5495, 5261, 3668, 4164, 3669, 1581, 5262, 4165, 5157, 2796, 3670,
+	1374, 2116, 3226, 1168, 239, 5496, 1169, 3671, 4903, 41, 1170, 1717,
+	119, 2117, 1718, 3672, 3673, 815, 816, 1109, 1582, 581, 4904, 1172,
+	2798, 4905, 2799, 2800, 2797, 1173, 1375, 582, 817, 1583, 1719, 4496,
+	4906, 4907, 2801, 4497, 583, 2802, 4166, 4167, 1376, 2803, 818, 2804,
+	2805, 3674, 1174, 3227, 2118, 240, 402, 819, 1176, 1584, 120, 2806,
+	4168, 3675, 3676, 584, 1377, 1585, 820, 3677, 2807, 2119, 4908, 3678,
+	4169, 1720, 4498, 585, 2808, 4909, 821, 2120, 4170, 2809, 3679, 1586,
+	2810, 3680, 2811, 1026, 1378, 296, 2812, 2813, 2814, 1177, 1379, 1799,
+	1178, 5264, 2815, 3681, 2121, 4910, 1380, 2816, 4499, 3682, 3683, 586,
+	1800, 3684, 2817, 403, 2122, 1179, 3150, 3685, 587, 5158, 822, 823,
+	2818, 4911, 1398, 2819, 1180, 404, 241, 5265, 4912, 4913, 1027, 588,
+	3686, 1181, 1721, 4500, 1028, 2820, 2821, 405, 2822, 2823, 2824, 3687,
+	3688, 1029, 589, 2825, 4501, 590, 4171, 4172, 4173, 5497, 3689, 2826,
+	1587, 1588, 4502, 1589, 5498, 3228, 1722, 3690, 1381, 2123, 2827, 4914,
+	242, 825, 1382, 3691, 2828, 2829, 2830, 2831, 4174, 2124, 1383, 1723,
+	5499, 3692, 1182, 1384, 1385, 2832, 15, 826, 42, 2125, 3693, 591,
+	1724, 2126, 3694, 407, 1030, 2833, 4175, 4915, 4916, 4177, 4917, 4176,
+	3695, 4504, 1801, 4178, 3229, 4918, 592, 4919, 4505, 3151, 2127, 2834,
+	827, 593, 3696, 1031, 3697, 3698, 5500, 2835, 3699, 828, 3230, 2128,
+	4179, 3700, 2836, 3701, 1802, 2837, 3702, 2838, 2839, 1725, 5501, 594,
+	2840, 4920, 2841, 3703, 3704, 4180, 408, 3705, 4921, 3706, 4506, 2842,
+	5502, 5503, 1032, 2129, 829, 2130, 1386, 4181, 3707, 4182, 2843, 1387,
+	409, 3152, 2844, 243, 64, 5504, 4183, 2131, 2132, 3708, 4184, 4922,
+	4507, 5266, 2845, 3709, 3710, 1590, 595, 1388, 1183, 1389, 4923, 1726,
+	1390, 2846, 1803, 1804, 2133, 5267, 2847, 2848, 2134, 3711, 1391, 1591,
+	4508, 3712, 2849, 3713, 244, 4185, 5159, 3714, 5268, 4186, 5505, 3715,
+	4924, 4509, 410, 4510, 411, 5269, 2850, 4925, 4511, 5270, 3716, 3153,
+	2851, 2852, 2135, 3717, 1033, 3718, 5506, 3231, 4187, 1184, 4926, 5507,
+	1034, 2853, 245, 5508, 830, 73, 4927, 5271, 831, 412, 4188, 4189,
+	4512, 1727, 1805, 246, 1728, 1185, 5272, 5273, 5274, 3719, 3720, 2854,
+	596, 305, 4928, 4929, 5160, 413, 3232, 1729, 4190, 597, 2136, 4513,
+	16, 4930, 4191, 65, 4931, 5509, 2855, 1035, 3721, 2137, 3722, 1036,
+	2856, 2857, 4932, 4514, 5275, 3723, 306, 2138, 4192, 3724, 2858, 3725,
+	4515, 414, 247, 4193, 1392, 2859, 832, 3726, 2860, 2861, 3727, 2862,
+	3728, 4516, 4194, 598, 2139, 3729, 121, 4517, 2140, 599, 1186, 2863,
+	415, 3154, 2864, 4933, 17, 600, 4518, 2865, 3730, 601, 2141, 602,
+	3731, 248, 1592, 43, 5276, 603, 4195, 4519, 1393, 5510, 4934, 3732,
+	1806, 4935, 2867, 4196, 416, 1187, 4936, 1394, 3733, 4937, 2868, 4197,
+	3734, 4198, 249, 3233, 4199, 4938, 4200, 1730, 4201, 833, 1395, 2142,
+	3234, 3735, 3736, 2869, 5277, 4202, 4939, 2143, 4520, 4203, 3737, 4940,
+	1593, 5511, 3235, 4204, 1037, 1396, 1594, 2144, 1038, 1039, 1040, 1041,
+	1188, 1189, 2145, 3738, 4205, 3739, 4206, 4207, 4521, 604, 2870, 2871,
+	4208, 4209, 1595, 2872, 417, 250, 1042, 3740, 834, 4941, 2873, 835,
+	3741, 3742, 3743, 4942, 2146, 1397, 4210, 1043, 3236, 2874, 4211, 5279,
+	4212, 2875, 2876, 3744, 4943, 2147, 605, 1399, 2148, 1400, 1807, 2149,
+	1401, 418, 2877, 1190, 1596, 1191, 2150, 1402, 1403, 2878, 836, 1192,
+	1808, 5512, 5513, 606, 5161, 3745, 2151, 837, 2152, 1597, 3746, 3747,
+	5280, 4213, 3748, 2879, 2153, 4214, 3749, 3750, 3751, 3752, 3753, 2880,
+	5281, 838, 1809, 3755, 3756, 3757, 2881, 4215, 3155, 4216, 3237, 4217,
+	66, 5282, 4218, 4219, 5162, 2882, 3238, 3758, 18, 419, 4522, 3239,
+	3240, 3759, 2154, 3241, 2155, 4523, 1171, 4524, 2156, 2884, 4526, 2883,
+	420, 4525, 4944, 2885, 1598, 4527, 4945, 3760, 839, 1731, 2886, 251,
+	4528, 4220, 5163, 2887, 3156, 2888, 4946, 2889, 2890, 2891, 2892, 122,
+	5514, 2157, 4529, 421, 1404, 5515, 5164, 2893, 3761, 4947, 4530, 2894,
+	3754, 4948, 5165, 2895, 4531, 4949, 2896, 2158, 1193, 67, 4950, 4221,
+	4951, 19, 2897, 4532, 4222, 4952, 4953, 5289, 4223, 252, 5290, 4954,
+	147, 3762, 607, 2898, 1810, 4224, 4955, 5291, 3763, 1732, 2899, 3764,
+	5516, 2900, 3765, 253, 1044, 1195, 2159, 2901, 4225, 3766, 2902, 1045,
+	2903, 4956, 3767, 1599, 4957, 3768, 3769, 3770, 4533, 1405, 1600, 1811,
+	1406, 4226, 1601, 2904, 2160, 254, 1046, 3771, 1602, 3772, 4534, 3773,
+	2905, 3774, 5293, 4227, 4958, 4228, 3775, 4535, 2161, 4959, 4960, 255,
+	608, 422, 4961, 5517, 423, 3776, 4536, 1603, 4970, 3777, 3778, 4229,
+	2162, 2906, 3779, 5518, 2907, 2908, 256, 4962, 2909, 3780, 2163, 5283,
+	1407, 4537, 4230, 4963, 3781, 4964, 1196, 1408, 1604, 2164, 1605, 3782,
+	3783, 2165, 3784, 5519, 2910, 4231, 2911, 257, 1606, 2912, 840, 3785,
+	4965, 5292, 841, 2913, 3786, 4232, 5520, 2914, 424, 3787, 842, 1607,
+	609, 3788, 610, 1409, 4233, 4538, 5521, 2915, 611, 1410, 2166, 4234,
+	3789, 5522, 4235, 258, 123, 4236, 2916, 3157, 3790, 4237, 843, 612,
+	1411, 2168, 2917, 20, 1812, 1733, 259, 613, 2918, 4968, 1175, 4966,
+	1608, 3791, 2169, 260, 2919, 3158, 1609, 4967, 4238, 261, 2920, 2921,
+	425, 3242, 4239, 3792, 4240, 1049, 614, 615, 1415, 3795, 2932, 2172,
+	2935, 2933, 2934, 5523, 2936, 5524, 5166, 3796, 2937, 426, 5294, 4971,
+	2938, 5525, 1814, 4539, 3797, 845, 68, 4540, 427, 3798, 3159, 1416,
+	2173, 4972, 5526, 4242, 428, 1610, 4541, 5295, 5527, 4243, 4542, 429,
+	2939, 4973, 2167, 307, 2170, 4969, 3793, 2922, 2923, 1412, 3794, 2924,
+	1047, 262, 1048, 2925, 2926, 1734, 4241, 2927, 2928, 616, 1197, 1735,
+	2929, 844, 2930, 1813, 1198, 1413, 2931, 2171, 263, 264, 4974, 4543,
+	5284, 2174, 4544, 1815, 617, 3799, 1417, 3800, 4975, 1199, 3801, 5528,
+	4977, 4244, 4978, 5529, 2175, 846, 3243, 3802, 2940, 3803, 2941, 4245,
+	5530, 2942, 124, 2943, 2944, 3804, 5296, 5297, 2945, 4976, 4246, 3805,
+	4979, 2946, 2947, 4247, 265, 618, 847, 4980, 4981, 2176, 3806, 4982,
+	2948, 4248, 848, 3807, 3808, 2949, 1050, 619, 1611, 1419, 620, 1418,
+	2950, 1200, 3809, 4546, 430, 1201, 1612, 4545, 621, 3810, 4547, 4983,
+	1736, 2951, 849, 266, 3811, 1613, 3812, 4548, 4249, 1816, 4549, 2177,
+	1421, 1817, 2178, 4550, 5531, 2952, 267, 622, 268, 1420, 623, 3160,
+	2953, 4984, 2181, 44, 2179, 624, 2954, 5298, 2180, 850, 431, 269,
+	1202, 3245, 1422, 1818, 2955, 3813, 4985, 851, 5532, 3244, 2956, 4986,
+	2957, 625, 2182, 2958, 45, 626, 1203, 270, 852, 4551, 2183, 4987,
+	125, 3161, 5167, 2959, 2960, 271, 2961, 3246, 2962, 1051, 1204, 853,
+	2963, 854, 2964, 2526, 2965, 2184, 2966, 4988, 4250, 1614, 4251, 627,
+	4553, 2967, 5533, 148, 3247, 3814, 855, 856, 2968, 2969, 5534, 272,
+	2970, 857, 4989, 858, 3815, 2971, 3816, 3248, 273, 2972, 274, 859,
+	4252, 1423, 628, 4554, 4253, 1052, 2973, 2974, 4552, 2975, 2976, 629,
+	2977, 3817, 860, 4990, 1249, 1205, 630, 4555, 1424, 4254, 631, 2978,
+	2979, 4556, 3818, 2980, 1615, 4991, 4255, 4256, 4257, 4557, 2981, 3819,
+	4258, 1616, 1425, 1737, 2982, 2983, 1738, 2984, 2185, 4992, 4259, 1426,
+	1427, 1206, 1429, 1430, 632, 3249, 2985, 3820, 1617, 1431, 1432, 3162,
+	1207, 4558, 4559, 861, 2986, 1618, 2987, 4993, 4994, 4995, 2186, 2988,
+	2989, 4996, 4997, 862, 863, 5285, 5286, 3821, 3822, 1433, 1208, 4998,
+	3250, 5287, 4999, 633, 3823, 1434, 4260, 5278, 1428, 864, 5000, 2990,
+	1619, 3824, 4560, 865, 5001, 4561, 634, 5535, 1053, 3825, 866, 1739,
+	635, 149, 5536, 5002, 1435, 4261, 3826, 5003, 4562, 5004, 5005, 3163,
+	636, 4262, 1209, 3827, 867, 4563, 2187, 5006, 1436, 1819, 2991, 5537,
+	868, 1210, 275, 22, 4263, 4564, 5538, 869, 432, 1740, 1741, 5007,
+	5539, 3828, 5008, 126, 1211, 1212, 3829, 637, 3251, 5288, 5009, 2992,
+	5010, 4565, 5011, 4264, 4265, 4266, 870, 2994, 5012, 3830, 638, 2993,
+	1213, 639, 640, 871, 641, 2995, 3831, 2996, 3164, 433, 1742, 3832,
+	4267, 2997, 276, 3833, 2998, 1437, 3252, 2999, 5013, 3000, 3001, 3002,
+	2188, 3003, 3004, 434, 127, 1438, 5014, 3834, 5540, 3007, 3005, 3006,
+	1214, 4268, 5015, 5016, 435, 5017, 5018, 1215, 3835, 3008, 5019, 642,
+	1620, 1439, 2189, 5299, 5020, 4269, 3009, 277, 3253, 5021, 3254, 4270,
+	5022, 3836, 3010, 3837, 3011, 2190, 1743, 643, 2191, 4271, 4566, 2192,
+	4567, 2193, 4568, 3838, 872, 2194, 873, 5023, 5024, 5025, 5026, 5169,
+	3013, 70, 644, 3014, 5541, 3015, 1216, 3016, 1217, 69, 3017, 278,
+	645, 3018, 1054, 1744, 1055, 5027, 4272, 2195, 3019, 3020, 3021, 5028,
+	2197, 5029, 3022, 1440, 46, 5030, 3023, 3255, 3165, 4569, 3839, 3024,
+	1441, 1442, 3025, 1218, 1219, 294, 2196, 3027, 3026, 2198, 1443, 3841,
+	1220, 5300, 2199, 1444, 1621, 3840, 3028, 646, 5542, 3029, 4273, 3030,
+	1445, 1221, 2200, 1222, 1622, 3031, 2201, 4274, 1623, 4275, 5031, 5032,
+	1446, 3842, 3843, 5033, 3032, 5168, 3012, 5034, 1223, 3844, 4570, 5170,
+	874, 3256, 5543, 436, 5035, 3033, 3845, 128, 3034, 1820, 3035, 875,
+	2202, 5544, 3036, 876, 5036, 5301, 4276, 1624, 1821, 5545, 2203, 2204,
+	647, 1224, 437, 2205, 5037, 1447, 1056, 3037, 3846, 877, 1448, 1449,
+	5038, 3038, 1626, 1057, 4571, 5171, 3166, 3847, 5302, 1450, 279, 1451,
+	2206, 438, 648, 649, 3848, 4572, 4277, 3849, 1452, 3257, 1627, 878,
+	3851, 3850, 5039, 5303, 3852, 129, 3853, 1628, 3854, 2207, 1225, 3039,
+	1058, 1629, 1630, 3855, 1453, 5172, 3856, 439, 3857, 280, 4573, 3040,
+	440, 1226, 3858, 441, 1631, 4278, 3859, 4279, 1059, 879, 3860, 1227,
+	4574, 5304, 3258, 2208, 1745, 880, 2209, 2210, 3041, 130, 4280, 5040,
+	5041, 1454, 2211, 5042, 3042, 4281, 3043, 3861, 2212, 3862, 5305, 5043,
+	3044, 3863, 5546, 1746, 5044, 3864, 1632, 3865, 3866, 5045, 5173, 3867,
+	71, 1060, 308, 3868, 3045, 650, 3869, 1061, 3870, 1455, 5046, 131,
+	1456, 2213, 4282, 3046, 47, 1062, 3871, 4283, 1822, 1228, 1229, 5047,
+	1457, 2214, 3872, 2215, 3047, 2216, 1747, 5174, 881, 5547, 3259, 1633,
+	5548, 281, 4284, 5048, 1634, 2217, 5306, 4285, 3873, 4286, 282, 5307,
+	5049, 48, 1063, 4287, 1194, 1230, 3874, 4575, 4576, 4288, 1635, 1231,
+	4577, 651, 4578, 4579, 3875, 652, 3048, 5050, 3049, 5051, 3050, 1823,
+	443, 444, 3051, 3052, 3053, 4289, 1824, 4290, 3054, 283, 132, 1636,
+	5308, 5052, 3876, 5053, 3877, 1232, 3878, 284, 1637, 1748, 285, 1064,
+	3260, 5054, 5055, 2218, 3879, 5056, 4580, 4291, 5057, 3055, 5058, 5059,
+	5060, 3880, 5175, 3056, 5061, 5062, 3057, 5549, 3261, 4581, 4582, 4583,
+	1638, 5550, 5063, 1458, 1639, 5064, 1233, 653, 5551, 4584, 4585, 2219,
+	286, 5065, 287, 654, 3881, 3058, 4586, 5066, 4292, 4293, 655, 3882,
+	3059, 1640, 5067, 5068, 5069, 5070, 1641, 4294, 3883, 445, 446, 656,
+	657, 3884, 3060, 3885, 5071, 1065, 5552, 5553, 4295, 4587, 3061, 658,
+	133, 2220, 3062, 3063, 2221, 2222, 1066, 3064, 3886, 2223, 3887, 3065,
+	3066, 3888, 4296, 5072, 3889, 2224, 150, 5554, 1459, 288, 1067, 1234,
+	1825, 2225, 3067, 1460, 1068, 4297, 2226, 3068, 882, 5073, 4298, 3069,
+	4588, 5309, 1749, 3890, 4299, 5074, 1235, 4300, 2227, 3891, 659, 3892,
+	5555, 5556, 3070, 289, 4589, 1069, 3071, 134, 2228, 883, 3072, 135,
+	5075, 1070, 49, 4590, 3893, 4591, 5557, 2229, 5076, 5310, 50, 51,
+	5078, 5079, 5077, 2230, 3262, 884, 2231, 3894, 3895, 3896, 5558, 5080,
+	4592, 3897, 4593, 3073, 3167, 3074, 4594, 660, 3075, 3898, 3899, 3076,
+	5559, 3077, 1071, 3263, 1236, 1461, 1072, 885, 3078, 2232, 2233, 886,
+	5311, 2234, 3900, 2235, 3079, 3264, 3080, 5081, 3168, 1237, 4302, 1642,
+	5312, 1238, 2236, 3901, 5082, 4303, 887, 5083, 1643, 3081, 4304, 2237,
+	3082, 3083, 3084, 1644, 1645, 3085, 5084, 5085, 5086, 661, 3169, 5560,
+	1646, 5087, 5176, 5561, 1239, 1750, 3086, 1073, 5088, 4595, 4596, 3087,
+	1462, 290, 5241, 5562, 1240, 5089, 5090, 5091, 888, 5092, 662, 3170,
+	5563, 5313, 3171, 3172, 21, 3902, 3903, 3089, 3090, 3091, 3092, 4307,
+	3093, 291, 5093, 3904, 5094, 5095, 1315, 4597, 3173, 3905, 2238, 5096,
+	1647, 309, 663, 292, 4308, 664, 3094, 3265, 3906, 3907, 2239, 889,
+	447, 2240, 3095, 4301, 2241, 5097, 4598, 448, 4309, 5098, 4599, 72,
+	4600, 4601, 1648, 293, 2242, 1463, 3908, 665, 4602,
+};
+
+static const uint16_t geo_hash[GEO_HASH_TAM] = {
+	0, 0, 0, 0, 3974, 0, 773, 0, 0, 0, 0, 0, 0, 3005, 4078, 0,
+	0, 2298, 2759, 0, 399, 0, 0, 0, 0, 0, 1799, 0, 173, 427, 0, 0,
+	0, 0, 2573, 0, 0, 0, 2935, 857, 733, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 538, 2864, 0, 3912, 0, 0, 1851, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3693, 2541, 0, 4246, 597, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4700, 0, 0, 0, 0, 2246, 0, 0, 2590, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3787, 0, 2516, 0, 3563, 0, 2288, 0, 845, 0, 0,
+	5485, 4378, 0, 0, 0, 0, 458, 5108, 0, 0, 3829, 0, 134, 1105, 1519, 4723,
+	0, 2164, 0, 0, 0, 0, 0, 4886, 0, 0, 0, 524, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 333, 0, 31, 0, 3468, 0, 0, 1007, 1645, 0, 4671,
+	1198, 0, 0, 0, 0, 0, 0, 0, 4404, 0, 3736, 0, 0, 0, 3513, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1748, 0, 0, 0, 4454, 0, 4926,
+	3227, 3334, 1468, 3674, 4856, 2106, 505, 0, 0, 1858, 0, 0, 5330, 0, 0, 0,
+	0, 3605, 0, 0, 0, 0, 0, 1509, 1918, 0, 3047, 0, 4123, 0, 0, 2032,
+	1323, 4578, 3872, 305, 5368, 0, 0, 0, 0, 1361, 0, 5270, 1962, 0, 0, 0,
+	4812, 0, 0, 0, 0, 1368, 0, 3351, 2651, 4897, 5523, 0, 2415, 0, 0, 858,
+	0, 258, 4388, 1054, 3282, 4546, 0, 0, 0, 0, 0, 4005, 0, 2701, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5070, 0, 0, 2992,
+	4064, 0, 0, 0, 0, 1262, 4512, 0, 0, 0, 0, 0, 1787, 0, 0, 0,
+	782, 2807, 5251, 0, 2561, 1712, 4260, 0, 0, 0, 0, 0, 3297, 0, 0, 0,
+	0, 2361, 0, 4179, 0, 2851, 0, 0, 0, 0, 92, 0, 0, 0, 5171, 0,
+	0, 0, 735, 0, 0, 0, 2403, 0, 4230, 0, 0, 0, 0, 0, 0, 4498,
+	0, 0, 0, 0, 2457, 4144, 0, 0, 0, 1639, 0, 0, 0, 1241, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3776, 0, 2503, 0, 0, 0, 2276, 3916, 0,
+	0, 0, 111, 4361, 4775, 0, 0, 0, 0, 0, 0, 0, 0, 4839, 418, 0,
+	0, 0, 2152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 506, 1146, 0,
+	0, 0, 1909, 3143, 0, 0, 0, 3682, 0, 0, 0, 3456, 0, 1588, 5084, 0,
+	0, 0, 1187, 0, 0, 0, 0, 0, 0, 0, 306, 0, 3721, 0, 0, 4755,
+	0, 0, 1630, 2343, 0, 0, 0, 0, 0, 0, 0, 0, 1459, 0, 3552, 0,
+	0, 3766, 0, 0, 4826, 0, 0, 2089, 485, 0, 0, 0, 0, 0, 4995, 3818,
+	0, 0, 605, 1094, 3593, 0, 0, 0, 0, 1496, 1903, 0, 364, 0, 0, 4017,
+	3400, 0, 925, 1309, 3858, 4562, 0, 0, 0, 0, 2200, 0, 1263, 5244, 1947, 0,
+	995, 5409, 0, 4659, 0, 0, 0, 0, 5254, 3338, 0, 0, 0, 0, 0, 0,
+	836, 0, 0, 234, 4368, 1042, 3268, 5449, 0, 0, 0, 2929, 0, 3990, 0, 2685,
+	0, 0, 4440, 0, 0, 5172, 0, 3543, 0, 0, 0, 3313, 0, 1845, 0, 0,
+	2978, 0, 4048, 0, 0, 3149, 0, 1245, 4499, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2795, 0, 0, 645, 0, 4688, 0, 0, 0, 0, 1298, 1825, 4352, 0,
+	0, 0, 0, 2350, 3087, 4164, 0, 159, 2840, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 711, 1994, 2627, 0, 0, 0, 4216, 0, 0, 219, 0, 0,
+	0, 0, 0, 905, 0, 2446, 0, 3981, 4131, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2734, 0, 0, 0, 2489, 4183, 0, 0, 0,
+	0, 0, 0, 0, 0, 4338, 0, 0, 0, 0, 4100, 0, 2908, 0, 681, 0,
+	0, 1692, 0, 0, 0, 0, 0, 0, 0, 0, 4982, 0, 0, 4940, 0, 1134,
+	0, 2955, 0, 0, 0, 445, 3123, 0, 0, 3669, 2392, 0, 0, 3444, 0, 1577,
+	5059, 0, 5006, 0, 1174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3709, 3636,
+	4730, 0, 0, 0, 2026, 0, 717, 5207, 0, 0, 0, 0, 0, 1444, 0, 0,
+	5146, 2264, 0, 0, 383, 0, 4803, 0, 0, 0, 0, 0, 5517, 0, 0, 0,
+	0, 3806, 0, 0, 1081, 1400, 0, 2139, 0, 5034, 0, 1892, 0, 0, 0, 0,
+	0, 488, 3390, 0, 0, 0, 3846, 4915, 0, 1124, 0, 316, 2185, 0, 0, 0,
+	0, 0, 981, 3660, 0, 4631, 0, 0, 0, 0, 0, 0, 0, 0, 4691, 0,
+	0, 2234, 0, 0, 3489, 0, 0, 1026, 1620, 5438, 0, 1217, 0, 2918, 0, 0,
+	0, 0, 0, 4423, 0, 3755, 3199, 0, 0, 3532, 0, 0, 5555, 0, 0, 1832,
+	4310, 0, 0, 2204, 0, 0, 0, 0, 4477, 0, 0, 0, 0, 1486, 0, 0,
+	2127, 3024, 0, 0, 1880, 2782, 913, 0, 5345, 0, 0, 0, 0, 1814, 0, 0,
+	0, 0, 0, 0, 0, 3067, 0, 4147, 0, 3429, 2054, 5297, 0, 3327, 0, 0,
+	0, 5152, 0, 0, 0, 821, 5312, 1849, 4354, 0, 0, 0, 0, 0, 205, 0,
+	0, 0, 0, 2674, 0, 1501, 0, 2433, 559, 0, 889, 0, 288, 0, 0, 3300,
+	0, 0, 0, 3642, 0, 2963, 4036, 0, 0, 2722, 3133, 0, 0, 0, 0, 0,
+	0, 164, 1767, 0, 0, 0, 0, 0, 0, 0, 0, 4084, 0, 0, 0, 800,
+	0, 403, 0, 0, 0, 0, 0, 2338, 1408, 0, 5220, 2827, 4966, 0, 0, 0,
+	1731, 0, 0, 0, 0, 0, 0, 3111, 0, 0, 0, 5142, 2380, 0, 4203, 0,
+	0, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2552, 4699, 0, 0, 0, 2014, 0, 0, 5061, 0, 0, 0, 662, 1176, 0,
+	0, 0, 0, 0, 0, 0, 0, 2598, 0, 0, 0, 0, 0, 0, 3333, 0,
+	0, 0, 3793, 3253, 0, 1681, 574, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 468, 0, 0, 0, 0, 0, 433, 5383, 0, 0, 0, 2171, 0,
+	0, 0, 0, 1566, 967, 3648, 5038, 642, 1164, 4609, 0, 0, 0, 0, 0, 0,
+	0, 0, 3699, 0, 39, 1367, 3474, 0, 1609, 0, 0, 0, 4935, 1205, 0, 0,
+	0, 0, 0, 0, 0, 4410, 0, 3742, 3185, 0, 4784, 495, 3519, 2063, 5124, 0,
+	4925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3239, 3909, 4639,
+	0, 0, 2115, 3009, 0, 5557, 0, 0, 900, 5337, 0, 0, 0, 0, 0, 1803,
+	0, 0, 0, 2560, 1925, 0, 0, 3054, 0, 0, 0, 3417, 0, 952, 4430, 0,
+	4393, 0, 0, 0, 0, 2222, 0, 802, 5287, 0, 4331, 0, 5428, 0, 0, 0,
+	0, 0, 0, 0, 0, 2657, 0, 0, 0, 2422, 0, 1417, 871, 0, 266, 4555,
+	1060, 0, 0, 0, 0, 3627, 2949, 2192, 4014, 56, 2708, 3118, 0, 0, 0, 0,
+	0, 0, 0, 0, 1757, 0, 0, 0, 0, 1868, 2554, 0, 2998, 4072, 0, 0,
+	0, 781, 1031, 1271, 4518, 5250, 0, 0, 0, 1793, 2325, 0, 5198, 0, 0, 0,
+	0, 0, 1720, 0, 0, 0, 846, 0, 0, 3305, 2605, 0, 0, 0, 2368, 0,
+	4041, 0, 0, 186, 4484, 0, 0, 0, 0, 0, 583, 0, 0, 3945, 0, 2788,
+	1885, 0, 0, 0, 0, 0, 0, 0, 0, 1287, 0, 0, 0, 0, 0, 643,
+	0, 2464, 3076, 0, 0, 0, 1646, 0, 370, 1199, 4763, 0, 0, 0, 0, 0,
+	0, 0, 2753, 0, 3781, 0, 0, 1668, 4208, 0, 211, 0, 0, 0, 708, 0,
+	4949, 3592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5133,
+	0, 4561, 0, 0, 0, 1549, 5015, 5331, 0, 0, 1152, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3689, 0, 17, 0, 3463, 0, 1594, 5092, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4395, 0, 3730, 0, 0, 0, 0, 0, 2048,
+	0, 752, 0, 0, 0, 0, 0, 0, 0, 1464, 0, 0, 0, 0, 3925, 0,
+	0, 0, 0, 0, 2097, 0, 0, 5544, 3365, 5058, 4928, 5326, 0, 0, 0, 1101,
+	4016, 0, 2160, 0, 0, 0, 0, 0, 0, 3634, 0, 0, 0, 3406, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2209, 784, 1352, 5253, 0, 4316, 1001, 0, 3259,
+	4666, 0, 3574, 2891, 1993, 5199, 0, 2645, 0, 0, 0, 0, 0, 1398, 176, 2852,
+	3508, 0, 1049, 0, 0, 0, 4280, 0, 313, 2937, 3996, 0, 0, 3106, 0, 4447,
+	0, 3223, 0, 4621, 0, 0, 874, 0, 0, 0, 1853, 0, 0, 0, 2226, 0,
+	0, 0, 0, 0, 1255, 0, 0, 2543, 4687, 0, 0, 2313, 3043, 679, 4118, 0,
+	0, 4416, 932, 5362, 1707, 0, 0, 0, 0, 1066, 0, 0, 2593, 0, 0, 0,
+	2953, 0, 761, 0, 167, 0, 4468, 0, 0, 0, 0, 569, 3209, 2408, 2882, 3932,
+	849, 2633, 2773, 4381, 5165, 350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2697,
+	622, 0, 0, 2452, 0, 0, 0, 0, 0, 4594, 0, 0, 0, 0, 0, 2263,
+	0, 0, 4059, 5294, 2740, 0, 0, 0, 0, 1656, 0, 0, 0, 1783, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 880, 4108, 0, 0, 0, 0, 413, 4939, 0,
+	0, 5119, 0, 0, 0, 0, 0, 1537, 4997, 0, 0, 0, 1140, 1750, 0, 0,
+	0, 0, 3903, 0, 0, 0, 3676, 2398, 4714, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1635, 0, 368, 0, 0, 0,
+	0, 2034, 0, 0, 5492, 0, 0, 0, 0, 3771, 0, 0, 537, 0, 0, 0,
+	0, 386, 0, 0, 0, 0, 3581, 0, 0, 3353, 5526, 0, 1485, 4899, 0, 0,
+	0, 1087, 0, 0, 2148, 4548, 0, 0, 0, 0, 0, 3621, 0, 0, 0, 3396,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1340, 4602, 3452, 0, 5076, 987,
+	4690, 0, 4646, 0, 0, 0, 1981, 0, 0, 0, 0, 0, 0, 0, 0, 1385,
+	0, 3495, 0, 0, 1034, 75, 1626, 4872, 4263, 0, 2924, 0, 0, 0, 3299, 5478,
+	4434, 0, 3761, 3210, 5381, 0, 0, 0, 2084, 0, 0, 0, 1838, 0, 0, 331,
+	0, 0, 0, 0, 0, 0, 0, 0, 3167, 2530, 4670, 0, 0, 2303, 3031, 0,
+	5183, 0, 0, 0, 921, 5348, 0, 0, 0, 0, 2825, 1820, 0, 0, 2578, 5238,
+	0, 0, 0, 0, 0, 2909, 152, 820, 4453, 0, 0, 0, 4854, 548, 4202, 2869,
+	2105, 3918, 830, 5157, 113, 4364, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2680, 0, 4251, 0, 0, 0, 4122, 0, 0, 0, 0, 938, 5367, 0, 0, 0,
+	0, 2251, 2970, 4044, 0, 5269, 2728, 3145, 0, 0, 0, 0, 0, 0, 0, 1772,
+	0, 5285, 0, 2521, 0, 0, 0, 0, 4092, 856, 0, 257, 0, 4387, 0, 0,
+	0, 0, 0, 0, 2345, 0, 745, 4004, 0, 1526, 0, 0, 0, 1737, 0, 0,
+	0, 0, 0, 0, 3890, 2622, 0, 0, 3664, 2387, 0, 4063, 0, 3165, 214, 4511,
+	0, 0, 0, 0, 0, 608, 0, 0, 3976, 0, 0, 0, 1204, 0, 0, 0,
+	0, 0, 0, 0, 0, 701, 0, 0, 4783, 0, 0, 4732, 0, 0, 4178, 0,
+	0, 0, 0, 0, 0, 0, 0, 3569, 0, 2295, 0, 3340, 0, 0, 1473, 4873,
+	0, 0, 1076, 1687, 0, 0, 2133, 5479, 0, 3835, 0, 0, 3610, 0, 0, 0,
+	0, 0, 3957, 1924, 0, 0, 0, 0, 0, 0, 0, 0, 1329, 4585, 3435, 3878,
+	1573, 974, 5045, 146, 337, 655, 4624, 0, 1969, 0, 0, 5425, 0, 0, 0, 3705,
+	0, 0, 0, 0, 0, 1615, 2021, 5239, 417, 0, 0, 0, 0, 265, 0, 1440,
+	3287, 5465, 0, 393, 3748, 3194, 0, 0, 504, 0, 2071, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 289, 0, 0, 0, 0, 0, 0, 0, 1186, 0, 2122,
+	4517, 0, 0, 3386, 5564, 907, 1516, 0, 0, 0, 1120, 0, 2813, 0, 0, 0,
+	0, 0, 0, 0, 3655, 0, 1458, 0, 801, 3424, 5286, 0, 0, 0, 0, 4185,
+	0, 0, 4150, 1374, 811, 0, 98, 4345, 1021, 3817, 0, 0, 0, 0, 2913, 0,
+	0, 0, 2668, 0, 0, 0, 0, 0, 1428, 0, 0, 0, 0, 0, 0, 0,
+	0, 4301, 0, 0, 2957, 4028, 0, 0, 1946, 3125, 994, 0, 0, 0, 0, 0,
+	0, 1762, 780, 0, 2509, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5448, 2568, 0, 0, 0, 2332, 0, 721, 5209, 0, 0, 4439, 0, 0, 1726,
+	0, 0, 0, 0, 0, 0, 0, 2611, 0, 0, 0, 2375, 2977, 0, 0, 0,
+	0, 4497, 0, 0, 0, 0, 0, 592, 0, 0, 3958, 0, 0, 0, 0, 0,
+	358, 0, 0, 0, 0, 0, 1297, 0, 0, 0, 4762, 0, 656, 0, 0, 0,
+	0, 0, 5426, 0, 0, 0, 0, 0, 0, 3557, 0, 2282, 0, 0, 0, 707,
+	0, 0, 0, 0, 1675, 0, 0, 0, 0, 0, 3823, 0, 0, 4956, 0, 0,
+	0, 0, 0, 0, 1908, 0, 0, 0, 0, 0, 0, 515, 5138, 0, 0, 0,
+	3863, 0, 1559, 4892, 5024, 0, 2208, 0, 0, 0, 0, 0, 0, 5414, 0, 0,
+	1193, 3695, 0, 0, 4099, 0, 0, 1601, 2010, 0, 0, 0, 0, 0, 246, 0,
+	0, 0, 3274, 0, 0, 1237, 0, 0, 0, 0, 0, 0, 2057, 5304, 0, 5504,
+	3329, 4994, 4841, 3548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4504, 1254, 0, 3372, 0, 894, 1503, 3241, 0, 0, 1107, 0, 2800, 2025,
+	4571, 0, 0, 0, 0, 959, 3644, 4658, 0, 0, 783, 3412, 1953, 0, 0, 3092,
+	0, 4170, 0, 0, 0, 1363, 793, 0, 83, 4324, 0, 0, 0, 0, 0, 0,
+	2897, 1999, 0, 0, 2652, 1891, 0, 0, 0, 0, 1410, 0, 487, 0, 0, 0,
+	0, 2451, 0, 4286, 0, 2943, 2184, 873, 4006, 3319, 3113, 0, 980, 0, 3231, 0,
+	0, 0, 0, 0, 2110, 0, 0, 0, 0, 0, 0, 2233, 0, 0, 0, 0,
+	0, 0, 0, 0, 2556, 0, 0, 0, 2320, 0, 689, 412, 1305, 0, 0, 941,
+	0, 0, 0, 0, 282, 2846, 710, 0, 0, 2600, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2689, 4958, 0, 0, 577, 4224, 5175, 5109, 3939, 863, 0, 136,
+	0, 912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4146, 0, 1595, 0, 0, 0, 0, 0, 2498, 0, 0, 0, 2270, 2994, 818,
+	5311, 0, 0, 0, 0, 0, 1662, 0, 0, 0, 1789, 0, 3811, 0, 0, 4938,
+	0, 0, 0, 0, 0, 0, 0, 286, 4996, 4843, 0, 0, 0, 497, 5127, 2363,
+	2962, 4035, 0, 0, 1543, 5005, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3911,
+	0, 3635, 1181, 3683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	635, 23, 3494, 4604, 0, 0, 4965, 1224, 0, 0, 0, 0, 0, 0, 0, 4433,
+	0, 5496, 0, 0, 4817, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,
+	0, 3179, 0, 3587, 0, 0, 3360, 5536, 0, 1491, 1898, 4622, 3029, 4914, 0, 0,
+	0, 0, 4557, 0, 3853, 0, 0, 0, 3629, 1819, 0, 0, 0, 0, 1941, 0,
+	0, 0, 0, 0, 0, 0, 0, 1346, 0, 0, 0, 5087, 1590, 0, 0, 0,
+	0, 5317, 2886, 1987, 0, 0, 942, 5443, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 85, 432, 0, 4270, 0, 3538, 0, 4576, 1461, 3307, 0, 0, 1565, 5036,
+	0, 0, 0, 0, 0, 2091, 0, 4487, 0, 3166, 0, 0, 0, 0, 0, 0,
+	0, 4595, 1888, 1608, 2790, 0, 2537, 0, 0, 0, 0, 0, 1289, 5296, 3402, 0,
+	0, 927, 0, 3079, 0, 4159, 0, 2833, 0, 0, 767, 0, 0, 4312, 0, 0,
+	881, 0, 274, 0, 0, 0, 0, 0, 2638, 0, 4210, 0, 213, 72, 287, 840,
+	2876, 119, 5358, 899, 0, 2441, 0, 0, 0, 0, 2932, 3992, 0, 0, 3101, 0,
+	0, 3053, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2484, 0, 0, 2257, 0,
+	0, 799, 3949, 3152, 0, 0, 0, 0, 0, 0, 0, 0, 2309, 0, 0, 0,
+	0, 0, 0, 0, 2421, 1703, 0, 193, 0, 0, 0, 0, 0, 0, 0, 475,
+	5115, 2352, 0, 754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3896, 2629, 5000, 1169, 0, 0, 0, 4071, 0, 0, 0, 0, 1270, 0, 0,
+	52, 4716, 616, 0, 0, 0, 2761, 0, 0, 0, 0, 366, 0, 0, 0, 0,
+	0, 0, 0, 3747, 5484, 0, 4793, 666, 0, 457, 1652, 0, 0, 0, 0, 0,
+	0, 3261, 3800, 0, 3576, 0, 0, 0, 3944, 0, 0, 1480, 0, 0, 0, 1694,
+	0, 0, 0, 0, 4536, 0, 3841, 0, 1533, 4986, 3616, 0, 2177, 0, 0, 0,
+	1930, 3168, 0, 5394, 0, 0, 0, 3671, 0, 1335, 0, 0, 0, 1579, 0, 0,
+	0, 2228, 0, 0, 0, 0, 0, 1020, 0, 0, 4694, 4948, 3591, 4649, 2834, 0,
+	0, 0, 2028, 4418, 0, 4855, 0, 0, 0, 3527, 275, 5132, 1068, 3293, 0, 0,
+	79, 1548, 0, 0, 0, 0, 0, 0, 4470, 0, 0, 5519, 0, 0, 0, 0,
+	15, 0, 0, 0, 1873, 2775, 5091, 0, 2525, 0, 0, 0, 0, 1809, 1277, 4524,
+	3392, 0, 915, 4392, 0, 3061, 4672, 4140, 0, 2820, 2047, 0, 0, 0, 0, 0,
+	0, 0, 0, 4149, 0, 0, 0, 1977, 0, 0, 0, 0, 4195, 0, 194, 0,
+	1381, 0, 0, 107, 0, 0, 5325, 2428, 0, 0, 0, 0, 2920, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2717, 0, 0, 0, 2470, 0, 0, 0,
+	0, 0, 0, 779, 5249, 3134, 0, 0, 0, 617, 0, 4079, 0, 0, 2299, 2762,
+	0, 0, 2644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2574,
+	0, 4278, 0, 0, 860, 734, 0, 3312, 0, 0, 0, 0, 0, 0, 0, 539,
+	2865, 0, 3913, 3884, 2617, 0, 1158, 0, 0, 477, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4247, 599, 0, 3042, 3436, 3967, 5046, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2247, 0, 0, 2592, 4774, 0, 0, 0, 0, 0, 760, 0, 0,
+	706, 0, 3788, 0, 2517, 0, 568, 3564, 2289, 3931, 848, 2853, 0, 0, 4380, 349,
+	0, 1682, 0, 460, 0, 0, 0, 0, 3830, 2696, 1106, 1520, 4970, 0, 2165, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 16, 525, 0, 0, 0, 0, 0, 0,
+	0, 0, 334, 2216, 0, 0, 3469, 0, 0, 1008, 5420, 0, 4673, 1200, 0, 0,
+	0, 0, 0, 0, 2016, 4405, 0, 3737, 0, 0, 0, 3514, 0, 0, 0, 0,
+	0, 0, 4993, 0, 0, 0, 0, 0, 0, 0, 4455, 0, 5507, 3229, 3335, 1469,
+	4858, 0, 0, 0, 0, 5549, 1860, 0, 0, 5333, 0, 0, 0, 0, 3606, 0,
+	0, 0, 0, 0, 1511, 0, 0, 3048, 0, 4125, 0, 0, 0, 1325, 4579, 3873,
+	308, 4802, 5370, 3650, 5491, 0, 0, 0, 5273, 1964, 0, 0, 0, 0, 0, 0,
+	175, 0, 1369, 0, 5525, 0, 0, 0, 0, 2416, 0, 0, 0, 0, 259, 4389,
+	1055, 3283, 0, 0, 0, 0, 0, 0, 0, 0, 2702, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5074, 5354, 0, 2993, 4065, 4645, 2747,
+	0, 0, 4513, 0, 0, 0, 0, 902, 0, 1788, 0, 0, 0, 2808, 5261, 3137,
+	0, 2562, 4114, 4262, 0, 281, 838, 709, 0, 0, 0, 0, 0, 3208, 0, 0,
+	4180, 0, 2854, 0, 0, 2688, 3099, 4957, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2404, 0, 584, 4231, 0, 0, 0, 0, 5182, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1640, 0, 5236, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3777, 0, 2504, 4201, 547, 5156, 2277, 0, 0, 389, 0, 0,
+	4363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2153,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 508, 1147, 2969, 0, 0, 0,
+	0, 5017, 0, 0, 322, 0, 0, 0, 3457, 0, 5086, 0, 0, 5028, 0, 1188,
+	0, 0, 0, 0, 1954, 0, 0, 0, 0, 3723, 0, 0, 4756, 466, 3502, 1631,
+	0, 0, 0, 0, 1231, 1525, 0, 0, 0, 1460, 0, 3553, 0, 0, 3323, 3216,
+	3767, 4830, 3178, 0, 2090, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 607,
+	1421, 3594, 0, 3975, 0, 0, 1497, 1904, 0, 3036, 0, 0, 0, 0, 0, 1310,
+	4563, 3859, 5355, 4782, 0, 0, 0, 2201, 0, 0, 0, 1948, 0, 0, 379, 5410,
+	0, 0, 0, 0, 1353, 5264, 0, 0, 4871, 0, 0, 0, 0, 0, 839, 0,
+	235, 4369, 1043, 3269, 5450, 0, 0, 0, 0, 0, 3991, 0, 2690, 0, 0, 0,
+	0, 0, 0, 0, 3544, 0, 0, 0, 3314, 3877, 1846, 0, 0, 2979, 0, 4050,
+	0, 2187, 1968, 4008, 1246, 4500, 0, 0, 0, 0, 0, 1777, 0, 5295, 0, 2796,
+	0, 0, 0, 2545, 0, 0, 2236, 0, 819, 1299, 1826, 0, 0, 0, 0, 3193,
+	2351, 3088, 4165, 273, 160, 2841, 5232, 0, 0, 78, 1742, 0, 5161, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4217, 0, 0, 222, 2121, 0, 0, 0, 0,
+	0, 0, 2447, 0, 0, 0, 2812, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2735, 0, 0, 0, 2490, 25, 0, 0, 0, 0, 0, 0,
+	0, 0, 4344, 0, 0, 0, 0, 4101, 192, 0, 0, 683, 0, 410, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4831, 0, 2462, 0, 1135, 0, 0, 0,
+	0, 0, 447, 4999, 0, 0, 3670, 2393, 0, 0, 571, 3445, 1578, 5060, 0, 0,
+	0, 1175, 0, 0, 0, 0, 0, 1311, 0, 0, 0, 3710, 0, 4731, 0, 0,
+	2331, 0, 0, 720, 0, 0, 0, 0, 0, 0, 1445, 0, 0, 5148, 2266, 0,
+	0, 384, 0, 4804, 0, 0, 2077, 236, 2374, 0, 0, 0, 0, 0, 3807, 0,
+	0, 591, 1082, 3582, 2140, 3956, 5037, 0, 1893, 0, 0, 0, 0, 0, 3391, 0,
+	0, 4549, 0, 3847, 0, 0, 1125, 0, 318, 2188, 4704, 1247, 0, 1936, 0, 982,
+	0, 0, 4633, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2237, 1674,
+	0, 3490, 0, 0, 1027, 1621, 0, 0, 1218, 0, 2919, 0, 0, 0, 0, 0,
+	4424, 0, 3756, 3200, 1436, 0, 514, 3533, 0, 0, 0, 0, 1833, 1558, 4889, 327,
+	0, 0, 0, 0, 0, 0, 4479, 0, 0, 0, 1487, 4902, 0, 2130, 3025, 4611,
+	0, 1881, 2009, 2783, 0, 5346, 0, 0, 0, 0, 0, 1047, 1283, 1815, 0, 0,
+	0, 0, 3068, 0, 4148, 0, 0, 2056, 1342, 4445, 0, 0, 0, 0, 5153, 0,
+	0, 0, 823, 2616, 1983, 4355, 5313, 0, 0, 0, 0, 206, 0, 0, 0, 3371,
+	2675, 0, 0, 0, 2434, 0, 3965, 890, 0, 0, 0, 4570, 1867, 0, 0, 0,
+	0, 0, 0, 4038, 0, 0, 2723, 0, 0, 2478, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2533, 4085, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4967, 0, 0, 0, 1732, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 5143, 2382, 0, 0, 0, 0, 58, 2109,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1758, 0, 0, 0, 0, 4705,
+	0, 3000, 0, 2015, 0, 0, 0, 0, 0, 0, 664, 4634, 0, 0, 0, 0,
+	2253, 0, 5080, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3794,
+	3254, 0, 0, 576, 1447, 227, 0, 862, 0, 0, 0, 0, 0, 0, 0, 0,
+	469, 3378, 0, 0, 0, 3836, 4891, 1113, 0, 0, 0, 2172, 0, 0, 0, 0,
+	5039, 968, 3649, 4904, 4612, 1165, 5389, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 40, 0, 3475, 0, 1610, 1014, 0, 0, 4679, 1206, 0, 2903, 2146, 5303, 0,
+	0, 0, 4411, 0, 3743, 3186, 0, 4786, 3521, 824, 2064, 5126, 0, 0, 0, 4291,
+	0, 0, 0, 0, 0, 0, 0, 4464, 0, 0, 3240, 0, 1475, 4643, 0, 2116,
+	3010, 0, 0, 2767, 0, 901, 4529, 5339, 0, 0, 634, 0, 1804, 0, 0, 0,
+	0, 1926, 1223, 0, 3055, 0, 4135, 0, 3418, 0, 954, 4432, 0, 0, 4815, 0,
+	0, 0, 2223, 0, 805, 5289, 0, 4333, 0, 4279, 0, 0, 0, 0, 0, 0,
+	0, 5535, 2661, 0, 0, 0, 2423, 0, 1419, 872, 0, 267, 0, 1062, 3289, 3852,
+	0, 0, 0, 2950, 0, 4019, 0, 2709, 3119, 0, 0, 0, 0, 0, 0, 0,
+	0, 1759, 0, 0, 0, 0, 0, 0, 0, 3001, 4073, 0, 5316, 0, 0, 1033,
+	1273, 4519, 5260, 0, 0, 0, 1795, 2326, 0, 5203, 2815, 0, 0, 0, 0, 1721,
+	0, 0, 0, 0, 724, 0, 0, 2606, 0, 0, 0, 2369, 0, 4188, 0, 0,
+	187, 4486, 0, 0, 0, 0, 0, 0, 0, 0, 3946, 0, 0, 1887, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 648, 0, 2466, 3078,
+	0, 0, 0, 1647, 766, 0, 340, 0, 41, 4311, 0, 0, 0, 5499, 0, 2754,
+	0, 3782, 0, 76, 1669, 2512, 0, 0, 0, 0, 0, 4842, 0, 0, 0, 0,
+	0, 0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5134, 0, 0, 0,
+	0, 0, 1551, 5016, 5377, 0, 0, 1153, 0, 0, 0, 0, 0, 3151, 0, 0,
+	0, 3690, 0, 22, 0, 3464, 0, 1596, 5094, 0, 0, 0, 1194, 137, 0, 0,
+	5274, 0, 0, 0, 4396, 0, 3731, 0, 0, 4767, 0, 5114, 2049, 0, 0, 437,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2098, 0, 0, 5546, 3366, 0, 0, 0, 3826, 51, 0, 1102, 0, 0, 0,
+	0, 5075, 0, 1914, 0, 0, 3638, 0, 0, 0, 3407, 0, 0, 0, 0, 296,
+	0, 0, 0, 0, 2211, 785, 0, 5263, 0, 4318, 1004, 3799, 0, 4667, 283, 0,
+	2892, 0, 0, 0, 2647, 0, 0, 0, 0, 0, 1404, 0, 3510, 126, 248, 1050,
+	4535, 0, 0, 4281, 4985, 2938, 0, 3998, 0, 0, 3107, 0, 4450, 0, 3224, 0,
+	0, 0, 0, 200, 0, 0, 0, 1855, 0, 0, 2988, 3233, 0, 0, 0, 3160,
+	0, 1256, 2711, 4506, 5237, 0, 0, 0, 2315, 3044, 4119, 5192, 2666, 0, 0, 0,
+	5364, 1708, 0, 0, 272, 3526, 0, 0, 0, 2594, 0, 0, 0, 2357, 3094, 762,
+	0, 169, 0, 0, 0, 0, 0, 0, 570, 5166, 2409, 2883, 3933, 0, 2634, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5018, 0, 0, 624, 0, 0,
+	2453, 0, 0, 0, 3948, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0,
+	0, 2742, 0, 0, 0, 0, 1657, 4194, 0, 191, 1784, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4109, 0, 0, 0, 0, 0, 0, 1699, 0, 0, 5120, 0,
+	0, 0, 0, 2716, 1538, 4998, 0, 0, 0, 1141, 1751, 0, 0, 0, 0, 3904,
+	0, 0, 0, 3677, 2399, 0, 0, 0, 2760, 1584, 0, 0, 400, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1636, 3717, 0, 0, 0, 0, 0, 2035, 0,
+	0, 5493, 0, 0, 0, 0, 3772, 1454, 0, 0, 0, 0, 0, 0, 4399, 0,
+	0, 0, 0, 0, 0, 0, 3354, 5527, 0, 4900, 0, 0, 0, 0, 598, 1088,
+	0, 2149, 0, 0, 0, 0, 0, 0, 3622, 0, 0, 0, 3397, 0, 0, 0,
+	0, 0, 3235, 0, 0, 0, 2195, 1341, 0, 0, 0, 0, 989, 0, 0, 4648,
+	0, 0, 0, 1982, 0, 0, 0, 0, 0, 0, 0, 0, 1386, 0, 459, 3496,
+	0, 1035, 1627, 0, 0, 4264, 0, 2925, 0, 3986, 0, 5482, 5277, 4435, 0, 3762,
+	3211, 0, 0, 0, 0, 2086, 0, 0, 0, 1840, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2531, 0, 2981, 148, 2304, 3032, 4626, 5184, 0, 0,
+	0, 922, 5349, 0, 0, 0, 0, 0, 1821, 5301, 0, 2580, 0, 0, 0, 0,
+	0, 0, 2912, 154, 0, 5467, 0, 3228, 0, 4857, 549, 5159, 2870, 0, 3919, 831,
+	0, 114, 1859, 4365, 5332, 0, 0, 0, 0, 0, 0, 0, 0, 2681, 0, 1510,
+	4252, 2442, 0, 4124, 0, 0, 0, 0, 1324, 5369, 307, 0, 0, 0, 2252, 2971,
+	4045, 0, 5271, 1963, 2729, 3146, 0, 0, 0, 0, 0, 0, 1773, 0, 0, 0,
+	0, 0, 0, 0, 0, 4093, 859, 0, 0, 0, 0, 408, 0, 0, 0, 0,
+	0, 2347, 0, 747, 0, 0, 1527, 4976, 0, 0, 1738, 1130, 0, 0, 0, 0,
+	0, 3891, 2623, 0, 534, 3665, 2388, 490, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 609, 0, 0, 3977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 705, 5079, 0, 0, 0, 4650, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3570, 5173, 0, 0, 3341, 5512, 0, 1474, 4875, 3262, 0, 1077,
+	1688, 0, 0, 2134, 0, 0, 0, 0, 0, 0, 3611, 0, 0, 0, 0, 0,
+	0, 0, 0, 4903, 0, 646, 0, 0, 0, 1330, 4586, 3440, 3880, 1574, 975, 5048,
+	149, 338, 4627, 0, 0, 1970, 0, 0, 0, 0, 0, 0, 3706, 0, 0, 0,
+	3482, 0, 1616, 0, 0, 419, 0, 0, 0, 0, 0, 0, 1441, 3288, 5468, 4419,
+	0, 3749, 3195, 0, 0, 507, 0, 2072, 0, 230, 1911, 1037, 1827, 0, 0, 0,
+	0, 0, 0, 0, 0, 5085, 0, 0, 0, 0, 0, 0, 19, 2123, 3020, 0,
+	3387, 0, 908, 0, 3722, 0, 0, 1121, 0, 1810, 2814, 0, 0, 0, 0, 1230,
+	0, 0, 0, 0, 0, 3425, 0, 0, 0, 0, 0, 4829, 4186, 0, 2859, 0,
+	0, 813, 5306, 100, 4346, 1022, 0, 0, 0, 3082, 0, 2914, 0, 0, 0, 2669,
+	0, 4236, 0, 0, 0, 1430, 884, 0, 0, 0, 0, 5353, 0, 0, 4302, 0,
+	0, 2958, 4029, 0, 2718, 3127, 0, 0, 0, 0, 0, 0, 0, 0, 1763, 0,
+	5259, 2511, 0, 1876, 0, 0, 0, 4080, 837, 0, 5202, 0, 0, 0, 0, 0,
+	0, 0, 5102, 2333, 1402, 178, 723, 2687, 2930, 5211, 0, 0, 1727, 0, 228, 0,
+	5149, 0, 0, 0, 2612, 0, 0, 0, 2376, 0, 4049, 0, 0, 199, 0, 0,
+	0, 0, 0, 0, 593, 0, 0, 3961, 0, 0, 0, 0, 0, 359, 0, 0,
+	0, 0, 0, 0, 0, 5049, 0, 4766, 0, 657, 0, 0, 0, 0, 0, 0,
+	691, 0, 0, 0, 0, 0, 3558, 0, 2283, 0, 0, 0, 0, 0, 0, 4787,
+	0, 1676, 0, 0, 221, 0, 0, 3824, 0, 0, 4961, 3599, 0, 0, 0, 0,
+	0, 1913, 0, 0, 0, 0, 0, 0, 516, 5139, 0, 1318, 0, 3865, 0, 1560,
+	5027, 0, 328, 0, 21, 0, 0, 0, 0, 0, 5415, 0, 0, 0, 3696, 0,
+	0, 0, 0, 0, 1602, 2011, 682, 4816, 0, 0, 0, 247, 0, 0, 0, 3276,
+	5455, 4983, 1239, 3738, 3177, 0, 0, 0, 0, 2058, 0, 0, 446, 0, 0, 0,
+	3549, 1420, 3248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4505,
+	0, 5550, 3373, 0, 895, 1504, 4303, 0, 0, 1108, 0, 2801, 0, 0, 0, 0,
+	0, 0, 0, 3645, 0, 0, 0, 3413, 2265, 1957, 5262, 0, 3093, 0, 4171, 0,
+	0, 0, 1364, 794, 0, 84, 4325, 1010, 0, 0, 0, 0, 0, 726, 2000, 2898,
+	0, 2653, 0, 0, 0, 0, 0, 1412, 0, 0, 0, 0, 0, 0, 4918, 0,
+	4287, 0, 317, 2186, 2944, 4007, 3320, 3114, 0, 0, 5398, 3232, 0, 4632, 0, 0,
+	1753, 0, 0, 0, 0, 0, 0, 0, 2235, 0, 0, 0, 0, 0, 1800, 0,
+	0, 2557, 0, 0, 0, 2321, 0, 692, 1307, 0, 0, 77, 947, 0, 1714, 0,
+	0, 0, 2847, 0, 5480, 0, 2601, 0, 0, 2440, 0, 4272, 0, 0, 0, 0,
+	4478, 0, 0, 0, 0, 579, 4226, 0, 2128, 3940, 864, 0, 0, 0, 914, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2704, 4745, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2499, 35, 0, 0, 2271, 2995, 822, 2835, 4068, 0,
+	0, 0, 0, 1664, 0, 0, 0, 1790, 0, 3812, 0, 0, 4942, 0, 0, 0,
+	561, 0, 0, 0, 0, 0, 0, 0, 0, 0, 499, 0, 2365, 0, 4037, 0,
+	0, 1544, 4864, 5008, 2194, 0, 0, 0, 0, 0, 0, 0, 5404, 0, 0, 1182,
+	3684, 0, 0, 0, 0, 0, 0, 0, 0, 961, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1225, 0, 0, 0, 0, 0, 0, 2041, 0, 0, 5497, 0,
+	0, 4819, 0, 0, 2381, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3588, 0, 0, 5538, 3361, 0, 1492, 4920, 0, 0, 4703, 1097, 0, 0, 0, 4558,
+	0, 3854, 0, 0, 663, 3630, 0, 0, 0, 0, 0, 1942, 0, 0, 0, 0,
+	0, 0, 0, 0, 1347, 0, 0, 0, 5088, 1591, 0, 4795, 0, 0, 0, 2887,
+	1989, 5266, 0, 5444, 0, 0, 0, 3726, 0, 1394, 0, 0, 0, 0, 0, 0,
+	4888, 0, 4273, 0, 0, 0, 0, 1462, 3308, 0, 0, 0, 0, 3219, 0, 4610,
+	0, 0, 2093, 0, 4491, 0, 3170, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2538, 0, 0, 0, 0, 0, 675, 1291, 5300, 0, 0, 928, 0,
+	0, 4785, 4160, 3520, 2836, 0, 0, 770, 2587, 0, 4313, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2641, 0, 562, 4211, 2877, 73, 3927, 841, 2766, 120, 4372,
+	0, 5338, 0, 0, 0, 0, 0, 0, 3993, 0, 0, 0, 0, 0, 0, 0,
+	4134, 0, 0, 0, 0, 953, 0, 0, 2485, 0, 0, 2258, 2984, 0, 804, 5288,
+	3153, 0, 4332, 4748, 0, 0, 0, 0, 0, 1779, 0, 0, 0, 2659, 0, 0,
+	0, 0, 1704, 1418, 0, 0, 0, 0, 1061, 0, 0, 0, 476, 5116, 2353, 0,
+	4018, 756, 438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3897, 2630,
+	0, 1170, 0, 0, 0, 0, 0, 0, 0, 0, 1272, 397, 0, 4717, 0, 619,
+	3481, 1794, 0, 0, 5078, 0, 1212, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5487, 0, 0, 4796, 0, 0, 0, 0, 0, 0, 0, 737, 0, 0, 0, 0,
+	0, 3577, 0, 0, 0, 3348, 0, 0, 1481, 4890, 0, 3019, 1695, 0, 0, 0,
+	0, 4538, 0, 3842, 0, 4987, 0, 3617, 2465, 2178, 0, 0, 3439, 1931, 0, 0,
+	5395, 2982, 4765, 0, 0, 0, 1336, 4597, 0, 0, 1580, 5065, 0, 0, 2229, 0,
+	5302, 0, 0, 0, 0, 5435, 0, 4696, 0, 0, 0, 0, 0, 450, 0, 2029,
+	0, 0, 0, 0, 4256, 0, 3528, 276, 0, 1070, 1449, 3294, 5474, 1550, 5376, 0,
+	0, 0, 0, 0, 2079, 4471, 0, 0, 0, 5026, 0, 0, 0, 18, 0, 0,
+	0, 1874, 2776, 5093, 0, 2526, 0, 0, 0, 0, 0, 1278, 4525, 3393, 5272, 917,
+	0, 0, 3062, 0, 4141, 0, 2821, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4196, 0, 196, 0, 1382, 826, 0,
+	108, 0, 0, 4293, 2429, 551, 0, 0, 0, 2921, 3982, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1264, 0, 0, 0, 295, 2471, 0, 0, 0, 2210, 0,
+	0, 5258, 3136, 4317, 1002, 4718, 0, 0, 0, 0, 0, 2300, 2763, 5201, 5178, 2646,
+	0, 0, 0, 0, 0, 1401, 2260, 3509, 0, 0, 0, 0, 2575, 0, 5174, 0,
+	2340, 0, 738, 3997, 0, 0, 4448, 0, 0, 0, 0, 0, 541, 2866, 5154, 3914,
+	3885, 2618, 1854, 1159, 0, 0, 0, 0, 0, 3159, 0, 0, 0, 0, 647, 32,
+	2544, 600, 2314, 4248, 3969, 680, 0, 0, 339, 0, 5363, 0, 0, 0, 0, 0,
+	2248, 0, 0, 0, 4777, 0, 665, 0, 0, 0, 0, 0, 168, 712, 0, 3789,
+	0, 0, 0, 3565, 0, 2290, 0, 0, 0, 0, 0, 0, 0, 0, 1683, 0,
+	0, 0, 1912, 0, 0, 3831, 0, 1522, 623, 4971, 0, 2166, 0, 0, 1919, 0,
+	0, 0, 5386, 4744, 0, 20, 526, 3661, 0, 0, 0, 2741, 1568, 0, 0, 335,
+	2217, 0, 0, 3470, 0, 0, 1009, 0, 0, 4674, 1201, 0, 0, 0, 0, 0,
+	0, 2017, 4406, 0, 0, 0, 0, 0, 3515, 0, 0, 0, 0, 0, 0, 0,
+	4846, 5359, 0, 197, 0, 0, 5545, 4456, 0, 5509, 3336, 0, 1470, 4862, 0, 0,
+	0, 0, 0, 1861, 0, 0, 0, 0, 4879, 0, 0, 3607, 0, 1265, 0, 3381,
+	0, 1512, 0, 3716, 3049, 0, 4126, 0, 0, 0, 1326, 4581, 5371, 0, 0, 0,
+	3651, 139, 0, 0, 0, 0, 1965, 0, 0, 0, 0, 0, 1403, 179, 725, 1370,
+	0, 0, 94, 0, 0, 0, 2417, 4833, 0, 0, 2905, 0, 0, 0, 5463, 4917,
+	0, 0, 0, 0, 1424, 0, 0, 2703, 0, 0, 0, 2458, 4238, 4297, 0, 0,
+	0, 63, 0, 0, 3120, 0, 988, 0, 601, 0, 4066, 4647, 2748, 4031, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2563, 4115,
+	0, 0, 0, 0, 713, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2855,
+	2085, 0, 0, 2607, 1839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2405, 0, 4232, 586, 0, 0, 3947, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2826, 0, 1641, 0, 2579, 0, 0, 2547, 4617, 0, 0, 0, 0, 0, 0,
+	0, 3778, 0, 2505, 0, 0, 5158, 2278, 0, 0, 0, 0, 0, 0, 0, 0,
+	1670, 0, 0, 5100, 0, 0, 3819, 0, 0, 1096, 4952, 0, 2155, 4219, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 509, 1148, 5135, 0, 0, 0, 0, 0, 0,
+	0, 324, 0, 0, 0, 3458, 0, 0, 996, 0, 0, 4661, 1189, 0, 0, 0,
+	0, 0, 0, 2005, 0, 0, 3725, 0, 0, 4758, 651, 3503, 2346, 0, 746, 0,
+	0, 1232, 0, 0, 0, 0, 0, 0, 0, 4441, 0, 3324, 3218, 3768, 4834, 0,
+	0, 0, 0, 0, 0, 0, 0, 4919, 0, 0, 0, 0, 0, 3595, 0, 0,
+	0, 0, 0, 1498, 1905, 3234, 3037, 0, 0, 0, 0, 0, 1313, 4565, 3860, 0,
+	0, 0, 3639, 0, 2202, 0, 0, 0, 1949, 0, 0, 299, 0, 0, 0, 0,
+	0, 1355, 0, 0, 0, 4874, 0, 0, 0, 0, 0, 0, 0, 239, 1995, 1044,
+	3270, 4370, 5452, 0, 0, 0, 0, 0, 0, 250, 2691, 0, 0, 0, 0, 0,
+	0, 2129, 3545, 0, 0, 3315, 3437, 3879, 4490, 5047, 2980, 147, 4052, 4625, 0, 0,
+	0, 1249, 4501, 5427, 0, 0, 0, 0, 1778, 0, 0, 0, 2797, 0, 5434, 0,
+	2548, 0, 0, 0, 0, 0, 1301, 5466, 0, 0, 0, 0, 0, 3089, 0, 4166,
+	5233, 161, 2842, 0, 0, 0, 80, 1743, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4220, 0, 0, 223, 0, 1406, 0, 129, 0, 0, 0, 2448,
+	0, 0, 0, 0, 0, 0, 0, 0, 3109, 0, 0, 0, 0, 0, 0, 0,
+	0, 2736, 0, 0, 4747, 2492, 0, 0, 0, 4152, 0, 812, 0, 0, 99, 0,
+	0, 0, 0, 0, 4102, 0, 0, 0, 686, 0, 0, 0, 0, 0, 0, 0,
+	1429, 57, 0, 0, 0, 0, 0, 2596, 0, 489, 1136, 0, 0, 0, 0, 3126,
+	0, 0, 0, 0, 0, 0, 0, 572, 3447, 5063, 3936, 0, 2510, 0, 1177, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3711, 0, 0, 4735, 0, 0, 0, 0,
+	722, 5210, 0, 0, 0, 0, 0, 1446, 0, 0, 0, 0, 0, 0, 4969, 0,
+	4805, 0, 0, 2078, 240, 1659, 0, 0, 0, 0, 0, 3808, 0, 0, 1083, 3583,
+	0, 0, 3959, 5529, 0, 1894, 0, 0, 0, 0, 0, 0, 0, 3438, 4551, 0,
+	3848, 0, 0, 1126, 0, 0, 2189, 0, 0, 0, 1937, 0, 983, 5400, 0, 4636,
+	0, 3430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2239, 0, 0, 3491, 0,
+	0, 1028, 5439, 0, 0, 1219, 4959, 0, 0, 0, 0, 0, 1910, 4426, 0, 0,
+	3203, 0, 0, 3534, 291, 0, 0, 3301, 3864, 1834, 0, 4894, 2964, 0, 0, 0,
+	0, 0, 0, 4480, 0, 0, 0, 4908, 0, 702, 2131, 3026, 4614, 0, 1882, 2785,
+	0, 0, 0, 0, 0, 0, 0, 0, 1284, 1816, 3275, 0, 0, 1238, 3176, 2339,
+	3069, 4154, 5221, 2828, 0, 2660, 0, 0, 0, 0, 0, 4103, 0, 0, 0, 0,
+	5314, 1984, 0, 0, 0, 0, 4204, 0, 208, 0, 0, 0, 0, 0, 0, 0,
+	0, 2435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1955, 2724, 0, 2480, 0, 0, 0, 0, 0, 1768, 5200, 0, 0,
+	0, 0, 0, 0, 0, 4086, 0, 0, 0, 0, 668, 404, 0, 0, 0, 0,
+	0, 0, 1411, 0, 0, 0, 0, 0, 0, 0, 1733, 0, 0, 0, 0, 0,
+	0, 435, 0, 0, 0, 0, 2383, 0, 0, 555, 2872, 60, 1567, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3700, 0, 4706, 0, 0, 0,
+	0, 0, 690, 1306, 0, 0, 943, 0, 0, 0, 0, 0, 0, 2254, 0, 0,
+	375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3795, 3255, 0, 0,
+	578, 3571, 4225, 0, 0, 0, 0, 0, 0, 353, 4807, 0, 0, 471, 3379, 5558,
+	0, 0, 3837, 0, 4743, 1114, 0, 0, 2173, 0, 0, 0, 0, 0, 970, 4909,
+	5390, 4615, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 1663,
+	3476, 0, 1611, 1016, 5429, 0, 4681, 1207, 3070, 2904, 4941, 0, 0, 0, 0, 4412,
+	0, 3744, 3187, 0, 0, 498, 3522, 156, 2065, 2364, 0, 0, 4294, 5007, 552, 0,
+	0, 0, 0, 0, 4465, 0, 0, 3243, 0, 1477, 4878, 0, 2117, 3011, 0, 0,
+	1869, 2768, 0, 5340, 0, 0, 0, 0, 0, 1805, 0, 0, 0, 1003, 1927, 0,
+	0, 3056, 0, 4136, 0, 3419, 0, 955, 1332, 0, 0, 4818, 0, 0, 0, 0,
+	0, 806, 0, 1973, 4334, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5537, 2663,
+	4449, 4916, 0, 2424, 542, 3030, 876, 0, 269, 5229, 1064, 3290, 5471, 0, 0, 0,
+	0, 2951, 4021, 62, 2710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2522, 3002, 4074, 5318, 1988, 0, 1274, 4521, 946, 5265,
+	0, 0, 0, 1796, 2327, 0, 0, 2816, 4950, 86, 0, 0, 1722, 4271, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2370, 0, 4189, 0, 0, 741, 2092, 4000,
+	4488, 0, 0, 0, 0, 0, 0, 0, 0, 2791, 0, 0, 0, 0, 0, 4091,
+	0, 0, 0, 1290, 674, 0, 0, 0, 0, 34, 649, 2467, 4616, 0, 0, 0,
+	1648, 768, 371, 0, 0, 0, 0, 0, 0, 0, 5500, 0, 0, 0, 3783, 0,
+	2513, 2639, 560, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 453,
+	0, 0, 0, 0, 4863, 0, 0, 0, 0, 2161, 0, 0, 0, 0, 0, 1552,
+	4880, 5020, 5378, 3012, 517, 1155, 0, 0, 0, 0, 0, 0, 0, 0, 3691, 0,
+	27, 0, 3465, 0, 1597, 5095, 0, 0, 0, 1196, 0, 0, 0, 0, 0, 0,
+	0, 4398, 0, 3732, 0, 0, 4770, 0, 0, 2051, 0, 755, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3561, 0, 0, 0, 0, 0, 0, 0, 0, 2099, 0,
+	0, 0, 3367, 0, 0, 5327, 3827, 0, 3678, 1103, 3480, 4022, 0, 0, 0, 0,
+	1211, 1915, 0, 0, 0, 0, 0, 3408, 0, 934, 0, 5486, 298, 4794, 0, 0,
+	0, 2212, 786, 0, 0, 0, 4319, 1005, 5416, 0, 4668, 0, 0, 2893, 238, 5481,
+	3347, 2648, 4887, 0, 0, 0, 0, 1405, 851, 0, 127, 249, 1051, 3278, 4383, 4537,
+	4282, 0, 2939, 0, 4001, 0, 2698, 3108, 5540, 4451, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1856, 0, 0, 2989, 0, 4060, 0, 5299, 3162, 0, 1258, 4507,
+	0, 0, 4695, 0, 0, 2316, 0, 4120, 5193, 2804, 0, 2506, 0, 0, 1709, 0,
+	0, 0, 0, 1069, 0, 0, 2595, 0, 0, 0, 2358, 3095, 763, 4174, 0, 170,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3935, 0, 2635, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 916, 625, 0, 2454, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2743, 0,
+	0, 0, 2500, 1658, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4110, 0, 0, 0, 0, 0, 414, 1700, 0, 0, 5121, 0, 0, 0, 0,
+	0, 1539, 5001, 0, 0, 0, 1143, 0, 0, 0, 0, 0, 3135, 0, 0, 0,
+	3679, 2400, 0, 0, 3453, 0, 1585, 5077, 0, 0, 0, 1183, 0, 0, 0, 0,
+	0, 0, 0, 300, 0, 3718, 0, 0, 4751, 0, 0, 2036, 0, 736, 5494, 0,
+	0, 0, 0, 0, 1455, 0, 540, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 251, 0, 3356, 5528, 0, 0, 0, 3814, 0, 0, 1090, 0, 0, 2150, 3968,
+	0, 0, 1900, 0, 0, 3623, 0, 0, 501, 2102, 3398, 0, 0, 0, 0, 4776,
+	0, 0, 0, 2196, 0, 5241, 0, 0, 0, 990, 5406, 0, 4652, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1387, 0, 3497, 229, 0, 1036, 1628,
+	0, 0, 1521, 4266, 2926, 0, 3987, 0, 0, 0, 4436, 0, 3764, 3213, 0, 0,
+	3540, 0, 0, 0, 0, 0, 1841, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1242, 4492, 5421, 0, 0, 0, 0, 2305, 3033, 0, 5185, 0, 0, 0, 923, 5350,
+	0, 0, 4153, 0, 0, 1822, 3484, 0, 2581, 0, 0, 0, 3081, 0, 0, 0,
+	155, 0, 0, 0, 3230, 5508, 4859, 550, 0, 2871, 0, 3920, 833, 0, 115, 4366,
+	0, 0, 0, 0, 0, 216, 0, 0, 0, 0, 0, 2683, 4253, 0, 2443, 0,
+	0, 0, 0, 0, 0, 4580, 0, 0, 0, 0, 0, 0, 138, 2973, 4046, 5275,
+	2730, 3147, 0, 4736, 0, 0, 0, 0, 177, 1774, 0, 0, 0, 93, 0, 0,
+	2296, 0, 0, 4094, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2348, 0,
+	0, 0, 5227, 1528, 4978, 0, 0, 0, 1131, 1739, 3960, 5530, 0, 0, 3892, 0,
+	0, 0, 3666, 2389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2022, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 4960, 0,
+	0, 0, 0, 0, 0, 3342, 5513, 0, 4876, 0, 3263, 0, 1078, 585, 1689, 0,
+	2135, 0, 0, 0, 0, 0, 0, 3612, 0, 0, 0, 0, 0, 1517, 0, 0,
+	443, 0, 0, 0, 0, 2180, 1331, 4588, 3441, 3881, 1575, 977, 3656, 150, 4628, 46,
+	5054, 0, 1972, 0, 0, 0, 0, 0, 0, 3707, 0, 1376, 3432, 3485, 0, 0,
+	1617, 0, 4845, 0, 1095, 0, 0, 2154, 0, 1442, 5470, 0, 4420, 0, 3750, 3196,
+	4861, 0, 0, 0, 2074, 0, 0, 0, 1828, 0, 3637, 323, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4660, 0, 0, 2124, 3021, 0, 1956, 0, 0, 909,
+	0, 3724, 0, 4757, 0, 0, 1811, 1632, 0, 0, 2569, 0, 0, 0, 0, 0,
+	0, 0, 3426, 0, 0, 0, 3217, 0, 4832, 0, 0, 2860, 0, 261, 814, 1294,
+	101, 4347, 5308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2670, 0, 4237, 0,
+	2430, 0, 1432, 885, 61, 0, 4564, 1073, 0, 0, 0, 0, 0, 0, 2959, 4030,
+	0, 2719, 3129, 0, 0, 0, 0, 0, 0, 0, 0, 1764, 1354, 0, 0, 945,
+	1878, 0, 0, 0, 4081, 0, 0, 5204, 0, 0, 0, 4327, 5451, 0, 0, 5103,
+	2334, 0, 729, 5215, 0, 0, 0, 0, 0, 1728, 0, 0, 0, 0, 0, 0,
+	0, 2613, 0, 0, 0, 2377, 0, 4051, 0, 0, 203, 0, 0, 0, 0, 0,
+	0, 594, 0, 0, 3962, 0, 0, 0, 0, 0, 2546, 0, 0, 0, 0, 0,
+	1300, 0, 0, 0, 0, 0, 659, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3560, 0, 2285, 0, 3330, 0, 4847, 0, 0, 0, 0, 1678, 4218,
+	2066, 0, 0, 0, 0, 0, 3751, 4962, 3601, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 5140, 0, 1319, 4572, 3866, 0, 1562, 960, 5030, 2491,
+	4606, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3697, 0, 36, 0, 3471,
+	0, 1603, 2012, 684, 0, 0, 0, 0, 0, 0, 0, 0, 3277, 5456, 4407, 1240,
+	3739, 3181, 0, 0, 0, 0, 2059, 0, 0, 4348, 0, 0, 0, 0, 0, 0,
+	0, 3446, 0, 0, 5062, 0, 0, 0, 0, 0, 0, 2111, 3006, 0, 5551, 3375,
+	0, 896, 1505, 4307, 5334, 4733, 1109, 0, 2802, 2168, 0, 0, 0, 0, 0, 0,
+	3646, 0, 0, 0, 3414, 0, 0, 0, 0, 0, 0, 4173, 0, 0, 0, 237,
+	796, 1365, 87, 4328, 1011, 5276, 0, 4676, 0, 0, 2900, 2002, 5216, 0, 2654, 0,
+	0, 0, 0, 0, 1413, 0, 0, 4489, 4550, 0, 0, 0, 0, 4288, 0, 2945,
+	0, 4010, 0, 3321, 3115, 0, 0, 5399, 3237, 0, 4635, 0, 0, 1754, 0, 0,
+	0, 1863, 0, 0, 0, 2238, 0, 0, 0, 0, 769, 0, 0, 0, 2558, 0,
+	0, 0, 2322, 0, 693, 0, 0, 0, 0, 949, 2640, 1715, 3201, 0, 290, 2848,
+	0, 0, 0, 2602, 0, 0, 0, 0, 0, 0, 0, 0, 182, 0, 0, 0,
+	0, 0, 580, 4227, 4905, 2419, 3941, 865, 2784, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2705, 4746, 636, 0, 4243, 4151, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2272, 0, 4069, 0, 0, 0, 0, 0, 394,
+	1665, 0, 0, 207, 1791, 0, 3813, 0, 0, 4944, 0, 0, 0, 3966, 0, 0,
+	1899, 0, 0, 0, 0, 0, 3250, 500, 5130, 0, 0, 0, 0, 0, 1545, 5009,
+	0, 2479, 618, 0, 0, 0, 0, 0, 0, 5405, 0, 0, 0, 3686, 0, 0,
+	0, 0, 0, 0, 0, 667, 964, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4968, 1226, 1643, 0, 0, 0, 0, 0, 2042, 0, 0, 434, 0, 0, 4821, 3539,
+	0, 0, 478, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 3589, 0, 0,
+	0, 3362, 0, 1493, 4922, 0, 0, 0, 1098, 0, 0, 0, 4559, 0, 0, 0,
+	0, 0, 3631, 0, 0, 0, 3403, 0, 1943, 0, 0, 3080, 0, 0, 0, 0,
+	0, 1349, 0, 3461, 0, 5089, 998, 0, 0, 0, 0, 0, 694, 1990, 2888, 0,
+	5445, 0, 4390, 0, 0, 0, 1395, 0, 470, 0, 0, 0, 0, 0, 0, 4275,
+	0, 2933, 0, 0, 0, 3103, 3309, 0, 969, 0, 3220, 0, 4613, 0, 0, 2094,
+	0, 0, 0, 3173, 0, 0, 0, 5320, 0, 42, 0, 0, 0, 1015, 0, 0,
+	2539, 4680, 0, 0, 2310, 0, 676, 1292, 5188, 0, 0, 929, 0, 0, 0, 0,
+	0, 2837, 0, 0, 0, 2588, 5247, 4292, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3242, 0, 0, 563, 1476, 2879, 74, 3928, 843, 4212, 121, 424, 4373, 5162, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2693, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2486, 0, 0, 2259, 2985, 4054, 0, 0, 3155, 0, 0,
+	0, 638, 1653, 0, 0, 0, 1780, 0, 3801, 0, 2662, 0, 0, 0, 0, 1705,
+	875, 0, 268, 0, 0, 1063, 0, 0, 0, 479, 5117, 2354, 0, 4020, 757, 440,
+	1534, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 3899, 2631, 0, 1171, 3672,
+	2395, 0, 0, 0, 0, 0, 4520, 0, 0, 0, 4721, 0, 620, 0, 0, 0,
+	0, 0, 0, 1213, 0, 0, 0, 0, 0, 3, 0, 0, 0, 5213, 5488, 0,
+	4798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3578, 0,
+	0, 0, 3349, 5520, 0, 1482, 4895, 0, 0, 1696, 1084, 0, 0, 0, 4540, 0,
+	3843, 0, 0, 0, 3618, 0, 602, 0, 0, 0, 1932, 5053, 0, 0, 343, 5321,
+	45, 0, 0, 1337, 4599, 0, 0, 1581, 5066, 0, 0, 2230, 0, 0, 0, 1978,
+	0, 0, 0, 0, 0, 0, 3713, 0, 0, 0, 452, 0, 2030, 1623, 0, 4860,
+	0, 4257, 0, 3529, 277, 0, 1071, 1450, 3295, 5475, 5019, 0, 3204, 0, 0, 1154,
+	0, 2081, 4473, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2777, 0,
+	0, 0, 2527, 0, 1195, 0, 0, 0, 1279, 4526, 3394, 0, 918, 4397, 0, 3063,
+	4768, 4142, 0, 2822, 2050, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4197, 0, 1423, 0, 1383, 827, 5228, 109, 4359, 0,
+	0, 0, 0, 0, 0, 0, 441, 2922, 3983, 0, 0, 0, 0, 0, 565, 0,
+	0, 0, 0, 0, 933, 0, 297, 2472, 0, 0, 0, 2966, 0, 0, 0, 3139,
+	944, 0, 4722, 0, 0, 0, 0, 0, 1769, 2301, 2764, 2518, 5179, 0, 0, 0,
+	0, 0, 850, 0, 0, 0, 4382, 0, 0, 2576, 0, 461, 0, 2341, 0, 740,
+	3999, 0, 0, 0, 0, 0, 0, 0, 0, 545, 0, 202, 3915, 3886, 2619, 0,
+	1160, 0, 0, 0, 0, 0, 3161, 0, 1257, 0, 0, 0, 33, 0, 603, 0,
+	0, 3970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3790, 0, 0, 0,
+	3566, 5167, 2291, 3934, 2031, 0, 0, 0, 0, 0, 0, 1684, 0, 0, 0, 0,
+	0, 0, 3832, 0, 1523, 4972, 0, 0, 2167, 0, 0, 1921, 0, 0, 0, 5387,
+	0, 0, 528, 3662, 0, 0, 0, 309, 3874, 1569, 5042, 0, 0, 2218, 0, 0,
+	0, 0, 0, 0, 5422, 0, 4675, 1202, 0, 0, 0, 0, 0, 0, 2018, 0,
+	0, 0, 0, 0, 0, 3516, 262, 0, 1056, 1437, 3284, 0, 0, 0, 0, 0,
+	1142, 0, 0, 2068, 4457, 0, 0, 3337, 0, 4867, 0, 0, 0, 0, 0, 1312,
+	1862, 0, 0, 0, 4306, 0, 0, 0, 0, 520, 1266, 4514, 3382, 5561, 903, 1513,
+	2473, 3050, 0, 4127, 0, 2809, 0, 4583, 5373, 0, 0, 0, 0, 3652, 0, 0,
+	0, 0, 0, 1966, 0, 0, 0, 0, 4181, 0, 180, 0, 1371, 808, 3355, 95,
+	4901, 0, 0, 2418, 0, 1089, 0, 2906, 0, 0, 3169, 5539, 0, 0, 0, 0,
+	0, 1425, 0, 0, 1248, 0, 0, 0, 2459, 0, 4298, 0, 0, 0, 4603, 0,
+	5240, 3121, 0, 0, 0, 0, 0, 4651, 0, 2749, 0, 0, 0, 0, 0, 0,
+	4711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2565, 4116, 4265, 0, 2328,
+	0, 715, 421, 0, 0, 0, 0, 3212, 3763, 0, 0, 5144, 2856, 0, 0, 0,
+	2608, 0, 0, 0, 0, 463, 0, 0, 0, 0, 0, 0, 0, 2532, 0, 4233,
+	587, 0, 0, 3951, 0, 0, 0, 0, 0, 355, 0, 0, 0, 0, 0, 0,
+	1642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 685, 0, 3779, 0,
+	2507, 0, 3554, 0, 2279, 0, 832, 0, 0, 0, 0, 0, 0, 1671, 0, 0,
+	215, 0, 0, 3820, 0, 2682, 4953, 0, 0, 2156, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 510, 5136, 2972, 0, 0, 0, 0, 1554, 0, 0, 325, 4734,
+	0, 0, 3460, 0, 0, 997, 5411, 0, 4662, 1190, 2494, 4128, 0, 0, 0, 0,
+	2006, 0, 0, 0, 0, 0, 143, 652, 3504, 0, 0, 0, 0, 4977, 1233, 0,
+	0, 0, 0, 0, 0, 0, 4442, 0, 3325, 3769, 5501, 4835, 0, 0, 0, 492,
+	0, 0, 1847, 0, 0, 0, 0, 0, 0, 0, 3596, 0, 0, 0, 3368, 0,
+	448, 1499, 1906, 3038, 0, 0, 0, 0, 0, 1315, 4567, 3861, 5356, 0, 0, 3640,
+	0, 0, 0, 0, 5246, 1950, 0, 0, 0, 0, 0, 0, 0, 1448, 1357, 0,
+	0, 4425, 0, 3202, 0, 0, 0, 0, 0, 2894, 242, 1996, 1045, 3271, 4893, 0,
+	0, 0, 0, 0, 0, 0, 2692, 0, 0, 0, 4907, 0, 4283, 0, 3546, 0,
+	4587, 0, 3316, 0, 0, 976, 5050, 0, 0, 4053, 0, 0, 1971, 0, 1250, 4502,
+	0, 0, 0, 891, 0, 0, 1375, 0, 3483, 2798, 0, 0, 0, 2549, 0, 0,
+	0, 0, 0, 1302, 5469, 4357, 0, 0, 0, 0, 3090, 0, 4168, 0, 2843, 2073,
+	0, 790, 0, 81, 1744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2394,
+	0, 4221, 0, 0, 224, 0, 0, 0, 131, 0, 0, 5343, 0, 2449, 0, 0,
+	0, 0, 0, 0, 0, 3110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2495, 4187, 0, 2267, 0, 0, 0, 5307, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2318, 0, 0, 0, 0, 4929, 0, 0, 2141, 0, 1431, 0, 0,
+	0, 0, 0, 0, 0, 0, 493, 1137, 0, 0, 0, 0, 3128, 0, 0, 0,
+	0, 0, 0, 0, 3448, 0, 0, 0, 3138, 3907, 1877, 1178, 0, 351, 0, 0,
+	0, 0, 0, 0, 0, 3712, 0, 0, 4738, 628, 2, 1622, 0, 727, 5212, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3757, 5495, 0, 4806, 0, 0,
+	0, 243, 1660, 0, 0, 0, 0, 0, 3809, 0, 0, 0, 3584, 0, 0, 0,
+	0, 0, 1488, 1895, 0, 0, 0, 0, 0, 0, 0, 4552, 0, 3849, 0, 342,
+	658, 44, 1127, 1541, 2190, 1251, 3624, 1938, 4708, 984, 5401, 0, 4638, 0, 3431, 2284,
+	1343, 3559, 0, 0, 4844, 0, 0, 0, 2240, 1677, 0, 0, 0, 4358, 1029, 3825,
+	5440, 0, 0, 3600, 0, 0, 0, 0, 2676, 0, 4429, 0, 0, 0, 0, 0,
+	3535, 292, 0, 0, 3303, 4531, 1835, 1561, 5029, 2965, 0, 4039, 4605, 0, 0, 0,
+	4482, 0, 0, 0, 0, 0, 0, 2132, 0, 0, 0, 1883, 2786, 0, 0, 2534,
+	0, 0, 0, 0, 0, 1285, 1817, 0, 0, 0, 0, 3180, 3072, 0, 4155, 5223,
+	2830, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1985, 0,
+	0, 0, 0, 4205, 0, 209, 0, 1389, 0, 3374, 116, 0, 0, 0, 2436, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2725, 0, 0, 2481, 0, 4172, 0, 0, 0, 0, 795, 0, 0, 0, 2439, 4326,
+	0, 0, 4087, 0, 0, 2001, 2899, 669, 405, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2583, 0, 0, 0, 0, 0, 750, 4009, 0, 0,
+	0, 0, 4933, 2384, 3236, 0, 556, 2873, 67, 3922, 5041, 0, 0, 1166, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3701, 0, 4709, 0, 0, 0, 0, 0, 2756,
+	0, 5402, 0, 948, 0, 0, 0, 0, 0, 0, 2255, 0, 0, 376, 4789, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3257, 3796, 0, 3572, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 473, 5112, 5560, 4532, 0, 3838,
+	0, 0, 1115, 26, 0, 2174, 0, 0, 4720, 0, 0, 971, 5391, 0, 4619, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4769, 2224, 0, 0, 3477, 0, 1612,
+	1017, 5431, 0, 4682, 1208, 4943, 0, 0, 0, 0, 0, 0, 4413, 0, 3745, 3188,
+	0, 0, 3523, 5128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1390,
+	0, 4466, 0, 0, 3244, 0, 1478, 4883, 3685, 2118, 519, 3016, 0, 1870, 2769, 0,
+	5341, 0, 0, 0, 0, 3614, 1806, 0, 0, 0, 0, 0, 0, 0, 3058, 0,
+	4137, 0, 3421, 0, 956, 1333, 4592, 5498, 4820, 0, 0, 0, 0, 0, 0, 5291,
+	1974, 4335, 0, 0, 0, 0, 0, 188, 0, 0, 0, 0, 2664, 4921, 0, 0,
+	2425, 0, 0, 877, 0, 270, 0, 1065, 3291, 5473, 0, 0, 0, 0, 2952, 4024,
+	69, 2713, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1348, 0, 0, 0,
+	0, 4710, 0, 2523, 3003, 4076, 0, 2757, 0, 4522, 398, 3141, 0, 0, 0, 0,
+	1797, 0, 0, 0, 2818, 0, 0, 0, 0, 1723, 4274, 0, 0, 0, 0, 0,
+	3102, 0, 0, 0, 0, 2371, 0, 535, 4191, 2862, 0, 0, 0, 0, 3171, 0,
+	0, 5319, 0, 0, 0, 0, 0, 0, 0, 0, 0, 529, 4242, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2244, 1649, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3785, 0, 2514, 0, 0,
+	0, 2878, 0, 842, 0, 0, 3189, 0, 0, 0, 5129, 0, 454, 0, 0, 0,
+	0, 0, 130, 0, 0, 0, 0, 2162, 0, 0, 0, 0, 5021, 0, 5379, 0,
+	0, 522, 1156, 0, 0, 0, 0, 3154, 0, 0, 0, 3692, 0, 29, 0, 3466,
+	0, 1598, 5096, 0, 0, 0, 1197, 0, 0, 0, 0, 0, 0, 0, 4401, 0,
+	3733, 0, 0, 4771, 3511, 0, 2052, 0, 0, 439, 0, 0, 0, 4686, 0, 0,
+	0, 0, 3562, 0, 0, 3898, 3225, 0, 1466, 4850, 0, 2101, 0, 0, 0, 0,
+	0, 0, 5329, 0, 0, 4719, 0, 0, 0, 0, 0, 0, 0, 1916, 0, 0,
+	3045, 0, 0, 0, 3409, 0, 935, 1321, 3870, 303, 4797, 5365, 0, 0, 2213, 0,
+	788, 5268, 1960, 4321, 0, 5418, 0, 0, 0, 0, 0, 0, 0, 0, 2649, 0,
+	0, 0, 2411, 0, 0, 853, 0, 255, 4385, 1052, 3279, 4539, 4906, 5459, 0, 2940,
+	2179, 4002, 0, 2699, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4598, 0, 0,
+	0, 1857, 0, 0, 2990, 0, 4061, 0, 5305, 3163, 0, 1259, 4509, 0, 0, 4697,
+	0, 0, 1785, 2317, 0, 5194, 2805, 0, 0, 0, 0, 1710, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2359, 3096, 4175, 0, 0, 172, 2080, 4472, 0,
+	0, 0, 0, 5169, 0, 0, 0, 3905, 2636, 1875, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 627, 0, 2455, 0, 0, 0, 3954, 1637,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2744, 0, 3774, 0, 2501,
+	0, 3083, 0, 198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4112, 0,
+	0, 0, 0, 4836, 415, 1701, 0, 0, 0, 0, 0, 0, 0, 0, 1540, 5002,
+	0, 0, 0, 1144, 0, 0, 0, 0, 0, 449, 0, 0, 0, 3680, 2402, 0,
+	0, 3454, 0, 1586, 5082, 0, 0, 0, 1184, 0, 0, 1, 0, 0, 0, 0,
+	0, 0, 3719, 0, 0, 4753, 0, 0, 2037, 0, 739, 0, 0, 0, 0, 0,
+	0, 1456, 0, 543, 3550, 0, 0, 0, 387, 0, 0, 0, 0, 2087, 0, 0,
+	3357, 5532, 0, 0, 0, 3815, 0, 0, 1091, 0, 0, 2151, 0, 5052, 0, 1901,
+	0, 0, 43, 0, 0, 0, 3399, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2198, 0, 0, 0, 0, 0, 991, 5407, 0, 4655, 0, 0, 0, 0, 0, 0,
+	937, 0, 0, 0, 0, 0, 1388, 0, 3498, 232, 0, 1039, 1629, 0, 0, 1228,
+	4267, 2927, 0, 3988, 0, 0, 1920, 0, 4437, 3765, 3214, 0, 0, 527, 3541, 0,
+	0, 0, 0, 1843, 0, 0, 0, 0, 4618, 0, 0, 0, 0, 1243, 4494, 0,
+	0, 0, 0, 0, 3034, 0, 0, 0, 2793, 0, 0, 924, 5351, 0, 0, 0,
+	260, 0, 1293, 1823, 0, 2582, 0, 0, 0, 3084, 1422, 749, 4162, 157, 0, 0,
+	0, 0, 0, 4296, 4865, 5160, 0, 0, 3921, 835, 2624, 0, 4367, 0, 0, 4881,
+	0, 0, 217, 3014, 0, 0, 0, 0, 2684, 611, 0, 2444, 0, 3979, 0, 0,
+	0, 0, 4582, 5372, 0, 0, 0, 0, 0, 0, 4047, 0, 0, 2732, 0, 0,
+	0, 629, 4, 2487, 0, 0, 728, 1775, 5214, 0, 0, 0, 0, 2297, 0, 0,
+	4096, 0, 0, 0, 0, 409, 0, 0, 0, 0, 5111, 0, 0, 201, 0, 0,
+	1529, 4979, 0, 0, 0, 1132, 1740, 0, 0, 66, 0, 3893, 0, 0, 0, 3667,
+	2390, 0, 4067, 0, 0, 0, 0, 0, 344, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2564, 4725, 0, 0, 2023, 0, 0, 420, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 382, 0, 0, 0, 0, 0,
+	0, 0, 3343, 5514, 0, 0, 0, 3265, 3803, 1079, 0, 0, 0, 2137, 3950, 0,
+	0, 1889, 0, 0, 3613, 0, 0, 483, 3388, 0, 1518, 0, 0, 0, 0, 1122,
+	0, 0, 2182, 4590, 0, 3443, 0, 5055, 978, 3657, 151, 4629, 1173, 0, 0, 0,
+	0, 0, 390, 0, 0, 3073, 0, 0, 1377, 0, 3486, 5101, 0, 1023, 1618, 0,
+	0, 0, 0, 2915, 0, 0, 0, 778, 0, 4421, 0, 3753, 3197, 0, 0, 3530,
+	0, 2075, 0, 0, 0, 1829, 4305, 0, 0, 0, 0, 0, 3459, 0, 4474, 0,
+	0, 0, 0, 0, 0, 0, 2125, 3022, 0, 0, 0, 0, 910, 0, 0, 0,
+	0, 0, 0, 1812, 0, 0, 0, 2570, 0, 0, 0, 3064, 0, 0, 0, 3427,
+	0, 0, 0, 0, 0, 0, 0, 0, 2861, 2232, 0, 816, 5309, 103, 4350, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2671, 0, 4240, 0, 2431, 0, 1434,
+	887, 68, 0, 4566, 1074, 1314, 0, 0, 0, 0, 0, 2960, 4032, 0, 2720, 3131,
+	0, 0, 0, 0, 0, 0, 0, 0, 1765, 1356, 0, 0, 0, 0, 0, 0,
+	0, 4082, 0, 0, 241, 0, 1281, 401, 4371, 0, 0, 0, 5104, 2336, 0, 731,
+	252, 5218, 0, 0, 0, 0, 1729, 0, 0, 0, 0, 0, 0, 0, 2614, 0,
+	0, 0, 2378, 2983, 0, 0, 0, 204, 0, 0, 0, 0, 0, 0, 595, 484,
+	0, 3963, 0, 0, 0, 0, 4992, 0, 0, 0, 0, 0, 0, 0, 0, 5057,
+	0, 0, 0, 660, 0, 2476, 4167, 0, 0, 0, 695, 0, 0, 0, 0, 0,
+	4729, 0, 2286, 0, 3331, 5505, 4848, 0, 0, 3249, 0, 1679, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3602, 0, 0, 0, 0, 0, 0, 0, 0, 0, 430,
+	0, 0, 521, 5141, 0, 1320, 4574, 3868, 0, 1563, 963, 5032, 329, 2493, 1162, 4607,
+	4750, 1959, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 3472, 0, 1604, 2013,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5457, 0, 4408, 0, 3740, 3182, 4685,
+	0, 491, 0, 2060, 0, 0, 4351, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5064, 0, 5012, 0, 0, 0, 0, 2112, 3007, 0, 5553, 3376, 0, 897, 1506,
+	5335, 0, 4737, 1111, 0, 1801, 0, 0, 0, 0, 0, 0, 0, 3647, 0, 0,
+	0, 3415, 3142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1366, 797, 5279, 88,
+	4329, 1012, 0, 0, 4677, 0, 0, 2901, 254, 2003, 0, 2655, 0, 0, 0, 0,
+	0, 1414, 0, 3518, 0, 0, 1058, 3172, 0, 0, 4289, 0, 2946, 0, 4012, 0,
+	0, 3116, 0, 4460, 0, 3238, 0, 4637, 0, 0, 1755, 0, 0, 0, 0, 1864,
+	0, 0, 2996, 0, 825, 0, 0, 4356, 0, 0, 0, 2559, 0, 0, 0, 2323,
+	3052, 696, 231, 0, 1038, 4427, 0, 0, 1716, 0, 0, 0, 0, 0, 0, 3302,
+	2603, 0, 0, 0, 2366, 5168, 0, 0, 0, 183, 4481, 0, 4964, 0, 0, 581,
+	0, 5176, 2420, 3942, 0, 0, 0, 0, 0, 354, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 637, 0, 0, 0, 0, 2829, 5222, 0, 0, 0, 0,
+	0, 0, 0, 0, 2273, 0, 0, 0, 2751, 0, 0, 0, 395, 1666, 553, 0,
+	0, 1792, 0, 0, 0, 0, 4946, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3855, 0, 0, 1546, 5013, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3687, 0, 0, 0, 0, 0,
+	1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1227, 1644,
+	3728, 0, 0, 0, 0, 2044, 89, 0, 0, 0, 0, 4824, 0, 0, 0, 1463,
+	0, 0, 5040, 64, 0, 391, 0, 0, 0, 0, 0, 0, 0, 5541, 3363, 5051,
+	1494, 341, 4923, 0, 4707, 1099, 0, 2792, 2158, 4560, 4461, 0, 0, 0, 0, 3632,
+	0, 0, 0, 3404, 0, 1944, 0, 0, 0, 4788, 4161, 0, 0, 0, 772, 1350,
+	0, 0, 4314, 999, 0, 3256, 4664, 0, 0, 2889, 1991, 0, 0, 2642, 4428, 4391,
+	0, 0, 0, 1396, 0, 472, 3380, 4530, 5559, 0, 0, 0, 4276, 0, 2934, 0,
+	3994, 0, 3310, 3104, 0, 0, 0, 3221, 0, 0, 0, 0, 2096, 0, 0, 0,
+	1850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5430, 0, 2540, 0, 0,
+	0, 2311, 0, 677, 5190, 0, 0, 0, 930, 5360, 0, 0, 0, 0, 2838, 0,
+	0, 0, 2589, 0, 4295, 0, 0, 0, 0, 0, 165, 0, 0, 0, 0, 0,
+	0, 564, 4214, 2406, 2880, 3013, 844, 3929, 124, 4377, 5163, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2694, 0, 0, 3057, 0, 0, 0, 3420, 0, 0, 0,
+	0, 0, 0, 0, 0, 2261, 2986, 4057, 807, 0, 3157, 0, 0, 0, 641, 1654,
+	0, 0, 0, 1781, 0, 3802, 0, 0, 0, 0, 0, 0, 544, 0, 0, 0,
+	0, 0, 0, 5472, 0, 0, 480, 0, 2355, 0, 65, 759, 2712, 1535, 4023, 4988,
+	315, 0, 1747, 0, 0, 0, 0, 5396, 3901, 2632, 0, 0, 2474, 2396, 503, 3673,
+	4075, 2755, 0, 0, 0, 0, 0, 0, 0, 621, 0, 0, 0, 0, 5205, 2817,
+	1214, 1633, 367, 4951, 0, 0, 13, 0, 0, 0, 5489, 0, 0, 4800, 0, 0,
+	0, 0, 4190, 0, 0, 0, 0, 0, 0, 4810, 0, 0, 3579, 0, 0, 3350,
+	5522, 0, 1483, 4896, 0, 0, 1697, 1085, 0, 0, 0, 4545, 0, 3844, 0, 0,
+	650, 3619, 0, 0, 0, 0, 0, 1933, 0, 0, 0, 0, 0, 0, 0, 0,
+	1338, 4600, 3450, 0, 1582, 985, 3784, 346, 2231, 5069, 0, 0, 1979, 0, 0, 5436,
+	0, 0, 0, 3714, 0, 0, 0, 0, 777, 0, 1624, 0, 4866, 0, 4259, 0,
+	0, 279, 0, 1452, 3296, 5476, 0, 1553, 4882, 3206, 0, 0, 518, 0, 2082, 0,
+	0, 0, 0, 962, 0, 0, 0, 28, 0, 0, 0, 2780, 0, 0, 0, 2528,
+	0, 0, 141, 0, 0, 1280, 4527, 3395, 0, 919, 4400, 0, 0, 0, 4143, 0,
+	2823, 0, 0, 0, 5234, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1465, 4199, 2867, 2100, 0, 828, 0, 110, 4360, 4934, 5328, 481, 0,
+	0, 0, 0, 2923, 3984, 0, 2678, 0, 4249, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 301, 2475, 0, 0, 2249, 2967, 4042, 787, 5267, 3140, 0, 4320, 0,
+	5417, 0, 0, 0, 0, 1770, 2302, 5278, 2519, 5181, 0, 0, 0, 2410, 0, 852,
+	0, 0, 128, 4384, 0, 0, 0, 0, 462, 0, 2342, 0, 743, 5225, 0, 0,
+	0, 0, 0, 1735, 0, 0, 0, 5155, 0, 0, 3888, 2620, 0, 1161, 0, 2385,
+	0, 0, 0, 0, 0, 4508, 0, 4991, 0, 0, 0, 604, 0, 0, 3972, 0,
+	5056, 0, 0, 0, 363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4780, 0,
+	0, 0, 0, 0, 0, 0, 171, 0, 0, 378, 3791, 0, 0, 3567, 0, 2293,
+	0, 0, 0, 0, 1471, 0, 0, 0, 1685, 0, 0, 0, 0, 0, 0, 3833,
+	0, 1524, 626, 3608, 4974, 0, 0, 0, 0, 1922, 0, 0, 5388, 0, 0, 532,
+	3663, 0, 1327, 0, 310, 3875, 1571, 5043, 3773, 142, 2219, 0, 0, 0, 0, 0,
+	0, 5423, 0, 0, 0, 3703, 0, 0, 4111, 0, 0, 1613, 2019, 0, 0, 4684,
+	0, 0, 3517, 263, 5122, 1057, 1438, 3285, 5464, 0, 0, 3191, 0, 0, 0, 0,
+	2069, 4459, 0, 5510, 0, 5011, 0, 0, 0, 2401, 0, 0, 0, 0, 5081, 0,
+	0, 0, 0, 0, 0, 0, 4515, 1267, 0, 3384, 0, 904, 1514, 0, 3051, 4752,
+	4130, 0, 2810, 0, 0, 0, 0, 0, 0, 0, 3653, 0, 0, 0, 3422, 0,
+	1967, 0, 0, 0, 0, 4182, 0, 0, 0, 253, 809, 1372, 96, 4337, 5531, 0,
+	0, 0, 0, 0, 2907, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1426, 0,
+	0, 0, 0, 0, 0, 2460, 0, 4299, 0, 2954, 2197, 0, 0, 0, 3122, 0,
+	0, 0, 0, 0, 4653, 0, 2750, 1760, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2566, 4117, 0, 0, 2329, 0, 716, 423,
+	5206, 0, 0, 0, 0, 0, 0, 0, 0, 2857, 5145, 0, 0, 2609, 1842, 1149,
+	0, 0, 0, 0, 0, 869, 0, 4493, 0, 0, 0, 0, 4234, 589, 0, 0,
+	3953, 882, 0, 0, 0, 0, 356, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4760, 0, 0, 0, 0, 0, 748, 0, 0, 0, 0, 3780, 0, 2508, 0, 3555,
+	0, 2280, 0, 834, 0, 0, 0, 0, 0, 0, 1672, 0, 0, 0, 0, 0,
+	3821, 0, 0, 4954, 610, 0, 2157, 3978, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 512, 0, 2373, 0, 0, 0, 1507, 1556, 2731, 5022, 326, 2203, 0, 0, 0,
+	0, 0, 0, 5412, 0, 4663, 1191, 0, 0, 0, 4095, 0, 0, 2007, 0, 0,
+	0, 0, 0, 0, 3505, 0, 0, 0, 0, 0, 0, 1235, 0, 4931, 0, 0,
+	0, 0, 2053, 4443, 5293, 3770, 3326, 5502, 4837, 0, 0, 0, 0, 0, 0, 1848,
+	0, 0, 0, 0, 0, 0, 0, 3597, 0, 0, 5547, 3369, 0, 1500, 0, 0,
+	3039, 0, 0, 0, 0, 0, 1316, 4568, 3862, 5357, 0, 0, 3641, 0, 0, 0,
+	0, 0, 1951, 0, 0, 381, 0, 0, 0, 163, 0, 1358, 0, 0, 0, 4877,
+	1600, 0, 3264, 0, 0, 0, 2895, 245, 1997, 1046, 2136, 3273, 5453, 0, 0, 0,
+	1407, 0, 0, 0, 0, 0, 0, 4343, 4911, 4284, 0, 0, 2181, 4589, 0, 3317,
+	3442, 3882, 0, 0, 0, 0, 0, 0, 2737, 0, 0, 4503, 0, 0, 0, 3071,
+	893, 0, 0, 0, 0, 0, 2799, 0, 0, 0, 2550, 4105, 0, 0, 0, 0,
+	687, 1303, 0, 0, 0, 939, 554, 3752, 0, 4169, 0, 2844, 698, 0, 792, 2597,
+	0, 4304, 4323, 1718, 0, 0, 0, 0, 0, 0, 4376, 0, 0, 0, 573, 4222,
+	0, 225, 3937, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2496,
+	0, 0, 2268, 0, 0, 815, 0, 0, 102, 4349, 0, 654, 0, 0, 0, 0,
+	0, 0, 0, 0, 411, 4239, 4932, 0, 2143, 0, 886, 1433, 0, 0, 0, 0,
+	0, 0, 0, 494, 1138, 5123, 0, 0, 0, 3130, 0, 0, 0, 319, 0, 0,
+	0, 3449, 0, 0, 0, 3908, 0, 0, 1179, 0, 352, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4740, 632, 12, 2335, 3492, 730, 5217, 0, 1221, 0, 0,
+	0, 0, 0, 1359, 0, 0, 0, 3758, 0, 0, 4809, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3585, 0, 0, 3358, 4544, 0, 1489,
+	1896, 4912, 360, 3027, 0, 0, 0, 0, 4554, 5347, 3850, 0, 5004, 1129, 3626, 0,
+	2191, 0, 0, 0, 1939, 0, 0, 5403, 0, 0, 0, 0, 0, 1344, 0, 0,
+	0, 2551, 0, 0, 0, 2242, 0, 0, 2884, 776, 0, 1030, 5441, 0, 0, 0,
+	0, 0, 0, 0, 0, 2677, 2039, 0, 0, 0, 0, 4268, 3015, 3536, 294, 4573,
+	0, 3304, 3867, 1836, 5031, 0, 0, 0, 4040, 0, 0, 1958, 0, 133, 4483, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1884, 2787, 0, 0, 2535, 0, 0, 0,
+	0, 0, 1286, 1818, 5290, 0, 0, 0, 0, 3075, 0, 4157, 0, 2831, 0, 0,
+	764, 0, 1734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4207, 0, 210, 0, 1392, 0, 5552, 117, 0, 0, 0, 2437, 0, 1110, 0, 2803,
+	0, 0, 2771, 0, 3097, 0, 0, 0, 0, 0, 0, 0, 0, 2726, 0, 0,
+	2482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4089,
+	0, 0, 2307, 0, 672, 407, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4811, 0, 2585, 0, 0, 0, 0, 0, 751, 4011, 0, 0, 0, 0, 0,
+	0, 0, 2145, 557, 2875, 71, 3924, 3894, 4990, 0, 1167, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3702, 0, 49, 4713, 613, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2256, 0, 5483, 0, 4791, 0, 0, 0, 0,
+	1650, 0, 0, 0, 0, 0, 0, 3258, 3797, 0, 3573, 0, 3501, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 5113, 0, 4533, 0, 3839, 0, 1531, 1117,
+	4749, 312, 2175, 0, 0, 0, 1928, 0, 972, 5392, 0, 4620, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 345, 2225, 0, 0, 3478, 0, 0, 1018, 5432, 0,
+	4683, 1209, 4945, 0, 0, 0, 0, 0, 0, 4415, 0, 3746, 4849, 0, 0, 3524,
+	0, 0, 0, 0, 0, 0, 5010, 0, 0, 0, 0, 0, 0, 0, 4467, 0,
+	0, 3246, 3345, 1479, 4884, 0, 2119, 3017, 0, 0, 1871, 2772, 302, 3098, 5342, 0,
+	0, 0, 3615, 1807, 1275, 0, 0, 5098, 0, 0, 3727, 3059, 0, 4138, 0, 0,
+	2043, 1334, 4593, 0, 0, 4822, 0, 0, 0, 0, 0, 0, 5292, 1975, 0, 0,
+	0, 0, 0, 0, 189, 0, 1379, 0, 0, 105, 2665, 0, 0, 2426, 0, 4254,
+	878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4026, 0, 2714, 0,
+	0, 0, 2468, 0, 0, 0, 0, 0, 0, 771, 0, 0, 0, 0, 0, 614,
+	2524, 3004, 4077, 0, 2758, 0, 0, 0, 0, 0, 0, 0, 0, 1798, 0, 0,
+	0, 0, 5281, 0, 0, 2572, 1724, 0, 2413, 0, 0, 732, 0, 0, 0, 0,
+	0, 0, 2372, 0, 0, 536, 868, 2095, 2863, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 53, 0, 0, 0, 0, 0, 4245, 0, 0, 0, 0, 0, 5189,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2245, 0, 0, 372, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3786, 0, 2515, 4213, 0, 0, 2287, 0,
+	0, 0, 0, 0, 4374, 0, 0, 0, 0, 455, 5107, 0, 0, 3828, 4870, 0,
+	1104, 0, 0, 0, 2163, 0, 0, 0, 0, 0, 0, 3883, 5380, 0, 523, 1157,
+	0, 0, 4055, 0, 3156, 0, 0, 0, 330, 0, 30, 0, 3467, 0, 1599, 1006,
+	5099, 0, 4669, 0, 0, 0, 0, 0, 0, 0, 0, 4403, 0, 3735, 0, 0,
+	4773, 3512, 0, 0, 0, 758, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4452, 0, 0, 3226, 3900, 1172, 1467, 879, 2104, 4852, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3604, 0, 0, 0, 0, 0, 1508, 1917, 4654, 3046, 0, 4121,
+	8, 3410, 0, 936, 1322, 3871, 304, 4577, 4799, 5366, 0, 2215, 0, 0, 0, 1961,
+	4322, 0, 0, 4808, 0, 0, 0, 0, 0, 0, 5521, 2650, 0, 0, 0, 2414,
+	0, 0, 855, 0, 256, 4386, 1053, 3281, 4541, 5462, 0, 0, 2941, 4193, 4003, 0,
+	2700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5067,
+	0, 2991, 0, 4062, 0, 0, 3164, 0, 1261, 4510, 0, 0, 0, 0, 0, 1786,
+	0, 0, 5196, 2806, 0, 0, 0, 0, 1711, 4258, 0, 278, 0, 1072, 1451, 0,
+	0, 0, 0, 3205, 2360, 0, 4177, 0, 2850, 174, 0, 0, 0, 91, 0, 0,
+	0, 456, 5170, 0, 0, 2637, 2778, 0, 0, 0, 0, 4229, 2975, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2456, 0, 0, 0, 0, 1638, 0, 369, 0,
+	0, 0, 0, 0, 0, 0, 0, 1295, 2746, 0, 3775, 0, 2502, 4198, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4113, 0, 0, 0, 0,
+	703, 416, 1702, 0, 0, 0, 0, 0, 0, 0, 0, 5003, 4853, 0, 0, 0,
+	502, 1145, 0, 0, 0, 0, 0, 0, 0, 0, 3681, 0, 0, 0, 3455, 0,
+	1587, 5083, 0, 5180, 0, 1185, 0, 0, 11, 0, 0, 0, 0, 0, 0, 3720,
+	0, 0, 4754, 0, 0, 2038, 0, 742, 0, 0, 0, 0, 0, 0, 1457, 0,
+	0, 3551, 5284, 0, 3887, 388, 0, 4825, 0, 0, 2088, 0, 0, 4543, 5533, 0,
+	0, 0, 3816, 0, 0, 1093, 0, 0, 0, 3971, 0, 0, 1902, 0, 0, 0,
+	0, 0, 0, 0, 0, 1308, 5068, 3857, 0, 4779, 0, 0, 321, 2199, 4727, 5242,
+	0, 1945, 0, 992, 0, 0, 4657, 0, 0, 2292, 775, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 700, 233, 3499, 1041, 3267, 5447, 0, 1229, 1719, 2928, 4973,
+	3989, 0, 0, 0, 0, 4438, 0, 3215, 0, 0, 530, 3542, 0, 0, 0, 0,
+	1844, 1570, 0, 2976, 140, 0, 0, 0, 3148, 0, 1244, 4495, 0, 0, 0, 0,
+	0, 2306, 3035, 0, 5186, 2794, 0, 0, 0, 5352, 0, 0, 0, 0, 0, 1296,
+	1824, 0, 0, 0, 0, 0, 2349, 3086, 4163, 5231, 158, 0, 4458, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2626, 0, 0, 0, 0, 0, 0, 0, 218,
+	0, 0, 0, 3383, 5562, 0, 612, 0, 2445, 0, 3980, 4129, 0, 0, 0, 0,
+	5374, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2733, 0, 0, 0, 2488, 14,
+	0, 0, 181, 1776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4097, 0, 0,
+	0, 0, 0, 0, 1691, 0, 0, 0, 0, 0, 0, 0, 436, 1530, 4981, 0,
+	0, 0, 1133, 1741, 0, 0, 0, 0, 444, 0, 0, 0, 3668, 2391, 0, 0,
+	0, 0, 1576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3708, 4642, 4728, 0, 0, 0, 2024, 0, 0, 422, 993, 0, 0, 0, 0,
+	1443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3344,
+	5516, 0, 0, 0, 3266, 3805, 0, 588, 1080, 0, 2138, 3952, 0, 0, 1890, 0,
+	0, 4828, 0, 0, 486, 3389, 0, 0, 0, 0, 0, 4759, 1123, 0, 0, 2183,
+	0, 4496, 0, 0, 0, 979, 3659, 5397, 4630, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1378, 0, 3488, 0, 0, 1025, 1619, 0, 0, 1216, 0,
+	2917, 0, 0, 0, 0, 5257, 4422, 0, 3754, 3198, 0, 0, 511, 3531, 2076, 0,
+	0, 0, 1831, 1555, 4309, 0, 0, 0, 0, 0, 0, 4476, 0, 0, 0, 0,
+	0, 0, 0, 2126, 3023, 0, 0, 1879, 2781, 911, 0, 0, 0, 144, 0, 0,
+	1813, 0, 0, 0, 1606, 1935, 1234, 2571, 3066, 0, 4145, 0, 3428, 0, 0, 0,
+	0, 0, 0, 0, 5150, 0, 0, 0, 817, 5310, 0, 4353, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2672, 0, 0, 0, 2432, 0, 1435, 888, 0, 284,
+	0, 0, 0, 0, 0, 0, 0, 0, 2961, 4034, 0, 2721, 3132, 0, 0, 0,
+	0, 0, 0, 0, 162, 1766, 0, 0, 0, 0, 0, 0, 0, 0, 4083, 0,
+	0, 244, 0, 1282, 402, 3272, 0, 0, 0, 5106, 2337, 0, 0, 5219, 0, 4963,
+	0, 4340, 0, 1730, 0, 0, 0, 867, 0, 0, 0, 2615, 0, 0, 0, 2379,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 892, 596, 0, 0, 3964, 0,
+	0, 0, 0, 0, 362, 4698, 4104, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	661, 0, 2477, 0, 0, 0, 0, 0, 791, 374, 5073, 1745, 0, 0, 0, 0,
+	0, 3332, 5506, 0, 426, 3792, 3252, 0, 1680, 5565, 0, 0, 0, 0, 0, 4869,
+	0, 0, 3603, 0, 0, 0, 467, 0, 0, 0, 0, 0, 431, 0, 0, 0,
+	0, 2170, 4575, 0, 0, 0, 1564, 966, 5035, 0, 639, 1163, 4608, 0, 0, 0,
+	0, 0, 0, 0, 0, 3698, 0, 38, 0, 3473, 0, 1607, 0, 0, 4823, 4930,
+	0, 0, 0, 2142, 0, 0, 0, 0, 4409, 0, 3741, 3184, 0, 0, 0, 0,
+	2062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3322, 0, 0, 2673, 0,
+	0, 0, 0, 0, 0, 2114, 3008, 285, 5556, 3377, 0, 898, 5336, 0, 0, 4739,
+	630, 7, 1112, 1802, 0, 0, 0, 0, 1220, 0, 0, 0, 0, 0, 3416, 0,
+	951, 0, 0, 5419, 0, 0, 0, 2849, 2221, 0, 798, 5283, 90, 4330, 1013, 0,
+	0, 4678, 0, 0, 2902, 2004, 0, 0, 2656, 4910, 4228, 0, 0, 0, 1416, 870,
+	0, 0, 4553, 1059, 0, 0, 0, 1128, 3625, 2948, 4290, 4013, 5323, 2707, 3117, 5548,
+	4463, 0, 0, 0, 0, 3433, 0, 1756, 0, 0, 0, 2765, 1865, 0, 0, 2241,
+	2997, 4070, 0, 0, 0, 1269, 0, 0, 0, 0, 0, 0, 2324, 0, 697, 4133,
+	5197, 0, 0, 0, 0, 1717, 0, 0, 293, 0, 0, 0, 4375, 2604, 0, 0,
+	0, 2367, 0, 0, 0, 0, 185, 0, 0, 0, 0, 0, 0, 582, 5177, 0,
+	3943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4056, 0, 0, 0, 0,
+	0, 0, 640, 0, 2463, 4156, 0, 5224, 0, 0, 0, 0, 0, 0, 0, 4702,
+	0, 2275, 0, 0, 0, 2752, 0, 0, 0, 0, 1667, 4206, 0, 0, 0, 442,
+	0, 0, 0, 4947, 3590, 0, 0, 566, 0, 0, 0, 0, 0, 0, 429, 0,
+	0, 0, 5131, 0, 0, 3856, 0, 0, 1547, 5014, 0, 320, 4724, 1151, 0, 0,
+	0, 0, 0, 0, 0, 0, 5385, 3688, 0, 10, 4088, 3462, 0, 1593, 5090, 670,
+	406, 0, 0, 0, 0, 0, 0, 0, 5446, 0, 0, 0, 3729, 0, 2584, 0,
+	0, 0, 2046, 0, 0, 0, 0, 0, 0, 0, 0, 0, 482, 0, 4542, 2874,
+	70, 3923, 392, 0, 0, 0, 0, 0, 0, 0, 5543, 3174, 3364, 1495, 4927, 5324,
+	48, 4712, 1100, 0, 0, 2159, 0, 0, 0, 0, 0, 0, 3633, 5375, 0, 0,
+	3405, 0, 0, 1866, 0, 377, 4790, 0, 0, 0, 2067, 774, 1351, 5248, 0, 4315,
+	1000, 0, 0, 4665, 0, 0, 2890, 1992, 0, 0, 2643, 0, 0, 0, 0, 0,
+	1397, 0, 3507, 0, 0, 1048, 0, 0, 0, 1116, 4277, 311, 2936, 3995, 2779, 3311,
+	3105, 0, 4446, 0, 3222, 0, 0, 0, 0, 0, 0, 0, 0, 1852, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2542, 0, 0, 0, 2312, 3041,
+	678, 5191, 0, 0, 4414, 931, 3190, 1706, 2999, 5361, 0, 2839, 0, 0, 0, 2591,
+	0, 0, 0, 0, 0, 0, 0, 166, 704, 0, 0, 3245, 0, 0, 567, 4215,
+	2407, 2881, 3930, 847, 2770, 125, 4379, 5164, 348, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2695, 0, 0, 0, 0, 0, 0, 0, 0, 0, 957, 0, 0, 0,
+	0, 0, 2262, 2987, 0, 4058, 0, 2739, 3158, 4336, 0, 0, 1655, 0, 0, 0,
+	1782, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4107, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5118, 2356, 0, 4025, 0, 0, 1536, 4840, 4989, 0, 0, 1749,
+	0, 0, 0, 0, 0, 3902, 0, 0, 0, 3675, 2397, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1215, 1634, 0,
+	0, 0, 0, 0, 2033, 0, 0, 5490, 0, 0, 4801, 0, 0, 464, 3500, 0,
+	0, 0, 0, 0, 385, 0, 0, 0, 0, 3580, 0, 0, 3352, 5524, 0, 1484,
+	4898, 0, 4827, 531, 1086, 1698, 4244, 2147, 4547, 0, 3845, 0, 0, 0, 3620, 0,
+	0, 0, 0, 0, 1934, 0, 0, 0, 0, 0, 0, 0, 0, 1339, 4601, 3451,
+	0, 5071, 986, 1583, 0, 4644, 0, 0, 0, 1980, 5245, 0, 5437, 0, 0, 0,
+	3715, 0, 1384, 0, 0, 0, 5256, 1625, 0, 0, 0, 4261, 0, 0, 280, 0,
+	1453, 3298, 5477, 0, 0, 3760, 3207, 0, 0, 0, 0, 2083, 0, 2686, 0, 1837,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5097, 0, 0, 2529, 0, 0, 0,
+	0, 0, 4528, 0, 0, 0, 920, 4402, 3734, 0, 4772, 0, 0, 2824, 0, 0,
+	0, 2577, 5235, 0, 0, 4098, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4851,
+	546, 4200, 2868, 2103, 3917, 829, 0, 112, 4362, 0, 0, 0, 0, 0, 0, 0,
+	0, 3985, 0, 2679, 0, 4250, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2250, 2214, 2968, 789, 4043, 3144, 0, 0, 0, 0, 0, 0,
+	0, 0, 1771, 0, 0, 0, 2520, 0, 0, 0, 2412, 0, 854, 0, 0, 0,
+	0, 0, 3280, 4339, 5460, 465, 5110, 2344, 0, 744, 5226, 0, 0, 0, 0, 0,
+	1736, 0, 0, 0, 0, 0, 0, 3889, 2621, 0, 0, 0, 2386, 0, 0, 0,
+	0, 0, 1260, 0, 0, 0, 0, 0, 606, 0, 0, 3973, 0, 5195, 0, 1203,
+	0, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4781, 0, 0, 0, 0,
+	4176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3568, 0, 2294, 0, 3339, 3906,
+	0, 1472, 4868, 0, 0, 1075, 1686, 0, 0, 0, 0, 0, 3834, 0, 4975, 3609,
+	0, 0, 0, 0, 0, 0, 1923, 0, 0, 0, 0, 0, 533, 0, 0, 1328,
+	4584, 3434, 2745, 1572, 973, 3876, 145, 336, 2220, 5044, 0, 0, 0, 0, 5424, 0,
+	0, 0, 3704, 0, 0, 0, 0, 0, 1614, 2020, 0, 0, 4693, 0, 0, 0,
+	264, 0, 1439, 3286, 0, 0, 0, 0, 3192, 0, 0, 0, 0, 2070, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2206, 6, 2120, 1268, 4516, 3385, 5563, 906, 1515, 0, 0, 0, 1119, 4132, 2811,
+	0, 0, 0, 0, 0, 0, 0, 3654, 0, 0, 0, 3423, 5282, 0, 0, 0,
+	0, 0, 4184, 0, 0, 0, 1373, 810, 0, 97, 4342, 5461, 0, 0, 0, 1092,
+	0, 2910, 0, 153, 0, 2667, 0, 0, 0, 0, 0, 1427, 0, 0, 1252, 0,
+	0, 0, 2461, 0, 4300, 0, 0, 2956, 4027, 0, 0, 3124, 0, 0, 5408, 0,
+	0, 4656, 0, 0, 1761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1360, 1040, 0, 0, 2567, 0, 0, 0, 2330, 0, 718, 123, 428, 5208, 0,
+	0, 0, 1725, 0, 0, 0, 2858, 5147, 0, 0, 2610, 0, 1150, 0, 2974, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4235, 590, 0, 0, 3955, 883, 0,
+	0, 0, 0, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4761, 0, 653,
+	2553, 3085, 4701, 0, 5230, 0, 0, 0, 0, 0, 0, 0, 3556, 0, 2281, 0,
+	0, 2625, 0, 0, 0, 0, 0, 1673, 0, 0, 0, 0, 0, 3822, 0, 0,
+	4955, 0, 0, 0, 0, 0, 0, 1907, 0, 0, 0, 0, 0, 0, 513, 5137,
+	0, 0, 0, 0, 0, 1557, 5023, 5384, 0, 631, 9, 2207, 0, 0, 0, 0,
+	5413, 0, 0, 1192, 3694, 0, 0, 0, 0, 0, 2008, 0, 0, 0, 1690, 0,
+	0, 3506, 0, 0, 0, 0, 0, 4980, 1236, 0, 373, 4936, 0, 0, 0, 2055,
+	4444, 0, 5503, 3328, 0, 4838, 3547, 0, 0, 2911, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3598, 0, 1253, 0, 3370, 0, 1502, 0, 4640, 3040, 4726, 0,
+	0, 0, 0, 1317, 4569, 0, 0, 0, 958, 3643, 0, 0, 0, 3411, 0, 1952,
+	0, 0, 3091, 0, 0, 0, 0, 699, 1362, 0, 0, 82, 0, 0, 3804, 4394,
+	0, 0, 0, 719, 803, 1998, 2896, 5454, 0, 0, 0, 0, 3175, 1409, 0, 0,
+	0, 0, 0, 2658, 2450, 0, 4285, 0, 2942, 0, 4591, 0, 3318, 3112, 0, 0,
+	3658, 0, 0, 0, 0, 2738, 4015, 2107, 0, 0, 0, 0, 3074, 0, 0, 0,
+	0, 0, 3487, 0, 1024, 5243, 0, 2555, 4106, 0, 0, 2319, 2916, 688, 1304, 0,
+	5252, 0, 940, 0, 0, 0, 0, 0, 1391, 2845, 0, 0, 2599, 1830, 4308, 0,
+	0, 0, 0, 0, 0, 0, 4475, 0, 0, 0, 0, 575, 4223, 0, 226, 3938,
+	861, 0, 135, 0, 0, 5344, 0, 0, 0, 714, 0, 0, 0, 0, 0, 0,
+	0, 0, 3065, 0, 0, 0, 0, 0, 671, 1752, 0, 0, 644, 2497, 0, 0,
+	2269, 0, 0, 0, 0, 104, 0, 4764, 0, 1661, 0, 0, 0, 0, 0, 3810,
+	0, 0, 4241, 4937, 0, 2144, 0, 1713, 0, 0, 0, 0, 0, 0, 0, 0,
+	496, 1139, 2362, 5125, 4033, 0, 0, 1542, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3910, 0, 4641, 1180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5025,
+	0, 0, 4741, 633, 3493, 5105, 0, 0, 0, 0, 1222, 0, 0, 0, 0, 0,
+	0, 5515, 4431, 0, 3759, 0, 0, 4813, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3586, 0, 0, 3359, 5534, 0, 1490, 1897, 4913, 361,
+	3028, 0, 0, 0, 0, 4556, 0, 3851, 0, 0, 0, 3628, 0, 2193, 2108, 0,
+	0, 1940, 0, 0, 0, 0, 0, 0, 0, 0, 1345, 0, 0, 0, 0, 1589,
+	0, 3251, 2243, 0, 5315, 2885, 1986, 5255, 1032, 5442, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2040, 0, 0, 0, 0, 4269, 0, 3537, 1399, 2169, 0, 3306, 3869,
+	0, 965, 5033, 0, 0, 0, 0, 0, 0, 0, 4485, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1886, 1605, 2789, 0, 2536, 0, 0, 0, 0, 0, 1288,
+	5458, 3401, 0, 0, 926, 3183, 3077, 4689, 4158, 0, 2832, 2061, 0, 765, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4209, 0, 212,
+	2113, 1393, 0, 5554, 118, 0, 0, 0, 2438, 0, 0, 0, 0, 2931, 0, 0,
+	0, 3100, 0, 0, 0, 0, 0, 0, 0, 0, 2727, 950, 0, 2483, 0, 0,
+	0, 0, 0, 0, 0, 5280, 3150, 0, 0, 4742, 0, 0, 0, 4090, 0, 2308,
+	0, 673, 5187, 0, 0, 0, 0, 0, 0, 866, 1415, 5151, 0, 0, 4814, 0,
+	2586, 0, 474, 0, 2947, 0, 753, 0, 2706, 0, 4462, 0, 0, 0, 0, 0,
+	558, 0, 0, 3926, 3895, 2628, 0, 1168, 0, 347, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 50, 4715, 615, 0, 0, 0, 0, 5072, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 425, 0, 0, 4792, 0, 0, 0, 1651, 0, 0,
+	184, 0, 0, 0, 3260, 3798, 0, 3575, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1693, 0, 0, 0, 0, 4534, 0, 3840, 0, 1532, 1118, 4984, 314, 2176,
+	0, 0, 0, 1929, 0, 0, 5393, 0, 4623, 0, 0, 2274, 0, 0, 0, 0,
+	0, 0, 0, 396, 2227, 0, 0, 3479, 0, 0, 1019, 5433, 0, 4692, 1210, 0,
+	0, 0, 0, 0, 0, 2027, 4417, 0, 0, 0, 0, 0, 3525, 271, 0, 1067,
+	3292, 5511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4469, 0, 5518, 3247, 3346,
+	4885, 5382, 2205, 5, 3018, 0, 0, 1872, 2774, 0, 0, 0, 0, 332, 0, 0,
+	1808, 1276, 4523, 0, 0, 0, 0, 0, 3060, 0, 4139, 0, 2819, 2045, 4596, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5298, 1976, 4341, 0, 0, 0, 4192,
+	0, 190, 0, 1380, 0, 5542, 106, 4924, 0, 5322, 2427, 0, 4255, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2715, 0, 0, 0, 2469,
+};
@@ -24,6 +24,15 @@
  */
 
 #include <stdio.h>
+#include <ctype.h>
+#include <stdatomic.h>
+#include <openssl/evp.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "msped_strs.h"
 #include "msped_macros.h"
 #include "msped_ws_defs.h"
@@ -64,9 +73,24 @@ struct msped_cfg {
     char *id_token;
 };
 
+#define MSPED_NF_TAMANHO_MIN 256
+
+#define MSPED_PROC_DECL "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+
+struct msped_lote_item {
+    const char *arquivo;
+    const char *xml;
+    size_t tamanho;
+    void *mapa;
+    size_t mapa_tamanho;
+    bool copia;
+};
+
 struct msped_lote {
-    const char *itens[MSPED_LOTE_QTD_MAX_ITENS];
+    struct msped_lote_item *itens;
+    size_t tamanho;
     uint8_t quantidade;
+    uint8_t capacidade;
 };
 
 static inline bool msped_validar_cfg(struct msped_cfg *cfg, msped_erro_callback erro_cb, void *erro_cls) {
@@ -240,14 +264,25 @@ char *msped_qrcode_url_criar(const char *url, const char *ch_nfe, const char *ve
     return res;
 }
 
+static pthread_mutex_t msped_inicializacao_mutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int msped_inicializacao_contador = 0;
+
 void msped_inicializar() {
-    mxml_xml_init();
-    curl_global_init(CURL_GLOBAL_DEFAULT);
+    pthread_mutex_lock(&msped_inicializacao_mutex);
+    if (0 == msped_inicializacao_contador++) {
+        mxml_xml_init();
+        curl_global_init(CURL_GLOBAL_DEFAULT);
+    }
+    pthread_mutex_unlock(&msped_inicializacao_mutex);
 }
 
 void msped_finalizar() {
-    curl_global_cleanup();
-    mxml_xml_finit();
+    pthread_mutex_lock(&msped_inicializacao_mutex);
+    if (msped_inicializacao_contador > 0 && 0 == --msped_inicializacao_contador) {
+        curl_global_cleanup();
+        mxml_xml_finit();
+    }
+    pthread_mutex_unlock(&msped_inicializacao_mutex);
 }
 
 struct msped_cfg *msped_cfg_arquivo_novo(enum MSPED_TIPO tipo, enum MSPED_CUF cuf, enum MSPED_AMBIENTE ambiente,
@@ -498,17 +533,125 @@ struct msped_lote *msped_lote_novo(msped_erro_callback erro_cb, void *erro_cls)
     return lote;
 }
 
+static void msped_lote_item_liberar(struct msped_lote_item *item) {
+    if (NULL == item->mapa)
+        return;
+#ifndef _WIN32
+    if (!item->copia) {
+        munmap(item->mapa, item->mapa_tamanho);
+        return;
+    }
+#endif
+    free(item->mapa);
+}
+
 void msped_lote_liberar(struct msped_lote *lote) {
-    if (NULL != lote)
-        free(lote);
+    if (NULL == lote)
+        return;
+    for (uint8_t i = 0; i < lote->quantidade; i++)
+        msped_lote_item_liberar(&lote->itens[i]);
+    free(lote->itens);
+    free(lote);
 }
 
 bool msped_lote_ok(struct msped_lote *lote) {
     return (NULL != lote && lote->quantidade > 0);
 }
 
+/* Delimita o conteúdo da nota, descartando espaços nas pontas e a declaração XML. */
+static const char *msped_lote_xml_delimitar(const char *xml, size_t *tamanho) {
+    const char *fim;
+    size_t tam = *tamanho;
+    while (tam > 0 && (unsigned char) *xml <= ' ') {
+        xml++;
+        tam--;
+    }
+    if (tam > 5 && 0 == strncmp(xml, "<?xml", 5) && NULL != (fim = memchr(xml, '>', tam))) {
+        tam -= (size_t) (fim + 1 - xml);
+        xml = fim + 1;
+        while (tam > 0 && (unsigned char) *xml <= ' ') {
+            xml++;
+            tam--;
+        }
+    }
+    while (tam > 0 && (unsigned char) xml[tam - 1] <= ' ')
+        tam--;
+    *tamanho = tam;
+    return xml;
+}
+
+static struct msped_lote_item *msped_lote_item_novo(struct msped_lote *lote, size_t tamanho,
+                                                    msped_erro_callback erro_cb, void *erro_cls) {
+    struct msped_lote_item *itens;
+    uint8_t capacidade;
+    if (lote->quantidade >= MSPED_LOTE_QTD_MAX_ITENS) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_LOTE_MAX_ERR, MSPED_LOTE_QTD_MAX_ITENS);
+        return NULL;
+    }
+    if (lote->tamanho + tamanho > MSPED_LOTE_TAMANHO_MAX) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_LIM_TAM_LOTE_ERR, lote->tamanho + tamanho,
+                   mu_size_unit(lote->tamanho + tamanho));
+        return NULL;
+    }
+    if (lote->quantidade == lote->capacidade) {
+        capacidade = (uint8_t) (lote->capacidade < 1 ? 4 : lote->capacidade * 2);
+        if (capacidade > MSPED_LOTE_QTD_MAX_ITENS)
+            capacidade = MSPED_LOTE_QTD_MAX_ITENS;
+        itens = realloc(lote->itens, capacidade * sizeof(struct msped_lote_item));
+        if (NULL == itens) {
+            _MSPED_ERR(erro_cb, erro_cls, S_MSPED_OBJ_ERR, "lote");
+            return NULL;
+        }
+        lote->itens = itens;
+        lote->capacidade = capacidade;
+    }
+    return memset(&lote->itens[lote->quantidade], 0, sizeof(struct msped_lote_item));
+}
+
+bool msped_lote_xml_adicionar(struct msped_lote *lote, const char *xml, size_t tamanho, bool copiar,
+                              msped_erro_callback erro_cb, void *erro_cls) {
+    struct msped_lote_item *item;
+    const char *dados;
+    if (NULL == lote) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "lote");
+        return false;
+    }
+    if (NULL == xml) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "xml");
+        return false;
+    }
+    if (tamanho < 1)
+        tamanho = strlen(xml);
+    dados = msped_lote_xml_delimitar(xml, &tamanho);
+    if (NULL == (item = msped_lote_item_novo(lote, tamanho, erro_cb, erro_cls)))
+        return false;
+    if (copiar) {
+        item->mapa = malloc(tamanho + sizeof(char));
+        if (NULL == item->mapa) {
+            _MSPED_ERR(erro_cb, erro_cls, S_MSPED_VAR_ERR, "xml");
+            return false;
+        }
+        memcpy(item->mapa, dados, tamanho);
+        ((char *) item->mapa)[tamanho] = '\0';
+        item->mapa_tamanho = tamanho;
+        item->copia = true;
+        dados = item->mapa;
+    }
+    item->xml = dados;
+    item->tamanho = tamanho;
+    lote->tamanho += tamanho;
+    lote->quantidade++;
+    return true;
+}
+
 bool msped_lote_arquivo_adicionar(struct msped_lote *lote, const char *arquivo_xml,
                                   msped_erro_callback erro_cb, void *erro_cls) {
+    struct msped_lote_item *item;
+    const char *dados;
+    void *mapa;
+    size_t mapa_tamanho;
+    size_t tamanho;
+    bool copia;
     if (NULL == lote) {
         _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "lote");
         return false;
@@ -521,11 +664,45 @@ bool msped_lote_arquivo_adicionar(struct msped_lote *lote, const char *arquivo_x
         _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARQ_NAO_ENC, arquivo_xml);
         return false;
     }
-    if (lote->quantidade > MSPED_LOTE_QTD_MAX_ITENS) {
-        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_LOTE_MAX_ERR, MSPED_LOTE_QTD_MAX_ITENS);
+    mapa = NULL;
+    mapa_tamanho = 0;
+    copia = false;
+#ifndef _WIN32
+    int fd;
+    struct stat st;
+    if ((fd = open(arquivo_xml, O_RDONLY)) != -1) {
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            mapa_tamanho = (size_t) st.st_size;
+            mapa = mmap(NULL, mapa_tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED == mapa)
+                mapa = NULL;
+        }
+        close(fd);
+    }
+#endif
+    if (NULL == mapa) {
+        if (NULL == (mapa = mu_ftos(arquivo_xml))) {
+            _MSPED_ERR(erro_cb, erro_cls, S_MSPED_VAR_ERR, "xml");
+            return false;
+        }
+        mapa_tamanho = strlen(mapa);
+        copia = true;
+    }
+    tamanho = mapa_tamanho;
+    dados = msped_lote_xml_delimitar(mapa, &tamanho);
+    if (NULL == (item = msped_lote_item_novo(lote, tamanho, erro_cb, erro_cls))) {
+        struct msped_lote_item tmp = {.mapa = mapa, .mapa_tamanho = mapa_tamanho, .copia = copia};
+        msped_lote_item_liberar(&tmp);
         return false;
     }
-    lote->itens[lote->quantidade++] = arquivo_xml;
+    item->arquivo = arquivo_xml;
+    item->xml = dados;
+    item->tamanho = tamanho;
+    item->mapa = mapa;
+    item->mapa_tamanho = mapa_tamanho;
+    item->copia = copia;
+    lote->tamanho += tamanho;
+    lote->quantidade++;
     return true;
 }
 
@@ -535,9 +712,21 @@ const char *msped_lote_arquivo_obter_por_indice(struct msped_lote *lote, uint8_t
         _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "lote");
         return false;
     }
-    if (indice < 0 || indice > lote->quantidade)
+    if (indice >= lote->quantidade)
+        return NULL;
+    return lote->itens[indice].arquivo;
+}
+
+const char *msped_lote_xml_obter_por_indice(struct msped_lote *lote, uint8_t indice, size_t *tamanho) {
+    if (NULL == lote || indice >= lote->quantidade)
         return NULL;
-    return lote->itens[indice];
+    if (NULL != tamanho)
+        *tamanho = lote->itens[indice].tamanho;
+    return lote->itens[indice].xml;
+}
+
+size_t msped_lote_tamanho(struct msped_lote *lote) {
+    return (NULL == lote ? 0 : lote->tamanho);
 }
 
 int8_t msped_lote_contar(struct msped_lote *lote) {
@@ -557,107 +746,274 @@ char *msped_doc_obter_chave(void *doc, const char *tag) {
     return res;
 }
 
-bool msped_qrcode_acrescentar(struct msped_cfg *cfg, void *xml_doc, msped_erro_callback erro_cb, void *erro_cls) {
-    bool res;
-    xmlDocPtr doc;
-    xmlNodePtr root;
+#define MSPED_QRCODE_HEX_TAM 64
+
+struct msped_qrcode_campos {
     xmlNodePtr nfe;
-    xmlNodePtr ide;
-    xmlNodePtr dest;
-    xmlNodePtr icmsTot;
-    xmlNodePtr signedInfo;
-    xmlNodePtr infNFeSupl;
-    xmlNodePtr nodeqr;
     xmlNodePtr signature;
-    char *chNFe;
-    char *cUF;
-    char *tpAmb;
-    char *dhEmi;
-    char *cDest;
-    char *vNF;
-    char *vICMS;
-    char *digVal;
-    const char *token;
-    const char *idToken;
+    const char *ch_nfe;
+    const char *tp_amb;
+    const char *dh_emi;
+    const char *c_dest;
+    const char *v_nf;
+    const char *v_icms;
+    const char *dig_val;
+};
+
+struct msped_qrcode_lote {
+    void **docs;
+    bool *resultados;
+    size_t quantidade;
+    const char *url;
     const char *versao;
+    const char *id_token;
+    const char *token;
+    atomic_size_t proximo;
+    atomic_size_t falhas;
+    msped_erro_callback erro_cb;
+    void *erro_cls;
+};
+
+static const char *msped_qrcode_no_texto(xmlNodePtr node) {
+    if (NULL == node->children || XML_TEXT_NODE != node->children->type || NULL == node->children->content)
+        return NULL;
+    return (const char *) node->children->content;
+}
+
+static bool msped_qrcode_no_nome(xmlNodePtr node, const char *nome) {
+    return NULL != node && NULL != node->name && 0 == strcmp((const char *) node->name, nome);
+}
+
+static void msped_qrcode_visitar(xmlNodePtr node, struct msped_qrcode_campos *campos) {
+    xmlNodePtr pai = node->parent;
+    xmlAttrPtr id;
+    const char *valor;
+    if (NULL == campos->nfe) {
+        if (msped_qrcode_no_nome(node, "NFe"))
+            campos->nfe = node;
+        return;
+    }
+    if (pai == campos->nfe) {
+        if (msped_qrcode_no_nome(node, "Signature"))
+            campos->signature = node;
+        else if (msped_qrcode_no_nome(node, "infNFe") && NULL != (id = xmlHasProp(node, BAD_CAST "Id")) &&
+                 NULL != id->children && NULL != (valor = (const char *) id->children->content)) {
+            while (*valor && !isdigit((unsigned char) *valor))
+                valor++;
+            campos->ch_nfe = valor;
+        }
+    } else if (msped_qrcode_no_nome(pai, "ide")) {
+        if (msped_qrcode_no_nome(node, "tpAmb"))
+            campos->tp_amb = msped_qrcode_no_texto(node);
+        else if (msped_qrcode_no_nome(node, "dhEmi"))
+            campos->dh_emi = msped_qrcode_no_texto(node);
+    } else if (msped_qrcode_no_nome(pai, "dest")) {
+        if (NULL == campos->c_dest &&
+            (msped_qrcode_no_nome(node, "CNPJ") || msped_qrcode_no_nome(node, "CPF") ||
+             msped_qrcode_no_nome(node, "idEstrangeiro")) && !mu_is_empty(valor = msped_qrcode_no_texto(node)))
+            campos->c_dest = valor;
+    } else if (msped_qrcode_no_nome(pai, "ICMSTot")) {
+        if (msped_qrcode_no_nome(node, "vNF"))
+            campos->v_nf = msped_qrcode_no_texto(node);
+        else if (msped_qrcode_no_nome(node, "vICMS"))
+            campos->v_icms = msped_qrcode_no_texto(node);
+    } else if (msped_qrcode_no_nome(pai, "Reference") && msped_qrcode_no_nome(pai->parent, "SignedInfo")) {
+        if (NULL == campos->dig_val && msped_qrcode_no_nome(node, "DigestValue"))
+            campos->dig_val = msped_qrcode_no_texto(node);
+    }
+}
+
+/* Coleta os campos do QR Code num único percurso do documento, sem copiar valores. */
+static void msped_qrcode_coletar(xmlNodePtr root, struct msped_qrcode_campos *campos) {
+    xmlNodePtr node;
+    memset(campos, 0, sizeof(struct msped_qrcode_campos));
+    node = root;
+    while (NULL != node) {
+        if (XML_ELEMENT_NODE == node->type) {
+            msped_qrcode_visitar(node, campos);
+            if (NULL != campos->dig_val)
+                break;
+            if (NULL != node->children) {
+                node = node->children;
+                continue;
+            }
+        }
+        while (node != root && NULL == node->next)
+            node = node->parent;
+        node = (node == root ? NULL : node->next);
+    }
+}
+
+static bool msped_qrcode_hex(const char *str, char *hex) {
+    size_t len = strlen(str);
+    if (len > MSPED_QRCODE_HEX_TAM)
+        return false;
+    for (size_t i = 0; i < len; i++)
+        mu_uitoh((uint8_t) str[i], hex + i * 2);
+    hex[len * 2] = '\0';
+    return true;
+}
+
+static char *msped_qrcode_url_montar(EVP_MD_CTX *md_ctx, const char *url, const struct msped_qrcode_campos *campos,
+                                     const char *versao, const char *id_token, const char *token) {
+    char *res;
+    char *seq;
+    const char *p_c_dest;
+    char p_dh_emi[MSPED_QRCODE_HEX_TAM * 2 + 1];
+    char p_dig_val[MSPED_QRCODE_HEX_TAM * 2 + 1];
+    char hash[SHA_DIGEST_LENGTH * 2 + 1];
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_tam;
+    if (!msped_qrcode_hex(campos->dh_emi, p_dh_emi) || !msped_qrcode_hex(campos->dig_val, p_dig_val))
+        return NULL;
+    p_c_dest = msped_qrcode_param_url(campos->c_dest);
+    seq = mu_fmt(MSPED_QRCODE_SEQ_FMT,
+                 campos->ch_nfe,
+                 versao,
+                 campos->tp_amb,
+                 (strcmp("", p_c_dest) == 0 ? "" : "&cDest="), p_c_dest,
+                 p_dh_emi,
+                 campos->v_nf,
+                 campos->v_icms,
+                 p_dig_val,
+                 id_token);
+    if (NULL == seq)
+        return NULL;
+    if (1 != EVP_DigestInit_ex(md_ctx, EVP_sha1(), NULL) ||
+        1 != EVP_DigestUpdate(md_ctx, seq, strlen(seq)) ||
+        1 != EVP_DigestUpdate(md_ctx, token, strlen(token)) ||
+        1 != EVP_DigestFinal_ex(md_ctx, digest, &digest_tam)) {
+        free(seq);
+        return NULL;
+    }
+    for (unsigned int i = 0; i < digest_tam; i++)
+        mu_uitouh(digest[i], hash + i * 2);
+    hash[digest_tam * 2] = '\0';
+    res = mu_fmt(MSPED_QRCODE_URL_FMT, url, (NULL == strchr(url, '?') ? "?" : ""), seq, hash);
+    free(seq);
+    return res;
+}
+
+static bool msped_qrcode_doc_acrescentar(struct msped_qrcode_lote *lote, EVP_MD_CTX *md_ctx, xmlDocPtr doc) {
+    struct msped_qrcode_campos campos;
+    xmlNodePtr infNFeSupl;
+    xmlNodePtr nodeqr;
+    char *qrcode;
+    msped_qrcode_coletar(xmlDocGetRootElement(doc), &campos);
+    if (NULL == campos.signature) {
+        _MSPED_ERR(lote->erro_cb, lote->erro_cls, S_MSPED_XML_ELEM_ERR, "Signature");
+        return false;
+    }
+    if (mu_is_empty(campos.ch_nfe) || mu_is_empty(campos.tp_amb) || mu_is_empty(campos.dh_emi) ||
+        mu_is_empty(campos.v_nf) || mu_is_empty(campos.v_icms) || mu_is_empty(campos.dig_val)) {
+        _MSPED_ERR(lote->erro_cb, lote->erro_cls, S_MSPED_QRCODE_ERR,
+                   (mu_is_empty(campos.ch_nfe) ? "" : campos.ch_nfe));
+        return false;
+    }
+    qrcode = msped_qrcode_url_montar(md_ctx, lote->url, &campos, lote->versao, lote->id_token, lote->token);
+    if (mu_is_empty(qrcode)) {
+        free(qrcode);
+        _MSPED_ERR(lote->erro_cb, lote->erro_cls, S_MSPED_QRCODE_ERR, campos.ch_nfe);
+        return false;
+    }
+    infNFeSupl = mxml_xml_doc_create_empty_element(doc, "infNFeSupl");
+    nodeqr = mxml_xml_node_append_child(infNFeSupl, mxml_xml_doc_create_empty_element(doc, "qrCode"));
+    mxml_xml_node_append_child(nodeqr, mxml_xml_doc_create_cdata_section(doc, qrcode, 0));
+    mxml_xml_node_insert_before(campos.signature, infNFeSupl);
+    free(qrcode);
+    return true;
+}
+
+static void *msped_qrcode_lote_trabalhador(void *cls) {
+    struct msped_qrcode_lote *lote = cls;
+    EVP_MD_CTX *md_ctx;
+    size_t i;
+    bool ok;
+    md_ctx = EVP_MD_CTX_new();
+    while ((i = atomic_fetch_add(&lote->proximo, 1)) < lote->quantidade) {
+        ok = (NULL != md_ctx && NULL != lote->docs[i] && msped_qrcode_doc_acrescentar(lote, md_ctx, lote->docs[i]));
+        if (NULL != lote->resultados)
+            lote->resultados[i] = ok;
+        if (!ok)
+            atomic_fetch_add(&lote->falhas, 1);
+    }
+    EVP_MD_CTX_free(md_ctx);
+    return NULL;
+}
+
+bool msped_qrcode_lote_acrescentar(struct msped_cfg *cfg, void **xml_docs, size_t quantidade, unsigned int threads,
+                                   bool *resultados, msped_erro_callback erro_cb, void *erro_cls) {
+    struct msped_qrcode_lote lote;
+    pthread_t *trabalhadores;
+    unsigned int criados;
     char *servico;
     char *sv_metodo;
     char *sv_operacao;
     char *sv_versao;
     char *sv_str;
     char *url;
-    char *qrcode;
     if (NULL == cfg) {
         _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "cfg");
         return false;
     }
-    if (NULL == xml_doc) {
-        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "xml_doc");
+    if (NULL == xml_docs) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "xml_docs");
         return false;
     }
-    res = false;
-    doc = xml_doc;
-    root = xmlDocGetRootElement(doc);
-    nfe = mxml_xml_node_find_node_by_name(root, "NFe");
-    ide = mxml_xml_node_find_node_by_name(root, "ide");
-    dest = mxml_xml_node_find_node_by_name(root, "dest");
-    icmsTot = mxml_xml_node_find_node_by_name(root, "ICMSTot");
-    signedInfo = mxml_xml_node_find_node_by_name(root, "SignedInfo");
-    chNFe = msped_doc_obter_chave(doc, "infNFe");
-    cUF = mxml_xml_node_get_value_str(ide, "cUF");
-    tpAmb = mxml_xml_node_get_value_str(ide, "tpAmb");
-    dhEmi = mxml_xml_node_get_value_str(ide, "dhEmi");
-    cDest = NULL;
-    if (NULL != dest) {
-        cDest = mxml_xml_node_get_value_str(dest, "CNPJ");
-        if (strcmp("", cDest) == 0) {
-            cDest = mxml_xml_node_get_value_str(dest, "CPF");
-            if (strcmp("", cDest) == 0)
-                cDest = mxml_xml_node_get_value_str(dest, "idEstrangeiro");
-        }
+    if (mu_is_empty(cfg->token)) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "token");
+        return false;
     }
-    vNF = mxml_xml_node_get_value_str(icmsTot, "vNF");
-    vICMS = mxml_xml_node_get_value_str(icmsTot, "vICMS");
-    digVal = mxml_xml_node_get_value_str(signedInfo, "DigestValue");
-    token = cfg->token;
-    idToken = (mu_is_empty(cfg->id_token), "000001", cfg->id_token);
-    versao = (mu_is_empty(cfg->n_versao), "100", cfg->n_versao);
     servico = "NfeConsultaQR";
     if (!msped_ws_info(cfg->modelo_nf, cfg->modelo, cfg->tipo, cfg->ambiente, cfg->cuf, cfg->sv, servico,
-                       &sv_metodo, &sv_operacao, &sv_versao, &sv_str, &url, erro_cb, erro_cls)) {
+                       &sv_metodo, &sv_operacao, &sv_versao, &sv_str, &url, erro_cb, erro_cls) || NULL == url) {
         if (MSPED_NF_NENHUM != cfg->modelo)
             _MSPED_ERR(erro_cb, erro_cls, S_MSPED_SRV_MOD_IND, msped_modelo_para_str(cfg->modelo),
-                        msped_cuf_para_uf(cfg->cuf), servico);
+                       msped_cuf_para_uf(cfg->cuf), servico);
         else
             _MSPED_ERR(erro_cb, erro_cls, S_MSPED_SRV_IND, msped_cuf_para_uf(cfg->cuf), servico);
-        goto feito;
-    }
-    qrcode = msped_qrcode_url_criar(url, chNFe, versao, tpAmb, cDest, dhEmi, vNF, vICMS, digVal, idToken, token,
-                                    erro_cb, erro_cls);
-    if (mu_is_empty(qrcode)) {
-        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_QRCODE_ERR, chNFe);
-        goto feito;
+        return false;
     }
-    infNFeSupl = mxml_xml_doc_create_empty_element(doc, "infNFeSupl");
-    nodeqr = mxml_xml_node_append_child(infNFeSupl, mxml_xml_doc_create_empty_element(doc, "qrCode"));
-    mxml_xml_node_append_child(nodeqr, mxml_xml_doc_create_cdata_section(doc, qrcode, 0));
-    signature = mxml_xml_node_find_node_by_name(nfe, "Signature");
-    if (NULL == signature) {
-        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_XML_ELEM_ERR, "Signature");
-        goto feito;
+    memset(&lote, 0, sizeof(struct msped_qrcode_lote));
+    lote.docs = xml_docs;
+    lote.resultados = resultados;
+    lote.quantidade = quantidade;
+    lote.url = url;
+    lote.versao = (mu_is_empty(cfg->n_versao) ? "100" : cfg->n_versao);
+    lote.id_token = (mu_is_empty(cfg->id_token) ? "000001" : cfg->id_token);
+    lote.token = cfg->token;
+    atomic_init(&lote.proximo, 0);
+    atomic_init(&lote.falhas, 0);
+    lote.erro_cb = erro_cb;
+    lote.erro_cls = erro_cls;
+    if (0 == threads) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0 ? (unsigned int) cpus : 1);
+    }
+    if (threads > quantidade)
+        threads = (unsigned int) quantidade;
+    criados = 0;
+    trabalhadores = NULL;
+    if (threads > 1 && NULL != (trabalhadores = malloc((threads - 1) * sizeof(pthread_t))))
+        for (unsigned int i = 0; i < threads - 1; i++) {
+            if (0 != pthread_create(&trabalhadores[criados], NULL, &msped_qrcode_lote_trabalhador, &lote))
+                break;
+            criados++;
+        }
+    msped_qrcode_lote_trabalhador(&lote);
+    for (unsigned int i = 0; i < criados; i++)
+        pthread_join(trabalhadores[i], NULL);
+    free(trabalhadores);
+    return 0 == atomic_load(&lote.falhas);
+}
+
+bool msped_qrcode_acrescentar(struct msped_cfg *cfg, void *xml_doc, msped_erro_callback erro_cb, void *erro_cls) {
+    bool res;
+    if (NULL == xml_doc) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "xml_doc");
+        return false;
     }
-    mxml_xml_node_insert_before(signature, infNFeSupl);
-    res = true;
-    free(qrcode);
-feito:
-    free(chNFe);
-    free(cUF);
-    free(tpAmb);
-    free(dhEmi);
-    free(cDest);
-    free(vNF);
-    free(vICMS);
-    free(digVal);
+    res = msped_qrcode_lote_acrescentar(cfg, &xml_doc, 1, 1, NULL, erro_cb, erro_cls);
     if (res && cfg->depuravel)
         xmlDocFormatDump(stdout, xml_doc, 1);
     return res;
@@ -678,11 +1034,9 @@ bool msped_enviar_lote(struct msped_cfg *cfg, struct msped_lote *lote, enum MSPE
     char *url;
     uint64_t id_lote;
     uint8_t ind_sinc;
-    const char *item;
-    char *nfe;
-    char *tmp_str;
-    size_t nfe_len;
-    char *xmls;
+    const char *nfes[MSPED_LOTE_QTD_MAX_ITENS];
+    size_t tamanhos[MSPED_LOTE_QTD_MAX_ITENS];
+    uint8_t qtd;
     if (NULL == cfg) {
         _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, "cfg");
         return false;
@@ -710,56 +1064,29 @@ bool msped_enviar_lote(struct msped_cfg *cfg, struct msped_lote *lote, enum MSPE
     if (NULL != lote_gera_id_cb)
         id_lote = lote_gera_id_cb(lote_gera_id_cls);
     else
-        id_lote = 0;
+        id_lote = msped_lote_id_gerar(NULL);
     if (processo == MSPED_PROC_TIPO_SINCRONO)
         ind_sinc = 1;
     else
         ind_sinc = 0;
-    if (lote->quantidade < 1) {
+    qtd = 0;
+    for (uint8_t i = 0; i < lote->quantidade; i++)
+        if (lote->itens[i].tamanho > MSPED_NF_TAMANHO_MIN) {
+            nfes[qtd] = lote->itens[i].xml;
+            tamanhos[qtd++] = lote->itens[i].tamanho;
+        }
+    if (qtd < 1) {
         _MSPED_ERR(erro_cb, erro_cls, "%s", S_MSPED_SEM_NFE_ERR);
         return false;
     }
-    xmls = NULL;
-    for (int i = 0; i < lote->quantidade; i++)
-        if (NULL != (item = lote->itens[i])) {
-            if (!mu_exists(item)) {
-                _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARQ_NAO_ENC, item);
-                free(xmls);
-                return false;
-            }
-            nfe = mu_ftos(item);
-            if (NULL == nfe) {
-                _MSPED_ERR(erro_cb, erro_cls, S_MSPED_VAR_ERR, "xmls");
-                free(xmls);
-                return false;
-            }
-            tmp_str = mu_rtrim(nfe);
-            free(nfe);
-            nfe = tmp_str;
-            nfe_len = strlen(nfe);
-            if (nfe_len > 256) { // tamanho mínimo de uma nota
-                if (NULL == xmls)
-                    xmls = nfe;
-                else {
-                    tmp_str = realloc(xmls, strlen(nfe) + 1);
-                    xmls = tmp_str;
-                    free(tmp_str);
-                    strcat(xmls, nfe);
-                    free(nfe);
-                }
-            } else
-                free(nfe);
-        }
-    if (NULL == xmls) {
-        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_VAR_ERR, "xmls");
-        free(xmls);
+    envi_lote = msped_montar_envi_lote_partes(cfg->tipo, cfg->portal, versao, id_lote, ind_sinc, nfes, tamanhos, qtd,
+                                              NULL);
+    if (NULL == envi_lote) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_VAR_ERR, "envi_lote");
         return false;
     }
-    xmls[strlen(xmls)] = '\0';
-    envi_lote = msped_montar_envi_lote(cfg->tipo, cfg->portal, versao, id_lote, ind_sinc, xmls);
     res = msped_enviar_envelope_soap12(cfg, url, operacao, envi_lote, versao, http_escrita_cb, http_escrita_cls,
                                        http_tentativa_cb, http_tentativa_cls, erro_cb, erro_cls);
-    free(xmls);
     free(envi_lote);
     return res;
 }
@@ -867,7 +1194,10 @@ bool msped_enviar_evento(struct msped_cfg *cfg, enum MSPED_DOC_TIPO tipo_doc, co
         return false;
     }
     free(mensagem);
-    num_lote = lote_gera_id_cb(lote_gera_id_cls);
+    if (NULL != lote_gera_id_cb)
+        num_lote = lote_gera_id_cb(lote_gera_id_cls);
+    else
+        num_lote = msped_lote_id_gerar(NULL);
     env_evento = msped_montar_env_evento(cfg->portal, versao, num_lote, signed_msg);
     res = msped_enviar_envelope_soap12(cfg, url, operacao, env_evento, versao, http_escrita_cb, http_escrita_cls,
                                        http_tentativa_cb, http_tentativa_cls, erro_cb, erro_cls);
@@ -875,10 +1205,10 @@ bool msped_enviar_evento(struct msped_cfg *cfg, enum MSPED_DOC_TIPO tipo_doc, co
     return res;
 }
 
-char *msped_atribuir_prot_msg(const char *tagproc, const char *tagmsg, const char *xmlmsg, const char *tagretorno,
-                              const char *xmlretorno, bool *atribuido,
-                              msped_atribuir_prot_msg_callback atrib_cb, void *atrib_cls,
-                              msped_erro_callback erro_cb, void *erro_cls) {
+static char *msped_atribuir_prot_msg_dom(const char *tagproc, const char *tagmsg, const char *xmlmsg,
+                                         const char *tagretorno, const char *xmlretorno, bool *atribuido,
+                                         msped_atribuir_prot_msg_callback atrib_cb, void *atrib_cls,
+                                         msped_erro_callback erro_cb, void *erro_cls) {
     xmlDocPtr doc;
     xmlDocPtr proc;
     xmlNodePtr nodedoc;
@@ -947,6 +1277,83 @@ feito:
     return res;
 }
 
+char *msped_atribuir_prot_msg(const char *tagproc, const char *tagmsg, const char *xmlmsg, const char *tagretorno,
+                              const char *xmlretorno, bool *atribuido,
+                              msped_atribuir_prot_msg_callback atrib_cb, void *atrib_cls,
+                              msped_erro_callback erro_cb, void *erro_cls) {
+    const char *msg;
+    const char *ret;
+    const char *procver;
+    const char *procns;
+    size_t msg_len;
+    size_t ret_len;
+    size_t procver_len;
+    size_t procns_len;
+    size_t tagproc_len;
+    size_t tam;
+    bool msg_pfx;
+    bool ret_pfx;
+    xmlDocPtr doc1;
+    char *res;
+    char *p;
+    if (NULL == xmlmsg || NULL == xmlretorno || mu_is_empty(tagproc)) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_ARG_REQ, (NULL == xmlmsg ? "xmlmsg" :
+                                                        (NULL == xmlretorno ? "xmlretorno" : "tagproc")));
+        return NULL;
+    }
+    msg = mxml_xml_scan_element(xmlmsg, 0, tagmsg, &msg_len, &msg_pfx);
+    ret = mxml_xml_scan_element(xmlretorno, 0, tagretorno, &ret_len, &ret_pfx);
+    /* elementos com prefixo dependem de declarações de namespace dos ancestrais, então são montados via DOM */
+    if (NULL == msg || NULL == ret || msg_pfx || ret_pfx)
+        return msped_atribuir_prot_msg_dom(tagproc, tagmsg, xmlmsg, tagretorno, xmlretorno, atribuido,
+                                           atrib_cb, atrib_cls, erro_cb, erro_cls);
+    procver = mxml_xml_scan_attribute(msg, msg_len, "versao", &procver_len);
+    if (NULL == procver || procver_len < 1) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_XML_ATRI_ERR, "versao");
+        return NULL;
+    }
+    procns = mxml_xml_scan_attribute(msg, msg_len, "xmlns", &procns_len);
+    if (NULL == procns || procns_len < 1) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_XML_ATRI_ERR, "xmlns");
+        return NULL;
+    }
+    tagproc_len = strlen(tagproc);
+    tam = sizeof(MSPED_PROC_DECL) - 1 + 1 + tagproc_len + sizeof(" versao=\"\" xmlns=\"\">") - 1 + procver_len +
+          procns_len + msg_len + ret_len + 2 + tagproc_len + 1;
+    res = malloc(tam + sizeof(char));
+    if (NULL == res) {
+        _MSPED_ERR(erro_cb, erro_cls, S_MSPED_VAR_ERR, "res");
+        return NULL;
+    }
+    p = res;
+#define _MSPED_APP(str, len) do { memcpy(p, (str), (len)); p += (len); } while (0)
+    _MSPED_APP(MSPED_PROC_DECL "<", sizeof(MSPED_PROC_DECL));
+    _MSPED_APP(tagproc, tagproc_len);
+    _MSPED_APP(" versao=\"", 9);
+    _MSPED_APP(procver, procver_len);
+    _MSPED_APP("\" xmlns=\"", 9);
+    _MSPED_APP(procns, procns_len);
+    _MSPED_APP("\">", 2);
+    _MSPED_APP(msg, msg_len);
+    _MSPED_APP(ret, ret_len);
+    _MSPED_APP("</", 2);
+    _MSPED_APP(tagproc, tagproc_len);
+    _MSPED_APP(">", 1);
+#undef _MSPED_APP
+    *p = '\0';
+    if (NULL != atrib_cb) {
+        doc1 = xmlReadMemory(xmlretorno, (int) strlen(xmlretorno), NULL, NULL, 0);
+        if (NULL == doc1) {
+            _MSPED_ERR(erro_cb, erro_cls, S_MSPED_OBJ_ERR, "doc1");
+            free(res);
+            return NULL;
+        }
+        *atribuido = atrib_cb(atrib_cls, doc1);
+        xmlFreeDoc(doc1);
+    }
+    return res;
+}
+
 bool msped_enviar_evento_cce(struct msped_cfg *cfg, enum MSPED_DOC_TIPO tipo_doc, const char *doc, const char *chave,
                              const char *x_correcao, uint8_t n_seq_evento,
                              msped_evento_assinatura_msg_callback assin_msg_cb, void *assin_msg_cls,
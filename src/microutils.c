@@ -42,6 +42,7 @@
 #include <regex.h>
 #include <libgen.h>
 #include <assert.h>
+#include <pthread.h>
 #include <zlib.h>
 
 #define _(String) (String)
@@ -395,8 +396,13 @@ char *mu_now_rfc2822() {
     size_t len;
     time_t t;
     struct tm *tm;
+    struct tm lt;
     t = time(NULL);
-    tm = localtime(&t);
+#ifdef WIN32
+    tm = localtime_s(&lt, &t) == 0 ? &lt : NULL;
+#else
+    tm = localtime_r(&t, &lt);
+#endif
     if (!tm)
         return NULL;
     /* see man: https://linux.die.net/man/3/strftime */
@@ -762,6 +768,300 @@ int mu_zfdeflate(const char *filename_in, const char *filename_out, int level) {
     return ret;
 }
 
+int mu_zdeflate_mem(const void *src, size_t len, void **dest, size_t *dest_len, int level) {
+    uLongf out_len;
+    void *out, *shrunk;
+    int ret;
+    if (!src || !dest || !dest_len) {
+        errno = EINVAL;
+        return Z_ERRNO;
+    }
+    out_len = compressBound((uLong) len);
+    if (!(out = malloc(out_len)))
+        return Z_MEM_ERROR;
+    ret = compress2(out, &out_len, src, (uLong) len, level);
+    if (ret != Z_OK) {
+        free(out);
+        return ret;
+    }
+    if ((shrunk = realloc(out, out_len > 0 ? out_len : 1)))
+        out = shrunk;
+    *dest = out;
+    *dest_len = out_len;
+    return Z_OK;
+}
+
+struct _mu_zpjob {
+    unsigned char *in;
+    size_t in_len;
+    const unsigned char *dict;
+    size_t dict_len;
+    unsigned char *out;
+    size_t out_len;
+    size_t out_size;
+    uLong crc;
+    bool last;
+    int ret;
+};
+
+struct _mu_zpool {
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    struct _mu_zpjob *jobs;
+    unsigned int njobs;
+    unsigned int next;
+    unsigned int done;
+    int level;
+    bool quit;
+};
+
+static int _mu_zpjob_deflate(struct _mu_zpjob *job, int level) {
+    z_stream strm;
+    unsigned char *out;
+    size_t size;
+    int ret, flush;
+    job->crc = crc32(crc32(0L, Z_NULL, 0), job->in, (uInt) job->in_len);
+    job->out_len = 0;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    ret = deflateInit2(&strm, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK)
+        return ret;
+    if (job->dict_len > 0 && (ret = deflateSetDictionary(&strm, job->dict, (uInt) job->dict_len)) != Z_OK)
+        goto done;
+    /* room for the sync flush marker besides the deflate bound */
+    size = deflateBound(&strm, (uLong) job->in_len) + 16;
+    if (size > job->out_size) {
+        if (!(out = realloc(job->out, size))) {
+            ret = Z_MEM_ERROR;
+            goto done;
+        }
+        job->out = out;
+        job->out_size = size;
+    }
+    flush = job->last ? Z_FINISH : Z_SYNC_FLUSH;
+    strm.next_in = job->in;
+    strm.avail_in = (uInt) job->in_len;
+    for (;;) {
+        strm.next_out = job->out + job->out_len;
+        strm.avail_out = (uInt) (job->out_size - job->out_len);
+        ret = deflate(&strm, flush);
+        assert(ret != Z_STREAM_ERROR);
+        job->out_len = job->out_size - strm.avail_out;
+        if (strm.avail_out > 0 && strm.avail_in == 0)
+            break;
+        size = job->out_size * 2;
+        if (!(out = realloc(job->out, size))) {
+            ret = Z_MEM_ERROR;
+            goto done;
+        }
+        job->out = out;
+        job->out_size = size;
+    }
+    ret = (job->last ? ret == Z_STREAM_END : ret == Z_OK) ? Z_OK : Z_BUF_ERROR;
+done:
+    deflateEnd(&strm);
+    return ret;
+}
+
+static void *_mu_zpool_worker(void *cls) {
+    struct _mu_zpool *pool = cls;
+    struct _mu_zpjob *job;
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        while (!pool->quit && pool->next >= pool->njobs)
+            pthread_cond_wait(&pool->work_cond, &pool->mutex);
+        if (pool->quit)
+            break;
+        job = &pool->jobs[pool->next++];
+        pthread_mutex_unlock(&pool->mutex);
+        job->ret = _mu_zpjob_deflate(job, pool->level);
+        pthread_mutex_lock(&pool->mutex);
+        if (++pool->done == pool->njobs)
+            pthread_cond_signal(&pool->done_cond);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+    return NULL;
+}
+
+static size_t _mu_zpread(mu_zstream_data_cb read_cb, void *read_cls, mu_zstream_eof_cb eof_cb, void *eof_cls,
+                         unsigned char *buf, size_t size, bool *eof) {
+    size_t len = 0, ret;
+    while (len < size) {
+        ret = read_cb(read_cls, buf + len, size - len);
+        if (ret == (size_t) -1)
+            return ret;
+        len += ret;
+        if (ret == 0 || eof_cb(eof_cls)) {
+            *eof = true;
+            break;
+        }
+    }
+    return len;
+}
+
+static void _mu_zput32(unsigned char *buf, uLong val) {
+    buf[0] = (unsigned char) (val & 0xff);
+    buf[1] = (unsigned char) ((val >> 8) & 0xff);
+    buf[2] = (unsigned char) ((val >> 16) & 0xff);
+    buf[3] = (unsigned char) ((val >> 24) & 0xff);
+}
+
+int mu_zpdeflate(mu_zstream_data_cb read_cb, void *read_cls, mu_zstream_data_cb write_cb, void *write_cls,
+                 mu_zstream_eof_cb eof_cb, void *eof_cls, int level, unsigned int threads) {
+    struct _mu_zpool pool;
+    pthread_t *workers;
+    unsigned char *dict = NULL;
+    unsigned char hdr[10] = {0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, 0, 3};
+    unsigned char trl[8];
+    unsigned int i, n, nworkers = 0;
+    size_t dict_len = 0, len;
+    uLong crc, total = 0;
+    bool eof = false;
+    int ret = Z_OK;
+    if (!read_cb || !read_cls || !write_cb || !write_cls || !eof_cb || !eof_cls) {
+        errno = EINVAL;
+        return Z_ERRNO;
+    }
+    if (level == Z_DEFAULT_COMPRESSION)
+        level = 6;
+    if (level < 0 || level > 9)
+        return Z_STREAM_ERROR;
+    if (threads == 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = ncpu > 0 ? (unsigned int) ncpu : 1;
+#else
+        threads = 1;
+#endif
+    }
+    memset(&pool, 0, sizeof(struct _mu_zpool));
+    pool.level = level;
+    pool.jobs = calloc(threads, sizeof(struct _mu_zpjob));
+    workers = calloc(threads, sizeof(pthread_t));
+    dict = malloc(MU_ZPDICT_SIZE);
+    if (!pool.jobs || !workers || !dict) {
+        ret = Z_MEM_ERROR;
+        goto done;
+    }
+    for (i = 0; i < threads; i++)
+        if (!(pool.jobs[i].in = malloc(MU_ZPBLOCK_SIZE))) {
+            ret = Z_MEM_ERROR;
+            goto done;
+        }
+    pthread_mutex_init(&pool.mutex, NULL);
+    pthread_cond_init(&pool.work_cond, NULL);
+    pthread_cond_init(&pool.done_cond, NULL);
+    for (i = 0; i < threads; i++) {
+        if (pthread_create(&workers[nworkers], NULL, &_mu_zpool_worker, &pool) != 0)
+            break;
+        nworkers++;
+    }
+    if (nworkers == 0) {
+        ret = Z_ERRNO;
+        goto cleanup;
+    }
+    hdr[8] = (unsigned char) (level == 9 ? 2 : (level == 1 ? 4 : 0));
+    if (write_cb(write_cls, hdr, sizeof(hdr)) == -1) {
+        ret = Z_ERRNO;
+        goto cleanup;
+    }
+    crc = crc32(0L, Z_NULL, 0);
+    while (!eof) {
+        for (n = 0; n < threads && !eof; n++) {
+            struct _mu_zpjob *job = &pool.jobs[n];
+            len = _mu_zpread(read_cb, read_cls, eof_cb, eof_cls, job->in, MU_ZPBLOCK_SIZE, &eof);
+            if (len == (size_t) -1) {
+                ret = Z_ERRNO;
+                goto cleanup;
+            }
+            job->in_len = len;
+            job->last = eof;
+            if (n == 0) {
+                job->dict = dict;
+                job->dict_len = dict_len;
+            } else {
+                struct _mu_zpjob *prev = &pool.jobs[n - 1];
+                job->dict_len = prev->in_len < MU_ZPDICT_SIZE ? prev->in_len : MU_ZPDICT_SIZE;
+                job->dict = prev->in + prev->in_len - job->dict_len;
+            }
+        }
+        pthread_mutex_lock(&pool.mutex);
+        pool.njobs = n;
+        pool.next = 0;
+        pool.done = 0;
+        pthread_cond_broadcast(&pool.work_cond);
+        while (pool.done < pool.njobs)
+            pthread_cond_wait(&pool.done_cond, &pool.mutex);
+        pthread_mutex_unlock(&pool.mutex);
+        for (i = 0; i < n; i++) {
+            struct _mu_zpjob *job = &pool.jobs[i];
+            if (job->ret != Z_OK) {
+                ret = job->ret;
+                goto cleanup;
+            }
+            if (write_cb(write_cls, job->out, job->out_len) == -1) {
+                ret = Z_ERRNO;
+                goto cleanup;
+            }
+            crc = crc32_combine(crc, job->crc, (z_off_t) job->in_len);
+            total += (uLong) job->in_len;
+        }
+        dict_len = pool.jobs[n - 1].in_len < MU_ZPDICT_SIZE ? pool.jobs[n - 1].in_len : MU_ZPDICT_SIZE;
+        memcpy(dict, pool.jobs[n - 1].in + pool.jobs[n - 1].in_len - dict_len, dict_len);
+    }
+    _mu_zput32(trl, crc);
+    _mu_zput32(trl + 4, total);
+    if (write_cb(write_cls, trl, sizeof(trl)) == -1)
+        ret = Z_ERRNO;
+cleanup:
+    pthread_mutex_lock(&pool.mutex);
+    pool.quit = true;
+    pthread_cond_broadcast(&pool.work_cond);
+    pthread_mutex_unlock(&pool.mutex);
+    for (i = 0; i < nworkers; i++)
+        pthread_join(workers[i], NULL);
+    pthread_cond_destroy(&pool.done_cond);
+    pthread_cond_destroy(&pool.work_cond);
+    pthread_mutex_destroy(&pool.mutex);
+done:
+    if (pool.jobs)
+        for (i = 0; i < threads; i++) {
+            free(pool.jobs[i].in);
+            free(pool.jobs[i].out);
+        }
+    free(pool.jobs);
+    free(workers);
+    free(dict);
+    return ret;
+}
+
+int mu_zfpdeflate(const char *filename_in, const char *filename_out, int level, unsigned int threads) {
+    FILE *fin, *fout;
+    int ret;
+    if (mu_is_empty(filename_in) || mu_is_empty(filename_out)) {
+        errno = EINVAL;
+        return Z_ERRNO;
+    }
+    fin = fopen(filename_in, "rb");
+    if (!fin)
+        return Z_ERRNO;
+    fout = fopen(filename_out, "wb");
+    if (!fout) {
+        fclose(fin);
+        errno = EINVAL;
+        return Z_ERRNO;
+    }
+    ret = mu_zpdeflate(&_mu_zfstream_read_cb, fin, &_mu_zfstream_write_cb, fout, &_mu_zfstream_eof_cb, fin, level,
+                       threads);
+    fclose(fin);
+    if (fclose(fout) != 0 && ret == Z_OK)
+        ret = Z_ERRNO;
+    return ret;
+}
+
 int mu_zinflate(mu_zstream_data_cb read_cb, void *read_cls, mu_zstream_data_cb write_cb, void *write_cls) {
     int ret;
     unsigned have;
@@ -27,10 +27,18 @@
 #include <config.h>
 #endif
 #include <string.h>
+#include <limits.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <xmlsec/base64.h>
 #include <xmlsec/crypto.h>
 #include <libxml/xmlschemas.h>
 #include <libxml/xmlsave.h>
+#include <libxml/xmlreader.h>
+#include <libxml/hash.h>
 #include <xmlsec/templates.h>
 #include <xmlsec/xmltree.h>
 #include <xmlsec/xmldsig.h>
@@ -39,6 +47,12 @@
 
 #define _(String) (String)
 
+#if LIBXML_VERSION >= 21200
+#define _MXML_CONST_ERROR const
+#else
+#define _MXML_CONST_ERROR
+#endif
+
 #ifndef _MXML_THROW
 #define _MXML_THROW(cb, cls, ...) \
 do { \
@@ -46,7 +60,7 @@ do { \
     char msg[MXML_ERR_SIZE]; \
     if (cb) { \
         err = mu_fmt(__VA_ARGS__); \
-        strcpy(msg, err); \
+        snprintf(msg, sizeof(msg), "%s", err ? err : ""); \
         free(err); \
         cb(cls, msg); \
     } else \
@@ -57,7 +71,6 @@ do { \
 struct mxml_xml_cfg {
     xmlSchemaParserCtxtPtr parser;
     xmlSchema *schema;
-    xmlSchemaValidCtxt *ctxt;
     mxml_err_cb error_cb;
     mxml_err_cb warn_cb;
     void *error_warn_cls;
@@ -145,7 +158,7 @@ static void _mxml_xml_err_cb(void *cls, const char *fmt, ...) {
         if (vasprintf(&err, fmt, va) == -1)
             memset(msg, 0, sizeof(msg));
         else
-            memcpy(msg, err, sizeof(msg));
+            snprintf(msg, sizeof(msg), "%s", err);
         free(err);
         va_end(va);
         cfg->error_cb(cfg->error_warn_cls, msg);
@@ -163,7 +176,7 @@ static void _mxml_xml_warn_cb(void *cls, const char *fmt, ...) {
         if (vasprintf(&warn, fmt, va) == -1)
             memset(msg, 0, sizeof(msg));
         else
-            strcpy(msg, warn);
+            snprintf(msg, sizeof(msg), "%s", warn);
         free(warn);
         va_end(va);
         cfg->warn_cb(cfg->error_warn_cls, msg);
@@ -199,40 +212,38 @@ void mxml_xml_finit() {
 struct mxml_xml_cfg *mxml_xml_cfg_new(const char *xsd_uri,
                                       mxml_err_cb error_cb, mxml_err_cb warn_cb, void *error_warn_cls) {
     struct mxml_xml_cfg *cfg;
+    xmlGenericErrorFunc old_err_func;
+    void *old_err_ctx;
     if (!(cfg = calloc(1, sizeof(struct mxml_xml_cfg))))
         return NULL;
     cfg->error_cb = error_cb;
     cfg->warn_cb = warn_cb;
     cfg->error_warn_cls = error_warn_cls;
+    /* the generic error handler is per thread in libxml2, so it is only borrowed while the schema is parsed */
+    old_err_func = xmlGenericError;
+    old_err_ctx = xmlGenericErrorContext;
     xmlSetGenericErrorFunc(cfg, &_mxml_xml_err_cb);
     cfg->parser = xmlSchemaNewParserCtxt(xsd_uri);
     if (!cfg->parser) {
+        xmlSetGenericErrorFunc(old_err_ctx, old_err_func);
         free(cfg);
         _MXML_THROW(error_cb, error_warn_cls, _("Failed to create XSD parser\n"));
         return NULL;
     }
     xmlSchemaSetParserErrors(cfg->parser, &_mxml_xml_err_cb, &_mxml_xml_warn_cb, cfg);
     cfg->schema = xmlSchemaParse(cfg->parser);
+    xmlSetGenericErrorFunc(old_err_ctx, old_err_func);
     if (!cfg->schema) {
         mxml_xml_cfg_free(cfg);
         _MXML_THROW(error_cb, error_warn_cls, _("Failed to parse XSD schema\n"));
         return NULL;
     }
-    cfg->ctxt = xmlSchemaNewValidCtxt(cfg->schema);
-    if (!cfg->ctxt) {
-        mxml_xml_cfg_free(cfg);
-        _MXML_THROW(error_cb, error_warn_cls, "%s", _("Failed to validade XSD schema\n"));
-        return NULL;
-    }
-    xmlSchemaSetValidErrors(cfg->ctxt, &_mxml_xml_err_cb, &_mxml_xml_warn_cb, cfg);
     cfg->ok = true;
     return cfg;
 }
 
 void mxml_xml_cfg_free(struct mxml_xml_cfg *cfg) {
     if (cfg) {
-        if (cfg->ctxt)
-            xmlSchemaFreeValidCtxt(cfg->ctxt);
         if (cfg->schema)
             xmlSchemaFree(cfg->schema);
         if (cfg->parser)
@@ -245,7 +256,7 @@ bool mxml_xml_cfg_ok(struct mxml_xml_cfg *cfg) {
     return cfg && cfg->ok;
 }
 
-bool mxml_xml_validate_file(struct mxml_xml_cfg *cfg, const char *filename, mxml_err_cb error_cb, void *error_cls) {
+static bool _mxml_xml_cfg_check(struct mxml_xml_cfg *cfg, mxml_err_cb error_cb, void *error_cls) {
     if (!cfg) {
         _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "cfg");
         return false;
@@ -254,6 +265,26 @@ bool mxml_xml_validate_file(struct mxml_xml_cfg *cfg, const char *filename, mxml
         _MXML_THROW(error_cb, error_cls, _("Invalid configuration\n"));
         return false;
     }
+    return true;
+}
+
+/* the compiled schema is read-only after mxml_xml_cfg_new(), so each validation owns a (cheap) context on top of it */
+static xmlSchemaValidCtxtPtr _mxml_xml_valid_ctxt_new(struct mxml_xml_cfg *cfg, mxml_err_cb error_cb,
+                                                      void *error_cls) {
+    xmlSchemaValidCtxtPtr ctxt;
+    if (!(ctxt = xmlSchemaNewValidCtxt(cfg->schema))) {
+        _MXML_THROW(error_cb, error_cls, _("Failed to create XSD validation context\n"));
+        return NULL;
+    }
+    xmlSchemaSetValidErrors(ctxt, &_mxml_xml_err_cb, &_mxml_xml_warn_cb, cfg);
+    return ctxt;
+}
+
+bool mxml_xml_validate_file(struct mxml_xml_cfg *cfg, const char *filename, mxml_err_cb error_cb, void *error_cls) {
+    xmlSchemaValidCtxtPtr ctxt;
+    int ret;
+    if (!_mxml_xml_cfg_check(cfg, error_cb, error_cls))
+        return false;
     if (!filename) {
         _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "filename");
         return false;
@@ -262,7 +293,245 @@ bool mxml_xml_validate_file(struct mxml_xml_cfg *cfg, const char *filename, mxml
         _MXML_THROW(error_cb, error_cls, _("File not found: %s\n"), filename);
         return false;
     }
-    return xmlSchemaValidateFile(cfg->ctxt, filename, 0) == 0;
+    if (!(ctxt = _mxml_xml_valid_ctxt_new(cfg, error_cb, error_cls)))
+        return false;
+    ret = xmlSchemaValidateFile(ctxt, filename, 0);
+    xmlSchemaFreeValidCtxt(ctxt);
+    return ret == 0;
+}
+
+bool mxml_xml_validate_doc(struct mxml_xml_cfg *cfg, void *doc, mxml_err_cb error_cb, void *error_cls) {
+    xmlSchemaValidCtxtPtr ctxt;
+    int ret;
+    if (!_mxml_xml_cfg_check(cfg, error_cb, error_cls))
+        return false;
+    if (!doc) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "doc");
+        return false;
+    }
+    if (!(ctxt = _mxml_xml_valid_ctxt_new(cfg, error_cb, error_cls)))
+        return false;
+    ret = xmlSchemaValidateDoc(ctxt, doc);
+    xmlSchemaFreeValidCtxt(ctxt);
+    return ret == 0;
+}
+
+bool mxml_xml_validate_buffer(struct mxml_xml_cfg *cfg, const char *buffer, size_t size,
+                              mxml_err_cb error_cb, void *error_cls) {
+    xmlDocPtr doc;
+    bool ret;
+    if (!_mxml_xml_cfg_check(cfg, error_cb, error_cls))
+        return false;
+    if (!buffer) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "buffer");
+        return false;
+    }
+    if (size < 1 || size > INT_MAX) {
+        _MXML_THROW(error_cb, error_cls, _("Invalid argument: %s\n"), "size");
+        return false;
+    }
+    if (!(doc = xmlReadMemory(buffer, (int) size, NULL, NULL, XML_PARSE_NONET))) {
+        _MXML_THROW(error_cb, error_cls, _("Failed to parse XML\n"));
+        return false;
+    }
+    ret = mxml_xml_validate_doc(cfg, doc, error_cb, error_cls);
+    xmlFreeDoc(doc);
+    return ret;
+}
+
+struct _mxml_xml_stream {
+    struct mxml_xml_cfg *cfg;
+    const char *filename;
+    size_t errors;
+    mxml_err_cb error_cb;
+    void *error_cls;
+};
+
+static void _mxml_xml_stream_err_cb(void *cls, _MXML_CONST_ERROR xmlError *error) {
+    struct _mxml_xml_stream *st = cls;
+    const char *text = (error->message ? error->message : "\n");
+    if (error->level == XML_ERR_WARNING) {
+        _MXML_THROW(st->cfg->warn_cb, st->cfg->error_warn_cls, "%s:%d:%d: %s", st->filename, error->line,
+                    error->int2, text);
+        return;
+    }
+    st->errors++;
+    _MXML_THROW(st->error_cb, st->error_cls, "%s:%d:%d: %s", st->filename, error->line, error->int2, text);
+}
+
+bool mxml_xml_validate_file_stream(struct mxml_xml_cfg *cfg, const char *filename,
+                                   mxml_err_cb error_cb, void *error_cls) {
+    struct _mxml_xml_stream st;
+    xmlSchemaValidCtxtPtr ctxt;
+    xmlTextReaderPtr reader;
+    xmlStructuredErrorFunc old_err_func;
+    void *old_err_ctx;
+    int ret;
+    if (!_mxml_xml_cfg_check(cfg, error_cb, error_cls))
+        return false;
+    if (!filename) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "filename");
+        return false;
+    }
+    if (!mu_exists(filename)) {
+        _MXML_THROW(error_cb, error_cls, _("File not found: %s\n"), filename);
+        return false;
+    }
+    if (!(ctxt = xmlSchemaNewValidCtxt(cfg->schema))) {
+        _MXML_THROW(error_cb, error_cls, _("Failed to create XSD validation context\n"));
+        return false;
+    }
+    /* the reader keeps only the current subtree, so memory does not grow with the file size */
+    if (!(reader = xmlReaderForFile(filename, NULL, XML_PARSE_NONET | XML_PARSE_HUGE))) {
+        xmlSchemaFreeValidCtxt(ctxt);
+        _MXML_THROW(error_cb, error_cls, _("Failed to open XML file: %s\n"), filename);
+        return false;
+    }
+    memset(&st, 0, sizeof(struct _mxml_xml_stream));
+    st.cfg = cfg;
+    st.filename = filename;
+    st.error_cb = error_cb;
+    st.error_cls = error_cls;
+    xmlSchemaSetValidStructuredErrors(ctxt, &_mxml_xml_stream_err_cb, &st);
+    if (xmlTextReaderSchemaValidateCtxt(reader, ctxt, 0) != 0) {
+        _MXML_THROW(error_cb, error_cls, _("Failed to attach XSD schema to XML reader\n"));
+        ret = -1;
+        goto done;
+    }
+    /* the schema plug replaces the reader SAX handlers, so parser errors are taken from the (per thread)
+     * structured error handler, borrowed while the file is read */
+    old_err_func = xmlStructuredError;
+    old_err_ctx = xmlStructuredErrorContext;
+    xmlSetStructuredErrorFunc(&st, &_mxml_xml_stream_err_cb);
+    while ((ret = xmlTextReaderRead(reader)) == 1);
+    xmlSetStructuredErrorFunc(old_err_ctx, old_err_func);
+    if (ret == 0 && xmlTextReaderIsValid(reader) != 1)
+        ret = -1;
+done:
+    xmlFreeTextReader(reader);
+    xmlSchemaFreeValidCtxt(ctxt);
+    return ret == 0 && st.errors == 0;
+}
+
+struct _mxml_xml_validation {
+    struct mxml_xml_cfg *cfg;
+    const char *const *filenames;
+    bool *results;
+    size_t count;
+    atomic_size_t next;
+    atomic_size_t failures;
+    mxml_err_cb error_cb;
+    void *error_cls;
+};
+
+static void *_mxml_xml_validation_worker(void *cls) {
+    struct _mxml_xml_validation *val = cls;
+    xmlSchemaValidCtxtPtr ctxt;
+    const char *filename;
+    size_t i;
+    bool ok;
+    ctxt = _mxml_xml_valid_ctxt_new(val->cfg, val->error_cb, val->error_cls);
+    while ((i = atomic_fetch_add(&val->next, 1)) < val->count) {
+        filename = val->filenames[i];
+        ok = false;
+        if (!filename)
+            _MXML_THROW(val->error_cb, val->error_cls, _("Required argument: %s\n"), "filename");
+        else if (!mu_exists(filename))
+            _MXML_THROW(val->error_cb, val->error_cls, _("File not found: %s\n"), filename);
+        else if (ctxt && !(ok = xmlSchemaValidateFile(ctxt, filename, 0) == 0))
+            _MXML_THROW(val->error_cb, val->error_cls, _("Invalid XML file: %s\n"), filename);
+        if (val->results)
+            val->results[i] = ok;
+        if (!ok)
+            atomic_fetch_add(&val->failures, 1);
+    }
+    if (ctxt)
+        xmlSchemaFreeValidCtxt(ctxt);
+    return NULL;
+}
+
+bool mxml_xml_validate_files(struct mxml_xml_cfg *cfg, const char *const *filenames, size_t count,
+                             unsigned int threads, bool *results, mxml_err_cb error_cb, void *error_cls) {
+    struct _mxml_xml_validation val;
+    pthread_t *workers;
+    unsigned int created;
+    if (!_mxml_xml_cfg_check(cfg, error_cb, error_cls))
+        return false;
+    if (!filenames) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "filenames");
+        return false;
+    }
+    memset(&val, 0, sizeof(struct _mxml_xml_validation));
+    val.cfg = cfg;
+    val.filenames = filenames;
+    val.results = results;
+    val.count = count;
+    atomic_init(&val.next, 0);
+    atomic_init(&val.failures, 0);
+    val.error_cb = error_cb;
+    val.error_cls = error_cls;
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0 ? (unsigned int) cpus : 1);
+    }
+    if (threads > count)
+        threads = (unsigned int) count;
+    created = 0;
+    workers = NULL;
+    if (threads > 1 && (workers = malloc((threads - 1) * sizeof(pthread_t))))
+        for (unsigned int i = 0; i < threads - 1; i++) {
+            if (pthread_create(&workers[created], NULL, &_mxml_xml_validation_worker, &val) != 0)
+                break;
+            created++;
+        }
+    _mxml_xml_validation_worker(&val);
+    for (unsigned int i = 0; i < created; i++)
+        pthread_join(workers[i], NULL);
+    free(workers);
+    return atomic_load(&val.failures) == 0;
+}
+
+bool mxml_xml_validate_dir(struct mxml_xml_cfg *cfg, const char *dirname, unsigned int threads,
+                           mxml_err_cb error_cb, void *error_cls) {
+    DIR *dir;
+    struct dirent *ent;
+    char **filenames, **tmp;
+    size_t count, capacity, len;
+    bool ret;
+    if (!_mxml_xml_cfg_check(cfg, error_cb, error_cls))
+        return false;
+    if (!dirname) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "dirname");
+        return false;
+    }
+    if (!(dir = opendir(dirname))) {
+        _MXML_THROW(error_cb, error_cls, _("Directory not found: %s\n"), dirname);
+        return false;
+    }
+    ret = false;
+    filenames = NULL;
+    count = capacity = 0;
+    while ((ent = readdir(dir))) {
+        len = strlen(ent->d_name);
+        if (len < 5 || strcasecmp(ent->d_name + len - 4, ".xml") != 0)
+            continue;
+        if (count == capacity) {
+            capacity = (capacity ? capacity * 2 : 64);
+            if (!(tmp = realloc(filenames, capacity * sizeof(char *))))
+                goto done;
+            filenames = tmp;
+        }
+        if (!(filenames[count] = mu_fmt("%s/%s", dirname, ent->d_name)))
+            goto done;
+        count++;
+    }
+    ret = mxml_xml_validate_files(cfg, (const char *const *) filenames, count, threads, NULL, error_cb, error_cls);
+done:
+    closedir(dir);
+    for (size_t i = 0; i < count; i++)
+        free(filenames[i]);
+    free(filenames);
+    return ret;
 }
 
 // XML utils
@@ -382,38 +651,155 @@ void *mxml_xml_doc_find_node_by_name(void *doc, const char *node_name) {
 }
 
 bool mxml_xml_node_try_get_value(void *node, char **value) {
-    return !value && (*value = (char *) xmlNodeGetContent(node)) != NULL;
+    return node && value && (*value = (char *) xmlNodeGetContent(node)) != NULL;
 }
 
 char *mxml_xml_node_get_value_str(void *root_node, const char *node_name) {
     char *res;
     if (!mxml_xml_node_try_get_value(mxml_xml_node_find_node_by_name(root_node, node_name), &res))
-        return malloc(0);
+        return calloc(1, 1);
     return res;
 }
 
 char *mxml_xml_doc_get_value_str(void *doc, const char *node_name) {
     char *res;
     if (!mxml_xml_node_try_get_value(mxml_xml_doc_find_node_by_name(doc, node_name), &res))
-        return malloc(0);
+        return calloc(1, 1);
     return res;
 }
 
 bool mxml_xml_node_try_get_attr(void *node, const char *attr_name, char **value) {
-    return !value && (*value = (char *) xmlGetProp(node, BAD_CAST attr_name)) != NULL;
+    return node && value && (*value = (char *) xmlGetProp(node, BAD_CAST attr_name)) != NULL;
 }
 
 char *mxml_xml_node_get_attr_str(void *root_node, const char *node_name, const char *attr_name) {
     char *res;
     if (!mxml_xml_node_try_get_attr(mxml_xml_node_find_node_by_name(root_node, node_name), attr_name, &res))
-        return malloc(0);
+        return calloc(1, 1);
     return res;
 }
 
 char *mxml_xml_doc_get_attr_str(void *doc, const char *node_name, const char *attr_name) {
     char *res;
     if (!mxml_xml_node_try_get_attr(mxml_xml_doc_find_node_by_name(doc, node_name), attr_name, &res))
-        return malloc(0);
+        return calloc(1, 1);
+    return res;
+}
+
+// XML index
+
+struct _mxml_xml_index_nodes {
+    xmlNodePtr *items;
+    size_t count;
+    size_t capacity;
+};
+
+struct mxml_xml_index {
+    xmlHashTablePtr names;
+};
+
+static void _mxml_xml_index_nodes_free(void *payload, const xmlChar *name) {
+    struct _mxml_xml_index_nodes *nodes = payload;
+    (void) name;
+    free(nodes->items);
+    free(nodes);
+}
+
+static bool _mxml_xml_index_add(struct mxml_xml_index *index, xmlNodePtr node) {
+    struct _mxml_xml_index_nodes *nodes;
+    xmlNodePtr *items;
+    if (!(nodes = xmlHashLookup(index->names, node->name))) {
+        if (!(nodes = calloc(1, sizeof(struct _mxml_xml_index_nodes))))
+            return false;
+        if (xmlHashAddEntry(index->names, node->name, nodes) != 0) {
+            free(nodes);
+            return false;
+        }
+    }
+    if (nodes->count == nodes->capacity) {
+        nodes->capacity = (nodes->capacity ? nodes->capacity * 2 : 4);
+        if (!(items = realloc(nodes->items, nodes->capacity * sizeof(xmlNodePtr))))
+            return false;
+        nodes->items = items;
+    }
+    nodes->items[nodes->count++] = node;
+    return true;
+}
+
+struct mxml_xml_index *mxml_xml_index_new(void *root_node) {
+    struct mxml_xml_index *index;
+    xmlNodePtr node;
+    if (!root_node)
+        return NULL;
+    if (!(index = calloc(1, sizeof(struct mxml_xml_index))))
+        return NULL;
+    if (!(index->names = xmlHashCreate(64))) {
+        free(index);
+        return NULL;
+    }
+    /* iterative pre-order walk, so each name keeps its nodes in document order */
+    node = root_node;
+    while (node) {
+        if (node->type == XML_ELEMENT_NODE && !_mxml_xml_index_add(index, node)) {
+            mxml_xml_index_free(index);
+            return NULL;
+        }
+        if (node->children && node->type == XML_ELEMENT_NODE) {
+            node = node->children;
+            continue;
+        }
+        while (node != root_node && !node->next)
+            node = node->parent;
+        if (node == root_node)
+            break;
+        node = node->next;
+    }
+    return index;
+}
+
+struct mxml_xml_index *mxml_xml_doc_index_new(void *doc) {
+    if (!doc)
+        return NULL;
+    return mxml_xml_index_new(xmlDocGetRootElement(doc));
+}
+
+void mxml_xml_index_free(struct mxml_xml_index *index) {
+    if (index) {
+        xmlHashFree(index->names, &_mxml_xml_index_nodes_free);
+        free(index);
+    }
+}
+
+size_t mxml_xml_index_find_nodes(struct mxml_xml_index *index, const char *node_name, void *const **nodes) {
+    struct _mxml_xml_index_nodes *found;
+    if (!index || !node_name || !(found = xmlHashLookup(index->names, BAD_CAST node_name))) {
+        if (nodes)
+            *nodes = NULL;
+        return 0;
+    }
+    if (nodes)
+        *nodes = (void *const *) found->items;
+    return found->count;
+}
+
+void *mxml_xml_index_find_node(struct mxml_xml_index *index, const char *node_name) {
+    void *const *nodes;
+    if (mxml_xml_index_find_nodes(index, node_name, &nodes) < 1)
+        return NULL;
+    return nodes[0];
+}
+
+char *mxml_xml_index_get_value_str(struct mxml_xml_index *index, const char *node_name) {
+    char *res;
+    if (!mxml_xml_node_try_get_value(mxml_xml_index_find_node(index, node_name), &res))
+        return calloc(1, 1);
+    return res;
+}
+
+char *mxml_xml_index_get_attr_str(struct mxml_xml_index *index, const char *node_name, const char *attr_name) {
+    char *res;
+    if (!mxml_xml_node_try_get_attr(mxml_xml_index_find_node(index, node_name), attr_name, &res))
+        return calloc(1, 1);
     return res;
 }
 
@@ -503,12 +889,153 @@ char *mxml_xml_node_dom_element_get_attribute(void *node, const char *name) {
     return (char *) value;
 }
 
+// XML scanner
+
+static const char *_mxml_scan_skip(const char *p, const char *end, const char *token) {
+    size_t len = strlen(token);
+    for (; p + len <= end; p++)
+        if (*p == *token && !memcmp(p, token, len))
+            return p + len;
+    return NULL;
+}
+
+static const char *_mxml_scan_tag_end(const char *p, const char *end) {
+    char quote = 0;
+    for (; p < end; p++) {
+        if (quote) {
+            if (*p == quote)
+                quote = 0;
+        } else if (*p == '"' || *p == '\'')
+            quote = *p;
+        else if (*p == '>')
+            return p;
+    }
+    return NULL;
+}
+
+static const char *_mxml_scan_name_end(const char *p, const char *end) {
+    while (p < end && *p != '>' && *p != '/' && *p != '=' && !isspace((unsigned char) *p))
+        p++;
+    return p;
+}
+
+static bool _mxml_scan_local_name_eq(const char *qname, const char *qname_end, const char *name, size_t name_len,
+                                     bool *prefixed) {
+    const char *local = memchr(qname, ':', (size_t) (qname_end - qname));
+    *prefixed = local != NULL;
+    local = local ? local + 1 : qname;
+    return (size_t) (qname_end - local) == name_len && !memcmp(local, name, name_len);
+}
+
+const char *mxml_xml_scan_element(const char *xml, size_t len, const char *name, size_t *elem_len, bool *prefixed) {
+    const char *p, *end, *q, *qend, *gt, *start;
+    size_t name_len;
+    unsigned int depth;
+    bool pfx, start_pfx;
+    if (!xml || mu_is_empty(name) || !elem_len)
+        return NULL;
+    if (len == 0)
+        len = strlen(xml);
+    end = xml + len;
+    name_len = strlen(name);
+    start = NULL;
+    start_pfx = false;
+    depth = 0;
+    p = xml;
+    while (p < end && (p = memchr(p, '<', (size_t) (end - p)))) {
+        if (p + 4 <= end && !memcmp(p, "<!--", 4))
+            p = _mxml_scan_skip(p + 4, end, "-->");
+        else if (p + 9 <= end && !memcmp(p, "<![CDATA[", 9))
+            p = _mxml_scan_skip(p + 9, end, "]]>");
+        else if (p + 2 <= end && p[1] == '?')
+            p = _mxml_scan_skip(p + 2, end, "?>");
+        else if (p + 2 <= end && p[1] == '!')
+            p = (gt = _mxml_scan_tag_end(p, end)) ? gt + 1 : NULL;
+        else if (p + 2 <= end && p[1] == '/') {
+            q = p + 2;
+            qend = _mxml_scan_name_end(q, end);
+            if (!(gt = _mxml_scan_tag_end(qend, end)))
+                return NULL;
+            if (start && _mxml_scan_local_name_eq(q, qend, name, name_len, &pfx) && --depth == 0) {
+                *elem_len = (size_t) (gt + 1 - start);
+                if (prefixed)
+                    *prefixed = start_pfx;
+                return start;
+            }
+            p = gt + 1;
+        } else {
+            q = p + 1;
+            qend = _mxml_scan_name_end(q, end);
+            if (!(gt = _mxml_scan_tag_end(qend, end)))
+                return NULL;
+            if (_mxml_scan_local_name_eq(q, qend, name, name_len, &pfx)) {
+                if (!start) {
+                    start = p;
+                    start_pfx = pfx;
+                }
+                if (gt[-1] != '/')
+                    depth++;
+                else if (depth == 0) {
+                    *elem_len = (size_t) (gt + 1 - start);
+                    if (prefixed)
+                        *prefixed = start_pfx;
+                    return start;
+                }
+            }
+            p = gt + 1;
+        }
+        if (!p)
+            return NULL;
+    }
+    return NULL;
+}
+
+const char *mxml_xml_scan_attribute(const char *elem, size_t len, const char *name, size_t *value_len) {
+    const char *p, *end, *an, *an_end, *val;
+    size_t name_len;
+    char quote;
+    if (!elem || len < 2 || *elem != '<' || mu_is_empty(name) || !value_len)
+        return NULL;
+    end = elem + len;
+    name_len = strlen(name);
+    p = _mxml_scan_name_end(elem + 1, end);
+    while (p < end) {
+        while (p < end && isspace((unsigned char) *p))
+            p++;
+        if (p >= end || *p == '>' || *p == '/')
+            return NULL;
+        an = p;
+        an_end = p = _mxml_scan_name_end(p, end);
+        while (p < end && isspace((unsigned char) *p))
+            p++;
+        if (p >= end || *p != '=')
+            return NULL;
+        p++;
+        while (p < end && isspace((unsigned char) *p))
+            p++;
+        if (p >= end || (*p != '"' && *p != '\''))
+            return NULL;
+        quote = *p++;
+        val = p;
+        if (!(p = memchr(p, quote, (size_t) (end - p))))
+            return NULL;
+        if ((size_t) (an_end - an) == name_len && !memcmp(an, name, name_len)) {
+            *value_len = (size_t) (p - val);
+            return val;
+        }
+        p++;
+    }
+    return NULL;
+}
+
 // XML sec
 
 struct mxml_xmlsec_cfg {
     bool ok;
     const char *pfx_filename;
     const char *pfx_pwd;
+    xmlSecKeyPtr key;
+    pthread_mutex_t key_lock;
 };
 
 void mxml_xmlsec_init(bool columned_base64, mxml_err_cb error_cb, void *error_cls) {
@@ -535,9 +1062,34 @@ void mxml_xmlsec_finit() {
     mxml_xml_finit();
 }
 
+static struct mxml_xmlsec_cfg *_mxml_xmlsec_cfg_new(xmlSecKeyPtr key) {
+    struct mxml_xmlsec_cfg *cfg;
+    if (!(cfg = calloc(1, sizeof(struct mxml_xmlsec_cfg)))) {
+        xmlSecKeyDestroy(key);
+        return NULL;
+    }
+    if (pthread_mutex_init(&cfg->key_lock, NULL) != 0) {
+        xmlSecKeyDestroy(key);
+        free(cfg);
+        return NULL;
+    }
+    cfg->key = key;
+    cfg->ok = true;
+    return cfg;
+}
+
+static xmlSecKeyPtr _mxml_xmlsec_cfg_key_dup(struct mxml_xmlsec_cfg *cfg) {
+    xmlSecKeyPtr key;
+    pthread_mutex_lock(&cfg->key_lock);
+    key = xmlSecKeyDuplicate(cfg->key);
+    pthread_mutex_unlock(&cfg->key_lock);
+    return key;
+}
+
 struct mxml_xmlsec_cfg *mxml_xmlsec_cfg_pfx_file_new(const char *pfx_filename, const char *pfx_pwd,
                                                      mxml_err_cb error_cb, void *error_cls) {
     struct mxml_xmlsec_cfg *cfg;
+    xmlSecKeyPtr key;
     if (!pfx_filename) {
         _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "pfx_filename");
         return NULL;
@@ -550,15 +1102,45 @@ struct mxml_xmlsec_cfg *mxml_xmlsec_cfg_pfx_file_new(const char *pfx_filename, c
         _MXML_THROW(error_cb, error_cls, _("File not found: %s\n"), pfx_filename);
         return NULL;
     }
-    if (!(cfg = calloc(1, sizeof(struct mxml_xmlsec_cfg))))
+    if (!(key = xmlSecCryptoAppPkcs12Load(pfx_filename, pfx_pwd, NULL, NULL))) {
+        _MXML_THROW(error_cb, error_cls, _("Failed to load PFX file: %s\n"), pfx_filename);
+        return NULL;
+    }
+    if (!(cfg = _mxml_xmlsec_cfg_new(key)))
         return NULL;
     cfg->pfx_filename = pfx_filename;
     cfg->pfx_pwd = pfx_pwd;
-    cfg->ok = true;
     return cfg;
 }
 
+struct mxml_xmlsec_cfg *mxml_xmlsec_cfg_pfx_memory_new(const void *pfx_data, size_t pfx_size, const char *pfx_pwd,
+                                                       mxml_err_cb error_cb, void *error_cls) {
+    xmlSecKeyPtr key;
+    if (!pfx_data) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "pfx_data");
+        return NULL;
+    }
+    if (pfx_size < 1) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "pfx_size");
+        return NULL;
+    }
+    if (!pfx_pwd) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "pfx_pwd");
+        return NULL;
+    }
+    if (!(key = xmlSecCryptoAppPkcs12LoadMemory(pfx_data, pfx_size, pfx_pwd, NULL, NULL))) {
+        _MXML_THROW(error_cb, error_cls, _("Failed to load PFX data\n"));
+        return NULL;
+    }
+    return _mxml_xmlsec_cfg_new(key);
+}
+
 void mxml_xmlsec_cfg_free(struct mxml_xmlsec_cfg *cfg) {
+    if (!cfg)
+        return;
+    if (cfg->key)
+        xmlSecKeyDestroy(cfg->key);
+    pthread_mutex_destroy(&cfg->key_lock);
     free(cfg);
 }
 
@@ -566,12 +1148,23 @@ bool mxml_xmlsec_cfg_ok(struct mxml_xmlsec_cfg *cfg) {
     return cfg && cfg->ok;
 }
 
-bool mxml_xmlsec_sign(struct mxml_xmlsec_cfg *cfg, bool is_file, const char *data, char **signed_data,
-                      const char *param_name, const char *signed_param_name, const char *encoding, const char *id_attr,
-                      const char *id_name, bool declares_attlist, bool formatted, bool removes_blanks,
-                      bool skip_xml_declaration, int compression, bool auto_uri, bool single_cert,
-                      mxml_sec_cb sec_cb, void *sec_cls, mxml_err_cb error_cb, void *error_cls) {
-    xmlDocPtr doc;
+static bool _mxml_xmlsec_cfg_check(struct mxml_xmlsec_cfg *cfg, mxml_err_cb error_cb, void *error_cls) {
+    if (!cfg) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "cfg");
+        return false;
+    }
+    if (!cfg->ok) {
+        _MXML_THROW(error_cb, error_cls, _("Invalid configuration\n"));
+        return false;
+    }
+    return true;
+}
+
+/* signs a parsed document in place; shared by the string, file and DOM variants */
+static bool _mxml_xmlsec_sign_doc(struct mxml_xmlsec_cfg *cfg, xmlDocPtr doc, const char *id_attr,
+                                  const char *id_name, bool declares_attlist, bool removes_blanks, bool auto_uri,
+                                  bool single_cert, mxml_sec_cb sec_cb, void *sec_cls, mxml_err_cb error_cb,
+                                  void *error_cls) {
     xmlChar *id;
     xmlChar *uri;
     xmlNodePtr id_node;
@@ -583,45 +1176,14 @@ bool mxml_xmlsec_sign(struct mxml_xmlsec_cfg *cfg, bool is_file, const char *dat
     xmlNodePtr last_cert_node;
     xmlNodePtr prev_cert_node;
     xmlSecDSigCtxPtr d_sig_ctx;
-    xmlSaveCtxtPtr save_ctxt;
-    xmlBufferPtr buffer;
     bool res;
     char *attlist;
-    int options;
-    if (!cfg) {
-        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "cfg");
-        return false;
-    }
-    if (!cfg->ok) {
-        _MXML_THROW(error_cb, error_cls, _("Invalid configuration\n"));
-        return false;
-    }
-    if (!data) {
-        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), param_name);
-        return false;
-    }
-    if (!signed_data) {
-        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), signed_param_name);
-        return false;
-    }
-    if (is_file && !mu_exists(data)) {
-        _MXML_THROW(error_cb, error_cls, _("File not found: %s\n"), data);
-        return false;
-    }
     res = false;
     id = NULL;
     uri = NULL;
     d_sig_ctx = NULL;
-    if (is_file)
-        doc = xmlParseFile(data);
-    else
-        /*doc = xmlParseMemory(data, xmlStrlen(BAD_CAST data));*/
-        doc = xmlParseDoc(BAD_CAST data);
-    if (!doc || !(root_node = xmlDocGetRootElement(doc))) {
-        if (is_file)
-            _MXML_THROW(error_cb, error_cls, _("Unable to parse file: %s\n"), data);
-        else
-            _MXML_THROW(error_cb, error_cls, _("Unable to parse string\n"));
+    if (!(root_node = xmlDocGetRootElement(doc))) {
+        _MXML_THROW(error_cb, error_cls, _("Document has no root element\n"));
         goto done;
     }
     if (declares_attlist && (id_attr && id_name &&
@@ -685,9 +1247,9 @@ bool mxml_xmlsec_sign(struct mxml_xmlsec_cfg *cfg, bool is_file, const char *dat
         _MXML_THROW(error_cb, error_cls, _("Failed to create signature context\n"));
         goto done;
     }
-    d_sig_ctx->signKey = xmlSecCryptoAppPkcs12Load(cfg->pfx_filename, cfg->pfx_pwd, NULL, NULL);
+    d_sig_ctx->signKey = _mxml_xmlsec_cfg_key_dup(cfg);
     if (!d_sig_ctx->signKey) {
-        _MXML_THROW(error_cb, error_cls, _("Failed to load PFX file: %s\n"), cfg->pfx_filename);
+        _MXML_THROW(error_cb, error_cls, _("Failed to duplicate signing key\n"));
         goto done;
     }
     if (xmlSecDSigCtxSign(d_sig_ctx, sign_node) < 0) {
@@ -706,48 +1268,302 @@ bool mxml_xmlsec_sign(struct mxml_xmlsec_cfg *cfg, bool is_file, const char *dat
     }
     if (sec_cb && !sec_cb(sec_cls, doc, MXML_SEC_CB_TYPE_AFTER))
         goto done;
-    xmlSetDocCompressMode(doc, compression);
+    res = true;
+done:
+    free(uri);
+    free(id);
+    if (d_sig_ctx)
+        xmlSecDSigCtxDestroy(d_sig_ctx);
+    return res;
+}
+
+struct _mxml_xmlsec_sink {
+    char **buffer;
+    size_t *buffer_size;
+    size_t length;
+    mxml_write_cb write_cb;
+    void *write_cls;
+    size_t written;
+};
+
+static int _mxml_xmlsec_sink_buffer_write(void *context, const char *data, int len) {
+    struct _mxml_xmlsec_sink *sink = context;
+    char *buf;
+    size_t size;
+    if (len < 0)
+        return -1;
+    if (sink->length + (size_t) len + 1 > *sink->buffer_size) {
+        size = (*sink->buffer_size ? *sink->buffer_size : 4096);
+        while (sink->length + (size_t) len + 1 > size)
+            size *= 2;
+        if (!(buf = realloc(*sink->buffer, size)))
+            return -1;
+        *sink->buffer = buf;
+        *sink->buffer_size = size;
+    }
+    memcpy(*sink->buffer + sink->length, data, (size_t) len);
+    sink->length += (size_t) len;
+    (*sink->buffer)[sink->length] = '\0';
+    return len;
+}
+
+static int _mxml_xmlsec_sink_cb_write(void *context, const char *data, int len) {
+    struct _mxml_xmlsec_sink *sink = context;
+    if (len < 0 || !sink->write_cb(sink->write_cls, data, (size_t) len))
+        return -1;
+    sink->length += (size_t) len;
+    return len;
+}
+
+static int _mxml_xmlsec_sink_close(void *context) {
+    (void) context;
+    return 0;
+}
+
+static bool _mxml_xmlsec_save_doc(xmlDocPtr doc, xmlOutputWriteCallback write_cb, struct _mxml_xmlsec_sink *sink,
+                                  const char *encoding, bool formatted, bool skip_xml_declaration,
+                                  mxml_err_cb error_cb, void *error_cls) {
+    xmlSaveCtxtPtr save_ctxt;
+    int options;
     options = XML_SAVE_AS_XML;
     if (formatted)
         options |= XML_SAVE_FORMAT;
     if (skip_xml_declaration)
         options |= XML_SAVE_NO_DECL;
-    if (is_file) {
-        save_ctxt = xmlSaveToFilename(*signed_data, encoding, options);
+    /* written straight into the sink, with no intermediate xmlBuffer copy */
+    save_ctxt = xmlSaveToIO(write_cb, &_mxml_xmlsec_sink_close, sink, encoding, options);
+    if (!save_ctxt) {
+        _MXML_THROW(error_cb, error_cls, _("Failed to create save context\n"));
+        return false;
+    }
+    if (xmlSaveDoc(save_ctxt, doc) < 0) {
+        xmlSaveClose(save_ctxt);
+        _MXML_THROW(error_cb, error_cls, _("Failed to save XML data\n"));
+        return false;
+    }
+    if (xmlSaveClose(save_ctxt) < 0) {
+        _MXML_THROW(error_cb, error_cls, _("Failed to save XML data\n"));
+        return false;
+    }
+    return true;
+}
+
+static xmlDocPtr _mxml_xmlsec_parse_string(const char *string, size_t length) {
+    /* same behavior as xmlParseDoc() under the defaults set by mxml_xmlsec_init() */
+    if (length > INT_MAX)
+        return NULL;
+    return xmlReadMemory(string, (int) length, NULL, NULL, XML_PARSE_NOENT | XML_PARSE_DTDLOAD | XML_PARSE_DTDATTR);
+}
+
+bool mxml_xmlsec_sign(struct mxml_xmlsec_cfg *cfg, bool is_file, const char *data, char **signed_data,
+                      const char *param_name, const char *signed_param_name, const char *encoding, const char *id_attr,
+                      const char *id_name, bool declares_attlist, bool formatted, bool removes_blanks,
+                      bool skip_xml_declaration, int compression, bool auto_uri, bool single_cert,
+                      mxml_sec_cb sec_cb, void *sec_cls, mxml_err_cb error_cb, void *error_cls) {
+    struct _mxml_xmlsec_sink sink;
+    xmlDocPtr doc;
+    xmlSaveCtxtPtr save_ctxt;
+    char *buffer;
+    size_t buffer_size;
+    bool res;
+    int options;
+    if (!cfg) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "cfg");
+        return false;
+    }
+    if (!cfg->ok) {
+        _MXML_THROW(error_cb, error_cls, _("Invalid configuration\n"));
+        return false;
+    }
+    if (!data) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), param_name);
+        return false;
+    }
+    if (!signed_data) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), signed_param_name);
+        return false;
+    }
+    if (is_file && !mu_exists(data)) {
+        _MXML_THROW(error_cb, error_cls, _("File not found: %s\n"), data);
+        return false;
+    }
+    res = false;
+    if (is_file)
+        doc = xmlParseFile(data);
+    else
+        doc = _mxml_xmlsec_parse_string(data, strlen(data));
+    if (!doc || !xmlDocGetRootElement(doc)) {
+        if (is_file)
+            _MXML_THROW(error_cb, error_cls, _("Unable to parse file: %s\n"), data);
+        else
+            _MXML_THROW(error_cb, error_cls, _("Unable to parse string\n"));
+        goto done;
+    }
+    if (!_mxml_xmlsec_sign_doc(cfg, doc, id_attr, id_name, declares_attlist, removes_blanks, auto_uri, single_cert,
+                               sec_cb, sec_cls, error_cb, error_cls))
+        goto done;
+    if (!is_file) {
         buffer = NULL;
-    } else {
-        buffer = xmlBufferCreate();
-        if (!buffer)
+        buffer_size = 0;
+        memset(&sink, 0, sizeof(struct _mxml_xmlsec_sink));
+        sink.buffer = &buffer;
+        sink.buffer_size = &buffer_size;
+        if (!_mxml_xmlsec_save_doc(doc, &_mxml_xmlsec_sink_buffer_write, &sink, encoding, formatted,
+                                   skip_xml_declaration, error_cb, error_cls)) {
+            free(buffer);
             goto done;
-        save_ctxt = xmlSaveToBuffer(buffer, encoding, options);
+        }
+        *signed_data = buffer;
+        res = true;
+        goto done;
     }
+    xmlSetDocCompressMode(doc, compression);
+    options = XML_SAVE_AS_XML;
+    if (formatted)
+        options |= XML_SAVE_FORMAT;
+    if (skip_xml_declaration)
+        options |= XML_SAVE_NO_DECL;
+    save_ctxt = xmlSaveToFilename(*signed_data, encoding, options);
     if (!save_ctxt) {
         _MXML_THROW(error_cb, error_cls, _("Failed to create save context\n"));
         goto done;
     }
     if (xmlSaveDoc(save_ctxt, doc) < 0) {
-        if (is_file)
-            _MXML_THROW(error_cb, error_cls, _("Failed to save file: %s\n"), data);
-        else
-            _MXML_THROW(error_cb, error_cls, _("Failed to save XML data\n"));
+        xmlSaveClose(save_ctxt);
+        _MXML_THROW(error_cb, error_cls, _("Failed to save file: %s\n"), data);
         goto done;
     }
     xmlSaveClose(save_ctxt);
-    if (!is_file) {
-        *signed_data = strdup((char *) xmlBufferContent(buffer));
-        xmlBufferFree(buffer);
-    }
     res = true;
 done:
-    free(uri);
-    free(id);
-    if (d_sig_ctx)
-        xmlSecDSigCtxDestroy(d_sig_ctx);
     if (doc)
         xmlFreeDoc(doc);
     return res;
 }
 
+static size_t _mxml_xmlsec_sign_to(struct mxml_xmlsec_cfg *cfg, xmlDocPtr doc, struct _mxml_xmlsec_sink *sink,
+                                   xmlOutputWriteCallback write_cb, const char *encoding, const char *id_attr,
+                                   const char *id_name, bool declares_attlist, bool formatted, bool removes_blanks,
+                                   bool skip_xml_declaration, bool auto_uri, bool single_cert, mxml_sec_cb sec_cb,
+                                   void *sec_cls, mxml_err_cb error_cb, void *error_cls) {
+    if (!_mxml_xmlsec_sign_doc(cfg, doc, id_attr, id_name, declares_attlist, removes_blanks, auto_uri, single_cert,
+                               sec_cb, sec_cls, error_cb, error_cls))
+        return 0;
+    if (!_mxml_xmlsec_save_doc(doc, write_cb, sink, encoding, formatted, skip_xml_declaration, error_cb, error_cls))
+        return 0;
+    return sink->length;
+}
+
+bool mxml_xmlsec_sign_doc(struct mxml_xmlsec_cfg *cfg, void *doc, const char *id_attr, const char *id_name,
+                          bool declares_attlist, bool removes_blanks, bool auto_uri, bool single_cert,
+                          mxml_sec_cb sec_cb, void *sec_cls, mxml_err_cb error_cb, void *error_cls) {
+    if (!_mxml_xmlsec_cfg_check(cfg, error_cb, error_cls))
+        return false;
+    if (!doc) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "doc");
+        return false;
+    }
+    return _mxml_xmlsec_sign_doc(cfg, doc, id_attr, id_name, declares_attlist, removes_blanks, auto_uri, single_cert,
+                                 sec_cb, sec_cls, error_cb, error_cls);
+}
+
+size_t mxml_xmlsec_sign_doc_to_buffer(struct mxml_xmlsec_cfg *cfg, void *doc, char **buffer, size_t *buffer_size,
+                                      const char *encoding, const char *id_attr, const char *id_name,
+                                      bool declares_attlist, bool formatted, bool removes_blanks,
+                                      bool skip_xml_declaration, bool auto_uri, bool single_cert, mxml_sec_cb sec_cb,
+                                      void *sec_cls, mxml_err_cb error_cb, void *error_cls) {
+    struct _mxml_xmlsec_sink sink;
+    if (!_mxml_xmlsec_cfg_check(cfg, error_cb, error_cls))
+        return 0;
+    if (!doc) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "doc");
+        return 0;
+    }
+    if (!buffer || !buffer_size) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), (buffer ? "buffer_size" : "buffer"));
+        return 0;
+    }
+    memset(&sink, 0, sizeof(struct _mxml_xmlsec_sink));
+    sink.buffer = buffer;
+    sink.buffer_size = buffer_size;
+    return _mxml_xmlsec_sign_to(cfg, doc, &sink, &_mxml_xmlsec_sink_buffer_write, encoding, id_attr, id_name,
+                                declares_attlist, formatted, removes_blanks, skip_xml_declaration, auto_uri,
+                                single_cert, sec_cb, sec_cls, error_cb, error_cls);
+}
+
+size_t mxml_xmlsec_sign_doc_to_cb(struct mxml_xmlsec_cfg *cfg, void *doc, mxml_write_cb write_cb, void *write_cls,
+                                  const char *encoding, const char *id_attr, const char *id_name,
+                                  bool declares_attlist, bool formatted, bool removes_blanks, bool skip_xml_declaration,
+                                  bool auto_uri, bool single_cert, mxml_sec_cb sec_cb, void *sec_cls,
+                                  mxml_err_cb error_cb, void *error_cls) {
+    struct _mxml_xmlsec_sink sink;
+    if (!_mxml_xmlsec_cfg_check(cfg, error_cb, error_cls))
+        return 0;
+    if (!doc) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "doc");
+        return 0;
+    }
+    if (!write_cb) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "write_cb");
+        return 0;
+    }
+    memset(&sink, 0, sizeof(struct _mxml_xmlsec_sink));
+    sink.write_cb = write_cb;
+    sink.write_cls = write_cls;
+    return _mxml_xmlsec_sign_to(cfg, doc, &sink, &_mxml_xmlsec_sink_cb_write, encoding, id_attr, id_name,
+                                declares_attlist, formatted, removes_blanks, skip_xml_declaration, auto_uri,
+                                single_cert, sec_cb, sec_cls, error_cb, error_cls);
+}
+
+size_t mxml_xmlsec_sign_string_to_buffer(struct mxml_xmlsec_cfg *cfg, const char *string, size_t length,
+                                         char **buffer, size_t *buffer_size, const char *encoding,
+                                         const char *id_attr, const char *id_name, bool declares_attlist,
+                                         bool formatted, bool removes_blanks, bool skip_xml_declaration, bool auto_uri,
+                                         bool single_cert, mxml_sec_cb sec_cb, void *sec_cls, mxml_err_cb error_cb,
+                                         void *error_cls) {
+    xmlDocPtr doc;
+    size_t res;
+    if (!_mxml_xmlsec_cfg_check(cfg, error_cb, error_cls))
+        return 0;
+    if (!string) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "string");
+        return 0;
+    }
+    if (!(doc = _mxml_xmlsec_parse_string(string, length))) {
+        _MXML_THROW(error_cb, error_cls, _("Unable to parse string\n"));
+        return 0;
+    }
+    res = mxml_xmlsec_sign_doc_to_buffer(cfg, doc, buffer, buffer_size, encoding, id_attr, id_name,
+                                         declares_attlist, formatted, removes_blanks, skip_xml_declaration, auto_uri,
+                                         single_cert, sec_cb, sec_cls, error_cb, error_cls);
+    xmlFreeDoc(doc);
+    return res;
+}
+
+size_t mxml_xmlsec_sign_string_to_cb(struct mxml_xmlsec_cfg *cfg, const char *string, size_t length,
+                                     mxml_write_cb write_cb, void *write_cls, const char *encoding,
+                                     const char *id_attr, const char *id_name, bool declares_attlist, bool formatted,
+                                     bool removes_blanks, bool skip_xml_declaration, bool auto_uri, bool single_cert,
+                                     mxml_sec_cb sec_cb, void *sec_cls, mxml_err_cb error_cb, void *error_cls) {
+    xmlDocPtr doc;
+    size_t res;
+    if (!_mxml_xmlsec_cfg_check(cfg, error_cb, error_cls))
+        return 0;
+    if (!string) {
+        _MXML_THROW(error_cb, error_cls, _("Required argument: %s\n"), "string");
+        return 0;
+    }
+    if (!(doc = _mxml_xmlsec_parse_string(string, length))) {
+        _MXML_THROW(error_cb, error_cls, _("Unable to parse string\n"));
+        return 0;
+    }
+    res = mxml_xmlsec_sign_doc_to_cb(cfg, doc, write_cb, write_cls, encoding, id_attr, id_name, declares_attlist,
+                                     formatted, removes_blanks, skip_xml_declaration, auto_uri, single_cert, sec_cb,
+                                     sec_cls, error_cb, error_cls);
+    xmlFreeDoc(doc);
+    return res;
+}
+
 bool mxml_xmlsec_sign_string(struct mxml_xmlsec_cfg *cfg, const char *string, char **signed_string,
                              const char *encoding, const char *id_attr, const char *id_name, bool declares_attlist,
                              bool formatted, bool removes_blanks, bool skip_xml_declaration, int compression,
@@ -825,9 +1641,9 @@ bool mxml_xmlsec_verify_file(struct mxml_xmlsec_cfg *cfg, const char *filename,
         _MXML_THROW(error_cb, error_cls, _("Failed to create signature context\n"));
         goto done;
     }
-    d_sig_ctx->signKey = xmlSecCryptoAppPkcs12Load(cfg->pfx_filename, cfg->pfx_pwd, NULL, NULL);
+    d_sig_ctx->signKey = _mxml_xmlsec_cfg_key_dup(cfg);
     if (!d_sig_ctx->signKey) {
-        _MXML_THROW(error_cb, error_cls, _("Failed to load PFX file: %s\n"), cfg->pfx_filename);
+        _MXML_THROW(error_cb, error_cls, _("Failed to duplicate signing key\n"));
         goto done;
     }
     if (xmlSecDSigCtxVerify(d_sig_ctx, sign_node) < 0) {
@@ -0,0 +1,181 @@
+/*
+ * libmicrosped - Micro biblioteca multiplataforma para comunicação com web services
+ * de SPED da SEFAZ.
+ *
+ * Copyright (c) 2017 Silvio Clecio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Verificação de concorrência do modelo descrito em microsped.h: várias threads usam o mesmo `msped_cfg` ao mesmo
+ * tempo. O programa é compilado com -fsanitize=thread pelo `make check`, então qualquer corrida de dados faz o teste
+ * falhar. Os web services apontam para uma porta local fechada, para exercitar cURL e os callbacks de erro sem rede.
+ */
+
+#include <microsped.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define CHECK_THREADS 8
+#define CHECK_ITERACOES 50
+#define CHECK_URL "http://127.0.0.1:1/ws/NfeStatusServico4"
+#define CHECK_CHAVE "51170100000000000191550010000000011000000019"
+
+#define CHECK_MODELO \
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" \
+    "<WS><UF><sigla>MT</sigla><homologacao>" \
+    "<NfeStatusServico method=\"nfeStatusServicoNF\" operation=\"NFeStatusServico4\" version=\"4.00\">" \
+    CHECK_URL "</NfeStatusServico>" \
+    "<NfeConsultaProtocolo method=\"nfeConsultaNF\" operation=\"NFeConsultaProtocolo4\" version=\"4.00\">" \
+    CHECK_URL "</NfeConsultaProtocolo>" \
+    "</homologacao></UF></WS>"
+
+struct check_thread {
+    struct msped_cfg *cfg;
+    uint64_t ids[CHECK_ITERACOES];
+    int falhas;
+};
+
+static atomic_int check_erros = 0;
+
+static void check_erro_cb(void *cls, const char *msg) {
+    (void) msg;
+    atomic_fetch_add((atomic_int *) cls, 1);
+}
+
+static size_t check_escrita_cb(void *dados, size_t tam, size_t qtd, void *cls) {
+    (void) dados;
+    (void) cls;
+    return tam * qtd;
+}
+
+static void *check_executar(void *arg) {
+    struct check_thread *t = arg;
+    const char *chaves[] = {CHECK_CHAVE, "123"};
+    char *metodo;
+    char *operacao;
+    char *versao;
+    char *sv_str;
+    char *url;
+    char *dh;
+    char id[16];
+    msped_inicializar();
+    for (int i = 0; i < CHECK_ITERACOES; i++) {
+        if (!msped_cfg_ws_info(t->cfg, "NfeStatusServico", &metodo, &operacao, &versao, &sv_str, &url,
+                               check_erro_cb, &check_erros) || NULL == url || 0 != strcmp(url, CHECK_URL))
+            t->falhas++;
+        /* porta fechada: a consulta falha e o erro é entregue a esta thread */
+        if (msped_consultar_status_servico(t->cfg, check_escrita_cb, NULL, NULL, NULL, check_erro_cb, &check_erros))
+            t->falhas++;
+        if (msped_consultar_situacao(t->cfg, CHECK_CHAVE, check_escrita_cb, NULL, NULL, NULL,
+                                     check_erro_cb, &check_erros))
+            t->falhas++;
+        if (1 != msped_validar_chaves(chaves, 2, NULL))
+            t->falhas++;
+        if (NULL == (dh = msped_data_hora_utc()))
+            t->falhas++;
+        free(dh);
+        msped_gerar_id_lote(id);
+        if (15 != strlen(id))
+            t->falhas++;
+        t->ids[i] = msped_lote_id_gerar(NULL);
+    }
+    msped_finalizar();
+    return NULL;
+}
+
+static int check_comparar(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *) a;
+    uint64_t y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+int main(void) {
+    static struct check_thread threads[CHECK_THREADS];
+    static uint64_t ids[CHECK_THREADS * CHECK_ITERACOES];
+    pthread_t tids[CHECK_THREADS];
+    char modelo[] = "msped_check_modelo_XXXXXX";
+    char pfx[] = "msped_check_pfx_XXXXXX";
+    char estado[] = "msped_check_lote_id_XXXXXX";
+    struct msped_cfg *cfg;
+    FILE *f;
+    size_t n;
+    int fd;
+    int falhas;
+    falhas = 0;
+    if ((fd = mkstemp(modelo)) < 0 || NULL == (f = fdopen(fd, "w"))) {
+        perror("modelo");
+        return 99;
+    }
+    fputs(CHECK_MODELO, f);
+    fclose(f);
+    if ((fd = mkstemp(pfx)) < 0 || (close(fd), (fd = mkstemp(estado)) < 0)) {
+        perror("mkstemp");
+        return 99;
+    }
+    close(fd);
+    msped_lote_id_arquivo_definir(estado);
+    msped_inicializar();
+    cfg = msped_cfg_arquivo_novo(MSPED_TIPO_NFE, MSPED_CUF_MT, MSPED_AMB_HOMOLOGACAO, MSPED_SV_NENHUM,
+                                 MSPED_NF_MODELO_55, modelo, pfx, "", "4.00", NULL, NULL, 1000, false,
+                                 check_erro_cb, &check_erros);
+    if (!msped_cfg_ok(cfg)) {
+        fprintf(stderr, "msped_cfg_arquivo_novo falhou\n");
+        return 99;
+    }
+    for (int i = 0; i < CHECK_THREADS; i++) {
+        threads[i].cfg = cfg;
+        if (0 != pthread_create(&tids[i], NULL, check_executar, &threads[i])) {
+            perror("pthread_create");
+            return 99;
+        }
+    }
+    n = 0;
+    for (int i = 0; i < CHECK_THREADS; i++) {
+        pthread_join(tids[i], NULL);
+        falhas += threads[i].falhas;
+        memcpy(&ids[n], threads[i].ids, sizeof(threads[i].ids));
+        n += CHECK_ITERACOES;
+    }
+    qsort(ids, n, sizeof(uint64_t), check_comparar);
+    for (size_t i = 1; i < n; i++)
+        if (ids[i] == ids[i - 1]) {
+            fprintf(stderr, "ID de lote repetido: %015" PRIu64 "\n", ids[i]);
+            falhas++;
+        }
+    /* cada iteração entrega exatamente um erro por consulta */
+    if (atomic_load(&check_erros) != 2 * CHECK_THREADS * CHECK_ITERACOES) {
+        fprintf(stderr, "erros recebidos: %d, esperados: %d\n", atomic_load(&check_erros),
+                2 * CHECK_THREADS * CHECK_ITERACOES);
+        falhas++;
+    }
+    msped_cfg_liberar(cfg);
+    msped_finalizar();
+    unlink(modelo);
+    unlink(pfx);
+    unlink(estado);
+    if (falhas > 0)
+        fprintf(stderr, "%d falhas\n", falhas);
+    return falhas > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -37,7 +37,7 @@
     char msg[MSPED_ERR_TAM]; \
     if (cb) { \
         erro = mu_fmt(__VA_ARGS__); \
-        strcpy(msg, erro); \
+        snprintf(msg, sizeof(msg), "%s", (NULL == erro ? "" : erro)); \
         free(erro); \
         cb(cls, msg); \
     } else \
@@ -24,8 +24,17 @@
  */
 
 #include <microsped.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#ifdef WIN32
+#include <io.h>
+#include <sys/locking.h>
+#endif
 #include "msped_strs.h"
 #include "msped_macros.h"
 
@@ -337,16 +346,60 @@ enum MSPED_NF_MODELO msped_str_para_modelo(const char *str) {
     return MSPED_NF_NENHUM;
 }
 
+#define _MSPED_CHAVE_LEN 44
+
 bool msped_validar_chave(const char *chave) {
-    return !mu_is_empty(chave) && mu_match("^[0-9]{44}$", chave);
+    if (NULL == chave)
+        return false;
+    for (uint8_t i = 0; i < _MSPED_CHAVE_LEN; i++)
+        if (chave[i] < '0' || chave[i] > '9')
+            return false;
+    return '\0' == chave[_MSPED_CHAVE_LEN];
+}
+
+char msped_calcular_dv_chave(const char *chave) {
+    unsigned int soma = 0, peso = 4, dv;
+    if (NULL == chave)
+        return '\0';
+    /* pesos 2..9 da direita para a esquerda; o dígito 0 recebe peso 4 */
+    for (uint8_t i = 0; i < _MSPED_CHAVE_LEN - 1; i++) {
+        if (chave[i] < '0' || chave[i] > '9')
+            return '\0';
+        soma += (chave[i] - '0') * peso;
+        peso = (2 == peso) ? 9 : peso - 1;
+    }
+    dv = 11 - (soma % 11);
+    return (char) ((dv > 9 ? 0 : dv) + '0');
+}
+
+bool msped_validar_chave_dv(const char *chave) {
+    char dv;
+    if (NULL == chave)
+        return false;
+    dv = msped_calcular_dv_chave(chave);
+    return '\0' != dv && dv == chave[_MSPED_CHAVE_LEN - 1] && '\0' == chave[_MSPED_CHAVE_LEN];
+}
+
+size_t msped_validar_chaves(const char *const *chaves, size_t qtd, bool *resultados) {
+    size_t validas = 0;
+    bool ok;
+    if (NULL == chaves)
+        return 0;
+    for (size_t i = 0; i < qtd; i++) {
+        ok = msped_validar_chave_dv(chaves[i]);
+        if (NULL != resultados)
+            resultados[i] = ok;
+        if (ok)
+            validas++;
+    }
+    return validas;
 }
 
 #ifdef _WIN32
 
 struct tm *localtime_r(const time_t *timep, struct tm *result) {
-    // localtime() na MSVCRT.DLL é thread-safe, mas não "reentrant"
-    memcpy(result, localtime(timep), sizeof(struct tm));
-    return result;
+    // localtime_s() escreve em result, sem passar pelo buffer estático
+    return localtime_s(result, timep) == 0 ? result : NULL;
 }
 
 #endif
@@ -363,7 +416,145 @@ void msped_gerar_id_lote_sleep(char *id, useconds_t usegs) {
 }
 
 void msped_gerar_id_lote(char *id) {
-    msped_gerar_id_lote_sleep(id, 100000);
+    snprintf(id, 16, "%015" PRIu64, msped_lote_id_gerar(NULL));
+}
+
+/* 2017-01-01T00:00:00Z: com 10 dígitos de segundos o ID cabe nos 15 dígitos de TIdLote até o ano 2333. */
+#define MSPED_LOTE_ID_EPOCA 1483228800
+#define MSPED_LOTE_ID_CONTADOR 1000
+#define MSPED_LOTE_ID_NOS 100
+/* faixa de tiques reservada no arquivo de estado de cada vez: um minuto de relógio */
+#define MSPED_LOTE_ID_RESERVA (60 * MSPED_LOTE_ID_CONTADOR)
+
+static atomic_uint_fast64_t msped_lote_id_tique = 0;
+static atomic_uint_fast64_t msped_lote_id_limite = 0;
+static atomic_int msped_lote_id_no = -1;
+static pthread_mutex_t msped_lote_id_mutex = PTHREAD_MUTEX_INITIALIZER;
+static char *msped_lote_id_caminho = NULL;
+
+void msped_lote_id_no_definir(uint8_t no) {
+    atomic_store(&msped_lote_id_no, no % MSPED_LOTE_ID_NOS);
+}
+
+void msped_lote_id_arquivo_definir(const char *caminho) {
+    pthread_mutex_lock(&msped_lote_id_mutex);
+    free(msped_lote_id_caminho);
+    msped_lote_id_caminho = (NULL != caminho ? strdup(caminho) : NULL);
+    /* a próxima chamada reserva sua faixa no novo arquivo */
+    atomic_store(&msped_lote_id_limite, 0);
+    pthread_mutex_unlock(&msped_lote_id_mutex);
+}
+
+static char *msped_lote_id_caminho_padrao(void) {
+    const char *dir;
+    if (NULL != (dir = getenv("MSPED_LOTE_ID_ARQUIVO")) && *dir)
+        return strdup(dir);
+#ifdef WIN32
+    if (NULL == (dir = getenv("TEMP")) || !*dir)
+        return NULL;
+    return mu_fmt("%s\\msped_lote_id", dir);
+#else
+    if (NULL == (dir = getenv("TMPDIR")) || !*dir)
+        dir = "/tmp";
+    return mu_fmt("%s/msped_lote_id_%u", dir, (unsigned int) getuid());
+#endif
+}
+
+static bool msped_lote_id_travar(int fd, bool travar) {
+#ifdef WIN32
+    return lseek(fd, 0, SEEK_SET) == 0 && _locking(fd, travar ? _LK_LOCK : _LK_UNLCK, 1) == 0;
+#else
+    struct flock fl;
+    memset(&fl, 0, sizeof(struct flock));
+    fl.l_type = (short) (travar ? F_WRLCK : F_UNLCK);
+    fl.l_whence = SEEK_SET;
+    return fcntl(fd, F_SETLKW, &fl) == 0;
+#endif
+}
+
+/*
+ * Reserva, a partir de \p novo, uma faixa de tiques que nenhum outro processo que use o mesmo arquivo de estado nem
+ * uma execução futura vai repetir: o limite da faixa é gravado no arquivo antes de qualquer ID dela ser devolvido.
+ */
+static void msped_lote_id_reservar(uint_fast64_t novo) {
+    char buf[32];
+    uint_fast64_t inicio;
+    uint_fast64_t limite;
+    uint_fast64_t atual;
+    ssize_t lidos;
+    int len;
+    int fd;
+    pthread_mutex_lock(&msped_lote_id_mutex);
+    if (novo < atomic_load(&msped_lote_id_limite)) {
+        /* outra thread reservou enquanto esta esperava */
+        pthread_mutex_unlock(&msped_lote_id_mutex);
+        return;
+    }
+    if (NULL == msped_lote_id_caminho)
+        msped_lote_id_caminho = msped_lote_id_caminho_padrao();
+    inicio = novo;
+    fd = -1;
+    if (NULL != msped_lote_id_caminho)
+#ifdef WIN32
+        fd = open(msped_lote_id_caminho, O_RDWR | O_CREAT | O_BINARY, 0600);
+#else
+        fd = open(msped_lote_id_caminho, O_RDWR | O_CREAT | O_NOFOLLOW | O_CLOEXEC, 0600);
+#endif
+    if (fd >= 0 && msped_lote_id_travar(fd, true)) {
+        if ((lidos = read(fd, buf, sizeof(buf) - 1)) > 0) {
+            buf[lidos] = '\0';
+            limite = strtoull(buf, NULL, 10);
+            if (limite > inicio)
+                inicio = limite;
+        }
+        limite = inicio + MSPED_LOTE_ID_RESERVA;
+        /* largura fixa: o texto novo sempre cobre o anterior por inteiro */
+        len = snprintf(buf, sizeof(buf), "%020" PRIuFAST64 "\n", limite);
+        if (lseek(fd, 0, SEEK_SET) == 0 && write(fd, buf, (size_t) len) == len)
+#ifdef WIN32
+            _commit(fd);
+#else
+            fsync(fd);
+#endif
+        msped_lote_id_travar(fd, false);
+    } else
+        limite = inicio + MSPED_LOTE_ID_RESERVA;
+    if (fd >= 0)
+        close(fd);
+    /* o tique salta para o início da faixa antes de o novo limite ficar visível */
+    atual = atomic_load(&msped_lote_id_tique);
+    while (atual + 1 < inicio && !atomic_compare_exchange_weak(&msped_lote_id_tique, &atual, inicio - 1));
+    atomic_store(&msped_lote_id_limite, limite);
+    pthread_mutex_unlock(&msped_lote_id_mutex);
+}
+
+uint64_t msped_lote_id_gerar(void *cls) {
+    uint_fast64_t atual;
+    uint_fast64_t novo;
+    uint_fast64_t agora;
+    time_t t;
+    int no;
+    (void) cls;
+    if ((no = atomic_load(&msped_lote_id_no)) < 0) {
+        no = (int) (getpid() % MSPED_LOTE_ID_NOS);
+        atomic_store(&msped_lote_id_no, no);
+    }
+    t = time(NULL);
+    agora = (t > MSPED_LOTE_ID_EPOCA ? (uint_fast64_t) (t - MSPED_LOTE_ID_EPOCA) : 0) * MSPED_LOTE_ID_CONTADOR;
+    /* tique = segundos * 1000 + contador; nunca recua, mesmo se o relógio voltar */
+    for (;;) {
+        atual = atomic_load(&msped_lote_id_tique);
+        novo = (agora > atual ? agora : atual + 1);
+        if (novo >= atomic_load(&msped_lote_id_limite)) {
+            msped_lote_id_reservar(novo);
+            continue;
+        }
+        /* se uma reserva moveu o tique desde a leitura, a troca falha e o cálculo é refeito */
+        if (atomic_compare_exchange_weak(&msped_lote_id_tique, &atual, novo))
+            break;
+    }
+    return ((novo / MSPED_LOTE_ID_CONTADOR) * MSPED_LOTE_ID_NOS + (uint_fast64_t) no) * MSPED_LOTE_ID_CONTADOR +
+           novo % MSPED_LOTE_ID_CONTADOR;
 }
 
 char *msped_data_hora_utc() {
@@ -375,19 +566,18 @@ char *msped_data_hora_utc() {
     size_t len;
     size_t zlen;
     time_t t;
-    struct tm *tm;
+    struct tm tm;
     tzset();
     t = abs((int) timezone);
-    tm = gmtime(&t);
-    if (NULL == tm)
+    /* gmtime_s()/localtime_s() write into tm, not into a static buffer */
+    if (0 != gmtime_s(&tm, &t))
         return NULL;
-    if (0 == strftime(zbuf, sizeof(zbuf), TZ_FMT(timezone), tm))
+    if (0 == strftime(zbuf, sizeof(zbuf), TZ_FMT(timezone), &tm))
         return NULL;
     t = time(NULL);
-    tm = localtime(&t);
-    if (NULL == tm)
+    if (0 != localtime_s(&tm, &t))
         return NULL;
-    if (0 == strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", tm))
+    if (0 == strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tm))
         return NULL;
     len = strlen(buf);
     zlen = strlen(zbuf);
@@ -403,9 +593,10 @@ char *msped_data_hora_utc() {
     char buf[64];
     size_t len;
     time_t t;
+    struct tm lt;
     struct tm *tm;
     t = time(NULL);
-    tm = localtime(&t);
+    tm = localtime_r(&t, &lt);
     if (NULL == tm)
         return NULL;
     if (0 == strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S%z", tm))
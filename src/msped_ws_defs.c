@@ -267,6 +267,36 @@ char *msped_montar_envi_lote(enum MSPED_TIPO tipo, const char *portal, const cha
     return mu_fmt(MSPED_ENV_LOTE_FMT, tp, portal, versao, id_lote, ind_sinc, nfe, tp);
 }
 
+char *msped_montar_envi_lote_partes(enum MSPED_TIPO tipo, const char *portal, const char *versao, uint64_t id_lote,
+                                    uint8_t ind_sinc, const char *const *nfes, const size_t *tamanhos,
+                                    uint8_t quantidade, size_t *tamanho) {
+    const char *tp = msped_montar_tipo_normal(tipo, false);
+    char *res;
+    char *p;
+    int ini;
+    int fim;
+    size_t total;
+    ini = snprintf(NULL, 0, MSPED_ENV_LOTE_INI_FMT, tp, portal, versao, id_lote, ind_sinc);
+    fim = snprintf(NULL, 0, MSPED_ENV_LOTE_FIM_FMT, tp);
+    if (ini < 0 || fim < 0)
+        return NULL;
+    total = (size_t) ini + (size_t) fim;
+    for (uint8_t i = 0; i < quantidade; i++)
+        total += tamanhos[i];
+    res = malloc(total + sizeof(char));
+    if (NULL == res)
+        return NULL;
+    p = res + snprintf(res, (size_t) ini + 1, MSPED_ENV_LOTE_INI_FMT, tp, portal, versao, id_lote, ind_sinc);
+    for (uint8_t i = 0; i < quantidade; i++) {
+        memcpy(p, nfes[i], tamanhos[i]);
+        p += tamanhos[i];
+    }
+    snprintf(p, (size_t) fim + 1, MSPED_ENV_LOTE_FIM_FMT, tp);
+    if (NULL != tamanho)
+        *tamanho = total;
+    return res;
+}
+
 char *msped_montar_cons_reci(enum MSPED_TIPO tipo, const char *portal, const char *versao, enum MSPED_AMBIENTE ambiente,
                              uint64_t recibo) {
     const char *tp = msped_montar_tipo_normal(tipo, false);
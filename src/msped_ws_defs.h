@@ -48,6 +48,10 @@
 
 #define MSPED_ENV_LOTE_FMT "<envi%s xmlns=\"%s\" versao=\"%s\"><idLote>%"PRIu64"</idLote><indSinc>%d</indSinc>%s</envi%s>"
 
+#define MSPED_ENV_LOTE_INI_FMT "<envi%s xmlns=\"%s\" versao=\"%s\"><idLote>%"PRIu64"</idLote><indSinc>%d</indSinc>"
+
+#define MSPED_ENV_LOTE_FIM_FMT "</envi%s>"
+
 #define MSPED_CONS_RECI_FMT "<consReci%s xmlns=\"%s\" versao=\"%s\"><tpAmb>%d</tpAmb><nRec>%"PRIu64"</nRec></consReci%s>"
 
 #define MSPED_EVENTO_FMT "<evento xmlns=\"%s\" versao=\"%s\"><infEvento Id=\"%s\"><cOrgao>%d</cOrgao><tpAmb>%d</tpAmb><%s>%s</%s><ch%s>%s</ch%s><dhEvento>%s</dhEvento><tpEvento>%s</tpEvento><nSeqEvento>%"PRIu64"</nSeqEvento><verEvento>%s</verEvento><detEvento versao=\"%s\"><descEvento>%s</descEvento>%s</detEvento></infEvento></evento>"
@@ -86,6 +90,10 @@ char *msped_montar_cons_cad(const char *portal, const char *versao, enum MSPED_C
 char *msped_montar_envi_lote(enum MSPED_TIPO tipo, const char *portal, const char *versao, uint64_t id_lote,
                              uint8_t ind_sinc, const char *nfe);
 
+char *msped_montar_envi_lote_partes(enum MSPED_TIPO tipo, const char *portal, const char *versao, uint64_t id_lote,
+                                    uint8_t ind_sinc, const char *const *nfes, const size_t *tamanhos,
+                                    uint8_t quantidade, size_t *tamanho);
+
 char *msped_montar_cons_reci(enum MSPED_TIPO tipo, const char *portal, const char *versao, enum MSPED_AMBIENTE ambiente,
                              uint64_t recibo);
 
@@ -19,6 +19,7 @@
 
 #include <pitangus/sefaz.h>
 #include <pitangus/libsped.h>
+#include <pitangus/sped.h>
 #include "send.h"
 #include "xml.h"
 #include <pitangus/genxml.h>
@@ -26,6 +27,8 @@
 #include <libxml/parser.h>
 #include <openssl/x509.h>
 #include <openssl/evp.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 int get_status_servico(int ambiente, char *URL, int cuf, 
@@ -79,7 +82,7 @@ static int sefaz_response_protocolos(LOTE *lote, xmlDocPtr doc, char *msg){
 		sprintf(xp, "nfe:protNFe/nfe:infProt[nfe:chNFe='%s']/nfe:xMotivo", 
 			n->idnfe->chave);
 		motivo = get_xml_element(doc, xp);
-		n->protocolo->xmot = strdup(motivo);
+		nfe_set_str(n, &n->protocolo->xmot, motivo);
 		strcat(msg, "\n");
 		strcat(msg, n->idnfe->chave);
 		strcat(msg, ": ");
@@ -90,11 +93,11 @@ static int sefaz_response_protocolos(LOTE *lote, xmlDocPtr doc, char *msg){
 			sprintf(xp, "nfe:protNFe/nfe:infProt[nfe:chNFe='%s']/nfe:nProt", 
 				n->idnfe->chave);
 			nProt = get_xml_element(doc, xp);
-			n->protocolo->numero = strdup(nProt);
+			nfe_set_str(n, &n->protocolo->numero, nProt);
 			sprintf(xp, "//nfe:protNFe/nfe:infProt[nfe:chNFe='%s']/..", 
 				n->idnfe->chave);
 			char *xml_prot = get_xml_subtree(doc, xp);
-			n->protocolo->xml = strdup(xml_prot);
+			nfe_set_str(n, &n->protocolo->xml, xml_prot);
 			xmlFree(nProt);
 			xmlFree(xml_prot);
 		}
@@ -261,3 +264,105 @@ int cons_lote(LOTE *lote, char *URL, int ambiente, int cuf, EVP_PKEY *key,
 
 	return cStat;
 }
+
+static int sefaz_response_inut(INUTILIZACAO *inut, const char *response){
+	char *status, *motivo, *nProt;
+	xmlDocPtr doc;
+	doc = xmlReadMemory(response, strlen(response), "noname.xml", NULL, 0);
+	if(doc == NULL)
+		return -ESEFAZ;
+	status = get_xml_element(doc, "nfe:infInut/nfe:cStat");
+	motivo = get_xml_element(doc, "nfe:infInut/nfe:xMotivo");
+	if(status == NULL || motivo == NULL){
+		xmlFree(status);
+		xmlFree(motivo);
+		xmlFreeDoc(doc);
+		return -ESEFAZ;
+	}
+	inut->cStat = atoi(status);
+	inut->xmot = strdup(motivo);
+	inut->xml_response = get_xml_subtree(doc, "//nfe:retInutNFe");
+	if(inut->cStat == SEFAZ_INUT_OK){
+		nProt = get_xml_element(doc, "nfe:infInut/nfe:nProt");
+		if(nProt != NULL)
+			inut->protocolo = strdup(nProt);
+		xmlFree(nProt);
+	}
+	xmlFree(status);
+	xmlFree(motivo);
+	xmlFreeDoc(doc);
+	return 0;
+}
+
+int send_inutilizacoes(INUTILIZACAO **inut, int n, char *URL, int ambiente,
+		int cuf, EVP_PKEY *key, X509 *cert, char *msg){
+	char **xml, **responses;
+	int i, homologadas = 0, sem_resposta = 0, rejeitada = -1, falhas = 0;
+	size_t len;
+
+	/* o SEFAZ recusaria o lote inteiro, faixa por faixa */
+	for(i = 0; i < n; i++){
+		len = inut[i]->justificativa? strlen(inut[i]->justificativa) : 0;
+		if(len < 15 || len > 255){
+			strcpy(msg, "A justificativa deve ter de 15 a 255 caracteres");
+			return -EINVFIELD;
+		}
+	}
+	xml = calloc(n, sizeof(char*));
+	responses = calloc(n, sizeof(char*));
+	if(xml == NULL || responses == NULL){
+		free(xml);
+		free(responses);
+		strcpy(msg, "Erro ao gerar os pedidos de inutilização");
+		return -EXML;
+	}
+	/* a assinatura (xmlsec) não é thread-safe; só o envio é paralelo */
+	for(i = 0; i < n; i++){
+		inut[i]->tipo_ambiente = ambiente;
+		xml[i] = gen_inut_xml(inut[i], key, cert);
+		free((char*)inut[i]->xml);
+		inut[i]->xml = xml[i];
+		/* fica fora do envio; send_sefaz_varios pula o NULL */
+		if(xml[i] == NULL){
+			fprintf(stderr, "livrenfe: Error: inutilização série %d, "
+				"%u a %u: XML não gerado\n", inut[i]->serie,
+				inut[i]->num_ini, inut[i]->num_fim);
+			falhas++;
+		}
+	}
+	send_sefaz_varios(SEFAZ_NFE_INUTILIZACAO, URL, ambiente, cuf, xml, n,
+		key, cert, responses);
+
+	for(i = 0; i < n; i++){
+		if(xml[i] == NULL){
+			continue;
+		} else if(responses[i] == NULL ||
+				sefaz_response_inut(inut[i], responses[i])){
+			sem_resposta++;
+		} else if(inut[i]->cStat == SEFAZ_INUT_OK){
+			homologadas++;
+		} else if(rejeitada < 0){
+			rejeitada = i;
+		}
+		free(responses[i]);
+	}
+	free(responses);
+	free(xml);
+
+	/* snprintf devolve o que escreveria; i não passa do fim de msg */
+	i = snprintf(msg, SEFAZ_MSG_TAM, "%d de %d faixas inutilizadas",
+		homologadas, n);
+	if(rejeitada >= 0 && i < SEFAZ_MSG_TAM)
+		i += snprintf(msg + i, SEFAZ_MSG_TAM - i,
+			"\nSérie %d, %u a %u: %.120s", inut[rejeitada]->serie,
+			inut[rejeitada]->num_ini, inut[rejeitada]->num_fim,
+			inut[rejeitada]->xmot);
+	if(falhas && i < SEFAZ_MSG_TAM)
+		i += snprintf(msg + i, SEFAZ_MSG_TAM - i,
+			"\n%d não enviadas: erro ao gerar o XML", falhas);
+	if(sem_resposta && i < SEFAZ_MSG_TAM)
+		snprintf(msg + i, SEFAZ_MSG_TAM - i,
+			"\n%d sem resposta do SEFAZ, tente novamente",
+			sem_resposta);
+	return homologadas;
+}
@@ -39,8 +39,19 @@ typedef struct {
 static size_t writefunction(void *ptr, size_t size,
 		size_t nmemb, void *s){
 	char **r = (char**) s;
-	*r = strndup(ptr, (size_t)(size*nmemb));
-	return (nmemb*size);
+	size_t tam = size * nmemb;
+	size_t ant = *r == NULL? 0 : strlen(*r);
+	char *novo;
+
+	/* a resposta pode vir em vários pedaços; devolver menos que tam
+	 * faz o curl abortar a transferência */
+	novo = realloc(*r, ant + tam + 1);
+	if(novo == NULL)
+		return 0;
+	memcpy(novo + ant, ptr, tam);
+	novo[ant + tam] = '\0';
+	*r = novo;
+	return tam;
 }
 
 CURLcode sslctx_function(CURL *curl, void *sslctx, SSL_KEY *ssl_key){
@@ -73,109 +84,105 @@ static char *format_soap(sefaz_servico_t service, char *xml, int cuf,
 		const char *wsdl){
 	int rc, buffersize;
 	xmlTextWriterPtr writer;
-	xmlDocPtr doc;
-	xmlChar *xmlbuf;
-	char *versao = get_versao(service);
+	xmlDocPtr doc = NULL;
+	xmlChar *xmlbuf = NULL;
+	char *versao;
+
+	if(xml == NULL)
+		return NULL;
+	versao = get_versao(service);
 
 	writer = xmlNewTextWriterDoc(&doc, 0);
 	if (writer == NULL)
-		return NULL;
+		goto erro;
 	xmlTextWriterStartDocument(writer, NULL, "UTF-8", NULL);
 	rc = xmlTextWriterStartElement(writer, BAD_CAST "soap12:Envelope");
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterWriteAttribute(writer, BAD_CAST "xmlns:xsi",
 			BAD_CAST "http://www.w3.org/2001/XMLSchema-instance");
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterWriteAttribute(writer, BAD_CAST "xmlns:xsd",
 			BAD_CAST "http://www.w3.org/2001/XMLSchema");
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterWriteAttribute(writer, BAD_CAST "xmlns:soap12",
 			BAD_CAST "http://www.w3.org/2003/05/soap-envelope");
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterStartElement(writer, BAD_CAST "soap12:Header");
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterStartElement(writer, BAD_CAST "nfeCabecMsg");
 	if (rc < 0)
-		return NULL;
+		goto erro;
 
 	rc = xmlTextWriterWriteAttribute(writer, BAD_CAST "xmlns",
 		BAD_CAST wsdl);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "versaoDados",
 			"%s", versao);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterWriteFormatElement(writer, BAD_CAST "cUF",
 			"%d", cuf);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterEndElement(writer);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterEndElement(writer);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterStartElement(writer, BAD_CAST "soap12:Body");
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterStartElement(writer, BAD_CAST "nfeDadosMsg");
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterWriteAttribute(writer, BAD_CAST "xmlns",
 			BAD_CAST wsdl);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterWriteRaw(writer, BAD_CAST xml);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterEndElement(writer);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterEndElement(writer);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	rc = xmlTextWriterEndElement(writer);
 	if (rc < 0)
-		return NULL;
+		goto erro;
 
 	if (rc < 0)
-		return NULL;
+		goto erro;
 	xmlTextWriterEndDocument(writer);
 	xmlDocDumpMemory(doc, &xmlbuf, &buffersize);
-
+erro:
+	xmlFreeTextWriter(writer);
+	xmlFreeDoc(doc);
 	return (char*) xmlbuf;
 }
 
-char *send_sefaz(sefaz_servico_t service, char *URL, int ambiente, int cuf, 
-		char *xml, EVP_PKEY *key, X509 *cert){
+static CURL *sefaz_handle(char *URL, char *soap, struct curl_slist *header,
+		SSL_KEY *ssl_key, char **server_response){
 	CURL *ch;
 	CURLcode rv;
-	rv = curl_global_init(CURL_GLOBAL_ALL);
 	ch = curl_easy_init();
-	struct curl_slist *header = NULL;
-	SSL_KEY ssl_key = { 
-		.key = key,
-		.cert = cert
-	};
-	char *server_response;
-	header = curl_slist_append(header, 
-		"Content-type: application/soap+xml; charset=UTF-8");
+	if(ch == NULL)
+		return NULL;
 	rv = curl_easy_setopt(ch, CURLOPT_VERBOSE, 0L);
 	rv = curl_easy_setopt(ch, CURLOPT_HTTPHEADER, header);
 	rv = curl_easy_setopt(ch, CURLOPT_NOPROGRESS, 1L);
 	rv = curl_easy_setopt(ch, CURLOPT_NOSIGNAL, 1L);
 	rv = curl_easy_setopt(ch, CURLOPT_WRITEFUNCTION, writefunction);
-	rv = curl_easy_setopt(ch, CURLOPT_WRITEDATA, &server_response);
-
-	char *h = format_soap(service, xml, cuf, SEFAZ_WSDL[service]);
-
-	rv = curl_easy_setopt(ch, CURLOPT_POSTFIELDS, h);
+	rv = curl_easy_setopt(ch, CURLOPT_WRITEDATA, server_response);
+	rv = curl_easy_setopt(ch, CURLOPT_POSTFIELDS, soap);
 
 	/* both VERIFYPEER and VERIFYHOST are set to 0 in this case because there is
 	   no CA certificate*/ 
@@ -184,7 +191,29 @@ char *send_sefaz(sefaz_servico_t service, char *URL, int ambiente, int cuf,
 	rv = curl_easy_setopt(ch, CURLOPT_SSL_VERIFYHOST, 0L);
 	rv = curl_easy_setopt(ch, CURLOPT_URL, URL);
 	rv = curl_easy_setopt(ch, CURLOPT_SSL_CTX_FUNCTION, *sslctx_function);
-	rv = curl_easy_setopt(ch, CURLOPT_SSL_CTX_DATA, &ssl_key);
+	rv = curl_easy_setopt(ch, CURLOPT_SSL_CTX_DATA, ssl_key);
+	(void)rv;
+	return ch;
+}
+
+char *send_sefaz(sefaz_servico_t service, char *URL, int ambiente, int cuf, 
+		char *xml, EVP_PKEY *key, X509 *cert){
+	CURL *ch;
+	CURLcode rv;
+	rv = curl_global_init(CURL_GLOBAL_ALL);
+	struct curl_slist *header = NULL;
+	SSL_KEY ssl_key = { 
+		.key = key,
+		.cert = cert
+	};
+	char *server_response = NULL;
+	header = curl_slist_append(header, 
+		"Content-type: application/soap+xml; charset=UTF-8");
+
+	char *h = format_soap(service, xml, cuf, SEFAZ_WSDL[service]);
+	if(h == NULL)
+		return NULL;
+	ch = sefaz_handle(URL, h, header, &ssl_key, &server_response);
 	rv = curl_easy_perform(ch);
 
 	free(h);
@@ -196,3 +225,79 @@ char *send_sefaz(sefaz_servico_t service, char *URL, int ambiente, int cuf,
 	curl_global_cleanup();
 	return server_response;
 }
+
+int send_sefaz_varios(sefaz_servico_t service, char *URL, int ambiente,
+		int cuf, char **xml, int n, EVP_PKEY *key, X509 *cert,
+		char **responses){
+	CURLM *multi;
+	CURLMsg *m;
+	CURL **ch;
+	char **soap;
+	int i, ativos, restantes, ok = 0;
+	struct curl_slist *header = NULL;
+	SSL_KEY ssl_key = {
+		.key = key,
+		.cert = cert
+	};
+
+	ch = calloc(n, sizeof(CURL*));
+	soap = calloc(n, sizeof(char*));
+	if(ch == NULL || soap == NULL){
+		free(ch);
+		free(soap);
+		return -1;
+	}
+	curl_global_init(CURL_GLOBAL_ALL);
+	multi = curl_multi_init();
+	/* a SEFAZ recusa quem abre conexões demais (cStat 656) */
+	curl_multi_setopt(multi, CURLMOPT_MAX_TOTAL_CONNECTIONS,
+		(long)SEFAZ_CONEXOES);
+	header = curl_slist_append(header,
+		"Content-type: application/soap+xml; charset=UTF-8");
+	for(i = 0; i < n; i++){
+		responses[i] = NULL;
+		soap[i] = format_soap(service, xml[i], cuf,
+			SEFAZ_WSDL[service]);
+		if(soap[i] == NULL)
+			continue;
+		ch[i] = sefaz_handle(URL, soap[i], header, &ssl_key,
+			&responses[i]);
+		if(ch[i] != NULL)
+			curl_multi_add_handle(multi, ch[i]);
+	}
+
+	do{
+		if(curl_multi_perform(multi, &ativos) != CURLM_OK)
+			break;
+		if(ativos)
+			curl_multi_wait(multi, NULL, 0, 1000, NULL);
+	} while(ativos);
+
+	while((m = curl_multi_info_read(multi, &restantes)) != NULL){
+		if(m->msg != CURLMSG_DONE)
+			continue;
+		for(i = 0; i < n && ch[i] != m->easy_handle; i++);
+		if(i == n)
+			continue;
+		if(m->data.result == CURLE_OK && responses[i] != NULL){
+			ok++;
+		} else {
+			free(responses[i]);
+			responses[i] = NULL;
+		}
+	}
+
+	for(i = 0; i < n; i++){
+		if(ch[i] != NULL){
+			curl_multi_remove_handle(multi, ch[i]);
+			curl_easy_cleanup(ch[i]);
+		}
+		free(soap[i]);
+	}
+	free(ch);
+	free(soap);
+	curl_multi_cleanup(multi);
+	curl_slist_free_all(header);
+	curl_global_cleanup();
+	return ok;
+}
@@ -24,10 +24,22 @@
 #include <openssl/evp.h>
 #include <openssl/x509.h>
 
+/* parallel connections to SEFAZ in send_sefaz_varios() */
+#define SEFAZ_CONEXOES	4
+
 /**
  * Send request to SEFAZ
  */
 extern char *send_sefaz(sefaz_servico_t service, char *URL, int ambiente, 
 		int cuf, char *xml, EVP_PKEY *, X509 *);
 
+/**
+ * Send several requests to the same SEFAZ service at once, over up to
+ * SEFAZ_CONEXOES connections, and wait for all of them. Returns how many
+ * got an answer; responses[i] is NULL for the others
+ */
+extern int send_sefaz_varios(sefaz_servico_t service, char *URL,
+		int ambiente, int cuf, char **xml, int n, EVP_PKEY *, X509 *,
+		char **responses);
+
 #endif
@@ -19,70 +19,164 @@
 
 #include <pitangus/sped.h>
 #include <pitangus/libsped.h>
+#include <pitangus/geo.h>
 #include <pitangus/utils.h>
 #define _XOPEN_SOURCE
 #include <time.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
-/*
- * Funcao para instanciar struct pais_t
- * */
-static
-PAIS *new_pais(){
-	PAIS *p = malloc(sizeof(PAIS));
-	PAIS m = {
-		.cPais = 1058,
-		.xPais = "BRASIL"
-	};
-	memcpy(p, &m, sizeof(PAIS));
+#define ARENA_BLOCO_PADRAO 16384
+#define ARENA_ALINHAMENTO _Alignof(max_align_t)
+
+struct arena_bloco {
+	struct arena_bloco *next;
+	size_t usado;
+	size_t tamanho;
+	_Alignas(max_align_t) unsigned char dados[];
+};
+
+struct ARENA {
+	struct arena_bloco *blocos;
+	size_t tamanho_bloco;
+};
+
+static struct arena_bloco *new_arena_bloco(size_t tamanho){
+	struct arena_bloco *b = malloc(sizeof(struct arena_bloco) + tamanho);
+	if(b == NULL){
+		return NULL;
+	}
+	b->next = NULL;
+	b->usado = 0;
+	b->tamanho = tamanho;
+	return b;
+}
+
+ARENA *new_arena(size_t tamanho_bloco){
+	ARENA *a = malloc(sizeof(ARENA));
+	if(a == NULL){
+		return NULL;
+	}
+	a->blocos = NULL;
+	a->tamanho_bloco = tamanho_bloco? tamanho_bloco : ARENA_BLOCO_PADRAO;
+	return a;
+}
+
+void *arena_alloc(ARENA *a, size_t tamanho){
+	struct arena_bloco *b;
+	void *p;
+	tamanho = (tamanho + ARENA_ALINHAMENTO - 1) & ~(ARENA_ALINHAMENTO - 1);
+	b = a->blocos;
+	if(b == NULL || b->tamanho - b->usado < tamanho){
+		/* Blocos grandes ficam atrás do atual, que continua em uso */
+		if(b != NULL && tamanho > a->tamanho_bloco / 4){
+			struct arena_bloco *g = new_arena_bloco(tamanho);
+			if(g == NULL){
+				return NULL;
+			}
+			g->usado = tamanho;
+			g->next = b->next;
+			b->next = g;
+			return g->dados;
+		}
+		b = new_arena_bloco(tamanho > a->tamanho_bloco?
+			tamanho : a->tamanho_bloco);
+		if(b == NULL){
+			return NULL;
+		}
+		b->next = a->blocos;
+		a->blocos = b;
+	}
+	p = b->dados + b->usado;
+	b->usado += tamanho;
 	return p;
 }
 
+char *arena_strdup(ARENA *a, const char *s){
+	size_t len;
+	char *p;
+	if(s == NULL){
+		return NULL;
+	}
+	len = strlen(s) + 1;
+	if((p = arena_alloc(a, len)) != NULL){
+		memcpy(p, s, len);
+	}
+	return p;
+}
+
+int arena_owns(ARENA *a, const void *p){
+	struct arena_bloco *b;
+	const unsigned char *c = p;
+	if(a == NULL || p == NULL){
+		return 0;
+	}
+	for(b = a->blocos; b != NULL; b = b->next){
+		if(c >= b->dados && c < b->dados + b->tamanho){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void free_arena(ARENA *a){
+	struct arena_bloco *b, *next;
+	if(a == NULL){
+		return;
+	}
+	for(b = a->blocos; b != NULL; b = next){
+		next = b->next;
+		free(b);
+	}
+	free(a);
+}
+
 /*
- * Funcao para instanciar struct uf_t
+ * Aloca na arena quando houver, senão no heap
  * */
-UF *new_uf(){
-	UF *p = malloc(sizeof(UF));
-	UF m = {
-		.cUF = 0,
-		.pais = new_pais()
-	};
-	memcpy(p, &m, sizeof(UF));
-	return p;
+static void *sped_alloc(ARENA *a, size_t tamanho){
+	return a? arena_alloc(a, tamanho) : malloc(tamanho);
+}
+
+static char *sped_strdup(ARENA *a, const char *s){
+	if(s == NULL){
+		return NULL;
+	}
+	return a? arena_strdup(a, s) : strdup(s);
 }
 
 /*
- * Funcao para instanciar struct municipio_t
- **/
-MUNICIPIO *new_municipio(){
-	MUNICIPIO *p = malloc(sizeof(MUNICIPIO));
-	MUNICIPIO m = {
-		.cMun = 0,
-		.uf = new_uf()
-	};
-	memcpy(p, &m, sizeof(MUNICIPIO));
-	return p;
+ * Libera somente o que veio do heap; o que está numa arena vai com ela
+ * */
+static void sped_free(ARENA *a, const void *p){
+	if(a == NULL){
+		free((void*)p);
+	}
 }
 
 /*
  *Funcao para instanciar struct endereco_t
  **/
-ENDERECO *new_endereco(){
-	ENDERECO *p = malloc(sizeof(ENDERECO));
+static ENDERECO *new_endereco_a(ARENA *a){
+	ENDERECO *p = sped_alloc(a, sizeof(ENDERECO));
 	ENDERECO m = {
 		.CEP = 0,
-		.municipio = new_municipio()
+		.municipio = &geo_municipio_nenhum
 	};
 	memcpy(p, &m, sizeof(ENDERECO));
 	return p;
 }
 
-static IDNFE *new_idnfe(){
+ENDERECO *new_endereco(){
+	return new_endereco_a(NULL);
+}
+
+static IDNFE *new_idnfe_a(ARENA *a){
 	IDNFE i = {
-		.municipio = new_municipio(),
-		.dh_saida = malloc(sizeof(time_t)),
+		.municipio = &geo_municipio_nenhum,
+		.dh_saida = sped_alloc(a, sizeof(time_t)),
 		.cod_nfe = rand() % 99999999,
 		.tipo_emissao = EMISSAO_NORMAL,
 		.local_destino = OPERACAO_INTERNA,
@@ -91,100 +185,99 @@ static IDNFE *new_idnfe(){
 		.finalidade = NFe_NORMAL,
 		.consumidor_final = CONSUMIDOR_FINAL
 	};
-	IDNFE *p = malloc(sizeof(IDNFE));
+	IDNFE *p = sped_alloc(a, sizeof(IDNFE));
 	memcpy(p, &i, sizeof(IDNFE));
 	return p;
 }
 
-EMITENTE *new_emitente(){
+static EMITENTE *new_emitente_a(ARENA *a){
 	EMITENTE e = {
-		.endereco = new_endereco()
+		.endereco = new_endereco_a(a)
 	};
-	EMITENTE *p = malloc(sizeof(EMITENTE));
+	EMITENTE *p = sped_alloc(a, sizeof(EMITENTE));
 	memcpy(p, &e, sizeof(EMITENTE));
 	return p;
 }
 
-DESTINATARIO *new_destinatario(){
+EMITENTE *new_emitente(){
+	return new_emitente_a(NULL);
+}
+
+static DESTINATARIO *new_destinatario_a(ARENA *a){
 	DESTINATARIO d = {
-		.endereco = new_endereco()
+		.endereco = new_endereco_a(a)
 	};
-	DESTINATARIO *p = malloc(sizeof(DESTINATARIO));
+	DESTINATARIO *p = sped_alloc(a, sizeof(DESTINATARIO));
 	memcpy(p, &d, sizeof(DESTINATARIO));
 	return p;
 }
 
-static PRODUTO *new_produto(){
+DESTINATARIO *new_destinatario(){
+	return new_destinatario_a(NULL);
+}
+
+static PRODUTO *new_produto_a(ARENA *a){
 	PRODUTO m = {
 		.id = 0
 	};
-	PRODUTO *p = malloc(sizeof(PRODUTO));
+	PRODUTO *p = sped_alloc(a, sizeof(PRODUTO));
 	memcpy(p, &m, sizeof(PRODUTO));
 	return p;
 }
 
-static ICMS *new_icms(){
+static ICMS *new_icms_a(ARENA *a){
 	ICMS m = {
 		.valor = 0
 	};
-	ICMS *p = malloc(sizeof(ICMS));
+	ICMS *p = sped_alloc(a, sizeof(ICMS));
 	memcpy(p, &m, sizeof(ICMS));
 	return p;
 }
 
-static PIS *new_pis(){
+static PIS *new_pis_a(ARENA *a){
 	PIS m = {
 		.quantidade = 0
 	};
-	PIS *p = malloc(sizeof(PIS));
+	PIS *p = sped_alloc(a, sizeof(PIS));
 	memcpy(p, &m, sizeof(PIS));
 	return p;
 }
 
-static COFINS *new_cofins(){
+static COFINS *new_cofins_a(ARENA *a){
 	COFINS m = {
 		.quantidade = 0
 	};
-	COFINS *p = malloc(sizeof(COFINS));
+	COFINS *p = sped_alloc(a, sizeof(COFINS));
 	memcpy(p, &m, sizeof(COFINS));
 	return p;
 }
 
-static IPI *new_ipi(){
+static IPI *new_ipi_a(ARENA *a){
 	IPI m = {
 		.codigo = 0
 	};
-	IPI *p = malloc(sizeof(IPI));
+	IPI *p = sped_alloc(a, sizeof(IPI));
 	memcpy(p, &m, sizeof(IPI));
 	return p;
 }
 
-static IMPOSTO *new_imposto(){
+static IMPOSTO *new_imposto_a(ARENA *a){
 	IMPOSTO m = {
-		.icms = new_icms(),
-		.pis = new_pis(),
-		.cofins = new_cofins(),
-		.ipi= new_ipi()
+		.icms = new_icms_a(a),
+		.pis = new_pis_a(a),
+		.cofins = new_cofins_a(a),
+		.ipi= new_ipi_a(a)
 	};
-	IMPOSTO *p = malloc(sizeof(IMPOSTO));
+	IMPOSTO *p = sped_alloc(a, sizeof(IMPOSTO));
 	memcpy(p, &m, sizeof(IMPOSTO));
 	return p;
 }
 
-static TRANSP *new_transp(){
-	TRANSP m = {
-		.modfrete = 0
-	};
-	TRANSP *p = malloc(sizeof(TRANSP));
-	memcpy(p, &m, sizeof(TRANSP));
-	return p;
-}
-
-static PROTOCOLO *new_protocolo(){
+static PROTOCOLO *new_protocolo_a(ARENA *a){
 	PROTOCOLO m = {
 		.numero = NULL
 	};
-	PROTOCOLO *p = malloc(sizeof(PROTOCOLO));
+	PROTOCOLO *p = sped_alloc(a, sizeof(PROTOCOLO));
 	memcpy(p, &m, sizeof(PROTOCOLO));
 	return p;
 }
@@ -198,28 +291,46 @@ static LOTE_ITEM *new_lote_item(){
 	return l;
 }
 
-ITEM *new_item(){
+static ITEM *new_item_a(ARENA *a){
 	ITEM m = {
-		.produto = new_produto(),
-		.imposto = new_imposto()
+		.produto = new_produto_a(a),
+		.imposto = new_imposto_a(a),
+		.arena = a
 	};
-	ITEM *p = malloc(sizeof(ITEM));
+	ITEM *p = sped_alloc(a, sizeof(ITEM));
 	memcpy(p, &m, sizeof(ITEM));
 	return p;
 }
+
+ITEM *new_item(){
+	return new_item_a(NULL);
+}
+
+ITEM *new_item_arena(ARENA *a){
+	return new_item_a(a);
+}
 		
-NFE *new_nfe(){
+static NFE *new_nfe_a(ARENA *a){
 	NFE n = {
-		.idnfe = new_idnfe(),
-		.emitente = new_emitente(),
-		.destinatario = new_destinatario(),
-		.protocolo = new_protocolo()
+		.idnfe = new_idnfe_a(a),
+		.emitente = new_emitente_a(a),
+		.destinatario = new_destinatario_a(a),
+		.protocolo = new_protocolo_a(a),
+		.arena = a
 	};
-	NFE *p = malloc(sizeof(NFE));
+	NFE *p = sped_alloc(a, sizeof(NFE));
 	memcpy(p, &n, sizeof(NFE));
 	return p;
 }
 
+NFE *new_nfe(){
+	return new_nfe_a(NULL);
+}
+
+NFE *new_nfe_arena(ARENA *a){
+	return new_nfe_a(a);
+}
+
 LOTE *new_lote(int id){
 	LOTE m = {
 		.id = id 
@@ -261,26 +372,63 @@ LOTE_EVENTO *new_lote_evento(int id){
 	return l;
 }
 
-int inst_produto(int id, const char *codigo, const char *desc, unsigned int ncm, 
-		unsigned int cfop, const char *unidade_comercial, double valor, 
-		PRODUTO *p){
+INUTILIZACAO *new_inutilizacao(EMITENTE *e, Mod mod, int serie,
+		unsigned int num_ini, unsigned int num_fim){
+	time_t now;
+	struct tm tm;
+	time(&now);
+	localtime_r(&now, &tm);
+	INUTILIZACAO m = {
+		.emitente = e,
+		.ano = tm.tm_year % 100,
+		.mod = mod,
+		.serie = serie,
+		.num_ini = num_ini,
+		.num_fim = num_fim
+	};
+	INUTILIZACAO *i = malloc(sizeof(INUTILIZACAO));
+	memcpy(i, &m, sizeof(INUTILIZACAO));
+	return i;
+}
+
+void free_inutilizacao(INUTILIZACAO *i){
+	if(i == NULL)
+		return;
+	free((char*)i->id);
+	free((char*)i->xmot);
+	free((char*)i->protocolo);
+	free((char*)i->xml);
+	free((char*)i->xml_response);
+	free(i);
+}
+
+static int inst_produto_a(ARENA *a, int id, const char *codigo,
+		const char *desc, unsigned int ncm, unsigned int cfop,
+		const char *unidade_comercial, double valor, PRODUTO *p){
 	p->id = id;
-	if(desc != NULL){
-		p->codigo = strdup(codigo);
+	if(codigo != NULL){
+		p->codigo = sped_strdup(a, codigo);
 	}
 	if(desc != NULL){
-		p->descricao = strdup(desc);
+		p->descricao = sped_strdup(a, desc);
 	}
 	p->ncm = ncm;
 	p->cfop = cfop;
 	p->unidade_comercial = unidade_comercial;
 	if(unidade_comercial != NULL){
-		p->unidade_comercial = strdup(unidade_comercial);
+		p->unidade_comercial = sped_strdup(a, unidade_comercial);
 	}
 	p->valor = valor;
 	return 0;
 }
 
+int inst_produto(int id, const char *codigo, const char *desc, unsigned int ncm, 
+		unsigned int cfop, const char *unidade_comercial, double valor, 
+		PRODUTO *p){
+	return inst_produto_a(NULL, id, codigo, desc, ncm, cfop,
+		unidade_comercial, valor, p);
+}
+
 int inst_icms(int origem, unsigned int tipo, double aliquota, double valor,
 		ICMS *i){
 	i->origem = origem;
@@ -290,13 +438,18 @@ int inst_icms(int origem, unsigned int tipo, double aliquota, double valor,
 	return 0;
 }
 
-int inst_ipi(int sit_trib, const char *classe, const char *codigo, IPI *i){
+static int inst_ipi_a(ARENA *a, int sit_trib, const char *classe,
+		const char *codigo, IPI *i){
 	i->sit_trib = sit_trib;
-	i->classe = strdup(classe);
-	i->codigo = strdup(codigo);
+	i->classe = sped_strdup(a, classe);
+	i->codigo = sped_strdup(a, codigo);
 	return 0;
 }
 
+int inst_ipi(int sit_trib, const char *classe, const char *codigo, IPI *i){
+	return inst_ipi_a(NULL, sit_trib, classe, codigo, i);
+}
+
 static int inst_imposto(ICMS *i, PIS *p, COFINS *c, IMPOSTO *imp){
 	imp->icms = i;
 	imp->pis = p;
@@ -311,156 +464,231 @@ int inst_item(double valor, double quantidade,
 		double icms_aliquota, double icms_valor, double pis_aliquota,
 		double cofins_aliquota, int ipi_sit_trib, char *ipi_classe,
 		char *ipi_codigo, char *descricao, char *unidade, ITEM *i){
-	inst_produto(id_produto, cod_produto, descricao, ncm, cfop, unidade, 
-		valor, i->produto);
+	inst_produto_a(i->arena, id_produto, cod_produto, descricao, ncm, cfop,
+		unidade, valor, i->produto);
 	inst_icms(icms_origem, icms_tipo, icms_aliquota, icms_valor,i->imposto->icms);
-	inst_ipi(ipi_sit_trib, ipi_classe, ipi_codigo, i->imposto->ipi);
+	inst_ipi_a(i->arena, ipi_sit_trib, ipi_classe, ipi_codigo,
+		i->imposto->ipi);
 	i->ordem = ordem;
 	i->quantidade = quantidade;
 	i->valor = valor;
 	return 0;
 }
 
+/*
+ * Garante espaço para mais um item em nfe->itens e nos vetores
+ * paralelos. Os vetores ficam sempre no heap, mesmo quando a NFE
+ * pertence a uma arena, porque precisam crescer com realloc.
+ * */
+static int reserve_itens(NFE *nfe){
+	unsigned int cap;
+	void *p;
+	if(nfe->q_itens < nfe->cap_itens){
+		return 0;
+	}
+	cap = nfe->cap_itens? nfe->cap_itens * 2 : 16;
+	if((p = realloc(nfe->itens, cap * sizeof(ITEM*))) == NULL)
+		return -1;
+	nfe->itens = p;
+	if((p = realloc(nfe->itens_quantidade, cap * sizeof(double))) == NULL)
+		return -1;
+	nfe->itens_quantidade = p;
+	if((p = realloc(nfe->itens_valor, cap * sizeof(double))) == NULL)
+		return -1;
+	nfe->itens_valor = p;
+	nfe->cap_itens = cap;
+	return 0;
+}
+
+static void set_item_valores(NFE *nfe, unsigned int n, ITEM *item){
+	nfe->itens_quantidade[n] = item->quantidade;
+	nfe->itens_valor[n] = item->valor;
+}
+
+static int find_item(NFE *nfe, ITEM *item){
+	unsigned int n;
+	/* ordem é a posição + 1 enquanto o item estiver na NFE */
+	if(item->ordem >= 1 && item->ordem <= nfe->q_itens &&
+			nfe->itens[item->ordem - 1] == item){
+		return item->ordem - 1;
+	}
+	for(n = 0; n < nfe->q_itens; n++){
+		if(nfe->itens[n] == item)
+			return n;
+	}
+	return -1;
+}
+
+double nfe_total_itens(const NFE *nfe){
+	const double *restrict q = nfe->itens_quantidade;
+	const double *restrict v = nfe->itens_valor;
+	unsigned int n;
+	double total = 0;
+	for(n = 0; n < nfe->q_itens; n++){
+		total += q[n] * v[n];
+	}
+	return total;
+}
+
 int add_item(NFE *nfe, ITEM *item){
-	ITEM *i;
+	if(reserve_itens(nfe)){
+		return -1;
+	}
+	nfe->itens[nfe->q_itens] = item;
+	set_item_valores(nfe, nfe->q_itens, item);
 	nfe->q_itens++;
 	nfe->total += item->valor * item->quantidade;
 	item->ordem = nfe->q_itens;
-	if((i = nfe->itens) == NULL){
-		nfe->itens = item;
-		return 0;
-	}
-	while(i->pointer != NULL){
-		i = i->pointer;
-	}
-	i->pointer = item;
 	return 0;
 }
 
-static void reorder_items(NFE *nfe){
-	ITEM *i = nfe->itens;
-	int n = 1;
-	while(i != NULL){
-		i->ordem = n;
-		n++;
-		i = i->pointer;
+int update_item(NFE *nfe, ITEM *item){
+	int n;
+	if(item == NULL || (n = find_item(nfe, item)) < 0){
+		return 0;
 	}
+	set_item_valores(nfe, n, item);
+	nfe->total = nfe_total_itens(nfe);
+	return 1;
+}
+
+ITEM *get_item(NFE *nfe, unsigned int n){
+	return n < nfe->q_itens? nfe->itens[n] : NULL;
 }
 
 int rm_item(NFE *nfe, ITEM *item){
-	ITEM *i = nfe->itens;
-	if(item == NULL){
+	unsigned int n, resto;
+	int pos;
+	if(item == NULL || (pos = find_item(nfe, item)) < 0){
 		return 0;
 	}
-	if(i == item){
-		nfe->itens = i->pointer;
-		nfe->q_itens--;
-		reorder_items(nfe);
-		return 1;
-	}
-	while(i != NULL){
-		if(i->pointer == item){
-			i->pointer = item->pointer;
-			nfe->q_itens--;
-			reorder_items(nfe);
-			return 1;
-		}
-		i = i->pointer;
+	n = pos;
+	resto = nfe->q_itens - n - 1;
+	memmove(nfe->itens + n, nfe->itens + n + 1, resto * sizeof(ITEM*));
+	memmove(nfe->itens_quantidade + n, nfe->itens_quantidade + n + 1,
+		resto * sizeof(double));
+	memmove(nfe->itens_valor + n, nfe->itens_valor + n + 1,
+		resto * sizeof(double));
+	nfe->q_itens--;
+	for(; n < nfe->q_itens; n++){
+		nfe->itens[n]->ordem = n + 1;
 	}
-	return 0;
+	nfe->total = nfe_total_itens(nfe);
+	return 1;
 }
 
 int add_nfe(LOTE *lote, NFE *nfe){
 	LOTE_ITEM *i = new_lote_item();
-	LOTE_ITEM *aux;
 	i->nfe = nfe;
+	i->next = NULL;
 	lote->qtd++;
-	if((aux = lote->nfes) == NULL){
-		lote->nfes= i;
-		return 0;
+	if(lote->ultimo == NULL){
+		lote->nfes = i;
+	} else {
+		lote->ultimo->next = i;
 	}
-	while(aux->next != NULL){
-		aux = aux->next;
-	}
-	aux->next = i;
+	lote->ultimo = i;
 	return 0;
 }
 
 int add_evento(LOTE_EVENTO *lote, EVENTO *e){
 	LOTE_EVENTO_ITEM *i = new_lote_evento_item();
-	LOTE_EVENTO_ITEM *aux;
 	i->evento = e;
+	i->next = NULL;
 	lote->qtd++;
 	i->evento->seq = lote->qtd;
-	if((aux = lote->eventos) == NULL){
+	if(lote->ultimo == NULL){
 		lote->eventos = i;
-		return 0;
+	} else {
+		lote->ultimo->next = i;
 	}
-	while(aux->next != NULL){
-		aux = aux->next;
-	}
-	aux->next = i;
+	lote->ultimo = i;
 	return 0;
 }
 
-static char get_dv(char *base){
-	int i, j, div, sum = 0;
-	int m[8] = {2,3,4,5,6,7,8,9};
-	char *baserev = strrev(base);
-	for(i = 0, j = 8; i < strlen(baserev); i++, j++){
-		sum += (baserev[i] - '0') * m[j%8];
-	}
-	div = 11 - (sum % 11);
-	div = (div > 9)? 0 : div;
-	free(baserev);
-	return (div + '0');
-}
-
-void set_chave(NFE *nfe){
-	char *base = malloc(sizeof(char) * 60);
-	sprintf(base, "%02d%s%s%02d%03d%09d%d%08d",
-		nfe->idnfe->municipio->uf->cUF,
-		timef(nfe->idnfe->dh_emis, "%y%m", 4),
-		nfe->emitente->cnpj,
-		nfe->idnfe->mod,
-		nfe->idnfe->serie,
-		nfe->idnfe->num_nf,
-		nfe->idnfe->tipo_emissao,
-		nfe->idnfe->cod_nfe);
-	nfe->idnfe->div = get_dv(base);
-	nfe->idnfe->chave = malloc(sizeof(char) * (strlen(base) + 2));
-	sprintf(nfe->idnfe->chave, "%s%c", base , nfe->idnfe->div);
-}
-
-static int inst_pais(const char *xPais, 
-		unsigned int cPais, 
-		PAIS *p){
-	p->xPais = xPais;
-	p->cPais = cPais;
+char chave_dv(const char *base){
+	int i, soma = 0, peso = 4, dv;
+	/* pesos 2..9 da direita para a esquerda, em uma única passada:
+	 * o primeiro dos 43 dígitos recebe peso 4 */
+	for(i = 0; i < CHAVE_LEN - 1; i++){
+		if(base[i] < '0' || base[i] > '9')
+			return '\0';
+		soma += (base[i] - '0') * peso;
+		peso = peso == 2? 9 : peso - 1;
+	}
+	dv = 11 - (soma % 11);
+	return (dv > 9? 0 : dv) + '0';
+}
+
+int gen_chave(char *chave, unsigned int cuf, time_t dh_emis,
+		const char *cnpj, int mod, int serie, int num_nf,
+		int tipo_emissao, int cod_nfe){
+	struct tm tm_info;
+	int n;
+	if(cnpj == NULL || strlen(cnpj) != 14)
+		return -1;
+	localtime_r(&dh_emis, &tm_info);
+	n = snprintf(chave, CHAVE_LEN + 1, "%02u%02d%02d%s%02d%03d%09d%d%08d",
+		cuf, tm_info.tm_year % 100, tm_info.tm_mon + 1, cnpj, mod,
+		serie, num_nf, tipo_emissao, cod_nfe);
+	if(n != CHAVE_LEN - 1)
+		return -1;
+	if((chave[CHAVE_LEN - 1] = chave_dv(chave)) == '\0')
+		return -1;
+	chave[CHAVE_LEN] = '\0';
 	return 0;
 }
 
-static int inst_uf(const char *xUF, 
-		unsigned int cUF, 
-		const char *xPais, 
-		unsigned int cPais, 
-		UF *u){
-	u->xUF = xUF;
-	u->cUF = cUF;
-	inst_pais(xPais, cPais, u->pais);
-	return 0;
+static int gen_chave_nfe(const NFE *nfe, char *chave){
+	return gen_chave(chave, nfe->idnfe->municipio->uf->cUF,
+		nfe->idnfe->dh_emis, nfe->emitente->cnpj, nfe->idnfe->mod,
+		nfe->idnfe->serie, nfe->idnfe->num_nf,
+		nfe->idnfe->tipo_emissao, nfe->idnfe->cod_nfe);
+}
+
+size_t gen_chaves(NFE *const *nfes, size_t qtd, char *chaves){
+	size_t i, geradas = 0;
+	for(i = 0; i < qtd; i++){
+		char *c = chaves + i * (CHAVE_LEN + 1);
+		if(gen_chave_nfe(nfes[i], c) == 0){
+			geradas++;
+		} else {
+			c[0] = '\0';
+		}
+	}
+	return geradas;
 }
 
-int inst_municipio(const char *xMun, 
-		unsigned int cMun, 
-		const char *xUF, 
-		unsigned int cUF, 
-		const char *xPais, 
-		unsigned int cPais, 
-		MUNICIPIO *m){
-	m->xMun = xMun;
-	m->cMun = cMun;
-	inst_uf(xUF, cUF, xPais, cPais, m->uf);
+int validar_chave(const char *chave){
+	char dv;
+	if(chave == NULL)
+		return 0;
+	dv = chave_dv(chave);
+	return dv != '\0' && chave[CHAVE_LEN - 1] == dv &&
+		chave[CHAVE_LEN] == '\0';
+}
+
+size_t validar_chaves(const char *const *chaves, size_t qtd, int *resultados){
+	size_t i, validas = 0;
+	for(i = 0; i < qtd; i++){
+		int ok = validar_chave(chaves[i]);
+		if(resultados != NULL)
+			resultados[i] = ok;
+		validas += ok;
+	}
+	return validas;
+}
+
+int set_chave(NFE *nfe){
+	char chave[CHAVE_LEN + 1];
+	sped_free(nfe->arena, nfe->idnfe->chave);
+	nfe->idnfe->chave = NULL;
+	/* sem chave, e não com a de antes, se algum campo não fecha */
+	if(gen_chave_nfe(nfe, chave)){
+		return -1;
+	}
+	nfe->idnfe->div = chave[CHAVE_LEN - 1];
+	nfe->idnfe->chave = sped_strdup(nfe->arena, chave);
 	return 0;
 }
 
@@ -469,19 +697,14 @@ int inst_endereco(const char *rua,
 		const char *complemento, 
 		const char *bairro, 
 		unsigned int cep, 
-		const char *xMun,
 		unsigned int cMun,
-		const char *xUF,
-		unsigned int cUF,
-		const char *xPais,
-		unsigned int cPais,
 		ENDERECO *e){
 	e->xLgr = rua;
 	e->nro = num;
 	e->Cpl = complemento;
 	e->xBairro = bairro;
 	e->CEP = cep;
-	inst_municipio(xMun, cMun, xUF, cUF, xPais, cPais, e->municipio);
+	e->municipio = geo_municipio_ou_nenhum(cMun);
 	return 0 ;
 }
 
@@ -542,7 +765,7 @@ int inst_nfe(unsigned int id_nfe,
 		PROTOCOLO *protocolo,
 		EMITENTE *emitente,
 		DESTINATARIO *destinatario,
-		MUNICIPIO *municipio, 
+		const MUNICIPIO *municipio, 
 		NFE *nfe){
 	IDNFE *idnfe = nfe->idnfe;
 	idnfe->id_nfe = id_nfe;
@@ -571,37 +794,171 @@ int inst_nfe(unsigned int id_nfe,
 	nfe->protocolo = protocolo;
 
 	if(!protocolo){
-		nfe->protocolo = new_protocolo();
+		nfe->protocolo = new_protocolo_a(nfe->arena);
 	}
 
   set_chave(nfe);
   return 0;
 }
 
-static void free_pais(PAIS *e){
-	free(e);
+/*
+ * Fora de uma arena cada objeto é dono das suas strings
+ * */
+static void free_endereco_a(ARENA *a, ENDERECO *e){
+	if(e == NULL){
+		return;
+	}
+	sped_free(a, e->xLgr);
+	sped_free(a, e->Cpl);
+	sped_free(a, e->xBairro);
+	sped_free(a, e);
 }
 
-static void free_uf(UF *e){
-	free_pais(e->pais);
-	free(e);
+static void free_emitente_a(ARENA *a, EMITENTE *e){
+	if(e == NULL){
+		return;
+	}
+	free_endereco_a(a, e->endereco);
+	sped_free(a, e->nome);
+	sped_free(a, e->inscricao_estadual);
+	sped_free(a, e->cnpj);
+	sped_free(a, e);
 }
 
-static void free_municipio(MUNICIPIO *e){
-	free_uf(e->uf);
-	free(e);
+static void free_destinatario_a(ARENA *a, DESTINATARIO *d){
+	if(d == NULL){
+		return;
+	}
+	free_endereco_a(a, d->endereco);
+	sped_free(a, d->nome);
+	sped_free(a, d->cnpj);
+	sped_free(a, d->tipo_doc);
+	sped_free(a, d->inscricao_estadual);
+	sped_free(a, d);
 }
+
+static void free_protocolo_a(ARENA *a, PROTOCOLO *p){
+	if(p == NULL){
+		return;
+	}
+	sped_free(a, p->dh_recib);
+	sped_free(a, p->numero);
+	sped_free(a, p->xml);
+	sped_free(a, p->xmot);
+	sped_free(a, p);
+}
+
 void free_endereco(ENDERECO *e){
-	free(e->municipio);
-	free(e);
+	free_endereco_a(NULL, e);
 }
 
 void free_emitente(EMITENTE *e){
-	free_endereco(e->endereco);
-	free(e);
+	free_emitente_a(NULL, e);
 }
 
 void free_destinatario(DESTINATARIO *d){
-	free_endereco(d->endereco);
-	free(d);
+	free_destinatario_a(NULL, d);
+}
+
+static void free_item_a(ARENA *a, ITEM *i){
+	if(i->produto != NULL){
+		sped_free(a, i->produto->codigo);
+		sped_free(a, i->produto->descricao);
+		sped_free(a, i->produto->unidade_comercial);
+		sped_free(a, i->produto);
+	}
+	if(i->imposto != NULL){
+		sped_free(a, i->imposto->icms);
+		sped_free(a, i->imposto->pis);
+		sped_free(a, i->imposto->cofins);
+		if(i->imposto->ipi != NULL){
+			sped_free(a, i->imposto->ipi->classe);
+			sped_free(a, i->imposto->ipi->codigo);
+			sped_free(a, i->imposto->ipi);
+		}
+		sped_free(a, i->imposto);
+	}
+	sped_free(a, i);
+}
+
+void free_item(ITEM *i){
+	if(i == NULL){
+		return;
+	}
+	/* Itens de uma arena ficam nela até free_arena() */
+	if(i->arena != NULL){
+		return;
+	}
+	free_item_a(NULL, i);
+}
+
+void free_nfe(NFE *nfe){
+	ARENA *a;
+	unsigned int n;
+	if(nfe == NULL){
+		return;
+	}
+	a = nfe->arena;
+	for(n = 0; n < nfe->q_itens; n++){
+		if(nfe->itens[n]->arena != a){
+			free_item(nfe->itens[n]);
+		}
+	}
+	free(nfe->itens);
+	free(nfe->itens_quantidade);
+	free(nfe->itens_valor);
+	if(a != NULL){
+		/* O resto do grafo está na arena: um free por bloco */
+		free_arena(a);
+		return;
+	}
+	if(nfe->idnfe != NULL){
+		sped_free(a, nfe->idnfe->nat_op);
+		sped_free(a, nfe->idnfe->versao);
+		sped_free(a, nfe->idnfe->chave);
+		sped_free(a, nfe->idnfe->dh_saida);
+		sped_free(a, nfe->idnfe);
+	}
+	free_emitente_a(a, nfe->emitente);
+	free_destinatario_a(a, nfe->destinatario);
+	sped_free(a, nfe->transp);
+	free_protocolo_a(a, nfe->protocolo);
+	sped_free(a, nfe->xml);
+	sped_free(a, nfe->inf_ad_fisco);
+	sped_free(a, nfe->inf_ad_contrib);
+	free(nfe);
+}
+
+char *nfe_strdup(NFE *nfe, const char *s){
+	return sped_strdup(nfe->arena, s);
+}
+
+void nfe_set_str(NFE *nfe, const char **campo, const char *s){
+	const char *ant = *campo;
+	/* copia antes de liberar: s pode ser o próprio *campo */
+	*campo = sped_strdup(nfe->arena, s);
+	sped_free(nfe->arena, ant);
+}
+
+int nfe_set_destinatario(NFE *nfe, const DESTINATARIO *d){
+	ARENA *a = nfe->arena;
+	DESTINATARIO *n = new_destinatario_a(a);
+	ENDERECO *e;
+	if(n == NULL || (e = n->endereco) == NULL){
+		free_destinatario_a(a, n);
+		return -1;
+	}
+	*e = *d->endereco;
+	e->xLgr = sped_strdup(a, e->xLgr);
+	e->Cpl = sped_strdup(a, e->Cpl);
+	e->xBairro = sped_strdup(a, e->xBairro);
+	*n = *d;
+	n->endereco = e;
+	n->nome = sped_strdup(a, d->nome);
+	n->cnpj = sped_strdup(a, d->cnpj);
+	n->tipo_doc = sped_strdup(a, d->tipo_doc);
+	n->inscricao_estadual = sped_strdup(a, d->inscricao_estadual);
+	free_destinatario_a(a, nfe->destinatario);
+	nfe->destinatario = n;
+	return 0;
 }
@@ -20,6 +20,8 @@
 #include "tool_db.h"
 #include <pitangus/errno.h>
 #include <sqlite3.h>
+#include <assert.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -27,45 +29,552 @@
 const char *db_file = NULL;
 sqlite3 *db;
 
+/* uma conexão e as statements preparadas nela */
+struct db_conn {
+	sqlite3 *db;
+	sqlite3_stmt *cache[DB_STMT_N];
+	int refs;
+	/* db_arquivos_geracao dos arquivos anexados; 0 é nenhum ainda */
+	int arquivos;
+};
+
+/* escritor único: db_writer.db == db */
+static struct db_conn db_writer;
+static pthread_mutex_t db_writer_mutex;
+static pthread_once_t db_writer_once = PTHREAD_ONCE_INIT;
+/* só a thread dona do lock do escritor tem profundidade > 0 */
+static __thread int db_tx_depth = 0;
+
+/* leitores: cada thread usa um só enquanto tiver statements abertas */
+static struct db_conn db_readers[DB_READERS];
+static pthread_mutex_t db_readers_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t db_readers_cond = PTHREAD_COND_INITIALIZER;
+static __thread struct db_conn *db_reader = NULL;
+/* > 0 enquanto db_open()/db_close() esperam os leitores voltarem; nenhum
+ * sai do pool nesse meio tempo */
+static int db_readers_fechando = 0;
+
+/* muda a cada ano arquivado; os leitores anexam de novo no próximo uso */
+static int db_arquivos_geracao = 1;
+
+/* Tabelas que os leitores leem também dos arquivos anuais: uma view temp
+ * com o mesmo nome esconde a de main e junta as de todos os arquivos, e
+ * as consultas não mudam. As de busca são fts5 e também expõem rowid e a
+ * coluna oculta com o nome da tabela, usada no MATCH */
+static const struct {
+	const char *nome;
+	int fts;
+} db_arquivadas[] = {
+	{"nfe", 0},
+	{"nfe_itens", 0},
+	{"xml_blobs", 0},
+	{"busca_nfe", 1},
+	{"busca_itens", 1}
+};
+
+/* statements que só leem e podem ir para um leitor */
+static const char db_stmt_leitura[DB_STMT_N] = {
+	[DB_STMT_COUNT_NFE] = 1,
+	[DB_STMT_COUNT_NFE_BUSCA] = 1,
+	[DB_STMT_NFE_PAGE_ID_DESC] = 1,
+	[DB_STMT_NFE_PAGE_ID_ASC] = 1,
+	[DB_STMT_NFE_PAGE_EMISSAO_DESC] = 1,
+	[DB_STMT_NFE_PAGE_EMISSAO_ASC] = 1,
+	[DB_STMT_NFE_PAGE_NUMERO_DESC] = 1,
+	[DB_STMT_NFE_PAGE_NUMERO_ASC] = 1,
+	[DB_STMT_NFE_BUSCA_ID_DESC] = 1,
+	[DB_STMT_NFE_BUSCA_ID_ASC] = 1,
+	[DB_STMT_NFE_BUSCA_EMISSAO_DESC] = 1,
+	[DB_STMT_NFE_BUSCA_EMISSAO_ASC] = 1,
+	[DB_STMT_NFE_BUSCA_NUMERO_DESC] = 1,
+	[DB_STMT_NFE_BUSCA_NUMERO_ASC] = 1,
+	[DB_STMT_LIST_UF] = 1,
+	[DB_STMT_LIST_MUNICIPIOS] = 1,
+	[DB_STMT_GET_NFE] = 1,
+	[DB_STMT_GET_NFE_XML] = 1,
+	[DB_STMT_GET_ITENS] = 1,
+	[DB_STMT_GET_EMITENTE] = 1,
+	[DB_STMT_GET_DESTINATARIO_DOC] = 1,
+	[DB_STMT_NEXT_NFE_NUMBER] = 1,
+	[DB_STMT_LIST_LACUNAS] = 1,
+	[DB_STMT_LIST_FAIXAS] = 1,
+	[DB_STMT_GET_WS_URL] = 1,
+	[DB_STMT_GET_URL_ID] = 1,
+	[DB_STMT_LIST_URLS] = 1,
+	[DB_STMT_GET_PREFS] = 1,
+	[DB_STMT_GET_XML_BLOB] = 1,
+	[DB_STMT_GET_XML_DICIONARIO] = 1
+};
+
+static void db_writer_mutex_init(void){
+	pthread_mutexattr_t attr;
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&db_writer_mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+}
+
+static void db_writer_lock(){
+	pthread_once(&db_writer_once, db_writer_mutex_init);
+	pthread_mutex_lock(&db_writer_mutex);
+}
+
+static void db_writer_unlock(){
+	pthread_mutex_unlock(&db_writer_mutex);
+}
+
+static void db_conn_close(struct db_conn *c){
+	int i;
+
+	for(i = 0; i < DB_STMT_N; i++){
+		sqlite3_finalize(c->cache[i]);
+		c->cache[i] = NULL;
+	}
+	sqlite3_close_v2(c->db);
+	c->db = NULL;
+	c->refs = 0;
+	c->arquivos = 0;
+}
+
+static int db_pragmas(sqlite3 *d, int writer){
+	char *err = NULL;
+	int rc;
+
+	sqlite3_busy_timeout(d, DB_BUSY_TIMEOUT);
+	rc = sqlite3_exec(d, writer?
+		"PRAGMA journal_mode = WAL;\
+		PRAGMA synchronous = NORMAL;\
+		PRAGMA mmap_size = " DB_MMAP_SIZE ";\
+		PRAGMA cache_size = " DB_CACHE_SIZE ";" :
+		"PRAGMA mmap_size = " DB_MMAP_SIZE ";\
+		PRAGMA cache_size = " DB_CACHE_SIZE ";\
+		PRAGMA query_only = 1;", NULL, NULL, &err);
+	if(rc != SQLITE_OK){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		sqlite3_free(err);
+		return -ESQL;
+	}
+	return 0;
+}
+
+/*
+ * Tira os leitores de uso antes de fechá-los: espera cada um voltar ao
+ * pool, com db_readers_mutex, e segura os próximos até
+ * db_readers_liberar(). A thread não pode ter um leitor seu
+ */
+static int db_readers_esperar(){
+	int i;
+
+	if(db_reader)
+		return -ESQL;
+	pthread_mutex_lock(&db_readers_mutex);
+	db_readers_fechando++;
+	for(i = 0; i < DB_READERS; i++){
+		while(db_readers[i].refs > 0)
+			pthread_cond_wait(&db_readers_cond, &db_readers_mutex);
+	}
+	pthread_mutex_unlock(&db_readers_mutex);
+	return 0;
+}
+
+/* fecha os leitores, já fora de uso, e devolve o pool; com os dois locks */
+static void db_readers_liberar(){
+	int i;
+
+	for(i = 0; i < DB_READERS; i++)
+		if(db_readers[i].db)
+			db_conn_close(&db_readers[i]);
+	db_readers_fechando--;
+	pthread_cond_broadcast(&db_readers_cond);
+}
+
+int db_open(const char *path){
+	sqlite3 *d;
+
+	if(sqlite3_open_v2(path, &d, SQLITE_OPEN_READWRITE |
+			SQLITE_OPEN_CREATE, NULL) != SQLITE_OK){
+		sqlite3_close(d);
+		return -ESQL;
+	}
+	if(db_pragmas(d, 1) || db_readers_esperar()){
+		sqlite3_close(d);
+		return -ESQL;
+	}
+	db_writer_lock();
+	pthread_mutex_lock(&db_readers_mutex);
+	/* statements preparadas pertencem às conexões anteriores; os
+	 * leitores abrem de novo sob demanda */
+	db_readers_liberar();
+	if(db_writer.db)
+		db_conn_close(&db_writer);
+	db_writer.db = db = d;
+	db_file = path;
+	pthread_mutex_unlock(&db_readers_mutex);
+	db_writer_unlock();
+	return 0;
+}
+
+/* colunas de main.tabela como lidas de schema, NULL nas que ele não tem
+ * por ser de uma versão anterior */
+static char *db_colunas(sqlite3 *d, const char *tabela, const char *schema){
+	sqlite3_stmt *stmt;
+	char *colunas = NULL;
+
+	if(sqlite3_prepare_v2(d, "SELECT group_concat(coluna, ', ') FROM (\
+			SELECT CASE WHEN a.name IS NULL THEN 'NULL'\
+				ELSE printf('\"%w\"', a.name) END AS coluna\
+			FROM pragma_table_info(?1, 'main') m\
+			LEFT JOIN pragma_table_info(?1, ?2) a ON a.name = m.name\
+			ORDER BY m.cid);", -1, &stmt, NULL) != SQLITE_OK)
+		return NULL;
+	sqlite3_bind_text(stmt, 1, tabela, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 2, schema, -1, SQLITE_STATIC);
+	if(sqlite3_step(stmt) == SQLITE_ROW &&
+			sqlite3_column_type(stmt, 0) != SQLITE_NULL)
+		colunas = sqlite3_mprintf("%s", sqlite3_column_text(stmt, 0));
+	sqlite3_finalize(stmt);
+	return colunas;
+}
+
+/*
+ * Anexa ao leitor os arquivos de main.arquivos como a<ano> e troca as
+ * tabelas de db_arquivadas por views sobre main e eles. As statements
+ * guardadas são descartadas, pois foram preparadas com os nomes antigos.
+ * Um arquivo que não abre fica de fora, com aviso; mais arquivos do que
+ * o SQLite deixa anexar é erro, para a lista não sair faltando anos
+ */
+static int db_conn_anexar(struct db_conn *c){
+	sqlite3_stmt *stmt;
+	sqlite3_str *sql;
+	struct { int ano; char *caminho; } *arq = NULL, *novo;
+	char *err = NULL, *colunas, *s;
+	int n = 0, i, j, rc;
+	const int n_tabelas = sizeof(db_arquivadas) / sizeof(db_arquivadas[0]);
+
+	for(i = 0; i < DB_STMT_N; i++){
+		sqlite3_finalize(c->cache[i]);
+		c->cache[i] = NULL;
+	}
+	if(sqlite3_prepare_v2(c->db, "SELECT ano, arquivo FROM main.arquivos\
+			ORDER BY ano DESC;", -1, &stmt, NULL) != SQLITE_OK)
+		return -ESQL;
+	while(sqlite3_step(stmt) == SQLITE_ROW){
+		if((novo = realloc(arq, sizeof(*arq) * (n + 1))) == NULL)
+			break;
+		arq = novo;
+		arq[n].ano = sqlite3_column_int(stmt, 0);
+		arq[n++].caminho = sqlite3_mprintf("%s",
+			sqlite3_column_text(stmt, 1));
+	}
+	sqlite3_finalize(stmt);
+	if(n > sqlite3_limit(c->db, SQLITE_LIMIT_ATTACHED, -1)){
+		fprintf(stderr, "livrenfe: Error: %d archives, but SQLite attaches"
+			" at most %d\n", n,
+			sqlite3_limit(c->db, SQLITE_LIMIT_ATTACHED, -1));
+		for(i = 0; i < n; i++)
+			sqlite3_free(arq[i].caminho);
+		free(arq);
+		return -ESQL;
+	}
+
+	/* só o schema temp muda, mas query_only o bloqueia também */
+	sql = sqlite3_str_new(c->db);
+	sqlite3_str_appendall(sql, "PRAGMA query_only = 0;");
+	for(i = 0; i < n_tabelas; i++)
+		sqlite3_str_appendf(sql, "DROP VIEW IF EXISTS temp.%s;",
+			db_arquivadas[i].nome);
+	if(sqlite3_prepare_v2(c->db, "SELECT name FROM pragma_database_list\
+			WHERE name NOT IN ('main', 'temp');", -1, &stmt,
+			NULL) == SQLITE_OK)
+		while(sqlite3_step(stmt) == SQLITE_ROW)
+			sqlite3_str_appendf(sql, "DETACH \"%w\";",
+				sqlite3_column_text(stmt, 0));
+	sqlite3_finalize(stmt);
+	s = sqlite3_str_finish(sql);
+	rc = sqlite3_exec(c->db, s, NULL, NULL, &err);
+	sqlite3_free(s);
+
+	for(i = 0; i < n && rc == SQLITE_OK; i++){
+		s = sqlite3_mprintf("ATTACH %Q AS a%d;", arq[i].caminho,
+			arq[i].ano);
+		if(sqlite3_exec(c->db, s, NULL, NULL, &err) != SQLITE_OK){
+			fprintf(stderr, "livrenfe: Error: archive %s: %s\n",
+				arq[i].caminho, err);
+			sqlite3_free(err);
+			err = NULL;
+			arq[i].ano = 0;
+		}
+		sqlite3_free(s);
+	}
+
+	/* com algum anexado, uma view por tabela, do ano mais novo ao mais
+	 * velho, como a lista é mostrada */
+	for(i = 0; i < n_tabelas && rc == SQLITE_OK; i++){
+		const char *t = db_arquivadas[i].nome;
+		for(j = 0; j < n && arq[j].ano == 0; j++);
+		if(j == n)
+			break;
+		sql = sqlite3_str_new(c->db);
+		colunas = db_colunas(c->db, t, "main");
+		sqlite3_str_appendf(sql, "CREATE TEMP VIEW %s AS SELECT", t);
+		if(db_arquivadas[i].fts)
+			sqlite3_str_appendf(sql, " rowid, %s,", t);
+		sqlite3_str_appendf(sql, " %s FROM main.%s", colunas, t);
+		sqlite3_free(colunas);
+		for(; j < n; j++){
+			char schema[16];
+			if(arq[j].ano == 0)
+				continue;
+			sprintf(schema, "a%d", arq[j].ano);
+			colunas = db_colunas(c->db, t, schema);
+			sqlite3_str_appendall(sql, " UNION ALL SELECT");
+			if(db_arquivadas[i].fts)
+				sqlite3_str_appendf(sql, " rowid, %s,", t);
+			sqlite3_str_appendf(sql, " %s FROM %s.%s", colunas,
+				schema, t);
+			sqlite3_free(colunas);
+		}
+		s = sqlite3_str_finish(sql);
+		rc = sqlite3_exec(c->db, s, NULL, NULL, &err);
+		sqlite3_free(s);
+	}
+	if(rc != SQLITE_OK){
+		fprintf(stderr, "livrenfe: Error: %s\n", err);
+		sqlite3_free(err);
+	}
+	sqlite3_exec(c->db, "PRAGMA query_only = 1;", NULL, NULL, NULL);
+
+	for(i = 0; i < n; i++)
+		sqlite3_free(arq[i].caminho);
+	free(arq);
+	return rc == SQLITE_OK? 0 : -ESQL;
+}
+
+static void db_reader_put();
+
+/* leitor da thread, reservando um livre do pool se ela não tem nenhum */
+static struct db_conn *db_reader_get(){
+	int i, geracao;
+
+	if(db_reader){
+		db_reader->refs++;
+		return db_reader;
+	}
+	pthread_mutex_lock(&db_readers_mutex);
+	for(;;){
+		while(db_readers_fechando > 0)
+			pthread_cond_wait(&db_readers_cond, &db_readers_mutex);
+		for(i = 0; i < DB_READERS; i++)
+			if(db_readers[i].refs == 0)
+				break;
+		if(i < DB_READERS)
+			break;
+		pthread_cond_wait(&db_readers_cond, &db_readers_mutex);
+	}
+	if(db_readers[i].db == NULL){
+		if(sqlite3_open_v2(db_file, &db_readers[i].db,
+				SQLITE_OPEN_READONLY, NULL) != SQLITE_OK ||
+				db_pragmas(db_readers[i].db, 0)){
+			sqlite3_close(db_readers[i].db);
+			db_readers[i].db = NULL;
+			pthread_mutex_unlock(&db_readers_mutex);
+			return NULL;
+		}
+	}
+	db_readers[i].refs = 1;
+	db_reader = &db_readers[i];
+	geracao = db_arquivos_geracao;
+	pthread_mutex_unlock(&db_readers_mutex);
+	/* só quando há arquivo novo; a escrita nunca passa por aqui */
+	if(db_reader->arquivos != geracao){
+		if(db_conn_anexar(db_reader)){
+			db_reader_put();
+			return NULL;
+		}
+		db_reader->arquivos = geracao;
+	}
+	return db_reader;
+}
+
+static void db_reader_put(){
+	if(db_reader->refs > 1){
+		db_reader->refs--;
+		return;
+	}
+	/* refs vai a 0 com o mutex: db_readers_esperar() o lê */
+	pthread_mutex_lock(&db_readers_mutex);
+	db_reader->refs = 0;
+	db_reader = NULL;
+	pthread_cond_broadcast(&db_readers_cond);
+	pthread_mutex_unlock(&db_readers_mutex);
+}
+
+void db_arquivos_mudou(){
+	pthread_mutex_lock(&db_readers_mutex);
+	db_arquivos_geracao++;
+	pthread_mutex_unlock(&db_readers_mutex);
+}
+
 int db_exec(const char *sql, char **err){
 	sqlite3_stmt *stmt;
 	int rc;
 	const char *tail_sql;
-	char *e = (char*)malloc(sizeof(char) * 200);
 
+	db_writer_lock();
 	do{
 		rc = sqlite3_prepare_v2(db, sql, -1, &stmt, &tail_sql);
 		if(rc != SQLITE_OK){
-			strcpy(e, sqlite3_errmsg(db));
-			err = &e;
+			*err = (char*)sqlite3_errmsg(db);
+			db_writer_unlock();
 			return -ESQL;
 		}
-		rc = sqlite3_step(stmt);
-		if(rc != SQLITE_DONE){
-			if(rc == SQLITE_ERROR){
-				strcpy(e, sqlite3_errmsg(db));
-				err = &e;
-				return -ESQL;
-			}
+		if(stmt == NULL){
+			/* só espaços ou comentários depois do último ';' */
 			break;
 		}
+		rc = sqlite3_step(stmt);
+		if(rc != SQLITE_DONE && rc != SQLITE_ROW){
+			*err = (char*)sqlite3_errmsg(db);
+			sqlite3_finalize(stmt);
+			db_writer_unlock();
+			return -ESQL;
+		}
 		rc = sqlite3_finalize(stmt);
 		if(rc != SQLITE_OK){
-			strcpy(e, sqlite3_errmsg(db));
-			err = &e;
+			*err = (char*)sqlite3_errmsg(db);
+			db_writer_unlock();
 			return -ESQL;
 		}
 		sql = tail_sql;
-	} while(tail_sql != NULL);
+	} while(tail_sql != NULL && *tail_sql != '\0');
+	db_writer_unlock();
 	return 0;
 }
 
 int db_select(const char *sql, char **err, sqlite3_stmt **stmt){
 	int rc;
 
+	/* roda no escritor; o lock fica até db_finalize() */
+	db_writer_lock();
 	rc = sqlite3_prepare_v2(db, sql, -1, stmt, NULL);
 	if(rc != SQLITE_OK){
-		strcpy(*err, sqlite3_errmsg(db));
+		*err = (char*)sqlite3_errmsg(db);
+		db_writer_unlock();
+		return -ESQL;
+	}
+	return 0;
+}
+
+void db_finalize(sqlite3_stmt *stmt){
+	sqlite3_finalize(stmt);
+	db_writer_unlock();
+}
+
+int db_prepare(enum db_stmt_id id, const char *sql, char **err,
+		sqlite3_stmt **stmt){
+	struct db_conn *c;
+	int rc;
+
+	if(db_stmt_leitura[id] && db_tx_depth == 0){
+		/* fora de uma transação desta thread; lê de um leitor */
+		c = db_reader_get();
+		if(c == NULL){
+			*err = "couldn't open a reader connection";
+			return -ESQL;
+		}
+	} else {
+		/* escrita, ou leitura que precisa ver a transação em curso;
+		 * o lock fica até db_run() ou db_done() */
+		db_writer_lock();
+		c = &db_writer;
+	}
+
+	if(c->cache[id] != NULL){
+		sqlite3_reset(c->cache[id]);
+		sqlite3_clear_bindings(c->cache[id]);
+		*stmt = c->cache[id];
+		return 0;
+	}
+	rc = sqlite3_prepare_v3(c->db, sql, -1, SQLITE_PREPARE_PERSISTENT,
+		&c->cache[id], NULL);
+	if(rc != SQLITE_OK){
+		*err = (char*)sqlite3_errmsg(c->db);
+		c->cache[id] = NULL;
+		if(c == &db_writer)
+			db_writer_unlock();
+		else
+			db_reader_put();
+		return -ESQL;
+	}
+	*stmt = c->cache[id];
+	return 0;
+}
+
+void db_done(sqlite3_stmt *stmt){
+	sqlite3_reset(stmt);
+	if(db_reader && sqlite3_db_handle(stmt) == db_reader->db)
+		db_reader_put();
+	else
+		db_writer_unlock();
+}
+
+int db_run(sqlite3_stmt *stmt, char **err){
+	int rc;
+
+	while((rc = sqlite3_step(stmt)) == SQLITE_ROW);
+	if(rc != SQLITE_DONE){
+		*err = (char*)sqlite3_errmsg(sqlite3_db_handle(stmt));
+		db_done(stmt);
+		return -ESQL;
+	}
+	db_done(stmt);
+	return 0;
+}
+
+int db_bind_id(sqlite3_stmt *stmt, int col, int id){
+	if(id == 0)
+		return sqlite3_bind_null(stmt, col);
+	return sqlite3_bind_int(stmt, col, id);
+}
+
+int db_begin(){
+	char *err = NULL;
+	/* o lock do escritor fica com a thread até o último commit */
+	db_writer_lock();
+	/* só a transação mais externa faz commit; as internas são savepoints */
+	if(db_exec(db_tx_depth == 0? "BEGIN IMMEDIATE;" : "SAVEPOINT db_tx;",
+			&err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		db_writer_unlock();
+		return -ESQL;
+	}
+	db_tx_depth++;
+	return 0;
+}
+
+int db_commit(){
+	char *err = NULL;
+	if(db_exec(db_tx_depth == 1? "COMMIT;" : "RELEASE db_tx;", &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		db_rollback();
+		return -ESQL;
+	}
+	db_tx_depth--;
+	db_writer_unlock();
+	return 0;
+}
+
+int db_rollback(){
+	char *err = NULL;
+	int rc;
+	if(db_tx_depth == 0)
+		return 0;
+	db_tx_depth--;
+	rc = db_exec(db_tx_depth == 0? "ROLLBACK;" :
+		"ROLLBACK TO db_tx; RELEASE db_tx;", &err);
+	db_writer_unlock();
+	if(rc){
+		fprintf(stderr, "livrenfe: Error: %s", err);
 		return -ESQL;
 	}
 	return 0;
@@ -74,15 +583,29 @@ int db_select(const char *sql, char **err, sqlite3_stmt **stmt){
 int db_close(sqlite3_stmt *stmt, char **err){
 	int rc;
 
+	/* devolve o lock que db_select() tomou */
 	rc = sqlite3_finalize(stmt);
+	db_writer_unlock();
 	if(rc != SQLITE_OK){
-		strcpy(*err, sqlite3_errmsg(db));
+		*err = (char*)sqlite3_errmsg(db);
+		return -ESQL;
+	}
+	if(db_readers_esperar()){
+		*err = "reader connection still in use by this thread";
 		return -ESQL;
 	}
-	sqlite3_close_v2(db);
+	db_writer_lock();
+	pthread_mutex_lock(&db_readers_mutex);
+	db_readers_liberar();
+	db_conn_close(&db_writer);
+	db = NULL;
+	pthread_mutex_unlock(&db_readers_mutex);
+	db_writer_unlock();
 	return 0;
 }
 
 int db_last_insert_id(){
+	/* fora de uma transação outra thread pode ter inserido depois */
+	assert(db_tx_depth > 0);
 	return sqlite3_last_insert_rowid(db);
 }
@@ -23,7 +23,26 @@
 #include "pitangus/libsped.h"
 #include <sqlite3.h>
 
-#define DB_VERSION	1
+/* read-only connections kept open next to the single writer */
+#define DB_READERS	4
+/* ms to wait on a locked database before failing */
+#define DB_BUSY_TIMEOUT	5000
+#define DB_MMAP_SIZE	"268435456"
+/* negative means KiB */
+#define DB_CACHE_SIZE	"-8192"
+/* words of a search matched separately, anywhere in the NFE or items */
+#define DB_BUSCA_TERMOS	4
+
+/**
+ * Open the DB in WAL mode as the writer connection, closing the previous
+ * writer and readers. Readers are opened read-only on demand and attach
+ * the yearly archives in main.arquivos: on them nfe, nfe_itens, xml_blobs
+ * and the search tables are views over main and every archive. The
+ * writer only ever sees main
+ * args:
+ *	1st: IN: path to DB file
+ */
+extern int db_open(const char *);
 
 /**
  * Execute SQL commands without returning results
@@ -34,7 +53,8 @@
 extern int db_exec(const char *, char **);
 
 /**
- * Execute SQL commands returning results
+ * Execute SQL commands returning results, on the writer connection. The
+ * writer lock is held until db_finalize()
  * args:
  * 	1st: IN: sql statement
  *	2nd: OUT: errmsg
@@ -42,6 +62,11 @@ extern int db_exec(const char *, char **);
  */
 extern int db_select(const char *, char **, sqlite3_stmt **stmt);
 
+/**
+ * Finalize a statement from db_select() and release the writer lock
+ */
+extern void db_finalize(sqlite3_stmt *);
+
 /**
  * Close DB connection after db_select()
  * args:
@@ -51,7 +76,183 @@ extern int db_select(const char *, char **, sqlite3_stmt **stmt);
 extern int db_close(sqlite3_stmt *, char **);
 
 /**
- * Get last inserted rowid on DB
+ * IDs of the cached statements. Each one is prepared once per connection
+ * by db_prepare() and reused with new bindings afterwards. Read-only ones
+ * run on a reader connection unless the calling thread is inside
+ * db_begin()
+ */
+enum db_stmt_id {
+	DB_STMT_COUNT_NFE,
+	DB_STMT_COUNT_NFE_BUSCA,
+	/* one per enum nfe_list_ordem, descending then ascending, first
+	 * without and then with a search */
+	DB_STMT_NFE_PAGE_ID_DESC,
+	DB_STMT_NFE_PAGE_ID_ASC,
+	DB_STMT_NFE_PAGE_EMISSAO_DESC,
+	DB_STMT_NFE_PAGE_EMISSAO_ASC,
+	DB_STMT_NFE_PAGE_NUMERO_DESC,
+	DB_STMT_NFE_PAGE_NUMERO_ASC,
+	DB_STMT_NFE_BUSCA_ID_DESC,
+	DB_STMT_NFE_BUSCA_ID_ASC,
+	DB_STMT_NFE_BUSCA_EMISSAO_DESC,
+	DB_STMT_NFE_BUSCA_EMISSAO_ASC,
+	DB_STMT_NFE_BUSCA_NUMERO_DESC,
+	DB_STMT_NFE_BUSCA_NUMERO_ASC,
+	DB_STMT_LIST_UF,
+	DB_STMT_LIST_MUNICIPIOS,
+	DB_STMT_INSERT_MUNICIPIO,
+	DB_STMT_REPLACE_DESTINATARIO,
+	DB_STMT_REPLACE_NFE,
+	DB_STMT_NFE_ARQUIVADA,
+	DB_STMT_DELETE_NFE_ITENS,
+	DB_STMT_REPLACE_PRODUTO,
+	DB_STMT_REPLACE_NFE_ITEM,
+	DB_STMT_REPLACE_NFE_ITENS_LOTE,
+	DB_STMT_GET_NFE,
+	DB_STMT_GET_NFE_XML,
+	DB_STMT_GET_ITENS,
+	DB_STMT_GET_EMITENTE,
+	DB_STMT_GET_DESTINATARIO_DOC,
+	DB_STMT_REPLACE_EMITENTE,
+	DB_STMT_NEXT_NFE_NUMBER,
+	DB_STMT_RESERVAR_SEQUENCIA,
+	DB_STMT_USAR_SEQUENCIA,
+	DB_STMT_GET_SEQUENCIA,
+	DB_STMT_LIST_LACUNAS,
+	DB_STMT_LIST_FAIXAS,
+	DB_STMT_INSERT_RESERVA,
+	DB_STMT_DELETE_RESERVA,
+	DB_STMT_INSERT_INUTILIZACAO,
+	DB_STMT_INSERT_LOTE,
+	DB_STMT_INSERT_LOTE_NFE,
+	DB_STMT_INSERT_LOTE_EVENTO,
+	DB_STMT_INSERT_LOTE_EVENTO_ITEM,
+	DB_STMT_REPLACE_EVENTO,
+	DB_STMT_UPDATE_EVENTO_JUSTIFICATIVA,
+	DB_STMT_GET_WS_URL,
+	DB_STMT_GET_URL_ID,
+	DB_STMT_UPDATE_URL,
+	DB_STMT_REPLACE_PREFS,
+	DB_STMT_LIST_URLS,
+	DB_STMT_GET_PREFS,
+	DB_STMT_FIND_XML_BLOB,
+	DB_STMT_INSERT_XML_BLOB,
+	DB_STMT_GET_XML_BLOB,
+	DB_STMT_SOLTAR_XML_BLOB,
+	DB_STMT_LAST_XML_DICIONARIO,
+	DB_STMT_INSERT_XML_DICIONARIO,
+	DB_STMT_GET_XML_DICIONARIO,
+	DB_STMT_N
+};
+
+/**
+ * Get a cached prepared statement, preparing it on first use
+ * The statement comes back reset and with its bindings cleared. Every
+ * successful call must be matched by db_run() or db_done(), which give
+ * the connection back.
+ * args:
+ *	1st: IN: statement id
+ *	2nd: IN: sql statement, used only on the first call for this id
+ *	3rd: OUT: errmsg
+ *	4th: OUT: stmt object
+ */
+extern int db_prepare(enum db_stmt_id, const char *, char **,
+	sqlite3_stmt **);
+
+/**
+ * Reset a statement from db_prepare() and release its connection
+ */
+extern void db_done(sqlite3_stmt *);
+
+/**
+ * Step a bound statement from db_prepare() until done and db_done() it
+ * args:
+ *	1st: IN: stmt object
+ *	2nd: OUT: errmsg
+ */
+extern int db_run(sqlite3_stmt *, char **);
+
+/**
+ * Bind an id, binding NULL when it is 0 so SQLite assigns a new rowid
+ */
+extern int db_bind_id(sqlite3_stmt *, int, int);
+
+/**
+ * Start a transaction on the writer connection, holding it for this
+ * thread until the matching db_commit() or db_rollback(). Calls may nest:
+ * inner ones open a savepoint and only the outermost commit is real
+ */
+extern int db_begin();
+
+/**
+ * Commit the innermost transaction opened with db_begin()
+ */
+extern int db_commit();
+
+/**
+ * Undo everything since the matching db_begin() and close it
+ */
+extern int db_rollback();
+
+/**
+ * Store a document in the XML blob table, deflated with a preset
+ * dictionary. Blobs are addressed by the SHA-256 of their content, so
+ * storing the same document again returns the existing id. Must run
+ * inside db_begin()
+ * args:
+ *	1st: IN: document, may be NULL
+ *	2nd: OUT: blob id, 0 for a NULL document
+ */
+extern int db_blob_put(const char *, int *);
+
+/**
+ * Read and inflate a blob stored by db_blob_put()
+ * args:
+ *	1st: IN: blob id, 0 gives a NULL document
+ *	2nd: OUT: document; caller must free
+ */
+extern int db_blob_get(int, char **);
+
+/**
+ * Register the xml_blob(text) SQL function, which stores its argument
+ * with db_blob_put() and returns the blob id, on the writer connection
+ */
+extern int db_blob_register_func();
+
+/**
+ * Delete blobs no longer referenced by any row. It reads every blob
+ * reference, so it runs after the bulk operations that drop many of
+ * them (the XML blob migration, archiving a year)
+ * args:
+ *	1st: OUT: errmsg
+ */
+extern int db_blob_limpar(char **);
+
+/**
+ * Delete one blob if no row references it anymore, after a row had its
+ * XML replaced by another one
+ * args:
+ *	1st: IN: blob id, 0 does nothing
+ */
+extern int db_blob_soltar(int);
+
+/**
+ * Create the schema of a yearly archive file unless it already has one.
+ * It is the same as the main DB's, holding only the rows moved there
+ * args:
+ *	1st: IN: path to archive file
+ */
+extern int create_db_arquivo(const char *);
+
+/**
+ * Make every reader attach the archives again the next time it is taken
+ * from the pool, after main.arquivos changed
+ */
+extern void db_arquivos_mudou();
+
+/**
+ * Get last inserted rowid on DB. Only inside db_begin(), where no other
+ * thread can insert in between
  */
 extern int db_last_insert_id();
 
@@ -0,0 +1,295 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "tool_db_interface.h"
+#include "tool_db.h"
+#include <pitangus/errno.h>
+#include <sqlite3.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* tabelas copiadas para o arquivo anual, na ordem em que são gravadas, e
+ * o que vai de cada uma; as referenciadas vêm antes de nfe, porque as
+ * triggers da busca as leem */
+static const struct {
+	const char *tabela;
+	const char *filtro;
+} copiadas[] = {
+	{"destinatarios", "id_destinatario IN (SELECT id_destinatario\
+		FROM main.nfe WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar))"},
+	{"produtos", "id_produto IN (SELECT id_produto FROM main.nfe_itens\
+		WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar))"},
+	{"nfe", "id_nfe IN (SELECT id_nfe FROM temp.arquivar)"},
+	{"nfe_itens", "id_nfe IN (SELECT id_nfe FROM temp.arquivar)"},
+	{"eventos", "id_nfe IN (SELECT id_nfe FROM temp.arquivar)"},
+	{"protocolos", "id_nfe IN (SELECT id_nfe FROM temp.arquivar)"},
+	{"lotes_nfes", "id_nfe IN (SELECT id_nfe FROM temp.arquivar)"},
+	{"xml_dicionarios", "1"},
+	{"xml_blobs", "id_blob IN (\
+		SELECT id_xml FROM main.nfe\
+			WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar)\
+		UNION ALL SELECT id_xml_protocolo FROM main.nfe\
+			WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar)\
+		UNION ALL SELECT id_xml FROM main.eventos\
+			WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar)\
+		UNION ALL SELECT id_xml_response FROM main.eventos\
+			WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar))"}
+};
+
+/* o que sai do banco principal depois da cópia; nfe por último */
+#define ARQUIVAR_APAGAR_SQL "DELETE FROM main.nfe_itens\
+		WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar);\
+	DELETE FROM main.eventos\
+		WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar);\
+	DELETE FROM main.protocolos\
+		WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar);\
+	DELETE FROM main.lotes_nfes\
+		WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar);\
+	DELETE FROM main.nfe\
+		WHERE id_nfe IN (SELECT id_nfe FROM temp.arquivar);"
+
+/* só vão para o arquivo as NF-e que não mudam mais: canceladas,
+ * denegadas (cStat 110, 301 a 303) e autorizadas (100, 150) que já não
+ * podem ser canceladas; rascunhos e as que esperam o SEFAZ ficam */
+#define ARQUIVAR_FINAL_SQL "(canceled OR sefaz_cstat IN (110, 301, 302, 303)\
+		OR (sefaz_cstat IN (100, 150) AND dh_emis < %lld))"
+
+/* o cancelamento vale por 24 h depois da autorização, que pode vir até
+ * 30 dias depois de dh_emis; só dh_emis fica gravado na NF-e */
+#define ARQUIVAR_PRAZO_CANCELAMENTO ((30 + 1) * 24 * 60 * 60)
+
+static char *caminho_arquivo(int ano){
+	char *caminho;
+	size_t len = strlen(db_file);
+
+	/* ao lado do banco principal: livrenfe.db -> livrenfe-2016.db */
+	caminho = malloc(len + 10);
+	if(caminho == NULL)
+		return NULL;
+	if(len > 3 && strcmp(db_file + len - 3, ".db") == 0)
+		sprintf(caminho, "%.*s-%d.db", (int)(len - 3), db_file, ano);
+	else
+		sprintf(caminho, "%s-%d", db_file, ano);
+	return caminho;
+}
+
+static int copiar(const char *tabela, const char *filtro, char **err){
+	sqlite3_stmt *stmt;
+	char *sql, *colunas = NULL;
+	int rc;
+
+	/* só as colunas que os dois lados têm; um arquivo criado numa versão
+	 * anterior pode ter menos */
+	sql = sqlite3_mprintf("SELECT group_concat(printf('\"%%w\"', name), ', ')\
+		FROM (SELECT m.name FROM pragma_table_info(%Q, 'main') m\
+		JOIN pragma_table_info(%Q, 'arquivo') a USING (name)\
+		ORDER BY m.cid);", tabela, tabela);
+	if(db_select(sql, err, &stmt)){
+		sqlite3_free(sql);
+		return -ESQL;
+	}
+	sqlite3_free(sql);
+	if(sqlite3_step(stmt) == SQLITE_ROW &&
+			sqlite3_column_text(stmt, 0) != NULL)
+		colunas = sqlite3_mprintf("%s", sqlite3_column_text(stmt, 0));
+	db_finalize(stmt);
+	if(colunas == NULL){
+		*err = "archive table has no columns in common";
+		return -ESQL;
+	}
+
+	sql = sqlite3_mprintf("INSERT OR REPLACE INTO arquivo.\"%w\" (%s)\
+		SELECT %s FROM main.\"%w\" WHERE %s;", tabela, colunas,
+		colunas, tabela, filtro);
+	rc = db_exec(sql, err);
+	sqlite3_free(sql);
+	sqlite3_free(colunas);
+	return rc;
+}
+
+static int contar(const char *sql, char **err){
+	sqlite3_stmt *stmt;
+	int n = 0;
+
+	if(db_select(sql, err, &stmt))
+		return -ESQL;
+	if(sqlite3_step(stmt) == SQLITE_ROW)
+		n = sqlite3_column_int(stmt, 0);
+	db_finalize(stmt);
+	return n;
+}
+
+static int _db_arquivar_ano(int ano, const char *caminho, char **err){
+	char *sql;
+	int i, rc;
+
+	for(i = 0; i < sizeof(copiadas) / sizeof(copiadas[0]); i++){
+		if(copiar(copiadas[i].tabela, copiadas[i].filtro, err))
+			return -ESQL;
+	}
+	/* os maiores ids do arquivo ficam registrados, para que os novos do
+	 * banco principal venham depois deles */
+	sql = sqlite3_mprintf("INSERT OR REPLACE INTO main.arquivos (ano,\
+		arquivo, n_nfe, id_nfe_max, id_blob_max, id_evento_max,\
+		id_protocolo_max) VALUES (%d, %Q,\
+		(SELECT count(*) FROM arquivo.nfe),\
+		(SELECT max(id_nfe) FROM arquivo.nfe),\
+		(SELECT max(id_blob) FROM arquivo.xml_blobs),\
+		(SELECT max(id_evento) FROM arquivo.eventos),\
+		(SELECT max(id_protocolo) FROM arquivo.protocolos));", ano,
+		caminho);
+	rc = db_exec(sql, err);
+	sqlite3_free(sql);
+	if(rc)
+		return -ESQL;
+	if(db_exec(ARQUIVAR_APAGAR_SQL, err) || db_blob_limpar(err))
+		return -ESQL;
+	return 0;
+}
+
+int db_arquivar_ano(int ano){
+	char *err = NULL, *sql, *caminho = NULL;
+	sqlite3_stmt *stmt;
+	struct tm tm;
+	time_t agora, inicio, fim;
+	int n, rc;
+
+	agora = time(NULL);
+	localtime_r(&agora, &tm);
+	if(ano >= tm.tm_year + 1900)
+		return -EINVFIELD;
+	memset(&tm, 0, sizeof(tm));
+	tm.tm_year = ano - 1900;
+	tm.tm_mday = 1;
+	tm.tm_isdst = -1;
+	inicio = mktime(&tm);
+	memset(&tm, 0, sizeof(tm));
+	tm.tm_year = ano + 1 - 1900;
+	tm.tm_mday = 1;
+	tm.tm_isdst = -1;
+	fim = mktime(&tm);
+
+	sql = sqlite3_mprintf("DROP TABLE IF EXISTS temp.arquivar;\
+		CREATE TEMP TABLE arquivar AS SELECT id_nfe FROM main.nfe\
+		WHERE dh_emis >= %lld AND dh_emis < %lld AND "
+		ARQUIVAR_FINAL_SQL ";", (long long)inicio, (long long)fim,
+		(long long)(agora - ARQUIVAR_PRAZO_CANCELAMENTO));
+	rc = db_exec(sql, &err);
+	sqlite3_free(sql);
+	if(rc){
+		fprintf(stderr, "livrenfe: Error: %s\n", err);
+		return -ESQL;
+	}
+	n = contar("SELECT count(*) FROM temp.arquivar;", &err);
+	if(n <= 0)
+		goto fim;
+
+	/* um ano que já tem arquivo recebe as que chegaram depois */
+	sql = sqlite3_mprintf("SELECT arquivo FROM main.arquivos WHERE ano = %d;",
+		ano);
+	rc = db_select(sql, &err, &stmt);
+	sqlite3_free(sql);
+	if(rc){
+		n = -ESQL;
+		goto fim;
+	}
+	if(sqlite3_step(stmt) == SQLITE_ROW)
+		caminho = strdup((const char*)sqlite3_column_text(stmt, 0));
+	db_finalize(stmt);
+	/* os leitores anexam todos os arquivos; um a mais do que o SQLite
+	 * deixa sumiria da lista */
+	if(caminho == NULL && contar("SELECT count(*) FROM main.arquivos;",
+			&err) >= sqlite3_limit(db, SQLITE_LIMIT_ATTACHED, -1)){
+		err = "no more yearly archives can be attached";
+		n = -ESQL;
+		goto fim;
+	}
+	if(caminho == NULL)
+		caminho = caminho_arquivo(ano);
+	if(caminho == NULL || create_db_arquivo(caminho)){
+		n = -ESQL;
+		goto fim;
+	}
+
+	/* ATTACH não pode estar dentro de uma transação */
+	sql = sqlite3_mprintf("ATTACH %Q AS arquivo;", caminho);
+	rc = db_exec(sql, &err);
+	sqlite3_free(sql);
+	if(rc){
+		n = -ESQL;
+		goto fim;
+	}
+	if(db_begin()){
+		n = -ESQL;
+	} else if(_db_arquivar_ano(ano, caminho, &err)){
+		db_rollback();
+		n = -ESQL;
+	} else if(db_commit()){
+		n = -ESQL;
+	}
+	/* o erro é lido antes do DETACH, que o sobrescreve */
+	if(n < 0)
+		fprintf(stderr, "livrenfe: Error: %s\n", err? err :
+			"couldn't archive year");
+	db_exec("DETACH arquivo;", &err);
+	if(n > 0)
+		db_arquivos_mudou();
+	db_exec("DROP TABLE IF EXISTS temp.arquivar;", &err);
+	free(caminho);
+	return n;
+
+fim:
+	if(n < 0)
+		fprintf(stderr, "livrenfe: Error: %s\n", err? err :
+			"couldn't archive year");
+	db_exec("DROP TABLE IF EXISTS temp.arquivar;", &err);
+	free(caminho);
+	return n;
+}
+
+int db_arquivar_fechados(){
+	time_t agora;
+	struct tm tm;
+	char *err = NULL;
+	int ano, atual, n, total = 0;
+
+	agora = time(NULL);
+	localtime_r(&agora, &tm);
+	atual = tm.tm_year + 1900;
+	ano = contar("SELECT CAST(strftime('%Y', min(dh_emis), 'unixepoch',\
+		'localtime') AS integer) FROM main.nfe;", &err);
+	if(ano < 0){
+		fprintf(stderr, "livrenfe: Error: %s\n", err);
+		return -ESQL;
+	}
+	if(ano == 0)
+		return 0;
+	for(; ano < atual; ano++){
+		n = db_arquivar_ano(ano);
+		if(n < 0)
+			return n;
+		total += n;
+	}
+	/* devolve ao disco as páginas que ficaram livres */
+	if(total > 0 && db_exec("VACUUM;", &err))
+		fprintf(stderr, "livrenfe: Error: %s\n", err);
+	return total;
+}
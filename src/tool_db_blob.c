@@ -0,0 +1,435 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#define _GNU_SOURCE
+#include "tool_db.h"
+#include <pitangus/errno.h>
+#include <openssl/sha.h>
+#include <sqlite3.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+/* o deflate só enxerga os últimos 32 KiB do dicionário */
+#define DICT_MAX	32768
+/* parte do dicionário reservada para a amostra do banco */
+#define AMOSTRA_MAX	(DICT_MAX / 2)
+#define CERT_INI	"<X509Certificate>"
+#define CERT_FIM	"</X509Certificate>"
+
+/*
+ * Começo do dicionário, comum a todo banco: o esqueleto de uma NF-e
+ * assinada, do protocolo e das respostas SOAP da SEFAZ. Os trechos que
+ * mais se repetem ficam no fim, mais perto do texto comprimido
+ */
+static const char dict_base[] =
+	"<soap12:Envelope xmlns:soap12=\"http://www.w3.org/2003/05/soap-envelope\" "
+	"xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+	"xmlns:xsd=\"http://www.w3.org/2001/XMLSchema\"><soap12:Header>"
+	"<nfeCabecMsg xmlns=\"http://www.portalfiscal.inf.br/nfe/wsdl/"
+	"NfeRetAutorizacao\"><cUF>35</cUF><versaoDados>3.10</versaoDados>"
+	"</nfeCabecMsg></soap12:Header><soap12:Body>"
+	"<nfeRetAutorizacaoLoteResult xmlns=\"http://www.portalfiscal.inf.br/nfe/"
+	"wsdl/NfeRetAutorizacao\"><nfeAutorizacaoLoteResult xmlns=\""
+	"http://www.portalfiscal.inf.br/nfe/wsdl/NfeAutorizacao\">"
+	"<nfeRecepcaoEventoResult xmlns=\"http://www.portalfiscal.inf.br/nfe/"
+	"wsdl/RecepcaoEvento\"><retEnvEvento versao=\"1.00\" "
+	"xmlns=\"http://www.portalfiscal.inf.br/nfe\"><idLote>1</idLote>"
+	"<retEvento versao=\"1.00\"><infEvento><tpAmb>2</tpAmb><verAplic>"
+	"SP_EVENTOS_PL_100</verAplic><cOrgao>35</cOrgao><cStat>135</cStat>"
+	"<xMotivo>Evento registrado e vinculado a NF-e</xMotivo>"
+	"<tpEvento>110111</tpEvento><xEvento>Cancelamento registrado</xEvento>"
+	"<nSeqEvento>1</nSeqEvento><dhRegEvento></dhRegEvento></infEvento>"
+	"</retEvento></retEnvEvento></nfeRecepcaoEventoResult>"
+	"<envEvento xmlns=\"http://www.portalfiscal.inf.br/nfe\" versao=\"1.00\">"
+	"<evento xmlns=\"http://www.portalfiscal.inf.br/nfe\" versao=\"1.00\">"
+	"<infEvento Id=\"ID1101113517\"><cOrgao>35</cOrgao><tpAmb>2</tpAmb>"
+	"<CNPJ></CNPJ><chNFe></chNFe><dhEvento></dhEvento><tpEvento>110111"
+	"</tpEvento><nSeqEvento>1</nSeqEvento><verEvento>1.00</verEvento>"
+	"<detEvento versao=\"1.00\"><descEvento>Cancelamento</descEvento>"
+	"<nProt></nProt><xJust></xJust></detEvento></infEvento></evento>"
+	"</envEvento><retConsReciNFe versao=\"3.10\" "
+	"xmlns=\"http://www.portalfiscal.inf.br/nfe\"><retEnviNFe versao=\"3.10\""
+	" xmlns=\"http://www.portalfiscal.inf.br/nfe\"><tpAmb>2</tpAmb>"
+	"<verAplic>SP_NFE_PL_008i2</verAplic><nRec>351000"
+	"</nRec><cStat>104</cStat><xMotivo>Lote processado</xMotivo>"
+	"<cUF>35</cUF><dhRecbto></dhRecbto><cMsg></cMsg><infRec><nRec></nRec>"
+	"<tMed>1</tMed></infRec>"
+	"<protNFe versao=\"3.10\"><infProt><tpAmb>2</tpAmb><verAplic>"
+	"SP_NFE_PL_008i2</verAplic><chNFe>3517</chNFe><dhRecbto>2017-"
+	"T00:00:00-03:00</dhRecbto><nProt>1351700</nProt><digVal></digVal>"
+	"<cStat>100</cStat><xMotivo>Autorizado o uso da NF-e</xMotivo>"
+	"</infProt></protNFe></retConsReciNFe>"
+	"</soap12:Body></soap12:Envelope>"
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<enviNFe xmlns=\"http://www.portalfiscal.inf.br/nfe\" versao=\"3.10\">"
+	"<idLote>1</idLote><indSinc>0</indSinc>"
+	"<NFe xmlns=\"http://www.portalfiscal.inf.br/nfe\"><infNFe Id=\"NFe3517"
+	"\" versao=\"3.10\"><ide><cUF>35</cUF><cNF></cNF><natOp>Venda de "
+	"mercadoria</natOp><indPag>0</indPag><mod>55</mod><serie>1</serie>"
+	"<nNF></nNF><dhEmi>2017-T00:00:00-03:00</dhEmi><tpNF>1</tpNF>"
+	"<idDest>1</idDest><cMunFG>35</cMunFG><tpImp>1</tpImp><tpEmis>1"
+	"</tpEmis><cDV></cDV><tpAmb>2</tpAmb><finNFe>1</finNFe><indFinal>0"
+	"</indFinal><indPres>0</indPres><procEmi>0</procEmi><verProc>"
+	"</verProc></ide><emit><CNPJ></CNPJ><xNome></xNome><enderEmit><xLgr>"
+	"</xLgr><nro></nro><xBairro></xBairro><cMun>35</cMun><xMun></xMun>"
+	"<UF>SP</UF><CEP></CEP><cPais>1058</cPais><xPais>BRASIL</xPais>"
+	"</enderEmit><IE></IE><CRT>1</CRT></emit><dest><CNPJ></CNPJ><xNome>"
+	"</xNome><enderDest><xLgr></xLgr><nro></nro><xBairro></xBairro>"
+	"<cMun>35</cMun><xMun></xMun><UF>SP</UF><CEP></CEP><cPais>1058</cPais>"
+	"<xPais>BRASIL</xPais></enderDest><indIEDest>1</indIEDest><IE></IE>"
+	"</dest><total><ICMSTot><vBC>0.00</vBC><vICMS>0.00</vICMS><vICMSDeson>"
+	"0.00</vICMSDeson><vFCPUFDest>0.00</vFCPUFDest><vICMSUFDest>0.00"
+	"</vICMSUFDest><vICMSUFRemet>0.00</vICMSUFRemet><vBCST>0.00</vBCST>"
+	"<vST>0.00</vST><vProd></vProd><vFrete>0.00</vFrete><vSeg>0.00</vSeg>"
+	"<vDesc>0.00</vDesc><vII>0.00</vII><vIPI>0.00</vIPI><vPIS>0.00</vPIS>"
+	"<vCOFINS>0.00</vCOFINS><vOutro>0.00</vOutro><vNF></vNF><vTotTrib>0.00"
+	"</vTotTrib></ICMSTot></total><transp><modFrete>9</modFrete></transp>"
+	"<infAdic><infAdFisco></infAdFisco><infCpl></infCpl></infAdic>"
+	"</infNFe><Signature xmlns=\"http://www.w3.org/2000/09/xmldsig#\">"
+	"<SignedInfo><CanonicalizationMethod Algorithm=\""
+	"http://www.w3.org/TR/2001/REC-xml-c14n-20010315\"/><SignatureMethod "
+	"Algorithm=\"http://www.w3.org/2000/09/xmldsig#rsa-sha1\"/><Reference "
+	"URI=\"#NFe3517\"><Transforms><Transform Algorithm=\""
+	"http://www.w3.org/2000/09/xmldsig#enveloped-signature\"/><Transform "
+	"Algorithm=\"http://www.w3.org/TR/2001/REC-xml-c14n-20010315\"/>"
+	"</Transforms><DigestMethod Algorithm=\""
+	"http://www.w3.org/2000/09/xmldsig#sha1\"/><DigestValue></DigestValue>"
+	"</Reference></SignedInfo><SignatureValue></SignatureValue><KeyInfo>"
+	"<X509Data><X509Certificate></X509Certificate></X509Data></KeyInfo>"
+	"</Signature></NFe></enviNFe>"
+	"<det nItem=\"1\"><prod><cProd></cProd><cEAN></cEAN><xProd></xProd>"
+	"<NCM></NCM><CFOP>5102</CFOP><uCom>UN</uCom><qCom>1.0000</qCom>"
+	"<vUnCom>0.0000000000</vUnCom><vProd>0.00</vProd><cEANTrib></cEANTrib>"
+	"<uTrib>UN</uTrib><qTrib>1.0000</qTrib><vUnTrib>0.0000000000</vUnTrib>"
+	"<indTot>1</indTot></prod><imposto><ICMS><ICMSSN102><orig>0</orig>"
+	"<CSOSN>102</CSOSN></ICMSSN102></ICMS><IPI><cEnq>999</cEnq><IPINT>"
+	"<CST>53</CST></IPINT></IPI><PIS><PISNT><CST>07</CST></PISNT></PIS>"
+	"<COFINS><COFINSNT><CST>07</CST></COFINSNT></COFINS></imposto></det>";
+
+struct dicionario {
+	int id;
+	size_t len;
+	unsigned char dados[DICT_MAX];
+};
+
+/* Monta base + amostra; a amostra vai no fim e corta o começo da base */
+static void montar_dicionario(struct dicionario *d, int id,
+		const unsigned char *amostra, size_t n){
+	size_t base = sizeof(dict_base) - 1;
+
+	if(n > AMOSTRA_MAX){
+		amostra += n - AMOSTRA_MAX;
+		n = AMOSTRA_MAX;
+	}
+	if(base + n > DICT_MAX)
+		base = DICT_MAX - n;
+	d->id = id;
+	memcpy(d->dados, dict_base + sizeof(dict_base) - 1 - base, base);
+	if(n > 0)
+		memcpy(d->dados + base, amostra, n);
+	d->len = base + n;
+}
+
+static int get_dicionario(int id, struct dicionario *d){
+	sqlite3_stmt *stmt;
+	char *err;
+	char *sql = "SELECT dados FROM xml_dicionarios\
+		WHERE id_dicionario = ?;";
+
+	if(id == 0){
+		montar_dicionario(d, 0, NULL, 0);
+		return 0;
+	}
+	if(db_prepare(DB_STMT_GET_XML_DICIONARIO, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, id);
+	if(sqlite3_step(stmt) != SQLITE_ROW){
+		db_done(stmt);
+		return -ESQL;
+	}
+	montar_dicionario(d, id, sqlite3_column_blob(stmt, 0),
+		sqlite3_column_bytes(stmt, 0));
+	db_done(stmt);
+	return 0;
+}
+
+/*
+ * Dicionário para comprimir doc: o último do banco, ou um novo treinado
+ * com o próprio doc quando ele traz um certificado que o último não tem.
+ * Assim o certificado, repetido em toda NF-e assinada, sai quase de graça
+ */
+static int dicionario_atual(const char *doc, size_t len,
+		struct dicionario *d){
+	sqlite3_stmt *stmt;
+	char *err;
+	const char *cert, *fim;
+	const unsigned char *amostra = NULL;
+	size_t n = 0;
+	int id = 0;
+	char *sql = "SELECT id_dicionario, dados FROM xml_dicionarios\
+		ORDER BY id_dicionario DESC LIMIT 1;";
+
+	if(db_prepare(DB_STMT_LAST_XML_DICIONARIO, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	if(sqlite3_step(stmt) == SQLITE_ROW){
+		id = sqlite3_column_int(stmt, 0);
+		amostra = sqlite3_column_blob(stmt, 1);
+		n = sqlite3_column_bytes(stmt, 1);
+	}
+	cert = strstr(doc, CERT_INI);
+	fim = cert? strstr(cert, CERT_FIM) : NULL;
+	if(fim == NULL || (amostra && memmem(amostra, n, cert,
+			fim - cert) != NULL)){
+		montar_dicionario(d, id, amostra, n);
+		db_done(stmt);
+		return 0;
+	}
+	db_done(stmt);
+
+	/* a amostra é o fim do doc, onde fica a assinatura */
+	n = len > AMOSTRA_MAX? AMOSTRA_MAX : len;
+	amostra = (const unsigned char*)doc + len - n;
+	sql = "INSERT INTO xml_dicionarios (dados) VALUES (?);";
+	if(db_prepare(DB_STMT_INSERT_XML_DICIONARIO, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_blob(stmt, 1, amostra, n, SQLITE_STATIC);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	montar_dicionario(d, db_last_insert_id(), amostra, n);
+	return 0;
+}
+
+static int comprimir(const char *doc, size_t len, struct dicionario *d,
+		unsigned char **out, size_t *out_len){
+	z_stream strm;
+	int ret;
+
+	memset(&strm, 0, sizeof(strm));
+	if(deflateInit(&strm, Z_BEST_COMPRESSION) != Z_OK)
+		return -1;
+	if(deflateSetDictionary(&strm, d->dados, d->len) != Z_OK ||
+			(*out = malloc(deflateBound(&strm, len))) == NULL){
+		deflateEnd(&strm);
+		return -1;
+	}
+	strm.next_in = (Bytef*)doc;
+	strm.avail_in = len;
+	strm.next_out = *out;
+	strm.avail_out = deflateBound(&strm, len);
+	ret = deflate(&strm, Z_FINISH);
+	*out_len = strm.total_out;
+	deflateEnd(&strm);
+	if(ret != Z_STREAM_END){
+		free(*out);
+		return -1;
+	}
+	return 0;
+}
+
+int db_blob_put(const char *doc, int *id){
+	sqlite3_stmt *stmt;
+	struct dicionario *d;
+	unsigned char hash[SHA256_DIGEST_LENGTH], *dados;
+	size_t len, dados_len;
+	char *err;
+	char *sql = "SELECT id_blob FROM xml_blobs WHERE hash = ?;";
+
+	*id = 0;
+	if(doc == NULL)
+		return 0;
+	len = strlen(doc);
+	SHA256((const unsigned char*)doc, len, hash);
+	if(db_prepare(DB_STMT_FIND_XML_BLOB, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_blob(stmt, 1, hash, sizeof(hash), SQLITE_STATIC);
+	if(sqlite3_step(stmt) == SQLITE_ROW)
+		*id = sqlite3_column_int(stmt, 0);
+	db_done(stmt);
+	if(*id != 0)
+		return 0;
+
+	if((d = malloc(sizeof(struct dicionario))) == NULL)
+		return -ESQL;
+	if(dicionario_atual(doc, len, d) ||
+			comprimir(doc, len, d, &dados, &dados_len)){
+		free(d);
+		return -ESQL;
+	}
+	sql = "INSERT INTO xml_blobs (hash, id_dicionario, tamanho, dados)\
+		VALUES (?, ?, ?, ?);";
+	if(db_prepare(DB_STMT_INSERT_XML_BLOB, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		free(dados);
+		free(d);
+		return -ESQL;
+	}
+	sqlite3_bind_blob(stmt, 1, hash, sizeof(hash), SQLITE_STATIC);
+	db_bind_id(stmt, 2, d->id);
+	sqlite3_bind_int64(stmt, 3, len);
+	sqlite3_bind_blob(stmt, 4, dados, dados_len, SQLITE_STATIC);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		free(dados);
+		free(d);
+		return -ESQL;
+	}
+	free(dados);
+	free(d);
+	*id = db_last_insert_id();
+	return 0;
+}
+
+int db_blob_get(int id, char **doc){
+	sqlite3_stmt *stmt;
+	struct dicionario *d;
+	z_stream strm;
+	size_t len;
+	char *err;
+	int ret;
+	char *sql = "SELECT id_dicionario, tamanho, dados FROM xml_blobs\
+		WHERE id_blob = ?;";
+
+	*doc = NULL;
+	if(id == 0)
+		return 0;
+	if(db_prepare(DB_STMT_GET_XML_BLOB, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, id);
+	if(sqlite3_step(stmt) != SQLITE_ROW){
+		db_done(stmt);
+		return -ESQL;
+	}
+	len = sqlite3_column_int64(stmt, 1);
+	d = malloc(sizeof(struct dicionario));
+	*doc = malloc(len + 1);
+	if(d == NULL || *doc == NULL ||
+			get_dicionario(sqlite3_column_int(stmt, 0), d)){
+		db_done(stmt);
+		free(*doc);
+		free(d);
+		*doc = NULL;
+		return -ESQL;
+	}
+
+	memset(&strm, 0, sizeof(strm));
+	strm.next_in = (Bytef*)sqlite3_column_blob(stmt, 2);
+	strm.avail_in = sqlite3_column_bytes(stmt, 2);
+	strm.next_out = (Bytef*)*doc;
+	strm.avail_out = len;
+	ret = inflateInit(&strm);
+	if(ret == Z_OK){
+		ret = inflate(&strm, Z_FINISH);
+		if(ret == Z_NEED_DICT){
+			inflateSetDictionary(&strm, d->dados, d->len);
+			ret = inflate(&strm, Z_FINISH);
+		}
+		inflateEnd(&strm);
+	}
+	db_done(stmt);
+	free(d);
+	if(ret != Z_STREAM_END || strm.total_out != len){
+		fprintf(stderr, "livrenfe: Error: corrupt XML blob %d\n", id);
+		free(*doc);
+		*doc = NULL;
+		return -ESQL;
+	}
+	(*doc)[len] = '\0';
+	return 0;
+}
+
+/* xml_blob(texto): guarda o texto como blob e devolve o id; usada para
+ * migrar as colunas de XML antigas com um UPDATE só */
+static void xml_blob_func(sqlite3_context *ctx, int argc,
+		sqlite3_value **argv){
+	int id;
+	if(db_blob_put((const char*)sqlite3_value_text(argv[0]), &id)){
+		sqlite3_result_error(ctx, "couldn't store XML blob", -1);
+		return;
+	}
+	if(id == 0)
+		sqlite3_result_null(ctx);
+	else
+		sqlite3_result_int(ctx, id);
+}
+
+int db_blob_register_func(){
+	if(sqlite3_create_function(db, "xml_blob", 1, SQLITE_UTF8, NULL,
+			xml_blob_func, NULL, NULL) != SQLITE_OK)
+		return -ESQL;
+	return 0;
+}
+
+/* blobs que alguma linha usa; o maior blob de cada arquivo anual fica,
+ * com o id_blob que lá também existe: os novos vêm depois dele e não
+ * repetem um de lá */
+#define BLOB_EM_USO_SQL "SELECT id_xml FROM nfe WHERE id_xml IS NOT NULL\
+		UNION ALL SELECT id_xml_protocolo FROM nfe\
+			WHERE id_xml_protocolo IS NOT NULL\
+		UNION ALL SELECT id_xml FROM eventos WHERE id_xml IS NOT NULL\
+		UNION ALL SELECT id_xml_response FROM eventos\
+			WHERE id_xml_response IS NOT NULL\
+		UNION ALL SELECT id_xml_response FROM lotes\
+			WHERE id_xml_response IS NOT NULL\
+		UNION ALL SELECT id_xml_response FROM lotes_evento\
+			WHERE id_xml_response IS NOT NULL\
+		UNION ALL SELECT id_xml FROM inutilizacoes WHERE id_xml IS NOT NULL\
+		UNION ALL SELECT id_xml_response FROM inutilizacoes\
+			WHERE id_xml_response IS NOT NULL\
+		UNION ALL SELECT id_blob_max FROM arquivos\
+			WHERE id_blob_max IS NOT NULL"
+
+int db_blob_limpar(char **err){
+	return db_exec("DELETE FROM xml_blobs WHERE id_blob NOT IN ("
+		BLOB_EM_USO_SQL ");", err);
+}
+
+int db_blob_soltar(int id){
+	sqlite3_stmt *stmt;
+	char *err;
+	/* outro documento igual pode usar o mesmo blob */
+	char *sql = "DELETE FROM xml_blobs WHERE id_blob = ? AND id_blob\
+		NOT IN (" BLOB_EM_USO_SQL ");";
+
+	if(id == 0)
+		return 0;
+	if(db_prepare(DB_STMT_SOLTAR_XML_BLOB, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, id);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	return 0;
+}
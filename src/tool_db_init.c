@@ -23,12 +23,7 @@
 #include <sqlite3.h>
 
 int set_db(char *path){
-	int rc = 0;
-	sqlite3 *d;
-	db_file = path;
-	rc = sqlite3_open(db_file, &d);
-	if(rc)
+	if(db_open(path))
 		return -ESQL;
-	db = d;
-	return rc;
+	return 0;
 }
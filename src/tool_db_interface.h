@@ -20,7 +20,8 @@
 #ifndef	DBI_H
 #define	DBI_H
 
-#define DB_VERSION	1
+/* PRAGMA user_version of the schema create_db() builds */
+#define DB_VERSION	10
 
 #include "tool_pitangus.h"
 #include <pitangus/libsped.h>
@@ -33,7 +34,17 @@
 extern int create_db();
 
 /**
- * Materialize NFE
+ * Bring an existing DB up to DB_VERSION, applying only the missing
+ * migrations, or create it if it is still empty
+ */
+extern int upgrade_db();
+
+/**
+ * Materialize NFE. A new one with num_nf 0 gets the next number of its
+ * emitente, modelo and serie from db_seq_reservar(), in the same
+ * transaction; a number chosen by hand only moves the sequence past it.
+ * An NF-e already moved to a yearly archive is not written again and
+ * -EARCHIVED is returned
  */
 extern int register_nfe(NFE *);
 
@@ -48,9 +59,44 @@ extern int register_evento(EVENTO *);
 extern int set_db(char *);
 
 /**
- * Get opened NFEs for GTKTreeView
+ * Sort keys of the NFE list, each one backed by an index
+ */
+enum nfe_list_ordem {
+	NFE_ORDEM_ID,
+	NFE_ORDEM_EMISSAO,
+	NFE_ORDEM_NUMERO,
+	NFE_ORDENS
+};
+
+/**
+ * A row of the NFE list
+ */
+typedef struct {
+	int id_nfe;
+	int num_nf;
+	int serie;
+	time_t dh_emis;
+	char *destinatario;
+	int cancelada;
+	int emitida;
+} NFE_LIST_ROW;
+
+/**
+ * Count NFEs matching a full-text search (NULL or "" for all). Every
+ * word must prefix a word of the recipient name or CNPJ, the chave, the
+ * natureza da operação or a product description or code
+ */
+extern int db_count_nfe(const char *filtro);
+
+/**
+ * Read a page of the NFE list by keyset: the rows right after `depois`
+ * in the given order (NULL to start from the first one), skipping
+ * `pular` rows, with the same search as db_count_nfe(). Returns how many rows were written to `rows`, each with
+ * a malloc'd destinatario, or < 0 on error
  */
-extern GtkListStore *get_list_nfe();
+extern int db_list_nfe_page(enum nfe_list_ordem ordem, int asc,
+	const char *filtro, const NFE_LIST_ROW *depois, int pular, int limite,
+	NFE_LIST_ROW *rows);
 
 /**
  * Get UF list
@@ -63,10 +109,17 @@ extern GtkListStore *db_list_uf();
 extern GtkListStore *db_list_municipios(char *);
 
 /**
- * Get NFE from DB
+ * Get NFE from DB. The signed XML and the protocol XML are left out;
+ * load them with db_load_nfe_xml() when needed
  */
 extern NFE *get_nfe(int);
 
+/**
+ * Load the signed XML and the protocol XML of an NFE from get_nfe(),
+ * filling only the ones still NULL
+ */
+extern int db_load_nfe_xml(NFE *);
+
 /**
  * Get ISSUER from DB
  */
@@ -89,12 +142,13 @@ extern char *get_ws_url(char *service, int ambiente, char **url_header,
 extern int set_emitente(EMITENTE *e);
 
 /**
- * Get next lote ID
+ * Reserve the next lote ID. IDs come from the sequencias table, so two
+ * callers never get the same one
  */
 extern int get_lote_id();
 
 /**
- * Get next lote evento ID
+ * Reserve the next lote evento ID
  */
 extern int get_lote_evento_id();
 
@@ -124,9 +178,134 @@ extern PREFS *get_prefs();
 extern PREFS_URLS *get_prefs_urls();
 
 /**
- * Get next NF number
+ * Suggest the next NF number of an emitente and modelo, in the serie used
+ * last, without reserving it; register_nfe() reserves it. number is 0 if
+ * nothing was numbered yet
+ * args:
+ *	1st: IN: emitente id
+ *	2nd: IN: modelo
+ *	3rd: OUT: number
+ *	4th: OUT: serie
+ */
+extern int get_next_nfe_number(int, int, int *, int *);
+
+/**
+ * Numbering sequences. Each one is a row of the sequencias table, per
+ * (emitente, modelo, serie) for NF-e and a single one for each kind of
+ * lote, which use 0 for the three
+ */
+enum db_seq {
+	DB_SEQ_NFE,
+	DB_SEQ_LOTE,
+	DB_SEQ_LOTE_EVENTO
+};
+
+/**
+ * Atomically reserve a block of consecutive numbers with a single write,
+ * locking only the DB writer for its duration. Numbers reserved and never
+ * used are gaps to be inutilized
+ * args:
+ *	1st: IN: sequence
+ *	2nd: IN: emitente id
+ *	3rd: IN: modelo, MOD_NFe or MOD_NFCe
+ *	4th: IN: serie
+ *	5th: IN: how many numbers, at least 1
+ *	6th: OUT: first number of the block
+ */
+extern int db_seq_reservar(enum db_seq, int, int, int, int, int *);
+
+/**
+ * Move a sequence past a number used without db_seq_reservar(), such as
+ * one typed by the user. Does nothing if the sequence is already ahead
+ * args:
+ *	1st: IN: sequence
+ *	2nd: IN: emitente id
+ *	3rd: IN: modelo
+ *	4th: IN: serie
+ *	5th: IN: number used
+ */
+extern int db_seq_usar(enum db_seq, int, int, int, int);
+
+/**
+ * Numbers leased from a sequence `bloco` at a time, for one POS terminal
+ * or worker thread. Fill the key and bloco and zero the rest; it is not
+ * shared between threads
+ */
+typedef struct {
+	enum db_seq tipo;
+	int id_emitente;
+	int modelo;
+	int serie;
+	int bloco;
+	int proximo;
+	int fim;
+} DB_SEQ_LEASE;
+
+/**
+ * Next number of a lease, reserving a new block when it runs out. The
+ * block is recorded in the DB until the next one or db_seq_lease_liberar()
+ * args:
+ *	1st: IN/OUT: lease
+ *	2nd: OUT: number
+ */
+extern int db_seq_lease_next(DB_SEQ_LEASE *, int *);
+
+/**
+ * Give up the rest of a lease's block, when its terminal or thread stops.
+ * Its unused numbers become holes for db_list_lacunas()
+ */
+extern int db_seq_lease_liberar(DB_SEQ_LEASE *);
+
+/**
+ * A run of unused NF numbers, to be inutilized
+ */
+typedef struct {
+	int serie;
+	unsigned int num_ini;
+	unsigned int num_fim;
+} DB_LACUNA;
+
+/**
+ * Find the holes in the numbering of every serie of an emitente, in one
+ * ordered pass over an index. Numbers of NF-e and of ranges already inutilized
+ * count as used, and so do the blocks of leases not yet released;
+ * consecutive missing numbers come as one range. Every serie starts at
+ * 1, so numbers missing before its first one are a hole too; the ones
+ * after the last are not reported
+ * args:
+ *	1st: IN: emitente id
+ *	2nd: IN: modelo
+ *	3rd: OUT: holes by serie and number; caller must free
+ * returns the number of holes, or less than 0 on error
+ */
+extern int db_list_lacunas(int, int, DB_LACUNA **);
+
+/**
+ * Save an inutilização request and the SEFAZ answer. Only the ones with
+ * cStat SEFAZ_INUT_OK close holes for db_list_lacunas()
+ */
+extern int db_save_inutilizacao(INUTILIZACAO *);
+
+/**
+ * Move the NF-e issued in a closed year, with their items, events and
+ * XML, into that year's archive file next to the DB. Readers keep
+ * listing and searching them; writes only touch the main DB. Only NF-e
+ * in a final state go: cancelled, denied, or authorized and past the
+ * cancellation window. Drafts and NF-e still waiting on the SEFAZ stay
+ * in the main DB and follow on a later call. Fails instead of creating
+ * more archives than SQLite can attach at once
+ * args:
+ *	1st: IN: year, before the current one
+ * returns the number of NF-e moved, or less than 0 on error
+ */
+extern int db_arquivar_ano(int);
+
+/**
+ * db_arquivar_ano() for every closed year still in the main DB, then
+ * give the freed pages back to the disk
+ * returns the number of NF-e moved, or less than 0 on error
  */
-extern int get_next_nfe_number(int *number, int *serie);
+extern int db_arquivar_fechados();
 
 /**
  * Save urls into DB
@@ -20,176 +20,565 @@
 #include "tool_db.h"
 #include <pitangus/sped.h>
 #include <pitangus/libsped.h>
+#include <pitangus/geo.h>
 #include <pitangus/errno.h>
 #include <pitangus/utils.h>
 #include <gtk/gtk.h>
 #include <sqlite3.h>
+#include <stdint.h>
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
-GtkListStore *get_list_nfe(){
+/* NFs com o termo ?n no índice de busca, no cabeçalho ou num item */
+#define NFE_BUSCA_TERMO(n) "n.id_nfe IN (SELECT rowid FROM busca_nfe\
+		WHERE busca_nfe MATCH " n "\
+		UNION SELECT id_nfe FROM busca_itens\
+		WHERE busca_itens MATCH " n ")"
+/* os termos depois do primeiro podem vir NULL, e aí nem são consultados;
+ * o primeiro sempre existe e é ele que leva às linhas de nfe */
+#define NFE_BUSCA_OPCIONAL(n) "(" n " IS NULL OR " NFE_BUSCA_TERMO(n) ")"
+#define NFE_BUSCA(a, b, c, d) NFE_BUSCA_TERMO(a)\
+	" AND " NFE_BUSCA_OPCIONAL(b) " AND " NFE_BUSCA_OPCIONAL(c)\
+	" AND " NFE_BUSCA_OPCIONAL(d)
+
+/* página da lista em ordem (chave, id_nfe), a partir da linha ?1, ?2;
+ * com busca, os termos vão de ?3 a ?6 */
+#define NFE_PAGE_SQL(chave, op, dir, filtro) "SELECT n.id_nfe, n.num_nf,\
+		n.serie, n.dh_emis, d.cnpj || ' - ' || d.nome, n.canceled,\
+		n.protocolo IS NOT NULL\
+		FROM nfe n JOIN destinatarios d USING (id_destinatario)\
+		WHERE (" chave ", n.id_nfe) " op " (?1, ?2)" filtro "\
+		ORDER BY " chave " " dir ", n.id_nfe " dir "\
+		LIMIT ?7 OFFSET ?8"
+#define NFE_PAGE_SQL_ORDEM(chave, filtro) {\
+		NFE_PAGE_SQL(chave, "<", "DESC", filtro),\
+		NFE_PAGE_SQL(chave, ">", "ASC", filtro)\
+	}
+#define NFE_PAGE_SQL_ORDENS(filtro) {\
+		[NFE_ORDEM_ID] = NFE_PAGE_SQL_ORDEM("n.id_nfe", filtro),\
+		[NFE_ORDEM_EMISSAO] = NFE_PAGE_SQL_ORDEM("n.dh_emis", filtro),\
+		[NFE_ORDEM_NUMERO] = NFE_PAGE_SQL_ORDEM("n.num_nf", filtro)\
+	}
+
+/* na ordem de DB_STMT_NFE_PAGE_ID_DESC em diante: sem e com busca */
+static const char *nfe_page_sql[2][NFE_ORDENS][2] = {
+	NFE_PAGE_SQL_ORDENS(""),
+	NFE_PAGE_SQL_ORDENS(" AND " NFE_BUSCA("?3", "?4", "?5", "?6"))
+};
+
+/* Quebra o texto digitado em até DB_BUSCA_TERMOS consultas FTS5 de
+ * prefixo, uma por palavra; o que sobrar vai junto na última. Só
+ * letras e dígitos ficam, então "12.345.678" vira "12345678"*. Retorna o
+ * número de termos, cada um liberado com sqlite3_free() */
+static int termos_busca(const char *filtro, char **termos){
+	int n = 0;
+	const unsigned char *c = (const unsigned char*)filtro;
+
+	if(filtro == NULL)
+		return 0;
+	while(*c){
+		char palavra[128];
+		size_t len = 0;
+		while(*c && isspace(*c))
+			c++;
+		while(*c && !isspace(*c)){
+			if((isalnum(*c) || *c >= 0x80) &&
+					len < sizeof(palavra) - 1)
+				palavra[len++] = *c;
+			c++;
+		}
+		/* o índice de prefixos começa em 2 caracteres; uma letra só
+		 * varreria o índice inteiro */
+		if(len < 2)
+			continue;
+		palavra[len] = '\0';
+		if(n < DB_BUSCA_TERMOS){
+			termos[n++] = sqlite3_mprintf("\"%s\"*", palavra);
+		} else {
+			char *aux = termos[n - 1];
+			termos[n - 1] = sqlite3_mprintf("%s \"%s\"*", aux,
+				palavra);
+			sqlite3_free(aux);
+		}
+	}
+	return n;
+}
+
+/* Liga os termos a partir da coluna col; as vagas que sobram ficam NULL
+ * e não custam uma consulta FTS cada */
+static void bind_busca(sqlite3_stmt *stmt, int col, char **termos, int n){
+	int i;
+	for(i = 0; i < DB_BUSCA_TERMOS; i++){
+		if(i < n)
+			sqlite3_bind_text(stmt, col + i, termos[i], -1,
+				sqlite3_free);
+		else
+			sqlite3_bind_null(stmt, col + i);
+	}
+}
+
+int db_count_nfe(const char *filtro){
 	sqlite3_stmt *stmt;
-	char *err;
-	int rc;
-	GtkListStore *list_store;
-	GtkTreeIter iter;
+	char *err, *termos[DB_BUSCA_TERMOS];
+	int n, n_termos;
+
+	n_termos = termos_busca(filtro, termos);
+	if(n_termos > 0){
+		char *sql = "SELECT count(*)\
+			FROM nfe n JOIN destinatarios d USING (id_destinatario)\
+			WHERE " NFE_BUSCA("?1", "?2", "?3", "?4");
+		if(db_prepare(DB_STMT_COUNT_NFE_BUSCA, sql, &err, &stmt)){
+			fprintf(stderr, "livrenfe: Error: %s", err);
+			while(n_termos > 0)
+				sqlite3_free(termos[--n_termos]);
+			return -ESQL;
+		}
+		bind_busca(stmt, 1, termos, n_termos);
+	} else {
+		char *sql = "SELECT count(*)\
+			FROM nfe n JOIN destinatarios d USING (id_destinatario)";
+		if(db_prepare(DB_STMT_COUNT_NFE, sql, &err, &stmt)){
+			fprintf(stderr, "livrenfe: Error: %s", err);
+			return -ESQL;
+		}
+	}
+	n = sqlite3_step(stmt) == SQLITE_ROW? sqlite3_column_int(stmt, 0) : 0;
+	db_done(stmt);
+	return n;
+}
+
+int db_list_nfe_page(enum nfe_list_ordem ordem, int asc, const char *filtro,
+		const NFE_LIST_ROW *depois, int pular, int limite,
+		NFE_LIST_ROW *rows){
+	sqlite3_stmt *stmt;
+	char *err, *termos[DB_BUSCA_TERMOS];
+	int rc, n = 0, n_termos, busca;
 
 	enum{
-		ID_NFE,
-		N_NFE,
-		SERIE,
-		DH_EMIS,
-		DESTINATARIO,
-		CANCELADA,
-		EMITIDA,
-		STATUS,
-		N_COLS
+		ID_NFE, N_NFE, SERIE, DH_EMIS, DESTINATARIO, CANCELADA,
+		EMITIDA
 	};
 
-	list_store = gtk_list_store_new(N_COLS, G_TYPE_INT, G_TYPE_INT,
-		G_TYPE_INT, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_INT,
-		G_TYPE_INT, G_TYPE_STRING);
-
-	char *sql = "SELECT id_nfe, num_nf, serie,\
-		strftime('%d/%m/%Y %H:%M:%S', dh_emis, 'unixepoch', 'localtime'), \
-		cnpj || ' - ' || nome as destinatario, canceled, protocolo\
-		FROM nfe JOIN destinatarios USING (id_destinatario);";
-	if(db_select(sql, &err, &stmt)){
-		return NULL;
+	asc = asc? 1 : 0;
+	n_termos = termos_busca(filtro, termos);
+	busca = n_termos > 0;
+	if(db_prepare(DB_STMT_NFE_PAGE_ID_DESC +
+			(busca * NFE_ORDENS + ordem) * 2 + asc,
+			nfe_page_sql[busca][ordem][asc], &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		while(n_termos > 0)
+			sqlite3_free(termos[--n_termos]);
+		return -ESQL;
+	}
+	if(depois == NULL){
+		sqlite3_int64 inicio = asc? INT64_MIN : INT64_MAX;
+		sqlite3_bind_int64(stmt, 1, inicio);
+		sqlite3_bind_int64(stmt, 2, inicio);
+	} else {
+		switch(ordem){
+			case NFE_ORDEM_EMISSAO:
+				sqlite3_bind_int64(stmt, 1, depois->dh_emis);
+				break;
+			case NFE_ORDEM_NUMERO:
+				sqlite3_bind_int(stmt, 1, depois->num_nf);
+				break;
+			default:
+				sqlite3_bind_int(stmt, 1, depois->id_nfe);
+				break;
+		}
+		sqlite3_bind_int(stmt, 2, depois->id_nfe);
+	}
+	if(busca)
+		bind_busca(stmt, 3, termos, n_termos);
+	sqlite3_bind_int(stmt, 7, limite);
+	sqlite3_bind_int(stmt, 8, pular);
+	while(n < limite && (rc = sqlite3_step(stmt)) == SQLITE_ROW){
+		const char *dest = (char*)sqlite3_column_text(stmt,
+			DESTINATARIO);
+		rows[n].id_nfe = sqlite3_column_int(stmt, ID_NFE);
+		rows[n].num_nf = sqlite3_column_int(stmt, N_NFE);
+		rows[n].serie = sqlite3_column_int(stmt, SERIE);
+		rows[n].dh_emis = sqlite3_column_int64(stmt, DH_EMIS);
+		rows[n].destinatario = dest? strdup(dest) : NULL;
+		rows[n].cancelada = sqlite3_column_int(stmt, CANCELADA);
+		rows[n].emitida = sqlite3_column_int(stmt, EMITIDA);
+		n++;
+	}
+	if(n < limite && rc != SQLITE_DONE){
+		fprintf(stderr, "livrenfe: Error: %s",
+			sqlite3_errmsg(sqlite3_db_handle(stmt)));
+		while(n > 0)
+			free(rows[--n].destinatario);
+		db_done(stmt);
+		return -ESQL;
 	}
+	db_done(stmt);
+	return n;
+}
 
-	do{
-		rc = sqlite3_step(stmt);
-		if(rc == SQLITE_ROW){
-			int id_nfe = sqlite3_column_int(stmt, 0);
-			int n_nfe = sqlite3_column_int(stmt, 1);
-			int serie = sqlite3_column_int(stmt, 2);
-			const unsigned char *dh_emis = sqlite3_column_text(stmt, 3);
-			const unsigned char *destinatario = sqlite3_column_text(stmt, 4);
-			int cancelada = sqlite3_column_int(stmt, 5);
-			int emitida = sqlite3_column_type(stmt, 6) == SQLITE_NULL? 0:1;
-			char *status;
-
-			status = emitida? "Autorizada" : "Não enviada";
-			status = cancelada? "Cancelada" : status;
+#define NFE_ITENS_INSERT "REPLACE INTO  nfe_itens (id_nfe, ordem,\
+	id_produto, icms_origem, icms_tipo, icms_aliquota,\
+	icms_valor, pis_aliquota, pis_quantidade,\
+	pis_nt, cofins_aliquota, cofins_quantidade, cofins_nt,\
+	ipi_sit_trib, ipi_classe, ipi_codigo, qtd, valor) VALUES "
+#define NFE_ITEM_VALUES "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"
+#define NFE_ITENS_VALUES_2 NFE_ITEM_VALUES ", " NFE_ITEM_VALUES
+#define NFE_ITENS_VALUES_4 NFE_ITENS_VALUES_2 ", " NFE_ITENS_VALUES_2
+#define NFE_ITENS_VALUES_LOTE NFE_ITENS_VALUES_4 ", " NFE_ITENS_VALUES_4
+/* número de linhas em NFE_ITENS_VALUES_LOTE */
+#define NFE_ITENS_POR_INSERT 8
+
+static int bind_item(sqlite3_stmt *stmt, int col, int id_nf, ITEM *item,
+		int id_produto){
+	IMPOSTO *imp = item->imposto;
+	ICMS *icms = imp->icms;
+	PIS *pis = imp->pis;
+	COFINS *cofins = imp->cofins;
+	IPI *ipi = imp->ipi;
+	sqlite3_bind_int(stmt, col++, id_nf);
+	sqlite3_bind_int(stmt, col++, item->ordem);
+	sqlite3_bind_int(stmt, col++, id_produto);
+	sqlite3_bind_int(stmt, col++, icms->origem);
+	sqlite3_bind_int(stmt, col++, icms->tipo);
+	sqlite3_bind_double(stmt, col++, icms->aliquota);
+	sqlite3_bind_double(stmt, col++, icms->valor);
+	sqlite3_bind_double(stmt, col++, pis->aliquota);
+	sqlite3_bind_int(stmt, col++, pis->quantidade);
+	sqlite3_bind_text(stmt, col++, pis->nt, -1, SQLITE_STATIC);
+	sqlite3_bind_double(stmt, col++, cofins->aliquota);
+	sqlite3_bind_int(stmt, col++, cofins->quantidade);
+	sqlite3_bind_text(stmt, col++, cofins->nt, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, col++, ipi->sit_trib);
+	sqlite3_bind_text(stmt, col++, ipi->classe, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, col++, ipi->codigo, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, col++, item->quantidade);
+	sqlite3_bind_double(stmt, col++, item->valor);
+	return col;
+}
 
-			gtk_list_store_append(list_store, &iter);
-			gtk_list_store_set(list_store, &iter, ID_NFE, id_nfe, 
-				N_NFE, n_nfe, SERIE, serie,
-				DH_EMIS, dh_emis, DESTINATARIO, destinatario, 
-				CANCELADA, cancelada, EMITIDA, emitida,
-				STATUS, status, -1);
-		} else if(rc == SQLITE_DONE){
-			break;
-		} else {
-			return NULL;
-		}
-	} while(rc == SQLITE_ROW);
+/* o escritor só vê o banco principal: uma NF-e que foi para um arquivo
+ * seria criada de novo aqui, sem o XML, e duplicada na lista */
+static int nfe_arquivada(int id_nfe){
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	int rc, arquivada;
+	char *sql = "SELECT NOT EXISTS (SELECT 1 FROM nfe WHERE id_nfe = ?1)\
+		AND ?1 <= (SELECT max(id_nfe_max) FROM arquivos);";
+	if(db_prepare(DB_STMT_NFE_ARQUIVADA, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, id_nfe);
+	rc = sqlite3_step(stmt);
+	arquivada = rc == SQLITE_ROW? sqlite3_column_int(stmt, 0) : -ESQL;
+	db_done(stmt);
+	return arquivada;
+}
 
-	
-	return list_store;
+/* blobs do XML e do protocolo de uma NF-e; 1 se ela não existe */
+static int nfe_blobs(int id_nfe, int *id_xml, int *id_xml_protocolo){
+	sqlite3_stmt *stmt;
+	char *err;
+	char *sql = "SELECT id_xml, id_xml_protocolo FROM nfe\
+		WHERE id_nfe = ?;";
+
+	*id_xml = *id_xml_protocolo = 0;
+	if(db_prepare(DB_STMT_GET_NFE_XML, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, id_nfe);
+	if(sqlite3_step(stmt) != SQLITE_ROW){
+		db_done(stmt);
+		return 1;
+	}
+	*id_xml = sqlite3_column_int(stmt, 0);
+	*id_xml_protocolo = sqlite3_column_int(stmt, 1);
+	db_done(stmt);
+	return 0;
 }
 
-int register_nfe(NFE *nfe){
-	set_chave(nfe);
+static int _register_nfe(NFE *nfe){
 	IDNFE *idnfe = nfe->idnfe;
 	DESTINATARIO *d = nfe->destinatario;
 	ENDERECO *ed = d->endereco;
-	char *sql, *err;
-	sql = malloc(400);
-	err = NULL;
-	int last_id, id_nf; 
-	sql = sqlite3_mprintf("REPLACE INTO destinatarios (id_destinatario,\
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	int last_id, id_nf, col, *id_produtos, id_xml, id_xml_protocolo, num;
+	int xml_ant = 0, protocolo_ant = 0, rc;
+	unsigned int n, lote;
+
+	if(idnfe->id_nfe && (rc = nfe_arquivada(idnfe->id_nfe)) != 0){
+		if(rc < 0)
+			return rc;
+		fprintf(stderr, "livrenfe: Error: NF-e %d is archived\n",
+			idnfe->id_nfe);
+		return -EARCHIVED;
+	}
+	/* sem número escolhido, a NF-e nova tira o próximo da sequência, na
+	 * mesma transação; dois terminais não recebem o mesmo número */
+	if(idnfe->id_nfe == 0 && idnfe->num_nf == 0){
+		if(db_seq_reservar(DB_SEQ_NFE, nfe->emitente->id, idnfe->mod,
+				idnfe->serie, 1, &num))
+			return -ESQL;
+		idnfe->num_nf = num;
+		/* uma chave já gerada foi feita sem o número */
+		if(idnfe->chave != NULL && set_chave(nfe))
+			return -EINVFIELD;
+	}
+	if(set_chave(nfe)){
+		fprintf(stderr, "livrenfe: Error: couldn't generate chave\n");
+		return -EINVFIELD;
+	}
+	char *sql = "REPLACE INTO destinatarios (id_destinatario,\
 		nome, tipo_ie, cnpj, rua, complemento, \
 		bairro, id_municipio, cep, numero, inscricao_estadual, \
-		tipo_doc) VALUES (%Q, %Q, '%d', %Q, %Q, %Q, %Q, \
-		'%d', '%d', %d, %Q, %Q);", 
-		d->id == 0? NULL : itoa(d->id), d->nome, d->tipo_ie, d->cnpj, 
-		ed->xLgr, ed->Cpl, ed->xBairro, ed->municipio->cMun, 
-		ed->CEP, ed->nro, d->inscricao_estadual, d->tipo_doc);
-	db_exec(sql, &err);
-	if(err){
+		tipo_doc) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+	if(db_prepare(DB_STMT_REPLACE_DESTINATARIO, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -1;
+	}
+	db_bind_id(stmt, 1, d->id);
+	sqlite3_bind_text(stmt, 2, d->nome, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 3, d->tipo_ie);
+	sqlite3_bind_text(stmt, 4, d->cnpj, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 5, ed->xLgr, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 6, ed->Cpl, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 7, ed->xBairro, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 8, ed->municipio->cMun);
+	sqlite3_bind_int(stmt, 9, ed->CEP);
+	sqlite3_bind_int(stmt, 10, ed->nro);
+	sqlite3_bind_text(stmt, 11, d->inscricao_estadual, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 12, d->tipo_doc, -1, SQLITE_STATIC);
+	if(db_run(stmt, &err)){
 		fprintf(stderr, "livrenfe: Error: %s", err);
 		return -1;
 	}
 	last_id = db_last_insert_id();
-       	sql = sqlite3_mprintf("REPLACE INTO nfe (id_municipio, nat_op, ind_pag, mod_nfe, \
+
+	if(db_blob_put(nfe->xml, &id_xml) ||
+			db_blob_put(nfe->protocolo->xml, &id_xml_protocolo))
+		return -1;
+	/* os blobs que a linha tinha, para soltar os que forem trocados */
+	if(idnfe->id_nfe && nfe_blobs(idnfe->id_nfe, &xml_ant,
+			&protocolo_ant) < 0)
+		return -1;
+
+	sql = "REPLACE INTO nfe (id_municipio, nat_op, ind_pag, mod_nfe, \
 		serie, num_nf, dh_emis, dh_saida, tipo, local_destino, \
 		tipo_impressao, tipo_ambiente, finalidade, consumidor_final, \
 		presencial, versao, div, chave, id_emitente, id_destinatario, \
 		q_itens, total, id_transportadora, cod_nfe, tipo_emissao, id_nfe,\
-		xml, protocolo, sefaz_cstat, sefaz_xmot, xml_protocolo, canceled,\
-		inf_ad_fisco, inf_ad_contrib) VALUES  \
-		(%d, %Q, %d, '%d', '%d', '%d', %lu, %Q, '%d', '%d' , '%d', '%d', \
-		 '%d', '%d', '%d', '%s', '%d', %Q, %d, '%d' , '%d', %f, %Q,\
-		 %d, %d, %Q, %Q, %Q, %d, %Q, %Q, %d, %Q, %Q);",
-		idnfe->municipio->cMun, idnfe->nat_op, idnfe->ind_pag, idnfe->mod, 
-		idnfe->serie, idnfe->num_nf, (unsigned long)idnfe->dh_emis,
-		idnfe->dh_saida == NULL? NULL:itoa(*idnfe->dh_saida), idnfe->tipo,
-		idnfe->local_destino, idnfe->tipo_impressao, idnfe->tipo_ambiente, 
-		idnfe->finalidade, idnfe->consumidor_final, idnfe->presencial,
-		VERSION_NAME, idnfe->div, idnfe->chave, nfe->emitente->id, 
-		last_id, nfe->q_itens, nfe->total, nfe->transp, idnfe->cod_nfe, 
-		idnfe->tipo_emissao, 
-		nfe->idnfe->id_nfe == 0? NULL:itoa(nfe->idnfe->id_nfe),
-		nfe->xml, nfe->protocolo->numero, nfe->protocolo->cod_status,
-		nfe->protocolo->xmot, nfe->protocolo->xml, nfe->canceled,
-		nfe->inf_ad_fisco, nfe->inf_ad_contrib);
-	db_exec(sql, &err);
-	if(err){
+		id_xml, protocolo, sefaz_cstat, sefaz_xmot, id_xml_protocolo,\
+		canceled, inf_ad_fisco, inf_ad_contrib) VALUES  \
+		(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, \
+		 ?, ?, NULL, ?, ?,\
+		 COALESCE(?, (SELECT max(id) + 1 FROM (SELECT max(id_nfe) AS id\
+			FROM nfe UNION ALL SELECT max(id_nfe_max) FROM arquivos\
+			UNION ALL SELECT 0))),\
+		 COALESCE(?, (SELECT id_xml FROM nfe WHERE id_nfe = ?)),\
+		 ?, ?, ?,\
+		 COALESCE(?, (SELECT id_xml_protocolo FROM nfe WHERE id_nfe = ?)),\
+		 ?, ?, ?);";
+	if(db_prepare(DB_STMT_REPLACE_NFE, sql, &err, &stmt)){
 		fprintf(stderr, "livrenfe: Error - %s", err);
 		return -1;
 	}
-	last_id = db_last_insert_id();
-	id_nf = last_id;
-	ITEM *item = nfe->itens;
-	sql = sqlite3_mprintf("DELETE FROM nfe_itens WHERE id_nfe = %d;",
-		last_id);
-	db_exec(sql, &err);
-	while(item != NULL){
-		PRODUTO *p = item->produto;
-		IMPOSTO *imp = item->imposto;
-		ICMS *icms = imp->icms;
-		PIS *pis = imp->pis;
-		COFINS *cofins = imp->cofins;
-		IPI *ipi = imp->ipi;
-		sql = sqlite3_mprintf("REPLACE INTO  produtos (id_produto, \
-			codigo, descricao, ncm, cfop, unidade,\
-			valor) VALUES (%Q, %Q, %Q, %d, %d, %Q, %f);",
-		       p->id == 0? NULL : itoa(p->id), p->codigo, 
-		       p->descricao, p->ncm, p->cfop, p->unidade_comercial,
-		       p->valor);
-		db_exec(sql, &err);
-		if(err){
+	col = 1;
+	sqlite3_bind_int(stmt, col++, idnfe->municipio->cMun);
+	sqlite3_bind_text(stmt, col++, idnfe->nat_op, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, col++, idnfe->ind_pag);
+	sqlite3_bind_int(stmt, col++, idnfe->mod);
+	sqlite3_bind_int(stmt, col++, idnfe->serie);
+	sqlite3_bind_int(stmt, col++, idnfe->num_nf);
+	sqlite3_bind_int64(stmt, col++, idnfe->dh_emis);
+	if(idnfe->dh_saida == NULL)
+		sqlite3_bind_null(stmt, col++);
+	else
+		sqlite3_bind_int64(stmt, col++, *idnfe->dh_saida);
+	sqlite3_bind_int(stmt, col++, idnfe->tipo);
+	sqlite3_bind_int(stmt, col++, idnfe->local_destino);
+	sqlite3_bind_int(stmt, col++, idnfe->tipo_impressao);
+	sqlite3_bind_int(stmt, col++, idnfe->tipo_ambiente);
+	sqlite3_bind_int(stmt, col++, idnfe->finalidade);
+	sqlite3_bind_int(stmt, col++, idnfe->consumidor_final);
+	sqlite3_bind_int(stmt, col++, idnfe->presencial);
+	sqlite3_bind_text(stmt, col++, VERSION_NAME, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, col++, idnfe->div);
+	sqlite3_bind_text(stmt, col++, idnfe->chave, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, col++, nfe->emitente->id);
+	sqlite3_bind_int(stmt, col++, last_id);
+	sqlite3_bind_int(stmt, col++, nfe->q_itens);
+	sqlite3_bind_double(stmt, col++, nfe->total);
+	sqlite3_bind_int(stmt, col++, idnfe->cod_nfe);
+	sqlite3_bind_int(stmt, col++, idnfe->tipo_emissao);
+	/* nova NF-e: depois da maior, mesmo das que foram para os arquivos
+	 * anuais, pois os leitores as veem juntas */
+	db_bind_id(stmt, col++, idnfe->id_nfe);
+	/* sem XML em memória (get_nfe() não o carrega) fica o que já havia */
+	db_bind_id(stmt, col++, id_xml);
+	db_bind_id(stmt, col++, idnfe->id_nfe);
+	sqlite3_bind_text(stmt, col++, nfe->protocolo->numero, -1,
+		SQLITE_STATIC);
+	sqlite3_bind_int(stmt, col++, nfe->protocolo->cod_status);
+	sqlite3_bind_text(stmt, col++, nfe->protocolo->xmot, -1,
+		SQLITE_STATIC);
+	db_bind_id(stmt, col++, id_xml_protocolo);
+	db_bind_id(stmt, col++, idnfe->id_nfe);
+	sqlite3_bind_int(stmt, col++, nfe->canceled);
+	sqlite3_bind_text(stmt, col++, nfe->inf_ad_fisco, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, col++, nfe->inf_ad_contrib, -1,
+		SQLITE_STATIC);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error - %s", err);
+		return -1;
+	}
+	id_nf = db_last_insert_id();
+	idnfe->id_nfe = id_nf;
+	/* um XML trocado, como o de uma NF-e assinada de novo, não fica
+	 * ocupando espaço */
+	if((id_xml && id_xml != xml_ant && db_blob_soltar(xml_ant)) ||
+			(id_xml_protocolo && id_xml_protocolo != protocolo_ant &&
+			db_blob_soltar(protocolo_ant)))
+		return -1;
+	/* o número pode ter sido digitado adiante da sequência */
+	if(db_seq_usar(DB_SEQ_NFE, nfe->emitente->id, idnfe->mod, idnfe->serie,
+			idnfe->num_nf))
+		return -1;
+
+	sql = "DELETE FROM nfe_itens WHERE id_nfe = ?;";
+	if(db_prepare(DB_STMT_DELETE_NFE_ITENS, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error - %s", err);
+		return -1;
+	}
+	sqlite3_bind_int(stmt, 1, id_nf);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error - %s", err);
+		return -1;
+	}
+
+	id_produtos = malloc(sizeof(int) * (nfe->q_itens + 1));
+	if(id_produtos == NULL)
+		return -1;
+	sql = "REPLACE INTO  produtos (id_produto, \
+		codigo, descricao, ncm, cfop, unidade,\
+		valor) VALUES (?, ?, ?, ?, ?, ?, ?);";
+	for(n = 0; n < nfe->q_itens; n++){
+		PRODUTO *p = nfe->itens[n]->produto;
+		if(db_prepare(DB_STMT_REPLACE_PRODUTO, sql, &err, &stmt)){
 			fprintf(stderr, "livrenfe: Error - %s", err);
+			free(id_produtos);
 			return -1;
 		}
-		last_id = db_last_insert_id();
-		sql = sqlite3_mprintf("REPLACE INTO  nfe_itens (id_nfe, ordem,\
-			id_produto, icms_origem, icms_tipo, icms_aliquota,\
-			icms_valor, pis_aliquota, pis_quantidade,\
-			pis_nt, cofins_aliquota, cofins_quantidade, cofins_nt,\
-			ipi_sit_trib, ipi_classe, ipi_codigo, qtd, valor)\
-			VALUES (%d, %d, %d, %d, %d, %f, %f, %f, %d, %Q, %f, \
-			%d, %Q, %d, %Q, %Q, %d, %f);",
-			id_nf, item->ordem, last_id, icms->origem, icms->tipo, 
-			icms->aliquota, icms->valor, pis->aliquota, 
-			pis->quantidade, pis->nt, cofins->aliquota,
-			cofins->quantidade, cofins->nt, ipi->sit_trib,
-			ipi->classe, ipi->codigo, item->quantidade,
-			item->valor);
-		db_exec(sql, &err);
-		if(err){
+		db_bind_id(stmt, 1, p->id);
+		sqlite3_bind_text(stmt, 2, p->codigo, -1, SQLITE_STATIC);
+		sqlite3_bind_text(stmt, 3, p->descricao, -1, SQLITE_STATIC);
+		sqlite3_bind_int(stmt, 4, p->ncm);
+		sqlite3_bind_int(stmt, 5, p->cfop);
+		sqlite3_bind_text(stmt, 6, p->unidade_comercial, -1,
+			SQLITE_STATIC);
+		sqlite3_bind_double(stmt, 7, p->valor);
+		if(db_run(stmt, &err)){
 			fprintf(stderr, "livrenfe: Error - %s", err);
+			free(id_produtos);
 			return -1;
 		}
-		item = item->pointer;
+		id_produtos[n] = db_last_insert_id();
 	}
+
+	/* itens em lotes de NFE_ITENS_POR_INSERT linhas por INSERT, o resto
+	 * linha a linha */
+	for(n = 0; n < nfe->q_itens; n += lote){
+		unsigned int i;
+		if(nfe->q_itens - n >= NFE_ITENS_POR_INSERT){
+			lote = NFE_ITENS_POR_INSERT;
+			col = db_prepare(DB_STMT_REPLACE_NFE_ITENS_LOTE,
+				NFE_ITENS_INSERT NFE_ITENS_VALUES_LOTE,
+				&err, &stmt);
+		} else {
+			lote = 1;
+			col = db_prepare(DB_STMT_REPLACE_NFE_ITEM,
+				NFE_ITENS_INSERT NFE_ITEM_VALUES, &err, &stmt);
+		}
+		if(col){
+			fprintf(stderr, "livrenfe: Error - %s", err);
+			free(id_produtos);
+			return -1;
+		}
+		col = 1;
+		for(i = n; i < n + lote; i++)
+			col = bind_item(stmt, col, id_nf, nfe->itens[i],
+				id_produtos[i]);
+		if(db_run(stmt, &err)){
+			fprintf(stderr, "livrenfe: Error - %s", err);
+			free(id_produtos);
+			return -1;
+		}
+	}
+	free(id_produtos);
+	return 0;
+}
+
+/* id, número e chave de uma NF-e antes do db_begin(); os que
+ * _register_nfe() gera somem no ROLLBACK e não podem ficar nela */
+struct nfe_ids {
+	int id_nfe;
+	unsigned int num_nf;
+	char *chave;
+};
+
+static int nfe_ids_guardar(NFE *nfe, struct nfe_ids *ids){
+	ids->id_nfe = nfe->idnfe->id_nfe;
+	ids->num_nf = nfe->idnfe->num_nf;
+	ids->chave = NULL;
+	/* set_chave() libera a chave antiga; guarda-se uma cópia */
+	if(nfe->idnfe->chave != NULL &&
+			(ids->chave = strdup(nfe->idnfe->chave)) == NULL)
+		return -1;
 	return 0;
 }
 
+static void nfe_ids_restaurar(NFE *nfe, const struct nfe_ids *ids){
+	IDNFE *idnfe = nfe->idnfe;
+
+	idnfe->id_nfe = ids->id_nfe;
+	idnfe->num_nf = ids->num_nf;
+	if(idnfe->chave == ids->chave || (idnfe->chave != NULL &&
+			ids->chave != NULL && !strcmp(idnfe->chave, ids->chave)))
+		return;
+	if(nfe->arena == NULL)
+		free(idnfe->chave);
+	idnfe->chave = NULL;
+	if(ids->chave != NULL){
+		idnfe->chave = nfe->arena? arena_strdup(nfe->arena, ids->chave) :
+			strdup(ids->chave);
+		idnfe->div = ids->chave[CHAVE_LEN - 1];
+	}
+}
+
+int register_nfe(NFE *nfe){
+	struct nfe_ids ids;
+	int rc;
+	if(nfe_ids_guardar(nfe, &ids))
+		return -1;
+	if(db_begin()){
+		free(ids.chave);
+		return -1;
+	}
+	if((rc = _register_nfe(nfe))){
+		db_rollback();
+		nfe_ids_restaurar(nfe, &ids);
+	} else if(db_commit()){
+		nfe_ids_restaurar(nfe, &ids);
+		rc = -1;
+	}
+	free(ids.chave);
+	return rc;
+}
+
 GtkListStore *db_list_uf(){
 	sqlite3_stmt *stmt;
 	char *err;
@@ -206,7 +595,7 @@ GtkListStore *db_list_uf(){
 	list_store = gtk_list_store_new(N_COLS, G_TYPE_STRING, G_TYPE_STRING);
 
 	char *sql = "SELECT cod_ibge, nome FROM uf;";
-	if(db_select(sql, &err, &stmt)){
+	if(db_prepare(DB_STMT_LIST_UF, sql, &err, &stmt)){
 		return NULL;
 	}
 
@@ -222,9 +611,11 @@ GtkListStore *db_list_uf(){
 		} else if(rc == SQLITE_DONE){
 			break;
 		} else {
+			db_done(stmt);
 			return NULL;
 		}
 	} while(rc == SQLITE_ROW);
+	db_done(stmt);
 
 	
 	return list_store;
@@ -245,13 +636,12 @@ GtkListStore *db_list_municipios(char *uf){
 
 	list_store = gtk_list_store_new(N_COLS, G_TYPE_STRING, G_TYPE_STRING);
 
-	char *sql = malloc(100);
-       	sprintf(sql, "SELECT m.id_municipio, m.nome FROM municipios m\
-		JOIN uf u using(id_uf) WHERE u.cod_ibge = '%s';",
-			uf);
-	if(db_select(sql, &err, &stmt)){
+	char *sql = "SELECT m.id_municipio, m.nome FROM municipios m\
+		JOIN uf u using(id_uf) WHERE u.cod_ibge = ?;";
+	if(db_prepare(DB_STMT_LIST_MUNICIPIOS, sql, &err, &stmt)){
 		return NULL;
 	}
+	sqlite3_bind_text(stmt, 1, uf, -1, SQLITE_STATIC);
 
 	do{
 		rc = sqlite3_step(stmt);
@@ -265,9 +655,11 @@ GtkListStore *db_list_municipios(char *uf){
 		} else if(rc == SQLITE_DONE){
 			break;
 		} else {
+			db_done(stmt);
 			return NULL;
 		}
 	} while(rc == SQLITE_ROW);
+	db_done(stmt);
 
 	
 	return list_store;
@@ -285,7 +677,7 @@ static int get_itens(NFE *n){
 		QTD, DESC, NCM, CFOP, UNIDADE, VALOR, COD_PROD, N_COLS
 	};
 
-	char *sql = sqlite3_mprintf("SELECT ni.id_nfe, ni.ordem, ni.id_produto,\
+	char *sql = "SELECT ni.id_nfe, ni.ordem, ni.id_produto,\
 		ni.icms_origem, ni.icms_tipo, ni.icms_aliquota, ni.icms_valor,\
 		ni.pis_aliquota, ni.pis_quantidade, ni.pis_nt, ni.cofins_aliquota,\
 		ni.cofins_quantidade, ni.cofins_nt, ni.ipi_sit_trib,\
@@ -293,22 +685,24 @@ static int get_itens(NFE *n){
 		p.cfop, p.unidade, p.valor, p.codigo\
 		FROM produtos p LEFT JOIN nfe_itens ni\
 			ON ni.id_produto = p.id_produto\
-		WHERE ni.id_nfe = %d", n->idnfe->id_nfe);
-	if(db_select(sql, &err, &stmt)){
+		WHERE ni.id_nfe = ?";
+	if(db_prepare(DB_STMT_GET_ITENS, sql, &err, &stmt)){
 		return -ESQL;
 	}
+	sqlite3_bind_int(stmt, 1, n->idnfe->id_nfe);
 
 	do{
-		ITEM *i = new_item();
 		rc = sqlite3_step(stmt);
 		if(rc == SQLITE_ROW){
+			ITEM *i = new_item_arena(n->arena);
 			int ordem, id_produto, icms_origem, icms_tipo,
 				pis_quantidade, pis_nt, cofins_quantidade,
 				cofins_nt, ipi_sit_trib, ncm, cfop;
 			double icms_aliquota, icms_valor, pis_aliquota,
 				cofins_aliquota, valor, quantidade;
 			char *descricao, *unidade, *ipi_classe, *ipi_codigo,
-				*cod_prod; 
+				*cod_prod;
+			ipi_classe = ipi_codigo = cod_prod = NULL;
 
 			ordem = sqlite3_column_int(stmt, ORDEM);
 			id_produto = sqlite3_column_int(stmt, ID_PRODUTO);
@@ -330,19 +724,20 @@ static int get_itens(NFE *n){
 			valor = sqlite3_column_double(stmt, VALOR);
 			quantidade = sqlite3_column_double(stmt, QTD);
 
-			descricao = strdup((char*)sqlite3_column_text(stmt, DESC));
-			unidade = strdup((char*)sqlite3_column_text(stmt, UNIDADE));
+			// inst_item() copia as strings para a arena da NF
+			descricao = (char*)sqlite3_column_text(stmt, DESC);
+			unidade = (char*)sqlite3_column_text(stmt, UNIDADE);
 			if(sqlite3_column_type(stmt, IPI_CLASSE) != SQLITE_NULL){
-				ipi_classe = strdup((char*)sqlite3_column_text(stmt, 
-					IPI_CLASSE));
+				ipi_classe = (char*)sqlite3_column_text(stmt, 
+					IPI_CLASSE);
 			}
 			if(sqlite3_column_type(stmt, IPI_CODIGO) != SQLITE_NULL){
-				ipi_codigo = strdup((char*)sqlite3_column_text(stmt, 
-					IPI_CODIGO));
+				ipi_codigo = (char*)sqlite3_column_text(stmt, 
+					IPI_CODIGO);
 			}
 			if(sqlite3_column_type(stmt, COD_PROD) != SQLITE_NULL){
-				cod_prod = strdup((char*)sqlite3_column_text(stmt, 
-					COD_PROD));
+				cod_prod = (char*)sqlite3_column_text(stmt, 
+					COD_PROD);
 			}
 
 			inst_item(valor, quantidade, 
@@ -356,9 +751,11 @@ static int get_itens(NFE *n){
 		} else if(rc == SQLITE_DONE){
 			break;
 		} else {
+			db_done(stmt);
 			return -ESQL;
 		}
 	} while(rc == SQLITE_ROW);
+	db_done(stmt);
 	return 0;
 }
 
@@ -367,86 +764,85 @@ NFE *get_nfe(int id){
 	char *err;
 	int rc;
 	NFE *nfe = NULL;
-	int id_nfe, id_mun, id_uf, ind_pag, mod_nfe, serie,
+	ARENA *arena;
+	int id_nfe, id_mun, ind_pag, mod_nfe, serie,
 		num_nf, tipo, local_destino, tipo_impressao,
 		tipo_emissao, tipo_ambiente, finalidade, 
 		consumidor_final, presencial, q_itens,
 		id_emit, crt_emit, id_mun_emit,
-		id_uf_emit, cep_emit, id_dest, t_ie_dest,
-		id_mun_dest, id_uf_dest, cod_nfe,
+		cep_emit, id_dest, t_ie_dest,
+		id_mun_dest, cod_nfe,
 		num_e_emit, num_e_dest, cep_dest, canceled;
-	id_nfe = id_mun = id_uf = ind_pag = mod_nfe = serie =
+	id_nfe = id_mun = ind_pag = mod_nfe = serie =
 		num_nf = tipo = local_destino = tipo_impressao =
 		tipo_emissao = tipo_ambiente = finalidade = 
 		consumidor_final = presencial = q_itens =
 		id_emit = crt_emit = id_mun_emit =
-		id_uf_emit = cep_emit = id_dest = t_ie_dest =
-		id_mun_dest = id_uf_dest = cod_nfe =
+		cep_emit = id_dest = t_ie_dest =
+		id_mun_dest = cod_nfe =
 		num_e_emit = num_e_dest = cep_dest = canceled = 0;
 	time_t dh_emis = 0, *dh_saida = NULL;
 	double total = 0;
-	char *nome_mun, *uf, *nat_op, *versao,  *nome_emit, 
+	char *nat_op, *versao,  *nome_emit, 
 		*cnpj_emit, *rua_emit, *comp_emit, *bairro_emit,
-		*mun_emit, *uf_emit, *nome_dest, *cnpj_dest,
-		*rua_dest, *comp_dest,*bairro_dest, *mun_dest,
-		*uf_dest, *chave, div, *ie_emit, *ie_dest,
-		*inf_ad_fisco, *inf_ad_contrib, *tipo_doc_dest, *protocolo,
-		*xml, *xml_protocolo;
-	nome_mun = uf = nat_op = versao =  nome_emit = 
+		*nome_dest, *cnpj_dest,
+		*rua_dest, *comp_dest,*bairro_dest,
+		*chave, div, *ie_emit, *ie_dest,
+		*inf_ad_fisco, *inf_ad_contrib, *tipo_doc_dest, *protocolo;
+	nat_op = versao =  nome_emit = 
 		cnpj_emit = rua_emit = comp_emit = bairro_emit =
-		mun_emit = uf_emit = nome_dest = cnpj_dest =
-		rua_dest = comp_dest =bairro_dest = mun_dest =
-		uf_dest = chave = ie_emit = ie_dest = inf_ad_fisco = 
-		inf_ad_contrib = tipo_doc_dest = protocolo = xml = 
-		xml_protocolo = NULL;
+		nome_dest = cnpj_dest =
+		rua_dest = comp_dest =bairro_dest =
+		chave = ie_emit = ie_dest = inf_ad_fisco = 
+		inf_ad_contrib = tipo_doc_dest = protocolo = NULL;
 	div = 0;
 
 	enum{
-		ID_NFE, ID_MUN, MUN, ID_UF, UF, NAT_OP, IND_PAG, MOD_NFE,
+		ID_NFE, ID_MUN, NAT_OP, IND_PAG, MOD_NFE,
 		SERIE, NUM_NF, DH_EMIS, DH_SAIDA, TIPO, LOCAL_DESTINO,
 		TIPO_IMPRESSAO, TIPO_EMISSAO, TIPO_AMBIENTE, FINALIDADE, 
 		CONSUMIDOR_FINAL, PRESENCIAL, VERSAO, DIV, CHAVE, Q_ITENS, 
 		TOTAL, ID_EMIT, NOME_EMIT, IE_EMIT, CRT_EMIT, CNPJ_EMIT, 
-		RUA_EMIT, COMP_EMIT, BAIRRO_EMIT, ID_MUN_EMIT, MUN_EMIT, 
-		ID_UF_EMIT, UF_EMIT, CEP_EMIT, ID_DEST, NOME_DEST, T_IE_DEST, 
+		RUA_EMIT, COMP_EMIT, BAIRRO_EMIT, ID_MUN_EMIT, 
+		CEP_EMIT, ID_DEST, NOME_DEST, T_IE_DEST, 
 		CNPJ_DEST, RUA_DEST, COMP_DEST, BAIRRO_DEST, ID_MUN_DEST, 
-		MUN_DEST, ID_UF_DEST, UF_DEST, COD_NFE, NUM_E_EMIT, NUM_E_DEST,
+		COD_NFE, NUM_E_EMIT, NUM_E_DEST,
 		IE_DEST, TIPO_DOC_DEST, CEP_DEST, CANCELED, PROTOCOLO, 
-		INF_AD_FISCO, INF_AD_CONTRIB, NFE_XML, PROT_XML, N_COLS
+		INF_AD_FISCO, INF_AD_CONTRIB, N_COLS
 	};
 
-	char *sql = sqlite3_mprintf("SELECT n.id_nfe, m.id_municipio, m.nome, u.cod_ibge, u.nome, \
+	// Município, UF e país vêm da tabela compartilhada de geo.h
+	char *sql = "SELECT n.id_nfe, n.id_municipio, \
 		n.nat_op, n.ind_pag, n.mod_nfe, n.serie, n.num_nf, n.dh_emis, n.dh_saida, \
 		n.tipo, n.local_destino, n.tipo_impressao, n.tipo_emissao, n.tipo_ambiente, \
 		n.finalidade, n.consumidor_final, n.presencial, n.versao, n.div, n.chave, \
 		n.q_itens, n.total, e.id_emitente, e.nome, e.inscricao_estadual, \
-		e.crt, e.cnpj, e.rua, e.complemento, e.bairro, e.id_municipio, m_e.nome, \
-		u_e.cod_ibge, u_e.nome, e.cep, d.id_destinatario, d.nome, d.tipo_ie, \
-		d.cnpj, d.rua, d.complemento, d.bairro, m_d.id_municipio, m_d.nome, \
-		u_d.cod_ibge, u_d.nome, n.cod_nfe, e.numero, d.numero, \
+		e.crt, e.cnpj, e.rua, e.complemento, e.bairro, e.id_municipio, \
+		e.cep, d.id_destinatario, d.nome, d.tipo_ie, \
+		d.cnpj, d.rua, d.complemento, d.bairro, d.id_municipio, \
+		n.cod_nfe, e.numero, d.numero, \
 		d.inscricao_estadual, d.tipo_doc, d.cep, n.canceled, n.protocolo,\
-		n.inf_ad_fisco, n.inf_ad_contrib, n.xml, n.xml_protocolo\
-		FROM nfe n LEFT JOIN municipios m ON m.id_municipio = n.id_municipio \
-		LEFT JOIN uf u ON u.id_uf = m.id_uf \
+		n.inf_ad_fisco, n.inf_ad_contrib\
+		FROM nfe n \
 		LEFT JOIN emitentes e ON e.id_emitente = n.id_emitente \
-		LEFT JOIN municipios m_e ON m_e.id_municipio = e.id_municipio \
-		LEFT JOIN uf u_e ON u_e.id_uf = m_e.id_uf \
 		LEFT JOIN destinatarios d ON d.id_destinatario = n.id_destinatario \
-		LEFT JOIN municipios m_d ON m_d.id_municipio = d.id_municipio \
-		LEFT JOIN uf u_d ON u_d.id_uf = m_d.id_uf \
-		WHERE n.id_nfe = %d", id);
-	if(db_select(sql, &err, &stmt)){
+		WHERE n.id_nfe = ?";
+	if(db_prepare(DB_STMT_GET_NFE, sql, &err, &stmt)){
+		return NULL;
+	}
+	sqlite3_bind_int(stmt, 1, id);
+	// Todo o grafo da NF é alocado numa arena, liberada por free_nfe()
+	if((arena = new_arena(0)) == NULL){
+		db_done(stmt);
 		return NULL;
 	}
 
 	do{
 		rc = sqlite3_step(stmt);
 		if(rc == SQLITE_ROW){
-			nfe = new_nfe();
 
 			id_nfe = sqlite3_column_int(stmt, ID_NFE);
 			id_mun = sqlite3_column_int(stmt, ID_MUN);
-			id_uf = sqlite3_column_int(stmt, ID_UF);
 			ind_pag = sqlite3_column_int(stmt, IND_PAG);
 			mod_nfe = sqlite3_column_int(stmt, MOD_NFE);
 			serie = sqlite3_column_int(stmt, SERIE);
@@ -465,13 +861,11 @@ NFE *get_nfe(int id){
 			id_emit = sqlite3_column_int(stmt, ID_EMIT);
 			crt_emit = sqlite3_column_int(stmt, CRT_EMIT);
 			id_mun_emit = sqlite3_column_int(stmt, ID_MUN_EMIT);
-			id_uf_emit = sqlite3_column_int(stmt, ID_UF_EMIT);
 			cep_emit = sqlite3_column_int(stmt, CEP_EMIT);
 			cep_dest = sqlite3_column_int(stmt, CEP_DEST);
 			id_dest = sqlite3_column_int(stmt, ID_DEST);
 			t_ie_dest = sqlite3_column_int(stmt, T_IE_DEST);
 			id_mun_dest = sqlite3_column_int(stmt, ID_MUN_DEST);
-			id_uf_dest = sqlite3_column_int(stmt, ID_UF_DEST);
 			cod_nfe = sqlite3_column_int(stmt, COD_NFE);
 			num_e_emit = sqlite3_column_int(stmt, NUM_E_EMIT);
 			num_e_dest = sqlite3_column_int(stmt, NUM_E_DEST);
@@ -479,105 +873,118 @@ NFE *get_nfe(int id){
 			canceled = sqlite3_column_int(stmt, CANCELED); 
 
 			dh_emis = sqlite3_column_double(stmt, DH_EMIS);
-			dh_saida = malloc(sizeof(time_t));
 			if(sqlite3_column_type(stmt, DH_SAIDA) == SQLITE_NULL){
-				free(dh_saida);
 				dh_saida = NULL;
 			} else {
+				dh_saida = arena_alloc(arena, sizeof(time_t));
 				*dh_saida = sqlite3_column_double(stmt, DH_SAIDA);
 			}
 			total = sqlite3_column_double(stmt, TOTAL);
 
-			nome_mun = strdup((char*)sqlite3_column_text(stmt, MUN)); 
-			uf = strdup((char*)sqlite3_column_text(stmt, UF)); 
-			nat_op = strdup((char*)sqlite3_column_text(stmt, NAT_OP)); 
-			versao = strdup((char*)sqlite3_column_text(stmt, VERSAO)); 
-			nome_emit = strdup((char*)sqlite3_column_text(stmt, NOME_EMIT)); 
-			cnpj_emit = strdup((char*)sqlite3_column_text(stmt, CNPJ_EMIT)); 
-			rua_emit = strdup((char*)sqlite3_column_text(stmt, RUA_EMIT)); 
+			nat_op = arena_strdup(arena, (char*)sqlite3_column_text(stmt, NAT_OP)); 
+			versao = arena_strdup(arena, (char*)sqlite3_column_text(stmt, VERSAO)); 
+			nome_emit = arena_strdup(arena, (char*)sqlite3_column_text(stmt, NOME_EMIT)); 
+			cnpj_emit = arena_strdup(arena, (char*)sqlite3_column_text(stmt, CNPJ_EMIT)); 
+			rua_emit = arena_strdup(arena, (char*)sqlite3_column_text(stmt, RUA_EMIT)); 
 			//comp_emit = strdup(sqlite3_column_text(stmt, COMP_EMIT)); 
-			bairro_emit = strdup((char*)sqlite3_column_text(stmt, BAIRRO_EMIT)); 
-			mun_emit = strdup((char*)sqlite3_column_text(stmt, MUN_EMIT)); 
-			uf_emit = strdup((char*)sqlite3_column_text(stmt, UF_EMIT)); 
-			ie_emit = strdup((char*)sqlite3_column_text(stmt, IE_EMIT));
+			bairro_emit = arena_strdup(arena, (char*)sqlite3_column_text(stmt, BAIRRO_EMIT)); 
+			ie_emit = arena_strdup(arena, (char*)sqlite3_column_text(stmt, IE_EMIT));
 			//ie_dest = strdup(sqlite3_column_text(stmt, IE_DEST));
-			nome_dest = strdup((char*)sqlite3_column_text(stmt, NOME_DEST)); 
-			cnpj_dest = strdup((char*)sqlite3_column_text(stmt, CNPJ_DEST)); 
-			rua_dest = strdup((char*)sqlite3_column_text(stmt, RUA_DEST)); 
-			comp_dest = strdup((char*)sqlite3_column_text(stmt, COMP_DEST)); 
-			bairro_dest = strdup((char*)sqlite3_column_text(stmt, BAIRRO_DEST)); 
-			mun_dest = strdup((char*)sqlite3_column_text(stmt, MUN_DEST)); 
-			uf_dest = strdup((char*)sqlite3_column_text(stmt, UF_DEST)); 
-			tipo_doc_dest = strdup((char*)sqlite3_column_text(stmt, TIPO_DOC_DEST));
-			chave = strdup((char*)sqlite3_column_text(stmt, CHAVE)); 
+			nome_dest = arena_strdup(arena, (char*)sqlite3_column_text(stmt, NOME_DEST)); 
+			cnpj_dest = arena_strdup(arena, (char*)sqlite3_column_text(stmt, CNPJ_DEST)); 
+			rua_dest = arena_strdup(arena, (char*)sqlite3_column_text(stmt, RUA_DEST)); 
+			comp_dest = arena_strdup(arena, (char*)sqlite3_column_text(stmt, COMP_DEST)); 
+			bairro_dest = arena_strdup(arena, (char*)sqlite3_column_text(stmt, BAIRRO_DEST)); 
+			tipo_doc_dest = arena_strdup(arena, (char*)sqlite3_column_text(stmt, TIPO_DOC_DEST));
+			chave = arena_strdup(arena, (char*)sqlite3_column_text(stmt, CHAVE)); 
 			if(sqlite3_column_type(stmt, PROTOCOLO) == SQLITE_NULL){
 				protocolo = NULL;
 			} else {
-				protocolo = strdup((char*)sqlite3_column_text(stmt,
+				protocolo = arena_strdup(arena, (char*)sqlite3_column_text(stmt,
 					PROTOCOLO)); 
 			}
 			if(sqlite3_column_type(stmt, INF_AD_FISCO) == SQLITE_NULL){
 				inf_ad_fisco = NULL;
 			} else {
-				inf_ad_fisco = strdup((char*)sqlite3_column_text(stmt,
+				inf_ad_fisco = arena_strdup(arena, (char*)sqlite3_column_text(stmt,
 					INF_AD_FISCO)); 
 			}
 			if(sqlite3_column_type(stmt, INF_AD_CONTRIB) == SQLITE_NULL){
 				inf_ad_contrib = NULL;
 			} else {
-				inf_ad_contrib = strdup((char*)sqlite3_column_text(stmt,
+				inf_ad_contrib = arena_strdup(arena, (char*)sqlite3_column_text(stmt,
 					INF_AD_CONTRIB)); 
 			}
-			if(sqlite3_column_type(stmt, NFE_XML) != SQLITE_NULL){
-				xml = strdup((char*)sqlite3_column_text(stmt,
-					NFE_XML)); 
-			}
-			if(sqlite3_column_type(stmt, PROT_XML) != SQLITE_NULL){
-				xml_protocolo = strdup((char*)sqlite3_column_text(stmt,
-					PROT_XML)); 
-			}
 		} else if(rc == SQLITE_DONE){
 			break;
 		} else {
+			db_done(stmt);
+			free_arena(arena);
 			return NULL;
 		}
 	} while(rc == SQLITE_ROW);
-	nfe = new_nfe();
+	db_done(stmt);
+	nfe = new_nfe_arena(arena);
 
 	//EMITENTE
 	inst_endereco(rua_emit, num_e_emit, comp_emit, bairro_emit, cep_emit,
-		mun_emit, id_mun_emit, uf_emit, id_uf_emit, "Brasil", 1058,
-		nfe->emitente->endereco);
+		id_mun_emit, nfe->emitente->endereco);
 	inst_emitente(id_emit, nome_emit, ie_emit, crt_emit, cnpj_emit,
 		nfe->emitente->endereco, nfe->emitente);
 
 
 	//DESTINATARIO
 	inst_endereco(rua_dest, num_e_dest, comp_dest, bairro_dest, cep_dest,
-		mun_dest, id_mun_dest, uf_dest, id_uf_dest, "Brasil", 1058,
-		nfe->destinatario->endereco);
+		id_mun_dest, nfe->destinatario->endereco);
 	inst_destinatario(id_dest, nome_dest, t_ie_dest, tipo_doc_dest, 
 		ie_dest, cnpj_dest, nfe->destinatario->endereco, nfe->destinatario);
 
-	//MUNICIPIO DA NFE
-	inst_municipio(nome_mun, id_mun, uf, id_uf, "Brasil", 1058,
-		nfe->idnfe->municipio);
-
 	inst_nfe(id_nfe, serie, num_nf, ind_pag, mod_nfe, tipo, local_destino,
 		tipo_impressao, tipo_emissao, tipo_ambiente, finalidade,
 		consumidor_final, presencial, cod_nfe, dh_emis, dh_saida,
 		nat_op, versao, inf_ad_fisco, inf_ad_contrib, NULL,
-		nfe->emitente, nfe->destinatario, nfe->idnfe->municipio,
-		nfe);
+		nfe->emitente, nfe->destinatario,
+		geo_municipio_ou_nenhum(id_mun), nfe);
 
-	nfe->xml = xml;
 	nfe->protocolo->numero = protocolo;
-	nfe->protocolo->xml = xml_protocolo;
 
 	get_itens(nfe);
 	return nfe; 
 }
 
+int db_load_nfe_xml(NFE *nfe){
+	char *xml = NULL, *xml_protocolo = NULL;
+	int id_xml, id_xml_protocolo;
+
+	if(nfe_blobs(nfe->idnfe->id_nfe, &id_xml, &id_xml_protocolo))
+		return -ESQL;
+	if(nfe->xml)
+		id_xml = 0;
+	if(nfe->protocolo->xml)
+		id_xml_protocolo = 0;
+
+	if(db_blob_get(id_xml, &xml) ||
+			db_blob_get(id_xml_protocolo, &xml_protocolo)){
+		free(xml);
+		return -ESQL;
+	}
+	if(nfe->arena == NULL){
+		if(xml)
+			nfe->xml = xml;
+		if(xml_protocolo)
+			nfe->protocolo->xml = xml_protocolo;
+		return 0;
+	}
+	// Copiados para a arena, liberados junto com a NF
+	if(xml)
+		nfe->xml = arena_strdup(nfe->arena, xml);
+	if(xml_protocolo)
+		nfe->protocolo->xml = arena_strdup(nfe->arena, xml_protocolo);
+	free(xml);
+	free(xml_protocolo);
+	return 0;
+}
+
 EMITENTE *get_emitente(int id){
 	EMITENTE *e = new_emitente();
 
@@ -585,25 +992,23 @@ EMITENTE *get_emitente(int id){
 	sqlite3_stmt *stmt;
 	enum{
 		ID_EMIT, NOME, IE, CRT, CNPJ, RUA, BAIRRO, ID_MUN, CEP,
-		NUM, COMP, MUN, ID_UF, UF
+		NUM, COMP
 	};
-	int crt, num, id_uf, id_mun, cep, rc;
-	char *nome, *ie, *cnpj, *rua, *bairro, *mun, *uf, *comp;
-	char *sql = sqlite3_mprintf("SELECT e.id_emitente, e.nome,\
+	int crt, num, id_mun, cep, rc;
+	char *nome, *ie, *cnpj, *rua, *bairro, *comp;
+	char *sql = "SELECT e.id_emitente, e.nome,\
 		e.inscricao_estadual, e.crt, e.cnpj, e.rua, e.bairro,\
-		e.id_municipio, e.cep, e.numero, e.complemento, m.nome,\
-		u.cod_ibge, u.nome\
-		FROM emitentes e LEFT JOIN municipios m \
-			ON m.id_municipio = e.id_municipio\
-		LEFT JOIN uf u ON u.id_uf = m.id_uf\
-		WHERE e.id_emitente = %d", id);
-	if(db_select(sql, &err, &stmt)){
+		e.id_municipio, e.cep, e.numero, e.complemento\
+		FROM emitentes e WHERE e.id_emitente = ?";
+	if(db_prepare(DB_STMT_GET_EMITENTE, sql, &err, &stmt)){
 		free_emitente(e);
 		return NULL;
 	}
+	sqlite3_bind_int(stmt, 1, id);
 
 	rc = sqlite3_step(stmt);
 	if(rc != SQLITE_ROW){
+		db_done(stmt);
 		free_emitente(e);
 		return NULL;
 	}
@@ -615,19 +1020,15 @@ EMITENTE *get_emitente(int id){
 
 	rua = strdup((char*)sqlite3_column_text(stmt, RUA));
 	bairro = strdup((char*)sqlite3_column_text(stmt, BAIRRO));
-	mun = strdup((char*)sqlite3_column_text(stmt, MUN));
-	
-	id_uf = sqlite3_column_int(stmt, ID_UF);
-	uf = strdup((char*)sqlite3_column_text(stmt, UF));
 	
 	comp = sqlite3_column_text(stmt, COMP)? 
 		strdup((char*)sqlite3_column_text(stmt, COMP)) : NULL;
 	num = sqlite3_column_int(stmt, NUM);
 	id_mun = sqlite3_column_int(stmt, ID_MUN);
 	cep = sqlite3_column_int(stmt, CEP);
+	db_done(stmt);
 
-	inst_endereco(rua, num, comp, bairro, cep, mun, id_mun, uf, id_uf, 
-		"Brasil", 1058,  e->endereco);
+	inst_endereco(rua, num, comp, bairro, cep, id_mun, e->endereco);
 	inst_emitente(id, nome, ie, crt, cnpj, e->endereco, e);
 	return e;
 
@@ -639,29 +1040,30 @@ DESTINATARIO *get_destinatario_by_doc(const char *doc){
 	sqlite3_stmt *stmt;
 	enum{
 		ID_DEST, NOME, TIPO_IE, IE, TIPO_DOC, CNPJ, RUA, BAIRRO, 
-		ID_MUN, CEP, NUM, COMP, MUN, ID_UF, UF
+		ID_MUN, CEP, NUM, COMP
 	};
-	int id, num, id_uf, id_mun, cep, rc, t_ie;
-	char *nome, *ie, *cnpj, *rua, *bairro, *mun, *uf, *comp, *tipo_doc;
-	char *sql = sqlite3_mprintf("SELECT d.id_destinatario, d.nome,\
+	int id, num, id_mun, cep, rc, t_ie;
+	char *nome, *ie, *cnpj, *rua, *bairro, *comp, *tipo_doc;
+	char *sql = "SELECT d.id_destinatario, d.nome,\
 		d.tipo_ie, d.inscricao_estadual, d.tipo_doc, d.cnpj, d.rua, \
-		d.bairro, d.id_municipio, d.cep, d.numero, d.complemento, \
-		m.nome, u.cod_ibge, u.nome\
-		FROM destinatarios d LEFT JOIN municipios m \
-			ON m.id_municipio = d.id_municipio\
-		LEFT JOIN uf u ON u.id_uf = m.id_uf\
-		WHERE d.cnpj = %Q ORDER BY d.id_destinatario desc", doc);
-	if(db_select(sql, &err, &stmt)){
+		d.bairro, d.id_municipio, d.cep, d.numero, d.complemento\
+		FROM destinatarios d\
+		WHERE d.cnpj = ? ORDER BY d.id_destinatario desc";
+	if(db_prepare(DB_STMT_GET_DESTINATARIO_DOC, sql, &err, &stmt)){
+		free_destinatario(d);
 		return NULL;
 	}
+	sqlite3_bind_text(stmt, 1, doc, -1, SQLITE_STATIC);
 
 	rc = sqlite3_step(stmt);
-	if(rc != SQLITE_ROW)
+	if(rc != SQLITE_ROW){
+		db_done(stmt);
+		free_destinatario(d);
 		return NULL;
+	}
 
 	id = sqlite3_column_int(stmt, ID_DEST);
 	num = sqlite3_column_int(stmt, NUM);
-	id_uf = sqlite3_column_int(stmt, ID_UF);
 	id_mun = sqlite3_column_int(stmt, ID_MUN);
 	cep = sqlite3_column_int(stmt, CEP);
 	t_ie = sqlite3_column_int(stmt, TIPO_IE);
@@ -672,176 +1074,275 @@ DESTINATARIO *get_destinatario_by_doc(const char *doc){
 	cnpj = strdup((char*)sqlite3_column_text(stmt, CNPJ));
 	rua = strdup((char*)sqlite3_column_text(stmt, RUA));
 	bairro = strdup((char*)sqlite3_column_text(stmt, BAIRRO));
-	mun = strdup((char*)sqlite3_column_text(stmt, MUN));
-	uf = strdup((char*)sqlite3_column_text(stmt, UF));
 	tipo_doc = strdup((char*)sqlite3_column_text(stmt, TIPO_DOC));
 	comp = sqlite3_column_text(stmt, COMP)? 
 		strdup((char*)sqlite3_column_text(stmt, COMP)) : NULL;
-	inst_endereco(rua, num, comp, bairro, cep, mun, id_mun, uf, id_uf, 
-		"Brasil", 1058, d->endereco);
+	db_done(stmt);
+	inst_endereco(rua, num, comp, bairro, cep, id_mun, d->endereco);
 	inst_destinatario(id, nome, t_ie, tipo_doc, ie, cnpj, d->endereco, d);
 	return d;
 }
 
 int set_emitente(EMITENTE *e){
-	char *sql, *err;
-	err = NULL;
-       	sql = sqlite3_mprintf("REPLACE INTO emitentes\
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	char *sql = "REPLACE INTO emitentes\
   		(id_emitente, nome, inscricao_estadual, crt, cnpj, rua,\
 		complemento, bairro, id_municipio, cep, numero)\
- 		VALUES (1, %Q, %Q, %d, %Q, %Q, %Q, %Q, %d, %d, %d);", 
-		e->nome, e->inscricao_estadual, e->crt, e->cnpj,
-		e->endereco->xLgr, e->endereco->Cpl,
-		e->endereco->xBairro, e->endereco->municipio->cMun,
-		e->endereco->CEP, e->endereco->nro);
-	db_exec(sql, &err);
-	if(err)
+ 		VALUES (1, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+	if(db_prepare(DB_STMT_REPLACE_EMITENTE, sql, &err, &stmt))
+		return -ESQL;
+	sqlite3_bind_text(stmt, 1, e->nome, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 2, e->inscricao_estadual, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 3, e->crt);
+	sqlite3_bind_text(stmt, 4, e->cnpj, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 5, e->endereco->xLgr, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 6, e->endereco->Cpl, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 7, e->endereco->xBairro, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 8, e->endereco->municipio->cMun);
+	sqlite3_bind_int(stmt, 9, e->endereco->CEP);
+	sqlite3_bind_int(stmt, 10, e->endereco->nro);
+	if(db_run(stmt, &err))
 		return -ESQL;
 	return 0;
 }
 
-int get_lote_id(){
-	char *err;
+static int _db_save_lote(LOTE *lote){
 	sqlite3_stmt *stmt;
-	int id, rc;
-	char *sql = sqlite3_mprintf("SELECT max(l.id_lote)\
-		FROM lotes l");
-	if(db_select(sql, &err, &stmt)){
+	char *sql, *err;
+	int id_xml_response;
+	err = NULL;
+	if(db_blob_put(lote->xml_response, &id_xml_response))
+		return -ESQL;
+	sql = "INSERT INTO lotes (id_lote, recibo, \
+		id_xml_response)\
+		VALUES (?, ?, ?)";
+	if(db_prepare(DB_STMT_INSERT_LOTE, sql, &err, &stmt))
 		return -ESQL;
+	sqlite3_bind_int(stmt, 1, lote->id);
+	sqlite3_bind_text(stmt, 2, lote->recibo, -1, SQLITE_STATIC);
+	db_bind_id(stmt, 3, id_xml_response);
+	if(db_run(stmt, &err))
+		return -ESQL;
+	LOTE_ITEM *i = lote->nfes;
+	sql = "INSERT INTO lotes_nfes (id_lote, id_nfe) VALUES (?, ?)";
+	while(i != NULL){
+		NFE *n = i->nfe;
+		/* register_nfe() preenche o id das NFs novas */
+		if(register_nfe(n))
+			return -ESQL;
+		if(db_prepare(DB_STMT_INSERT_LOTE_NFE, sql, &err, &stmt))
+			return -ESQL;
+		sqlite3_bind_int(stmt, 1, lote->id);
+		sqlite3_bind_int(stmt, 2, n->idnfe->id_nfe);
+		if(db_run(stmt, &err))
+			return -ESQL;
+		i = i->next;
 	}
-
-	rc = sqlite3_step(stmt);
-	if(rc != SQLITE_ROW)
-		return 1;
-	id = sqlite3_column_int(stmt, 0);
-	return ++id;
+	return 0;
 }
 
-int get_lote_evento_id(){
-	char *err;
-	sqlite3_stmt *stmt;
-	int id, rc;
-	char *sql = sqlite3_mprintf("SELECT max(l.id_lote_evento)\
-		FROM lotes_evento l");
-	if(db_select(sql, &err, &stmt)){
-		return -ESQL;
+/* ids, números e chaves das NFs do lote antes do db_begin(); os que as
+ * NFs salvas antes de uma falha receberam somem no ROLLBACK */
+static struct nfe_ids *lote_ids_guardar(LOTE *lote){
+	LOTE_ITEM *i;
+	struct nfe_ids *ids;
+	int n = 0;
+
+	for(i = lote->nfes; i != NULL; i = i->next)
+		n++;
+	ids = calloc(n + 1, sizeof(*ids));
+	if(ids == NULL)
+		return NULL;
+	for(i = lote->nfes, n = 0; i != NULL; i = i->next){
+		if(nfe_ids_guardar(i->nfe, &ids[n++])){
+			while(n--)
+				free(ids[n].chave);
+			free(ids);
+			return NULL;
+		}
 	}
+	return ids;
+}
 
-	rc = sqlite3_step(stmt);
-	if(rc != SQLITE_ROW)
-		return 1;
-	id = sqlite3_column_int(stmt, 0);
-	return ++id;
+static void lote_ids_restaurar(LOTE *lote, const struct nfe_ids *ids){
+	LOTE_ITEM *i;
+	int n = 0;
+
+	for(i = lote->nfes; i != NULL; i = i->next)
+		nfe_ids_restaurar(i->nfe, &ids[n++]);
 }
 
-int get_next_nfe_number(int *number, int *serie){
-	char *err;
-	sqlite3_stmt *stmt;
+static void lote_ids_liberar(LOTE *lote, struct nfe_ids *ids){
+	LOTE_ITEM *i;
+	int n = 0;
+
+	for(i = lote->nfes; i != NULL; i = i->next)
+		free(ids[n++].chave);
+	free(ids);
+}
+
+int db_save_lote(LOTE *lote){
+	struct nfe_ids *ids;
 	int rc;
-	char *sql = sqlite3_mprintf("SELECT max(num_nf) + 1, serie\
-		FROM nfe");
-	if(db_select(sql, &err, &stmt)){
-		return -ESQL;	
-	}
 
-	rc = sqlite3_step(stmt);
-	if(rc != SQLITE_ROW){
-		return -1;
+	if(lote->qtd > 0){
+		if((ids = lote_ids_guardar(lote)) == NULL)
+			return -ESQL;
+		if(db_begin()){
+			lote_ids_liberar(lote, ids);
+			return -ESQL;
+		}
+		if(_db_save_lote(lote)){
+			db_rollback();
+			rc = -ESQL;
+		} else {
+			rc = db_commit();
+		}
+		if(rc)
+			lote_ids_restaurar(lote, ids);
+		lote_ids_liberar(lote, ids);
+		return rc;
 	}
-	*number = sqlite3_column_int(stmt, 0);
-	*serie = sqlite3_column_int(stmt, 1);
 	return 0;
 }
 
-int db_save_lote(LOTE *lote){
+static int _db_save_lote_evento(LOTE_EVENTO *lote){
+	sqlite3_stmt *stmt;
 	char *sql, *err;
+	int id_xml_response;
 	err = NULL;
-	if(lote->qtd > 0){
-		sql = sqlite3_mprintf("INSERT INTO lotes (id_lote, recibo, \
-			xml_response)\
-			VALUES (%d, %Q, %Q)", lote->id, lote->recibo, 
-				lote->xml_response);
-		db_exec(sql, &err);
-		if(err)
+	if(db_blob_put(lote->xml_response, &id_xml_response))
+		return -ESQL;
+	sql = "INSERT INTO lotes_evento \
+		(id_lote_evento, recibo, id_xml_response)\
+		VALUES (?, ?, ?)";
+	if(db_prepare(DB_STMT_INSERT_LOTE_EVENTO, sql, &err, &stmt))
+		return -ESQL;
+	sqlite3_bind_int(stmt, 1, lote->id);
+	sqlite3_bind_text(stmt, 2, lote->recibo, -1, SQLITE_STATIC);
+	db_bind_id(stmt, 3, id_xml_response);
+	if(db_run(stmt, &err))
+		return -ESQL;
+	LOTE_EVENTO_ITEM *i = lote->eventos;
+	sql = "INSERT INTO lotes_evento_items(id_lote_evento,\
+		id_evento) VALUES (?, ?)";
+	while(i != NULL){
+		EVENTO *e = i->evento;
+		if(register_evento(e))
 			return -ESQL;
-		LOTE_ITEM *i = lote->nfes;
-		sql = malloc(sizeof(char) * 500);
-		strcpy(sql, "INSERT INTO lotes_nfes (id_lote, id_nfe) VALUES ");
-		while(i != NULL){
-			NFE *n = i->nfe;
-			char *aux = sqlite3_mprintf("(%d, %d)", lote->id,
-				n->idnfe);
-			if(i != lote->nfes)
-				strcat(sql, ", ");
-			strcat(sql, aux);
-			register_nfe(n);
-			i = i->next;
-		}
-		db_exec(sql, &err);
-		if(err)
+		if(db_prepare(DB_STMT_INSERT_LOTE_EVENTO_ITEM, sql, &err,
+				&stmt))
+			return -ESQL;
+		sqlite3_bind_int(stmt, 1, lote->id);
+		sqlite3_bind_text(stmt, 2, e->id, -1, SQLITE_STATIC);
+		if(db_run(stmt, &err))
 			return -ESQL;
+		i = i->next;
 	}
 	return 0;
 }
 
+/* id de um evento e os da sua NF antes do db_begin() */
+struct evento_ids {
+	const char *id;
+	struct nfe_ids nfe;
+};
+
+static int evento_ids_guardar(EVENTO *e, struct evento_ids *ids){
+	ids->id = e->id;
+	return nfe_ids_guardar(e->nfe, &ids->nfe);
+}
+
+static void evento_ids_restaurar(EVENTO *e, const struct evento_ids *ids){
+	if(e->id != ids->id)
+		free((char*)e->id);
+	e->id = ids->id;
+	nfe_ids_restaurar(e->nfe, &ids->nfe);
+}
+
 int db_save_lote_evento(LOTE_EVENTO *lote){
-	char *sql, *err;
-	err = NULL;
+	LOTE_EVENTO_ITEM *i;
+	struct evento_ids *ids;
+	int n = 0, rc;
+
 	if(lote->qtd > 0){
-		sql = sqlite3_mprintf("INSERT INTO lotes_evento \
-			(id_lote_evento, recibo, xml_response)\
-			VALUES (%d, %Q, %Q)", lote->id, lote->recibo, 
-				lote->xml_response);
-		db_exec(sql, &err);
-		if(err)
+		/* como em db_save_lote(), um ROLLBACK desfaz os ids de todos */
+		for(i = lote->eventos; i != NULL; i = i->next)
+			n++;
+		if((ids = malloc(sizeof(*ids) * (n + 1))) == NULL)
 			return -ESQL;
-		LOTE_EVENTO_ITEM *i = lote->eventos;
-		sql = malloc(sizeof(char) * 500);
-		strcpy(sql, "INSERT INTO lotes_evento_items(id_lote_evento,\
-			id_evento) VALUES ");
-		while(i != NULL){
-			EVENTO *e = i->evento;
-			register_evento(e);
-			char *aux = sqlite3_mprintf("(%d, %Q)", lote->id,
-				e->id);
-			if(i != lote->eventos)
-				strcat(sql, ", ");
-			strcat(sql, aux);
-			i = i->next;
+		for(i = lote->eventos, n = 0; i != NULL; i = i->next){
+			if(evento_ids_guardar(i->evento, &ids[n++]))
+				break;
 		}
-		db_exec(sql, &err);
-		if(err)
-			return -ESQL;
+		if(i != NULL || db_begin()){
+			rc = -ESQL;
+		} else {
+			if(_db_save_lote_evento(lote)){
+				db_rollback();
+				rc = -ESQL;
+			} else {
+				rc = db_commit();
+			}
+			if(rc)
+				for(i = lote->eventos, n = 0; i != NULL;
+						i = i->next)
+					evento_ids_restaurar(i->evento, &ids[n++]);
+		}
+		while(n--)
+			free(ids[n].nfe.chave);
+		free(ids);
+		return rc;
 	}
 	return 0;
 }
 
-int register_evento(EVENTO *e){
+static int _register_evento(EVENTO *e){
+	sqlite3_stmt *stmt;
 	char *sql, *err;
-	sql = malloc(400);
 	err = NULL;
-	int last_id; 
-	sql = sqlite3_mprintf("REPLACE INTO eventos (id_evento, id_nfe, type,\
-		xml, xml_response, xmot)\
-		VALUES (%Q, %d, %d, %Q, %Q, %Q);",
-		e->id == 0? NULL : e->id, e->nfe->idnfe->id_nfe, e->type, 
-		e->xml, e->xml_response, e->xmot);
-	db_exec(sql, &err);
-	last_id = db_last_insert_id();
-	e->id = itoa(last_id);
-	if(err){
+	int last_id, id_xml, id_xml_response;
+	if(db_blob_put(e->xml, &id_xml) ||
+			db_blob_put(e->xml_response, &id_xml_response))
+		return -ESQL;
+	/* um id novo vem depois dos que foram para os arquivos, como o de
+	 * _register_nfe(); os lotes_evento_items do banco principal ainda
+	 * apontam para eles */
+	sql = "REPLACE INTO eventos (id_evento, id_nfe, type,\
+		id_xml, id_xml_response, xmot)\
+		VALUES (COALESCE(?, (SELECT max(id) + 1 FROM\
+		(SELECT max(id_evento) AS id FROM eventos UNION ALL\
+		SELECT max(id_evento_max) FROM arquivos UNION ALL SELECT 0))),\
+		?, ?, ?, ?, ?);";
+	if(db_prepare(DB_STMT_REPLACE_EVENTO, sql, &err, &stmt))
+		return -ESQL;
+	sqlite3_bind_text(stmt, 1, e->id, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 2, e->nfe->idnfe->id_nfe);
+	sqlite3_bind_int(stmt, 3, e->type);
+	db_bind_id(stmt, 4, id_xml);
+	db_bind_id(stmt, 5, id_xml_response);
+	sqlite3_bind_text(stmt, 6, e->xmot, -1, SQLITE_STATIC);
+	if(db_run(stmt, &err)){
 		fprintf(stderr, "livrenfe: Error: %s", err);
 		return -ESQL;
 	}
-	register_nfe(e->nfe);
+	last_id = db_last_insert_id();
+	e->id = itoa(last_id);
+	if(register_nfe(e->nfe))
+		return -ESQL;
 	switch(e->type){
 		case CANCELAMENTO_TYPE:{
 			EVENTO_CANCELAMENTO *ec = (EVENTO_CANCELAMENTO*) e;
-			sql = sqlite3_mprintf("UPDATE evento SET \
-				justificativa = %Q WHERE id_evento = %d;", 
-				ec->justificativa, last_id);
-			db_exec(sql, &err);
-			if(err){
+			sql = "UPDATE eventos SET \
+				justificativa = ? WHERE id_evento = ?;";
+			if(db_prepare(DB_STMT_UPDATE_EVENTO_JUSTIFICATIVA, sql,
+					&err, &stmt))
+				return -ESQL;
+			sqlite3_bind_text(stmt, 1, ec->justificativa, -1,
+				SQLITE_STATIC);
+			sqlite3_bind_int(stmt, 2, last_id);
+			if(db_run(stmt, &err)){
 				fprintf(stderr, "livrenfe: Error: %s", err);
 				return -ESQL;
 			}
@@ -850,3 +1351,21 @@ int register_evento(EVENTO *e){
 	}
 	return 0;
 }
+
+int register_evento(EVENTO *e){
+	struct evento_ids ids;
+	int rc;
+
+	evento_ids_guardar(e, &ids);
+	if(db_begin())
+		return -ESQL;
+	if(_register_evento(e)){
+		db_rollback();
+		rc = -ESQL;
+	} else {
+		rc = db_commit();
+	}
+	if(rc)
+		evento_ids_restaurar(e, &ids);
+	return rc;
+}
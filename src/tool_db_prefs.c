@@ -29,130 +29,113 @@
 char *get_ws_url(char *service, int ambiente, char **url_header, 
 		char **url_body){
 	sqlite3_stmt *stmt;
-	char *err, *url = NULL , *s;
-	err = malloc(sizeof(char) * 200);
+	char *err, *url = NULL;
 	int rc;
-	s = ambiente == 1? "url_prod" : "url_cert";
 
-	char *sql = sqlite3_mprintf("SELECT %s, url_header, url_body FROM urls \
-		WHERE service = %Q", s, service);
-	if(db_select(sql, &err, &stmt)){
+	char *sql = "SELECT url_prod, url_cert, url_header, url_body FROM urls \
+		WHERE service = ?";
+	if(db_prepare(DB_STMT_GET_WS_URL, sql, &err, &stmt)){
 	fprintf(stdout, "SQL: %s\n", err);
 		return NULL;
 	}
+	sqlite3_bind_text(stmt, 1, service, -1, SQLITE_STATIC);
 	rc = sqlite3_step(stmt);
 	if(rc == SQLITE_ROW){
 		const char *aux = NULL;
-		aux = (char*)sqlite3_column_text(stmt, 0);
+		aux = (char*)sqlite3_column_text(stmt, ambiente == 1? 0 : 1);
 		url = aux == NULL? NULL:strdup(aux);
-		aux = (char*)sqlite3_column_text(stmt, 1);
-		*url_header = aux == NULL? NULL:strdup(aux);
 		aux = (char*)sqlite3_column_text(stmt, 2);
+		*url_header = aux == NULL? NULL:strdup(aux);
+		aux = (char*)sqlite3_column_text(stmt, 3);
 		*url_body = aux == NULL? NULL:strdup(aux);
 	}
+	db_done(stmt);
 	return url;
 }
 
 int get_url_id(char *service){
 	sqlite3_stmt *stmt;
 	char *err;
-	err = malloc(sizeof(char) * 200);
 	int rc, id = 0;
-	char *sql = sqlite3_mprintf("SELECT id_url  FROM urls \
-		WHERE service = %Q", service);
-	if(db_select(sql, &err, &stmt)){
+	char *sql = "SELECT id_url  FROM urls \
+		WHERE service = ?";
+	if(db_prepare(DB_STMT_GET_URL_ID, sql, &err, &stmt)){
 	fprintf(stdout, "SQL: %s\n", err);
 		return -EIDNFOUND;
 	}
+	sqlite3_bind_text(stmt, 1, service, -1, SQLITE_STATIC);
 	rc = sqlite3_step(stmt);
 	if(rc == SQLITE_ROW){
 		id = sqlite3_column_int(stmt, 0);
 	}
+	db_done(stmt);
 	return id;
 }
 
+static int set_url(int id_url, const char *prod, const char *cert){
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	char *sql = "UPDATE urls SET url_prod = ?,\
+		url_cert = ? WHERE id_url = ?;";
+	if(db_prepare(DB_STMT_UPDATE_URL, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_text(stmt, 1, prod, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 2, cert, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 3, id_url);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	return 0;
+}
+
 int set_prefs_urls(PREFS_URLS *urls){
-	char *sql, *err;
-	err = NULL;
 	if(urls){
-		sql = sqlite3_mprintf("UPDATE urls SET url_prod = %Q,\
-			url_cert = %Q WHERE id_url = %d;",
-			urls->recepcaoevento_prod, 
-			urls->recepcaoevento_cert, SEFAZ_RECEPCAO_EVENTO);
-		db_exec(sql, &err);
-		if(err){
-			fprintf(stderr, "livrenfe: Error: %s", err);
-			return -ESQL;
-		}
-		sql = sqlite3_mprintf("UPDATE urls SET url_prod = %Q,\
-			url_cert = %Q WHERE id_url = %d;",
-			urls->nfeconsultacadastro_prod, 
-			urls->nfeconsultacadastro_cert, SEFAZ_NFE_CONSULTA_CADASTRO);
-		db_exec(sql, &err);
-		if(err){
-			fprintf(stderr, "livrenfe: Error: %s", err);
-			return -ESQL;
-		}
-		sql = sqlite3_mprintf("UPDATE urls SET url_prod = %Q,\
-			url_cert = %Q WHERE id_url = %d;",
-			urls->nfeinutilizacao_prod, 
-			urls->nfeinutilizacao_cert, SEFAZ_NFE_INUTILIZACAO);
-		db_exec(sql, &err);
-		if(err){
-			fprintf(stderr, "livrenfe: Error: %s", err);
+		if(set_url(SEFAZ_RECEPCAO_EVENTO, urls->recepcaoevento_prod,
+				urls->recepcaoevento_cert) ||
+			set_url(SEFAZ_NFE_CONSULTA_CADASTRO,
+				urls->nfeconsultacadastro_prod,
+				urls->nfeconsultacadastro_cert) ||
+			set_url(SEFAZ_NFE_INUTILIZACAO,
+				urls->nfeinutilizacao_prod,
+				urls->nfeinutilizacao_cert) ||
+			set_url(SEFAZ_NFE_CONSULTA_PROTOCOLO,
+				urls->nfeconsultaprotocolo_prod,
+				urls->nfeconsultaprotocolo_cert) ||
+			set_url(SEFAZ_NFE_STATUS_SERVICO,
+				urls->nfestatusservico_prod,
+				urls->nfestatusservico_cert) ||
+			set_url(SEFAZ_NFE_AUTORIZACAO,
+				urls->nfeautorizacao_prod,
+				urls->nfeautorizacao_cert) ||
+			set_url(SEFAZ_NFE_RET_AUTORIZACAO,
+				urls->nferetautorizacao_prod,
+				urls->nferetautorizacao_cert))
 			return -ESQL;
-		}
-		sql = sqlite3_mprintf("UPDATE urls SET url_prod = %Q,\
-			url_cert = %Q WHERE id_url = %d;",
-			urls->nfeconsultaprotocolo_prod, 
-			urls->nfeconsultaprotocolo_cert, SEFAZ_NFE_CONSULTA_PROTOCOLO);
-		db_exec(sql, &err);
-		if(err){
-			fprintf(stderr, "livrenfe: Error: %s", err);
-			return -ESQL;
-		}
-		sql = sqlite3_mprintf("UPDATE urls SET url_prod = %Q,\
-			url_cert = %Q WHERE id_url = %d;",
-			urls->nfestatusservico_prod, 
-			urls->nfestatusservico_cert, SEFAZ_NFE_STATUS_SERVICO);
-		db_exec(sql, &err);
-		if(err){
-			fprintf(stderr, "livrenfe: Error: %s", err);
-			return -ESQL;
-		}
-		sql = sqlite3_mprintf("UPDATE urls SET url_prod = %Q,\
-			url_cert = %Q WHERE id_url = %d;",
-			urls->nfeautorizacao_prod, 
-			urls->nfeautorizacao_cert, SEFAZ_NFE_AUTORIZACAO);
-		db_exec(sql, &err);
-		if(err){
-			fprintf(stderr, "livrenfe: Error: %s", err);
-			return -ESQL;
-		}
-		sql = sqlite3_mprintf("UPDATE urls SET url_prod = %Q,\
-			url_cert = %Q WHERE id_url = %d;",
-			urls->nferetautorizacao_prod, 
-			urls->nferetautorizacao_cert, SEFAZ_NFE_RET_AUTORIZACAO);
-		db_exec(sql, &err);
-		if(err){
-			fprintf(stderr, "livrenfe: Error: %s", err);
-			return -ESQL;
-		}
 	}
 	return 0;
 }
 
 int set_prefs(PREFS *prefs){
+	sqlite3_stmt *stmt;
 	char *sql, *err;
 	err = NULL;
 	if(prefs){
-		sql = sqlite3_mprintf("REPLACE INTO prefs (id, ambiente,\
+		sql = "REPLACE INTO prefs (id, ambiente,\
 			cert_type, a1_cert_file, a3_library)\
-			VALUES  (%d, %d, %d, %Q, %Q);",
-			1, prefs->ambiente, prefs->cert_type,
-			prefs->cert_file, prefs->card_reader_lib);
-		db_exec(sql, &err);
-		if(err){
+			VALUES  (1, ?, ?, ?, ?);";
+		if(db_prepare(DB_STMT_REPLACE_PREFS, sql, &err, &stmt)){
+			fprintf(stderr, "livrenfe: Error: %s", err);
+			return -ESQL;
+		}
+		sqlite3_bind_int(stmt, 1, prefs->ambiente);
+		sqlite3_bind_int(stmt, 2, prefs->cert_type);
+		sqlite3_bind_text(stmt, 3, prefs->cert_file, -1, SQLITE_STATIC);
+		sqlite3_bind_text(stmt, 4, prefs->card_reader_lib, -1,
+			SQLITE_STATIC);
+		if(db_run(stmt, &err)){
 			fprintf(stderr, "livrenfe: Error: %s", err);
 			return -ESQL;
 		}
@@ -165,11 +148,10 @@ PREFS_URLS *get_prefs_urls(){
 	sqlite3_stmt *stmt;
 	char *err;
 	int rc;
-	err = malloc(sizeof(char) * 200);
 	
-	char *sql = sqlite3_mprintf("SELECT id_url, url_prod, url_cert \
-		FROM urls");
-	if(db_select(sql, &err, &stmt)){
+	char *sql = "SELECT id_url, url_prod, url_cert \
+		FROM urls";
+	if(db_prepare(DB_STMT_LIST_URLS, sql, &err, &stmt)){
 		free(p);
 		return NULL;
 	}
@@ -213,10 +195,12 @@ PREFS_URLS *get_prefs_urls(){
 		} else if(rc == SQLITE_DONE){
 			break;
 		} else {
+			db_done(stmt);
 			free(p);
 			return NULL;
 		}
 	} while(rc == SQLITE_ROW);
+	db_done(stmt);
 
 	return p;
 }
@@ -226,11 +210,10 @@ static URLS *get_ambiente_urls(int ambiente){
 	sqlite3_stmt *stmt;
 	char *err;
 	int rc;
-	err = malloc(sizeof(char) * 200);
 	
-	char *sql = sqlite3_mprintf("SELECT id_url, url_prod, url_cert \
-		FROM urls");
-	if(db_select(sql, &err, &stmt)){
+	char *sql = "SELECT id_url, url_prod, url_cert \
+		FROM urls";
+	if(db_prepare(DB_STMT_LIST_URLS, sql, &err, &stmt)){
 		free(u);
 		return NULL;
 	}
@@ -265,10 +248,12 @@ static URLS *get_ambiente_urls(int ambiente){
 		} else if(rc == SQLITE_DONE){
 			break;
 		} else {
+			db_done(stmt);
 			free(u);
 			return NULL;
 		}
 	} while(rc == SQLITE_ROW);
+	db_done(stmt);
 	return u;
 }
 
@@ -277,12 +262,11 @@ PREFS *get_prefs(){
 	sqlite3_stmt *stmt;
 	char *err;
 	int rc;
-	err = malloc(sizeof(char) * 200);
 	
-	char *sql = sqlite3_mprintf("SELECT ambiente, cert_type, a1_cert_file,\
+	char *sql = "SELECT ambiente, cert_type, a1_cert_file,\
 		a3_library\
-		FROM prefs");
-	if(db_select(sql, &err, &stmt)){
+		FROM prefs";
+	if(db_prepare(DB_STMT_GET_PREFS, sql, &err, &stmt)){
 		free(p);
 		return NULL;
 	}
@@ -298,9 +282,11 @@ PREFS *get_prefs(){
 			p->card_reader_lib = a3_lib? strdup(a3_lib):strdup("");
 			p->ambiente = ambiente;
 			p->cert_type = cert_type;
+			db_done(stmt);
 			p->urls = get_ambiente_urls(ambiente);
 			break;
 		} else if(rc == SQLITE_DONE){
+			db_done(stmt);
 			p->ambiente = DEFAULT_AMBIENTE;
 			p->cert_type = DEFAULT_CERT_TYPE;
 			p->urls = get_ambiente_urls(DEFAULT_AMBIENTE);
@@ -308,6 +294,7 @@ PREFS *get_prefs(){
 			p->card_reader_lib = strdup("");
 			break;
 		} else {
+			db_done(stmt);
 			free(p);
 			return NULL;
 		}
@@ -0,0 +1,385 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "tool_db_interface.h"
+#include "tool_db.h"
+#include <pitangus/errno.h>
+#include <pitangus/sefaz.h>
+#include <sqlite3.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int _db_seq_reservar(enum db_seq tipo, int id_emitente, int modelo,
+		int serie, int qtd, int *primeiro){
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	char *sql;
+	int rc;
+
+	/* a linha é criada no primeiro uso; só ela fica travada, nfe nunca
+	 * é lida */
+	sql = "INSERT INTO sequencias (tipo, id_emitente, modelo, serie,\
+		proximo) VALUES (?1, ?2, ?3, ?4, 1 + ?5)\
+		ON CONFLICT (tipo, id_emitente, modelo, serie)\
+		DO UPDATE SET proximo = proximo + ?5;";
+	if(db_prepare(DB_STMT_RESERVAR_SEQUENCIA, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, tipo);
+	sqlite3_bind_int(stmt, 2, id_emitente);
+	sqlite3_bind_int(stmt, 3, modelo);
+	sqlite3_bind_int(stmt, 4, serie);
+	sqlite3_bind_int(stmt, 5, qtd);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+
+	/* ainda dentro da transação: é o valor que este UPDATE gravou */
+	sql = "SELECT proximo FROM sequencias WHERE tipo = ? AND\
+		id_emitente = ? AND modelo = ? AND serie = ?;";
+	if(db_prepare(DB_STMT_GET_SEQUENCIA, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, tipo);
+	sqlite3_bind_int(stmt, 2, id_emitente);
+	sqlite3_bind_int(stmt, 3, modelo);
+	sqlite3_bind_int(stmt, 4, serie);
+	rc = sqlite3_step(stmt);
+	if(rc != SQLITE_ROW){
+		fprintf(stderr, "livrenfe: Error: %s",
+			sqlite3_errmsg(sqlite3_db_handle(stmt)));
+		db_done(stmt);
+		return -ESQL;
+	}
+	*primeiro = sqlite3_column_int(stmt, 0) - qtd;
+	db_done(stmt);
+	return 0;
+}
+
+int db_seq_reservar(enum db_seq tipo, int id_emitente, int modelo, int serie,
+		int qtd, int *primeiro){
+	if(qtd < 1)
+		return -EINVFIELD;
+	if(db_begin())
+		return -ESQL;
+	if(_db_seq_reservar(tipo, id_emitente, modelo, serie, qtd,
+			primeiro)){
+		db_rollback();
+		return -ESQL;
+	}
+	return db_commit();
+}
+
+int db_seq_usar(enum db_seq tipo, int id_emitente, int modelo, int serie,
+		int numero){
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	/* número digitado à mão adiante da sequência: ela pula para depois
+	 * dele, para não entregá-lo de novo */
+	char *sql = "INSERT INTO sequencias (tipo, id_emitente, modelo, serie,\
+		proximo) VALUES (?, ?, ?, ?, ? + 1)\
+		ON CONFLICT (tipo, id_emitente, modelo, serie)\
+		DO UPDATE SET proximo = max(proximo, excluded.proximo);";
+	if(db_prepare(DB_STMT_USAR_SEQUENCIA, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, tipo);
+	sqlite3_bind_int(stmt, 2, id_emitente);
+	sqlite3_bind_int(stmt, 3, modelo);
+	sqlite3_bind_int(stmt, 4, serie);
+	sqlite3_bind_int(stmt, 5, numero);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	return 0;
+}
+
+/* apaga o bloco atual do lease, se houver, e grava o novo; fim == 0 só
+ * apaga */
+static int trocar_reserva(DB_SEQ_LEASE *l, int ini, int fim){
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	char *sql = "DELETE FROM reservas WHERE tipo = ? AND id_emitente = ?\
+		AND modelo = ? AND serie = ? AND num_fim = ?;";
+	if(l->fim > 0){
+		if(db_prepare(DB_STMT_DELETE_RESERVA, sql, &err, &stmt)){
+			fprintf(stderr, "livrenfe: Error: %s", err);
+			return -ESQL;
+		}
+		sqlite3_bind_int(stmt, 1, l->tipo);
+		sqlite3_bind_int(stmt, 2, l->id_emitente);
+		sqlite3_bind_int(stmt, 3, l->modelo);
+		sqlite3_bind_int(stmt, 4, l->serie);
+		sqlite3_bind_int(stmt, 5, l->fim - 1);
+		if(db_run(stmt, &err)){
+			fprintf(stderr, "livrenfe: Error: %s", err);
+			return -ESQL;
+		}
+	}
+	if(fim == 0)
+		return 0;
+
+	sql = "INSERT INTO reservas (tipo, id_emitente, modelo, serie,\
+		num_ini, num_fim) VALUES (?, ?, ?, ?, ?, ?);";
+	if(db_prepare(DB_STMT_INSERT_RESERVA, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, l->tipo);
+	sqlite3_bind_int(stmt, 2, l->id_emitente);
+	sqlite3_bind_int(stmt, 3, l->modelo);
+	sqlite3_bind_int(stmt, 4, l->serie);
+	sqlite3_bind_int(stmt, 5, ini);
+	sqlite3_bind_int(stmt, 6, fim - 1);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	return 0;
+}
+
+int db_seq_lease_next(DB_SEQ_LEASE *l, int *numero){
+	int primeiro;
+	if(l->proximo >= l->fim){
+		/* o bloco fica registrado na mesma transação que o reserva */
+		if(db_begin())
+			return -ESQL;
+		if(_db_seq_reservar(l->tipo, l->id_emitente, l->modelo,
+				l->serie, l->bloco, &primeiro) ||
+				trocar_reserva(l, primeiro, primeiro + l->bloco)){
+			db_rollback();
+			return -ESQL;
+		}
+		if(db_commit())
+			return -ESQL;
+		l->proximo = primeiro;
+		l->fim = primeiro + l->bloco;
+	}
+	*numero = l->proximo++;
+	return 0;
+}
+
+int db_seq_lease_liberar(DB_SEQ_LEASE *l){
+	if(trocar_reserva(l, 0, 0))
+		return -ESQL;
+	l->proximo = l->fim = 0;
+	return 0;
+}
+
+int get_lote_id(){
+	int id;
+	if(db_seq_reservar(DB_SEQ_LOTE, 0, 0, 0, 1, &id))
+		return -ESQL;
+	return id;
+}
+
+int get_lote_evento_id(){
+	int id;
+	if(db_seq_reservar(DB_SEQ_LOTE_EVENTO, 0, 0, 0, 1, &id))
+		return -ESQL;
+	return id;
+}
+
+int get_next_nfe_number(int id_emitente, int modelo, int *number,
+		int *serie){
+	char *err;
+	sqlite3_stmt *stmt;
+	int rc;
+	/* só sugere; a série usada por último é a de número mais alto */
+	char *sql = "SELECT proximo, serie FROM sequencias\
+		WHERE tipo = ? AND id_emitente = ? AND modelo = ?\
+		ORDER BY proximo DESC LIMIT 1;";
+	if(db_prepare(DB_STMT_NEXT_NFE_NUMBER, sql, &err, &stmt)){
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, DB_SEQ_NFE);
+	sqlite3_bind_int(stmt, 2, id_emitente);
+	sqlite3_bind_int(stmt, 3, modelo);
+
+	rc = sqlite3_step(stmt);
+	if(rc == SQLITE_ROW){
+		*number = sqlite3_column_int(stmt, 0);
+		*serie = sqlite3_column_int(stmt, 1);
+	} else {
+		*number = 0;
+		*serie = 0;
+	}
+	db_done(stmt);
+	return rc == SQLITE_ROW || rc == SQLITE_DONE? 0 : -1;
+}
+
+static int acrescentar(DB_LACUNA **l, int *n, int *max, int serie,
+		unsigned ini, unsigned fim){
+	DB_LACUNA *novo;
+	if(*n == *max){
+		*max = *max? *max * 2 : 16;
+		novo = realloc(*l, sizeof(DB_LACUNA) * *max);
+		if(novo == NULL)
+			return -1;
+		*l = novo;
+	}
+	(*l)[*n].serie = serie;
+	(*l)[*n].num_ini = ini;
+	(*l)[*n].num_fim = fim;
+	(*n)++;
+	return 0;
+}
+
+/* tira da lacuna as faixas inutilizadas ou reservadas, que vêm ordenadas;
+ * uma contida na anterior cai no continue */
+static int recortar(DB_LACUNA **l, int *n, int *max, DB_LACUNA *inut,
+		int n_inut, int serie, unsigned ini, unsigned fim){
+	int i;
+	for(i = 0; i < n_inut && ini <= fim; i++){
+		if(inut[i].serie != serie || inut[i].num_fim < ini)
+			continue;
+		if(inut[i].num_ini > fim)
+			break;
+		if(inut[i].num_ini > ini && acrescentar(l, n, max, serie, ini,
+				inut[i].num_ini - 1))
+			return -1;
+		ini = inut[i].num_fim + 1;
+	}
+	if(ini <= fim)
+		return acrescentar(l, n, max, serie, ini, fim);
+	return 0;
+}
+
+int db_list_lacunas(int id_emitente, int modelo, DB_LACUNA **lacunas){
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	DB_LACUNA *l = NULL, *inut = NULL;
+	int n = 0, max = 0, n_inut = 0, max_inut = 0, rc;
+	int serie, ant_serie = -1;
+	unsigned num, ant = 0;
+	/* poucas linhas; carregadas antes para recortar as lacunas. Os
+	 * blocos de leases ainda vivos também saem, podem se sobrepor */
+	char *sql = "SELECT serie, num_ini, num_fim FROM inutilizacoes\
+		WHERE id_emitente = ?1 AND modelo = ?2 AND cstat = ?3\
+		UNION ALL SELECT serie, num_ini, num_fim FROM reservas\
+		WHERE tipo = ?4 AND id_emitente = ?1 AND modelo = ?2\
+		ORDER BY 1, 2;";
+	if(db_prepare(DB_STMT_LIST_FAIXAS, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, id_emitente);
+	sqlite3_bind_int(stmt, 2, modelo);
+	sqlite3_bind_int(stmt, 3, SEFAZ_INUT_OK);
+	sqlite3_bind_int(stmt, 4, DB_SEQ_NFE);
+	while((rc = sqlite3_step(stmt)) == SQLITE_ROW){
+		if(acrescentar(&inut, &n_inut, &max_inut,
+				sqlite3_column_int(stmt, 0),
+				sqlite3_column_int(stmt, 1),
+				sqlite3_column_int(stmt, 2)))
+			break;
+	}
+	db_done(stmt);
+	if(rc != SQLITE_DONE){
+		free(inut);
+		return -ESQL;
+	}
+
+	/* percorre nfe_numeracao_idx na ordem, sem ordenar nada; funções de
+	 * janela sobre a mesma leitura saem bem mais lentas */
+	sql = "SELECT serie, num_nf FROM nfe\
+		WHERE id_emitente = ? AND mod_nfe = ?\
+		ORDER BY serie, num_nf;";
+	if(db_prepare(DB_STMT_LIST_LACUNAS, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		free(inut);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, id_emitente);
+	sqlite3_bind_int(stmt, 2, modelo);
+	while((rc = sqlite3_step(stmt)) == SQLITE_ROW){
+		serie = sqlite3_column_int(stmt, 0);
+		num = sqlite3_column_int(stmt, 1);
+		/* toda série começa no 1; o que falta antes do primeiro número
+		 * também é lacuna */
+		if(serie != ant_serie)
+			ant = 0;
+		if(num > ant + 1 && recortar(&l, &n, &max, inut, n_inut, serie,
+				ant + 1, num - 1))
+			break;
+		ant_serie = serie;
+		ant = num;
+	}
+	free(inut);
+	if(rc != SQLITE_DONE){
+		fprintf(stderr, "livrenfe: Error: %s",
+			sqlite3_errmsg(sqlite3_db_handle(stmt)));
+		db_done(stmt);
+		free(l);
+		return -ESQL;
+	}
+	db_done(stmt);
+	*lacunas = l;
+	return n;
+}
+
+static int _db_save_inutilizacao(INUTILIZACAO *inut){
+	sqlite3_stmt *stmt;
+	char *err = NULL;
+	int id_xml, id_xml_response;
+	char *sql = "INSERT INTO inutilizacoes (id_emitente, modelo, serie,\
+		ano, num_ini, num_fim, justificativa, cstat, xmot, protocolo,\
+		id_xml, id_xml_response)\
+		VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+
+	if(db_blob_put(inut->xml, &id_xml) ||
+			db_blob_put(inut->xml_response, &id_xml_response))
+		return -ESQL;
+	if(db_prepare(DB_STMT_INSERT_INUTILIZACAO, sql, &err, &stmt)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	sqlite3_bind_int(stmt, 1, inut->emitente->id);
+	sqlite3_bind_int(stmt, 2, inut->mod);
+	sqlite3_bind_int(stmt, 3, inut->serie);
+	sqlite3_bind_int(stmt, 4, inut->ano);
+	sqlite3_bind_int(stmt, 5, inut->num_ini);
+	sqlite3_bind_int(stmt, 6, inut->num_fim);
+	sqlite3_bind_text(stmt, 7, inut->justificativa, -1, SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 8, inut->cStat);
+	sqlite3_bind_text(stmt, 9, inut->xmot, -1, SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 10, inut->protocolo, -1, SQLITE_STATIC);
+	db_bind_id(stmt, 11, id_xml);
+	db_bind_id(stmt, 12, id_xml_response);
+	if(db_run(stmt, &err)){
+		fprintf(stderr, "livrenfe: Error: %s", err);
+		return -ESQL;
+	}
+	return 0;
+}
+
+int db_save_inutilizacao(INUTILIZACAO *inut){
+	if(db_begin())
+		return -ESQL;
+	if(_db_save_inutilizacao(inut)){
+		db_rollback();
+		return -ESQL;
+	}
+	return db_commit();
+}
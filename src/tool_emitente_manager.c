@@ -27,6 +27,7 @@
 #include <pitangus/libsped.h>
 #include <gtk/gtk.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 struct _EmitenteManagerClass{
@@ -79,24 +80,24 @@ static int save_emitente(GtkButton *b, GtkWidget *win){
 
 	priv = emitente_manager_get_instance_private(EMITENTE_MANAGER(win));
 	EMITENTE *e = new_emitente();
-	unsigned int id, crt, num, cod_mun, cod_uf, cep;
+	unsigned int id, crt, num, cod_mun, cep;
 	const char *nome, *ie, *cnpj, *rua, *complemento, *bairro;
 	id = 1;
 	num = atoi(gtk_entry_get_text(priv->num));
 	cep = atoi(gtk_entry_get_text(priv->cep));
-	cnpj =  gtk_entry_get_text(priv->cnpj);
-	nome = gtk_entry_get_text(priv->razao_social);
-	ie = gtk_entry_get_text(priv->ie);
-	rua = gtk_entry_get_text(priv->rua);
-	complemento = gtk_entry_get_text(priv->complemento);
-	bairro = gtk_entry_get_text(priv->bairro);
+	/* free_emitente() libera as strings; as do GTK não são nossas */
+	cnpj = strdup(gtk_entry_get_text(priv->cnpj));
+	nome = strdup(gtk_entry_get_text(priv->razao_social));
+	ie = strdup(gtk_entry_get_text(priv->ie));
+	rua = strdup(gtk_entry_get_text(priv->rua));
+	complemento = strdup(gtk_entry_get_text(priv->complemento));
+	bairro = strdup(gtk_entry_get_text(priv->bairro));
 
 	crt = atoi(gtk_combo_box_get_active_id(priv->crt));
-	cod_uf = atoi(gtk_combo_box_get_active_id(priv->uf));
 	cod_mun = atoi(gtk_combo_box_get_active_id(priv->municipio));
 	
-	inst_endereco(rua, num, complemento, bairro, cep, NULL, cod_mun,
-		NULL, cod_uf, "Brasil", 1058, e->endereco);
+	inst_endereco(rua, num, complemento, bairro, cep, cod_mun,
+		e->endereco);
 	inst_emitente(id, nome, ie, crt, cnpj, e->endereco, e);
 	
 	set_emitente(e);
@@ -96,10 +96,10 @@ static int set_item(GtkButton *b, GtkWidget *iman){
 	if(check_fields(iman))
 		return -EINVFIELD;
 
+	NFE *nfe = (ITEM_MANAGER(iman))->nfe;
 	ITEM *item = ITEM_MANAGER(iman)->item?
-		ITEM_MANAGER(iman)->item : new_item();
+		ITEM_MANAGER(iman)->item : new_item_arena(nfe->arena);
 
-	NFE *nfe = (ITEM_MANAGER(iman))->nfe;
 	inst_produto(0, gtk_entry_get_text(priv->codigo),
 		gtk_entry_get_text(priv->descricao),
 		atoi(gtk_entry_get_text(priv->ncm)),
@@ -135,6 +135,8 @@ static int set_item(GtkButton *b, GtkWidget *iman){
 	if(ITEM_MANAGER(iman)->item == NULL){
 		item->ordem = (ITEM_MANAGER(iman))->nfe->q_itens + 1; 
 		add_item(nfe, item);
+	} else {
+		update_item(nfe, item);
 	}
 	gtk_widget_destroy(iman);
 	return 0;
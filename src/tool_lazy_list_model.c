@@ -0,0 +1,181 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "tool_lazy_list_model.h"
+#include <gtk/gtk.h>
+
+struct _LazyListModel{
+	GObject parent;
+	gint stamp;
+	gint n_rows;
+	gint n_columns;
+	GType *types;
+	LazyListValueFunc func;
+	gpointer data;
+	GDestroyNotify destroy;
+};
+
+struct _LazyListModelClass{
+	GObjectClass parent_class;
+};
+
+static void lazy_list_model_tree_model_init(GtkTreeModelIface *iface);
+
+G_DEFINE_TYPE_WITH_CODE(LazyListModel, lazy_list_model, G_TYPE_OBJECT,
+	G_IMPLEMENT_INTERFACE(GTK_TYPE_TREE_MODEL,
+		lazy_list_model_tree_model_init))
+
+/* a linha vai no user_data do iter */
+#define ITER_ROW(iter)	GPOINTER_TO_INT((iter)->user_data)
+
+static gboolean set_iter(LazyListModel *m, GtkTreeIter *iter, gint row){
+	if(row < 0 || row >= m->n_rows){
+		iter->stamp = 0;
+		return FALSE;
+	}
+	iter->stamp = m->stamp;
+	iter->user_data = GINT_TO_POINTER(row);
+	iter->user_data2 = NULL;
+	iter->user_data3 = NULL;
+	return TRUE;
+}
+
+static GtkTreeModelFlags get_flags(GtkTreeModel *model){
+	return GTK_TREE_MODEL_LIST_ONLY | GTK_TREE_MODEL_ITERS_PERSIST;
+}
+
+static gint get_n_columns(GtkTreeModel *model){
+	return LAZY_LIST_MODEL(model)->n_columns;
+}
+
+static GType get_column_type(GtkTreeModel *model, gint column){
+	LazyListModel *m = LAZY_LIST_MODEL(model);
+	g_return_val_if_fail(column >= 0 && column < m->n_columns,
+		G_TYPE_INVALID);
+	return m->types[column];
+}
+
+static gboolean get_iter(GtkTreeModel *model, GtkTreeIter *iter,
+		GtkTreePath *path){
+	if(gtk_tree_path_get_depth(path) != 1)
+		return FALSE;
+	return set_iter(LAZY_LIST_MODEL(model), iter,
+		gtk_tree_path_get_indices(path)[0]);
+}
+
+static GtkTreePath *get_path(GtkTreeModel *model, GtkTreeIter *iter){
+	g_return_val_if_fail(iter->stamp == LAZY_LIST_MODEL(model)->stamp,
+		NULL);
+	return gtk_tree_path_new_from_indices(ITER_ROW(iter), -1);
+}
+
+static void get_value(GtkTreeModel *model, GtkTreeIter *iter, gint column,
+		GValue *value){
+	LazyListModel *m = LAZY_LIST_MODEL(model);
+	g_return_if_fail(column >= 0 && column < m->n_columns);
+	g_return_if_fail(iter->stamp == m->stamp);
+	g_value_init(value, m->types[column]);
+	m->func(ITER_ROW(iter), column, value, m->data);
+}
+
+static gboolean iter_next(GtkTreeModel *model, GtkTreeIter *iter){
+	return set_iter(LAZY_LIST_MODEL(model), iter, ITER_ROW(iter) + 1);
+}
+
+static gboolean iter_previous(GtkTreeModel *model, GtkTreeIter *iter){
+	return set_iter(LAZY_LIST_MODEL(model), iter, ITER_ROW(iter) - 1);
+}
+
+static gboolean iter_children(GtkTreeModel *model, GtkTreeIter *iter,
+		GtkTreeIter *parent){
+	if(parent)
+		return FALSE;
+	return set_iter(LAZY_LIST_MODEL(model), iter, 0);
+}
+
+static gboolean iter_has_child(GtkTreeModel *model, GtkTreeIter *iter){
+	return FALSE;
+}
+
+static gint iter_n_children(GtkTreeModel *model, GtkTreeIter *iter){
+	return iter? 0 : LAZY_LIST_MODEL(model)->n_rows;
+}
+
+static gboolean iter_nth_child(GtkTreeModel *model, GtkTreeIter *iter,
+		GtkTreeIter *parent, gint n){
+	if(parent)
+		return FALSE;
+	return set_iter(LAZY_LIST_MODEL(model), iter, n);
+}
+
+static gboolean iter_parent(GtkTreeModel *model, GtkTreeIter *iter,
+		GtkTreeIter *child){
+	return FALSE;
+}
+
+static void lazy_list_model_tree_model_init(GtkTreeModelIface *iface){
+	iface->get_flags = get_flags;
+	iface->get_n_columns = get_n_columns;
+	iface->get_column_type = get_column_type;
+	iface->get_iter = get_iter;
+	iface->get_path = get_path;
+	iface->get_value = get_value;
+	iface->iter_next = iter_next;
+	iface->iter_previous = iter_previous;
+	iface->iter_children = iter_children;
+	iface->iter_has_child = iter_has_child;
+	iface->iter_n_children = iter_n_children;
+	iface->iter_nth_child = iter_nth_child;
+	iface->iter_parent = iter_parent;
+}
+
+static void lazy_list_model_finalize(GObject *object){
+	LazyListModel *m = LAZY_LIST_MODEL(object);
+	if(m->destroy)
+		m->destroy(m->data);
+	g_free(m->types);
+	G_OBJECT_CLASS(lazy_list_model_parent_class)->finalize(object);
+}
+
+static void lazy_list_model_init(LazyListModel *m){
+	do{
+		m->stamp = g_random_int();
+	} while(m->stamp == 0);
+}
+
+static void lazy_list_model_class_init(LazyListModelClass *class){
+	G_OBJECT_CLASS(class)->finalize = lazy_list_model_finalize;
+}
+
+LazyListModel *lazy_list_model_new(gint n_rows, gint n_columns,
+		const GType *types, LazyListValueFunc func, gpointer data,
+		GDestroyNotify destroy){
+	LazyListModel *m = g_object_new(LAZY_LIST_MODEL_TYPE, NULL);
+	m->n_rows = n_rows > 0? n_rows : 0;
+	m->n_columns = n_columns;
+#if GLIB_CHECK_VERSION(2,68,0)
+	m->types = g_memdup2(types, sizeof(GType) * n_columns);
+#else
+	m->types = g_memdup(types, sizeof(GType) * n_columns);
+#endif
+	m->func = func;
+	m->data = data;
+	m->destroy = destroy;
+	return m;
+}
@@ -0,0 +1,54 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef	LAZY_LIST_MODEL_H
+#define	LAZY_LIST_MODEL_H
+
+#include <gtk/gtk.h>
+
+#define LAZY_LIST_MODEL_TYPE	(lazy_list_model_get_type())
+#define	LAZY_LIST_MODEL(obj)	(G_TYPE_CHECK_INSTANCE_CAST((obj), LAZY_LIST_MODEL_TYPE, LazyListModel))
+
+typedef struct _LazyListModel LazyListModel;
+typedef struct _LazyListModelClass LazyListModelClass;
+
+/**
+ * Fill `value`, already initialized to the column type, for a row
+ */
+typedef void (*LazyListValueFunc)(gint row, gint column, GValue *value,
+	gpointer data);
+
+GType lazy_list_model_get_type(void);
+
+/**
+ * Flat GtkTreeModel with a fixed number of rows whose values are only
+ * asked for, through `func`, when the view draws them
+ * args:
+ *	1st: IN: number of rows
+ *	2nd: IN: number of columns
+ *	3rd: IN: column types, copied
+ *	4th: IN: value callback
+ *	5th: IN: callback data
+ *	6th: IN: frees the callback data with the model, may be NULL
+ */
+LazyListModel *lazy_list_model_new(gint n_rows, gint n_columns,
+	const GType *types, LazyListValueFunc func, gpointer data,
+	GDestroyNotify destroy);
+
+#endif
@@ -0,0 +1,173 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "tool_nfe_list.h"
+#include "tool_lazy_list_model.h"
+#include "tool_db_interface.h"
+#include <gtk/gtk.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct pagina{
+	int num;
+	unsigned int uso;
+	int n;
+	NFE_LIST_ROW rows[NFE_LIST_PAGE];
+};
+
+struct nfe_list{
+	enum nfe_list_ordem ordem;
+	int asc;
+	char *filtro;
+	int n_paginas;
+	/* limites[k]: última linha da página k - 1, onde a k começa */
+	NFE_LIST_ROW *limites;
+	char *tem_limite;
+	unsigned int relogio;
+	struct pagina cache[NFE_LIST_MAX_PAGES];
+};
+
+static const GType nfe_list_types[NFE_LIST_N_COLS] = {
+	[NFE_LIST_ID_NFE] = G_TYPE_INT,
+	[NFE_LIST_N_NFE] = G_TYPE_INT,
+	[NFE_LIST_SERIE] = G_TYPE_INT,
+	[NFE_LIST_DH_EMIS] = G_TYPE_STRING,
+	[NFE_LIST_DESTINATARIO] = G_TYPE_STRING,
+	[NFE_LIST_CANCELADA] = G_TYPE_INT,
+	[NFE_LIST_EMITIDA] = G_TYPE_INT,
+	[NFE_LIST_STATUS] = G_TYPE_STRING
+};
+
+static void esvaziar(struct pagina *p){
+	int i;
+	for(i = 0; i < p->n; i++)
+		free(p->rows[i].destinatario);
+	p->n = 0;
+	p->num = -1;
+}
+
+static struct pagina *get_pagina(struct nfe_list *l, int k){
+	struct pagina *p = &l->cache[0];
+	int i, j, n;
+
+	for(i = 0; i < NFE_LIST_MAX_PAGES; i++){
+		if(l->cache[i].num == k){
+			l->cache[i].uso = ++l->relogio;
+			return &l->cache[i];
+		}
+		if(l->cache[i].uso < p->uso)
+			p = &l->cache[i];
+	}
+
+	/* continua do limite conhecido mais próximo; só pula linhas com
+	 * OFFSET quando a barra de rolagem salta páginas */
+	for(j = k; j > 0 && !l->tem_limite[j]; j--);
+	esvaziar(p);
+	n = db_list_nfe_page(l->ordem, l->asc, l->filtro,
+		j > 0? &l->limites[j] : NULL, (k - j) * NFE_LIST_PAGE,
+		NFE_LIST_PAGE, p->rows);
+	if(n < 0)
+		n = 0;
+	p->n = n;
+	p->num = k;
+	p->uso = ++l->relogio;
+	if(n > 0 && k + 1 < l->n_paginas){
+		l->limites[k + 1] = p->rows[n - 1];
+		l->limites[k + 1].destinatario = NULL;
+		l->tem_limite[k + 1] = 1;
+	}
+	return p;
+}
+
+static void nfe_list_value(gint row, gint column, GValue *value,
+		gpointer data){
+	struct nfe_list *l = data;
+	struct pagina *p = get_pagina(l, row / NFE_LIST_PAGE);
+	NFE_LIST_ROW *r;
+	char dh[20];
+	struct tm tm;
+
+	/* a tabela mudou desde a contagem; a linha fica vazia */
+	if(row % NFE_LIST_PAGE >= p->n)
+		return;
+	r = &p->rows[row % NFE_LIST_PAGE];
+	switch(column){
+		case NFE_LIST_ID_NFE:
+			g_value_set_int(value, r->id_nfe);
+			break;
+		case NFE_LIST_N_NFE:
+			g_value_set_int(value, r->num_nf);
+			break;
+		case NFE_LIST_SERIE:
+			g_value_set_int(value, r->serie);
+			break;
+		case NFE_LIST_DH_EMIS:
+			localtime_r(&r->dh_emis, &tm);
+			strftime(dh, sizeof(dh), "%d/%m/%Y %H:%M:%S", &tm);
+			g_value_set_string(value, dh);
+			break;
+		case NFE_LIST_DESTINATARIO:
+			g_value_set_string(value, r->destinatario);
+			break;
+		case NFE_LIST_CANCELADA:
+			g_value_set_int(value, r->cancelada);
+			break;
+		case NFE_LIST_EMITIDA:
+			g_value_set_int(value, r->emitida);
+			break;
+		case NFE_LIST_STATUS:
+			g_value_set_static_string(value, r->cancelada?
+				"Cancelada" : r->emitida? "Autorizada" :
+				"Não enviada");
+			break;
+	}
+}
+
+static void nfe_list_free(gpointer data){
+	struct nfe_list *l = data;
+	int i;
+	for(i = 0; i < NFE_LIST_MAX_PAGES; i++)
+		esvaziar(&l->cache[i]);
+	free(l->limites);
+	free(l->tem_limite);
+	free(l->filtro);
+	free(l);
+}
+
+GtkTreeModel *nfe_list_model_new(enum nfe_list_ordem ordem, int asc,
+		const char *filtro){
+	struct nfe_list *l;
+	int i, n;
+
+	n = db_count_nfe(filtro);
+	if(n < 0)
+		n = 0;
+	l = calloc(1, sizeof(struct nfe_list));
+	l->ordem = ordem;
+	l->asc = asc;
+	l->filtro = filtro? strdup(filtro) : NULL;
+	l->n_paginas = (n + NFE_LIST_PAGE - 1) / NFE_LIST_PAGE;
+	l->limites = calloc(l->n_paginas + 1, sizeof(NFE_LIST_ROW));
+	l->tem_limite = calloc(l->n_paginas + 1, sizeof(char));
+	for(i = 0; i < NFE_LIST_MAX_PAGES; i++)
+		l->cache[i].num = -1;
+	return GTK_TREE_MODEL(lazy_list_model_new(n, NFE_LIST_N_COLS,
+		nfe_list_types, nfe_list_value, l, nfe_list_free));
+}
@@ -0,0 +1,53 @@
+/* Copyright (c) 2016, 2017 Pablo G. Gallardo <pggllrd@gmail.com>
+ *
+ * This file is part of Pitangus.
+ *
+ * Pitangus is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Pitangus is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Pitangus.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef	NFE_LIST_H
+#define	NFE_LIST_H
+
+#include "tool_db_interface.h"
+#include <gtk/gtk.h>
+
+/* rows read from the DB at a time */
+#define NFE_LIST_PAGE		256
+/* pages kept in memory per model */
+#define NFE_LIST_MAX_PAGES	16
+
+enum{
+	NFE_LIST_ID_NFE,
+	NFE_LIST_N_NFE,
+	NFE_LIST_SERIE,
+	NFE_LIST_DH_EMIS,
+	NFE_LIST_DESTINATARIO,
+	NFE_LIST_CANCELADA,
+	NFE_LIST_EMITIDA,
+	NFE_LIST_STATUS,
+	NFE_LIST_N_COLS
+};
+
+/**
+ * NFE list for GtkTreeView, read from the DB in pages as it is scrolled
+ * args:
+ *	1st: IN: sort key
+ *	2nd: IN: ascending if not 0
+ *	3rd: IN: recipient name or document filter, may be NULL
+ */
+extern GtkTreeModel *nfe_list_model_new(enum nfe_list_ordem ordem, int asc,
+	const char *filtro);
+
+#endif
@@ -23,10 +23,12 @@
 #include "tool_db_interface.h"
 #include "tool_pitangus.h"
 #include "tool_gtk_common.h"
+#include "tool_lazy_list_model.h"
 #include <pitangus/utils.h>
 #include <pitangus/errno.h>
 #include <pitangus/sped.h>
 #include <pitangus/libsped.h>
+#include <pitangus/geo.h>
 #include <gtk/gtk.h>
 #include <string.h>
 #include <stdlib.h>
@@ -102,30 +104,50 @@ static void list_forma_pagamento(GtkComboBox *fp){
 	gtk_combo_box_set_id_column(fp, ID);
 }
 
-static GtkListStore *get_item_list(NFE *nfe){
-	GtkListStore *list_store;
-	GtkTreeIter iter;
-	ITEM *i;
+enum{ COD_PRODUTO, DESCRICAO, QTD, VALOR, POINTER, N_ITEM_COLS };
 
-	enum{ COD_PRODUTO, DESCRICAO, QTD, VALOR, POINTER, N_COLS };
-
-	list_store = gtk_list_store_new(N_COLS, G_TYPE_STRING, G_TYPE_STRING,
-		G_TYPE_INT, G_TYPE_STRING, G_TYPE_POINTER);
-	i = nfe->itens;
-	while(i){
-		gtk_list_store_append(list_store, &iter);
-		char *aux = dtoa(i->valor);
-		gtk_list_store_set(list_store, &iter, 
-			COD_PRODUTO, i->produto->codigo, 
-			DESCRICAO, i->produto->descricao,
-			QTD, i->quantidade,
-			VALOR, aux,
-			POINTER, i, -1);
-		
-		free(aux);
-		i = i->pointer;
+static const GType item_list_types[N_ITEM_COLS] = {
+	[COD_PRODUTO] = G_TYPE_STRING,
+	[DESCRICAO] = G_TYPE_STRING,
+	[QTD] = G_TYPE_INT,
+	[VALOR] = G_TYPE_STRING,
+	[POINTER] = G_TYPE_POINTER
+};
+
+static void item_list_value(gint row, gint column, GValue *value,
+		gpointer data){
+	NFE *nfe = data;
+	ITEM *i;
+	char *aux;
+
+	if((unsigned int)row >= nfe->q_itens)
+		return;
+	i = nfe->itens[row];
+	switch(column){
+		case COD_PRODUTO:
+			g_value_set_string(value, i->produto->codigo);
+			break;
+		case DESCRICAO:
+			g_value_set_string(value, i->produto->descricao);
+			break;
+		case QTD:
+			g_value_set_int(value, i->quantidade);
+			break;
+		case VALOR:
+			aux = dtoa(i->valor);
+			g_value_set_string(value, aux);
+			free(aux);
+			break;
+		case POINTER:
+			g_value_set_pointer(value, i);
+			break;
 	}
-	return list_store;
+}
+
+/* lê os itens direto do vetor da NF, só as linhas visíveis */
+static GtkTreeModel *get_item_list(NFE *nfe){
+	return GTK_TREE_MODEL(lazy_list_model_new(nfe->q_itens, N_ITEM_COLS,
+		item_list_types, item_list_value, nfe, NULL));
 }
 
 
@@ -211,7 +233,7 @@ static void list_municipios(GtkComboBox *uf, GtkComboBox *municipio){
 
 static void list_items(gpointer p, NFEManager *win){
 	NFEManagerPrivate *priv;
-	GtkListStore *l;
+	GtkTreeModel *l;
 
 	priv = nfe_manager_get_instance_private(NFE_MANAGER(win));
 	NFE *nfe = (NFE_MANAGER(win))->nfe;
@@ -237,7 +259,8 @@ static void list_items(gpointer p, NFEManager *win){
 		       	"text", 2, NULL);
 	col_valor = gtk_tree_view_column_new_with_attributes ("Valor",
 		       	r_valor, "text", 3, NULL);
-	gtk_tree_view_set_model(priv->treeview, GTK_TREE_MODEL (l));
+	gtk_tree_view_set_model(priv->treeview, l);
+	g_object_unref(l);
 	if(!gtk_tree_view_get_n_columns(priv->treeview)){
 		gtk_tree_view_append_column (GTK_TREE_VIEW (priv->treeview), col_id_prod);
 		gtk_tree_view_append_column (GTK_TREE_VIEW (priv->treeview), col_desc);
@@ -279,7 +302,7 @@ static int check_fields(GtkWidget *nman){
 	int rc;
 
 	priv = nfe_manager_get_instance_private(NFE_MANAGER(nman));
-	if(validate_integer(priv->num, "Número de NF inválido", nman, FALSE))
+	if(validate_integer(priv->num, "Número de NF inválido", nman, TRUE))
 		return -EINVFIELD;
 	if(validate_integer(priv->serie, "Número de série inválido", nman, FALSE))
 		return -EINVFIELD;
@@ -343,38 +366,58 @@ static int save_nfe(GtkButton *b, GtkWidget *win){
 		ENDERECO *endereco = destinatario->endereco;
 		idnfe->serie = atoi(gtk_entry_get_text(priv->serie));
 		idnfe->num_nf = atoi(gtk_entry_get_text(priv->num));
-		idnfe->nat_op = gtk_entry_get_text(priv->nat_op);
+		nfe_set_str(nfe, &idnfe->nat_op, gtk_entry_get_text(priv->nat_op));
 		idnfe->ind_pag = atoi(gtk_combo_box_get_active_id(priv->forma_pagamento));
 		idnfe->mod = MOD_NFe;
 		idnfe->dh_emis = strtotime(gtk_entry_get_text(priv->dh_emis));
 		time_t saida = strtotime(gtk_entry_get_text(priv->dh_saida));
-		idnfe->dh_saida = saida == -1? NULL:&saida;
-		idnfe->municipio->uf->cUF = atoi(gtk_combo_box_get_active_id(priv->uf));
-		idnfe->municipio->cMun = atoi(gtk_combo_box_get_active_id(priv->municipio));
+		if(saida == -1){
+			if(nfe->arena == NULL)
+				free(idnfe->dh_saida);
+			idnfe->dh_saida = NULL;
+		} else {
+			if(idnfe->dh_saida == NULL)
+				idnfe->dh_saida = nfe->arena?
+					arena_alloc(nfe->arena, sizeof(time_t)) :
+					malloc(sizeof(time_t));
+			*idnfe->dh_saida = saida;
+		}
+		idnfe->municipio = geo_municipio_ou_nenhum(
+			atoi(gtk_combo_box_get_active_id(priv->municipio)));
 		idnfe->tipo_ambiente = prefs->ambiente;
 
-		destinatario->tipo_doc = gtk_combo_box_get_active_id(priv->t_doc);
-		destinatario->cnpj = gtk_entry_get_text(priv->doc);
-		destinatario->nome = gtk_entry_get_text(priv->razao_social);
+		/* os textos são do GTK; a NF fica com cópias suas */
+		nfe_set_str(nfe, &destinatario->tipo_doc,
+			gtk_combo_box_get_active_id(priv->t_doc));
+		nfe_set_str(nfe, &destinatario->cnpj, gtk_entry_get_text(priv->doc));
+		nfe_set_str(nfe, &destinatario->nome,
+			gtk_entry_get_text(priv->razao_social));
 		destinatario->tipo_ie = atoi(gtk_combo_box_get_active_id(priv->tipo_contribuinte));
-		destinatario->inscricao_estadual= gtk_entry_get_text(priv->ie);
+		nfe_set_str(nfe, &destinatario->inscricao_estadual,
+			gtk_entry_get_text(priv->ie));
 
-		endereco->xLgr = gtk_entry_get_text(priv->logradouro);
+		nfe_set_str(nfe, &endereco->xLgr,
+			gtk_entry_get_text(priv->logradouro));
 		endereco->nro = atoi(gtk_entry_get_text(priv->numero_endereco));
-		endereco->Cpl = gtk_entry_get_text(priv->complemento);
-		endereco->xBairro = gtk_entry_get_text(priv->bairro);
+		nfe_set_str(nfe, &endereco->Cpl,
+			gtk_entry_get_text(priv->complemento));
+		nfe_set_str(nfe, &endereco->xBairro,
+			gtk_entry_get_text(priv->bairro));
 		endereco->CEP = atoi(gtk_entry_get_text(priv->cep));
-		endereco->municipio->uf->cUF = atoi(gtk_combo_box_get_active_id(priv->uf_destinatario));
-		endereco->municipio->cMun = atoi(gtk_combo_box_get_active_id(priv->municipio_destinatario));
-
-		nfe->inf_ad_fisco = gtk_entry_get_text(priv->inf_ad_fisco);
-		nfe->inf_ad_fisco = strlen(nfe->inf_ad_fisco) == 0? 
-			NULL : nfe->inf_ad_fisco;
-		nfe->inf_ad_contrib = gtk_entry_get_text(priv->inf_ad_contrib);
-		nfe->inf_ad_contrib = strlen(nfe->inf_ad_contrib) == 0? 
-			NULL : nfe->inf_ad_contrib;
+		endereco->municipio = geo_municipio_ou_nenhum(
+			atoi(gtk_combo_box_get_active_id(priv->municipio_destinatario)));
+
+		const char *inf = gtk_entry_get_text(priv->inf_ad_fisco);
+		nfe_set_str(nfe, &nfe->inf_ad_fisco, strlen(inf) == 0?
+			NULL : inf);
+		inf = gtk_entry_get_text(priv->inf_ad_contrib);
+		nfe_set_str(nfe, &nfe->inf_ad_contrib, strlen(inf) == 0?
+			NULL : inf);
 		nfe->emitente->id = 1;
-		register_nfe(nfe);
+		if(register_nfe(nfe)){
+			show_msg("Erro ao salvar a NF-e", win);
+			return -ESQL;
+		}
 	}
 
 	gtk_widget_destroy(win);
@@ -418,8 +461,12 @@ static void lookup_destinatario(gpointer p,  NFEManager *nman){
 	DESTINATARIO *d = get_destinatario_by_doc(doc);
 	
 	if(d){
-		free_destinatario(nman->nfe->destinatario);
-		nman->nfe->destinatario = d;
+		// Copiado para onde a NF aloca (arena ou heap), liberado com ela
+		int rc = nfe_set_destinatario(nman->nfe, d);
+		free_destinatario(d);
+		if(rc)
+			return;
+		d = nman->nfe->destinatario;
 		inst_nfe_destinatario(NULL, nman);
 	}
 	// Set id to 0 to save it with another id
@@ -479,12 +526,15 @@ static void default_emis(NFEManagerPrivate *priv){
 
 static void default_nfe_number(NFEManagerPrivate *priv){
 	int num, serie;
-	get_next_nfe_number(&num, &serie);
+	/* os mesmos emitente e modelo que save_nfe() grava */
+	get_next_nfe_number(1, MOD_NFe, &num, &serie);
 	if(num == 0){
 		num = 1;
 		serie = 1;
 	}
-	gtk_entry_set_text(priv->num, itoa(num));
+	/* vazio, register_nfe() reserva o número ao salvar; a sugestão só
+	 * aparece, outro terminal pode levá-la antes */
+	gtk_entry_set_placeholder_text(priv->num, itoa(num));
 	gtk_entry_set_text(priv->serie, itoa(serie));
 }
 
@@ -502,7 +552,9 @@ static void on_remover_item_click(GtkMenuItem *m, NFEManager *nman){
 		ITEM *item;
 		NFE *nfe = nman->nfe;
 		gtk_tree_model_get(model, &iter, 4, &item, -1);
-		rm_item(nfe, item);
+		if(rm_item(nfe, item)){
+			free_item(item);
+		}
 		list_items(NULL, nman);
 	}
 }
@@ -591,6 +643,11 @@ static void nfe_manager_init(NFEManager *nman){
 
 
 static void nfe_manager_dispose(GObject *object){
+	NFEManager *nman = NFE_MANAGER(object);
+	if(nman->nfe){
+		free_nfe(nman->nfe);
+		nman->nfe = NULL;
+	}
 	G_OBJECT_CLASS(nfe_manager_parent_class)->dispose(object);
 }
 
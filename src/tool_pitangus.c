@@ -76,6 +76,10 @@ int connect(){
 		} else {
 			path = p;
 			set_db(path);
+			if(upgrade_db()){
+				fprintf(stderr, "livrenfe: couldn't upgrade database %s\n", path);
+				return -EFOP;
+			}
 		}
 	} else {
 		if(init(path))
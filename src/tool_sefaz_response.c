@@ -49,6 +49,39 @@ struct _SefazResponsePrivate{
 
 G_DEFINE_TYPE_WITH_PRIVATE(SefazResponse, sefaz_response, GTK_TYPE_DIALOG)
 
+/* um pedido por lacuna, todos enviados de uma vez */
+static void inutilizar_lacunas(char *justificativa, char *URL, int ambiente,
+		int cuf, EVP_PKEY *pKey, X509 *cert, char *msg){
+	EMITENTE *e = get_emitente(1);
+	INUTILIZACAO **inut;
+	DB_LACUNA *l;
+	int i, n;
+
+	n = db_list_lacunas(e->id, MOD_NFe, &l);
+	if(n <= 0){
+		strcpy(msg, n == 0? "Não há lacunas na numeração" :
+			"Erro ao procurar lacunas na numeração");
+		free_emitente(e);
+		return;
+	}
+	inut = malloc(sizeof(INUTILIZACAO*) * n);
+	for(i = 0; i < n; i++){
+		inut[i] = new_inutilizacao(e, MOD_NFe, l[i].serie,
+			l[i].num_ini, l[i].num_fim);
+		inut[i]->justificativa = justificativa;
+	}
+	send_inutilizacoes(inut, n, URL, ambiente, cuf, pKey, cert, msg);
+	for(i = 0; i < n; i++){
+		/* as recusadas também, para consulta */
+		if(inut[i]->xml_response != NULL)
+			db_save_inutilizacao(inut[i]);
+		free_inutilizacao(inut[i]);
+	}
+	free(inut);
+	free(l);
+	free_emitente(e);
+}
+
 static void *sefaz_thread(void *arg){
 	SefazResponse *sr = SEFAZ_RESPONSE(arg);
 	SefazResponsePrivate *priv;
@@ -67,7 +100,7 @@ static void *sefaz_thread(void *arg){
 		int rc = get_private_key(&pKey, &cert, sr->password);
 
 		if(rc == 0){
-			msg = malloc(sizeof(char) * 255);
+			msg = malloc(sizeof(char) * SEFAZ_MSG_TAM);
 			int ambiente = prefs->ambiente;
 			URLS *urls = prefs->urls;
 			if(sr->lote){
@@ -81,6 +114,10 @@ static void *sefaz_thread(void *arg){
 				send_lote_evento(sr->lote_evento, urls->nfeconsultaprotocolo, 
 					ambiente, cuf, pKey, cert, msg);
 				db_save_lote_evento(sr->lote_evento);
+			} else if(sr->inutilizar){
+				inutilizar_lacunas(sr->inutilizar,
+					urls->nfeinutilizacao, ambiente, cuf,
+					pKey, cert, msg);
 			} else {
 				int res = get_status_servico(ambiente, urls->nfestatusservico, cuf, 
 					pKey, cert, msg);
@@ -38,6 +38,8 @@ struct _SefazResponse{
 	char *password;
 	LOTE *lote;
 	LOTE_EVENTO *lote_evento;
+	/* inutiliza as lacunas da numeração com esta justificativa */
+	char *inutilizar;
 };
 
 #endif
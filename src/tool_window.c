@@ -24,6 +24,7 @@
 #include "tool_prefs_dialog.h"
 #include "tool_pitangus.h"
 #include "tool_db_interface.h"
+#include "tool_nfe_list.h"
 #include <pitangus/sped.h>
 #include <pitangus/libsped.h>
 #include <pitangus/genxml.h>
@@ -31,15 +32,19 @@
 #include <gtk/gtk.h>
 #include <string.h>
 #include <locale.h>
+#include <pthread.h>
 
 struct _LivrenfeWindow{
 	GtkApplicationWindow parent;
 	GtkTreeView *treeview;
+	GtkSearchEntry *busca;
 	GtkMenuItem *emitente_manager_btn;
 	GtkMenuItem *status_servico_btn;
+	GtkMenuItem *inutilizar_btn;
 	GtkMenuItem *new_nfe_btn;
 	GtkMenuItem *about_btn;
 	GtkMenuItem *pref_btn;
+	GtkMenuItem *arquivar_btn;
 	GtkMenu *menu_nf;
 	GtkMenuItem *abrir_nfe;
 	GtkMenuItem *emitir_nfe;
@@ -55,6 +60,10 @@ struct _LivrenfeWindow{
 	GtkButton *just_ok_btn;
 	gulong passwd_click_signal_handler;
 	gulong passwd_key_signal_handler;
+	enum nfe_list_ordem ordem;
+	int ordem_asc;
+	/* a justificativa pedida é para inutilizar, não cancelar */
+	int just_inutilizar;
 };
 
 struct _LivrenfeWindowClass{
@@ -162,6 +171,18 @@ static void sefaz_cancelar(gpointer *b, LivrenfeWindow *win){
 	gtk_window_present(GTK_WINDOW(sr));
 }
 
+static void sefaz_inutilizar(gpointer *b, LivrenfeWindow *win){
+	char *j = strdup(gtk_entry_get_text(win->justificativa));
+	gtk_entry_set_text(win->justificativa, "");
+	char *password = strdup(gtk_entry_get_text(win->password));
+	password_modal_dismiss(NULL, win);
+	SefazResponse *sr;
+	sr = sefaz_response_new(LIVRENFE_WINDOW(win));
+	sr->password = password;
+	sr->inutilizar = j;
+	gtk_window_present(GTK_WINDOW(sr));
+}
+
 static void on_emitir_nfe_click(GtkMenuItem *m, LivrenfeWindow *win){
 	gtk_widget_set_visible(GTK_WIDGET(win->password_modal), TRUE);
 	gtk_widget_grab_focus(GTK_WIDGET(win->password));
@@ -200,7 +221,9 @@ static void export_nfe(NFE *nfe, GtkWindow *win){
 		FILE *f = fopen(filename, "w");
 		if(f){
 			char *content = gen_export_nfe_xml(nfe);
-			fprintf(f, "%s\n", content);
+			if(content)
+				fputs(content, f);
+			free(content);
 			fclose(f);
 		} else {
 			GtkDialogFlags flag = GTK_DIALOG_DESTROY_WITH_PARENT;
@@ -226,7 +249,22 @@ static void on_export_nfe_click(GtkMenuItem *m, LivrenfeWindow *win){
 		int idnfe;
 		gtk_tree_model_get(model, &iter, 0, &idnfe, -1);
 		NFE *nfe = get_nfe(idnfe);
+		/* a linha pode ter ido para um arquivo depois da lista */
+		if(nfe == NULL || db_load_nfe_xml(nfe)){
+			GtkWidget *dialog;
+			dialog = gtk_message_dialog_new(GTK_WINDOW(win),
+				GTK_DIALOG_DESTROY_WITH_PARENT,
+				GTK_MESSAGE_ERROR,
+				GTK_BUTTONS_CLOSE,
+				"NF-e não encontrada");
+			gtk_dialog_run(GTK_DIALOG(dialog));
+			gtk_widget_destroy(GTK_WIDGET(dialog));
+			if(nfe)
+				free_nfe(nfe);
+			return;
+		}
 		export_nfe(nfe, GTK_WINDOW(win));
+		free_nfe(nfe);
 	}
 }
 
@@ -240,53 +278,86 @@ static void on_just_ok_click(GtkButton *m, LivrenfeWindow *win){
 		g_signal_handler_disconnect(win->password, 
 			win->passwd_key_signal_handler);
 	}
+	GCallback acao = win->just_inutilizar? G_CALLBACK(sefaz_inutilizar) :
+		G_CALLBACK(sefaz_cancelar);
 	win->passwd_click_signal_handler =  g_signal_connect(win->pw_ok_btn, 
-		"clicked", G_CALLBACK(sefaz_cancelar), win);
+		"clicked", acao, win);
 	win->passwd_key_signal_handler =  g_signal_connect(win->password, 
-		"activate", G_CALLBACK(sefaz_cancelar), win);
+		"activate", acao, win);
 }
 
 static void on_cancel_nfe_click(GtkMenuItem *m, LivrenfeWindow *win){
+	win->just_inutilizar = 0;
 	gtk_widget_set_visible(GTK_WIDGET(win->just_modal), TRUE);
 	gtk_widget_grab_focus(GTK_WIDGET(win->justificativa));
 }
 
+static GtkTreeViewColumn *new_list_column(const char *title, int col,
+		int width){
+	GtkTreeViewColumn *c;
+	c = gtk_tree_view_column_new_with_attributes(title,
+		gtk_cell_renderer_text_new(), "text", col, NULL);
+	/* altura fixa: a view não mede todas as linhas do modelo */
+	gtk_tree_view_column_set_sizing(c, GTK_TREE_VIEW_COLUMN_FIXED);
+	gtk_tree_view_column_set_fixed_width(c, width);
+	gtk_tree_view_column_set_resizable(c, TRUE);
+	return c;
+}
+
+static void on_list_column_clicked(GtkTreeViewColumn *c,
+		LivrenfeWindow *win){
+	enum nfe_list_ordem ordem;
+	GList *cols, *l;
+
+	ordem = GPOINTER_TO_INT(g_object_get_data(G_OBJECT(c), "ordem"));
+	win->ordem_asc = win->ordem == ordem? !win->ordem_asc : 0;
+	win->ordem = ordem;
+	cols = gtk_tree_view_get_columns(win->treeview);
+	for(l = cols; l != NULL; l = l->next)
+		gtk_tree_view_column_set_sort_indicator(l->data, l->data == c);
+	g_list_free(cols);
+	gtk_tree_view_column_set_sort_order(c, win->ordem_asc?
+		GTK_SORT_ASCENDING : GTK_SORT_DESCENDING);
+	list_nfe(win);
+}
+
+static void set_list_column_ordem(GtkTreeViewColumn *c,
+		enum nfe_list_ordem ordem, LivrenfeWindow *win){
+	gtk_tree_view_column_set_clickable(c, TRUE);
+	g_object_set_data(G_OBJECT(c), "ordem", GINT_TO_POINTER(ordem));
+	g_signal_connect(c, "clicked", G_CALLBACK(on_list_column_clicked),
+		win);
+}
+
 void list_nfe(LivrenfeWindow *win){
-	GtkCellRenderer *r_num_nfe;
-	GtkCellRenderer *r_serie;
-	GtkCellRenderer *r_dh_emis;
-	GtkCellRenderer *r_destinatario;
-	GtkCellRenderer *r_status;
 	GtkTreeViewColumn *col_num_nfe;
-	GtkTreeViewColumn *col_serie;
 	GtkTreeViewColumn *col_dh_emis;
-	GtkTreeViewColumn *col_destinatario;
-	GtkTreeViewColumn *col_status;
-	GtkListStore *ls = get_list_nfe();
-
-	r_num_nfe = gtk_cell_renderer_text_new();
-	r_serie = gtk_cell_renderer_text_new();
-	r_dh_emis = gtk_cell_renderer_text_new();
-	r_destinatario = gtk_cell_renderer_text_new();
-	r_status = gtk_cell_renderer_text_new();
-	col_num_nfe = gtk_tree_view_column_new_with_attributes ("NFE", r_num_nfe,
-		       	"text", 1, NULL);
-	col_serie = gtk_tree_view_column_new_with_attributes ("Série", r_serie, 
-			"text", 2, NULL);
-	col_dh_emis = gtk_tree_view_column_new_with_attributes ("Emissão", r_dh_emis,
-		       	"text", 3, NULL);
-	col_status= gtk_tree_view_column_new_with_attributes ("Status",
-		       	r_status, "text", 7, NULL);
-	col_destinatario = gtk_tree_view_column_new_with_attributes ("Destinatário",
-		       	r_destinatario, "text", 4, NULL);
-	gtk_tree_view_set_model(win->treeview, GTK_TREE_MODEL (ls));
+	GtkTreeModel *model;
+
 	if(!gtk_tree_view_get_n_columns(win->treeview)){
-		gtk_tree_view_append_column (GTK_TREE_VIEW (win->treeview), col_num_nfe);
-		gtk_tree_view_append_column (GTK_TREE_VIEW (win->treeview), col_serie);
-		gtk_tree_view_append_column (GTK_TREE_VIEW (win->treeview), col_dh_emis);
-		gtk_tree_view_append_column (GTK_TREE_VIEW (win->treeview), col_status);
-		gtk_tree_view_append_column (GTK_TREE_VIEW (win->treeview), col_destinatario);
+		col_num_nfe = new_list_column("NFE", NFE_LIST_N_NFE, 80);
+		set_list_column_ordem(col_num_nfe, NFE_ORDEM_NUMERO, win);
+		col_dh_emis = new_list_column("Emissão", NFE_LIST_DH_EMIS, 160);
+		set_list_column_ordem(col_dh_emis, NFE_ORDEM_EMISSAO, win);
+		gtk_tree_view_append_column(win->treeview, col_num_nfe);
+		gtk_tree_view_append_column(win->treeview,
+			new_list_column("Série", NFE_LIST_SERIE, 60));
+		gtk_tree_view_append_column(win->treeview, col_dh_emis);
+		gtk_tree_view_append_column(win->treeview,
+			new_list_column("Status", NFE_LIST_STATUS, 110));
+		gtk_tree_view_append_column(win->treeview,
+			new_list_column("Destinatário", NFE_LIST_DESTINATARIO,
+			360));
+		gtk_tree_view_set_fixed_height_mode(win->treeview, TRUE);
 	}
+	model = nfe_list_model_new(win->ordem, win->ordem_asc,
+		gtk_entry_get_text(GTK_ENTRY(win->busca)));
+	gtk_tree_view_set_model(win->treeview, model);
+	g_object_unref(model);
+}
+
+static void on_busca_changed(GtkSearchEntry *e, LivrenfeWindow *win){
+	list_nfe(win);
 }
 
 static void emitente_manager_activate(GtkMenuItem *i, gpointer win){
@@ -416,6 +487,94 @@ static gint nfe_on_popup(GtkTreeView *t, gpointer win){
 	return TRUE;
 }
 
+static void on_inutilizar_click(GtkMenuItem *m, LivrenfeWindow *win){
+	EMITENTE *e = get_emitente(1);
+	if(e){
+		free_emitente(e);
+		win->just_inutilizar = 1;
+		gtk_widget_set_visible(GTK_WIDGET(win->just_modal), TRUE);
+		gtk_widget_grab_focus(GTK_WIDGET(win->justificativa));
+	} else {
+		GtkWidget *dialog;
+		dialog = gtk_message_dialog_new(GTK_WINDOW(win),
+			GTK_DIALOG_DESTROY_WITH_PARENT,
+			GTK_MESSAGE_ERROR,
+			GTK_BUTTONS_CLOSE,
+			"Cadastre primeiro o emitente");
+		gtk_dialog_run(GTK_DIALOG(dialog));
+		gtk_widget_destroy(GTK_WIDGET(dialog));
+		emitente_manager_activate(NULL, win);
+	}
+}
+
+/* resultado de arquivar_thread() para a thread principal */
+struct arquivar {
+	LivrenfeWindow *win;
+	int n;
+};
+
+static gboolean arquivar_fim(gpointer p){
+	struct arquivar *a = p;
+	LivrenfeWindow *win = a->win;
+	GtkWidget *dialog;
+	int n = a->n;
+
+	free(a);
+	if(n < 0){
+		dialog = gtk_message_dialog_new(GTK_WINDOW(win),
+			GTK_DIALOG_DESTROY_WITH_PARENT,
+			GTK_MESSAGE_ERROR,
+			GTK_BUTTONS_CLOSE,
+			"Erro ao mover os anos fechados");
+	} else if(n == 0){
+		dialog = gtk_message_dialog_new(GTK_WINDOW(win),
+			GTK_DIALOG_DESTROY_WITH_PARENT,
+			GTK_MESSAGE_INFO,
+			GTK_BUTTONS_CLOSE,
+			"Nenhuma NF-e de anos fechados para arquivar");
+	} else {
+		dialog = gtk_message_dialog_new(GTK_WINDOW(win),
+			GTK_DIALOG_DESTROY_WITH_PARENT,
+			GTK_MESSAGE_INFO,
+			GTK_BUTTONS_CLOSE,
+			"%d NF-e de anos fechados movidas para arquivos anuais",
+			n);
+	}
+	gtk_dialog_run(GTK_DIALOG(dialog));
+	gtk_widget_destroy(GTK_WIDGET(dialog));
+	gtk_widget_set_sensitive(GTK_WIDGET(win->arquivar_btn), TRUE);
+	list_nfe(win);
+	g_object_unref(win);
+	return G_SOURCE_REMOVE;
+}
+
+static void *arquivar_thread(void *arg){
+	struct arquivar *a = arg;
+
+	/* copia anos inteiros e faz VACUUM; a janela não pode esperar */
+	a->n = db_arquivar_fechados();
+	/* o GTK só é usado da thread principal */
+	g_idle_add(arquivar_fim, a);
+	return NULL;
+}
+
+static void on_arquivar_click(GtkMenuItem *m, LivrenfeWindow *win){
+	struct arquivar *a;
+	pthread_t tid;
+
+	if((a = malloc(sizeof(*a))) == NULL)
+		return;
+	a->win = g_object_ref(win);
+	gtk_widget_set_sensitive(GTK_WIDGET(win->arquivar_btn), FALSE);
+	if(pthread_create(&tid, NULL, &arquivar_thread, a)){
+		gtk_widget_set_sensitive(GTK_WIDGET(win->arquivar_btn), TRUE);
+		g_object_unref(win);
+		free(a);
+		return;
+	}
+	pthread_detach(tid);
+}
+
 static void on_status_servico_click(gpointer p, LivrenfeWindow *win){
 	EMITENTE *e = get_emitente(1);
 	if(e){
@@ -448,8 +607,13 @@ static void livrenfe_window_init(LivrenfeWindow *win){
 	gtk_widget_init_template(GTK_WIDGET(win));
 	win->passwd_click_signal_handler = 0;
 	win->passwd_key_signal_handler = 0;
+	win->ordem = NFE_ORDEM_ID;
+	win->ordem_asc = 0;
+	win->just_inutilizar = 0;
 	g_signal_connect(win, "show", G_CALLBACK(list_nfe),
 			NULL);
+	g_signal_connect(win->busca, "search-changed",
+			G_CALLBACK(on_busca_changed), win);
 	g_signal_connect((LIVRENFE_WINDOW(win))->new_nfe_btn, "activate", 
 		G_CALLBACK(nfe_manager_activate), win);
 	g_signal_connect((LIVRENFE_WINDOW(win))->treeview, "row-activated",
@@ -464,8 +628,12 @@ static void livrenfe_window_init(LivrenfeWindow *win){
 			G_CALLBACK(about_activate), win);
 	g_signal_connect((LIVRENFE_WINDOW(win))->pref_btn, "activate",
 			G_CALLBACK(pref_activate), win);
+	g_signal_connect((LIVRENFE_WINDOW(win))->arquivar_btn, "activate",
+			G_CALLBACK(on_arquivar_click), win);
 	g_signal_connect((LIVRENFE_WINDOW(win))->status_servico_btn, "activate",
 			G_CALLBACK(on_status_servico_click), win);
+	g_signal_connect((LIVRENFE_WINDOW(win))->inutilizar_btn, "activate",
+			G_CALLBACK(on_inutilizar_click), win);
 	g_signal_connect((LIVRENFE_WINDOW(win))->pw_cancel_btn, "clicked",
 			G_CALLBACK(password_modal_dismiss), win);
 	g_signal_connect((LIVRENFE_WINDOW(win))->just_cancel_btn, "clicked",
@@ -498,6 +666,8 @@ static void livrenfe_window_class_init(LivrenfeWindowClass *class){
 
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
 		       	treeview);
+	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
+		       	busca);
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
 		       	new_nfe_btn);
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
@@ -506,6 +676,8 @@ static void livrenfe_window_class_init(LivrenfeWindowClass *class){
 		       	about_btn);
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
 		       	pref_btn);
+	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
+		       	arquivar_btn);
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
 		       	menu_nf);
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
@@ -518,6 +690,8 @@ static void livrenfe_window_class_init(LivrenfeWindowClass *class){
 		       	export_nfe);
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
 		       	status_servico_btn);
+	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
+		       	inutilizar_btn);
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,
 		       	password_modal);
 	gtk_widget_class_bind_template_child(GTK_WIDGET_CLASS(class), LivrenfeWindow,